@@ -688,6 +688,29 @@ private:
   double const end;
 };
 
+/*
+ * Indicator of the region around the vortex pair in which the aeroacoustic source term is computed
+ * and transferred to the acoustic mesh. The source term decays with the distance to the vortices,
+ * so that it can be neglected in the far field of large fluid domains.
+ */
+template<int dim>
+class SourceRegion : public dealii::Function<dim>
+{
+public:
+  SourceRegion(double const radius) : dealii::Function<dim>(1, 0.0), radius(radius)
+  {
+  }
+
+  double
+  value(dealii::Point<dim> const & p, unsigned int const) const final
+  {
+    return p.norm() <= radius ? 1.0 : 0.0;
+  }
+
+private:
+  double const radius;
+};
+
 template<int dim>
 class AnalyticalSourceTerm : public dealii::Function<dim>
 {
@@ -812,6 +835,9 @@ private:
 
     this->field_functions->analytical_aero_acoustic_source_term =
       std::make_shared<AnalyticalSourceTerm<dim>>(source_term_with_convection, intensity, r_0, r_c);
+
+    this->field_functions->source_term_region =
+      std::make_shared<SourceRegion<dim>>(source_region_radius);
   }
 
   void
@@ -841,6 +867,10 @@ private:
                         source_term_with_convection,
                         "Source term contains convective effects.",
                         dealii::Patterns::Bool());
+      prm.add_parameter("SourceRegionRadius",
+                        source_region_radius,
+                        "Radius of the region in which the source term is computed.",
+                        dealii::Patterns::Double(1e-12));
     }
     prm.leave_subsection();
   }
@@ -850,6 +880,10 @@ private:
   double intensity                   = 7.54;
   double r_0                         = 1.0;
   double r_c                         = 0.1 * r_0;
+
+  // the source term decays like 1/r^2 in the far field and is reduced by about two orders of
+  // magnitude at a distance of 10 * r_0 compared to the vicinity of the vortices
+  double source_region_radius = 10.0;
 };
 } // namespace AeroAcoustic
 
@@ -22,6 +22,9 @@
 #ifndef APPLICATIONS_CONVECTION_DIFFUSION_TEST_CASES_BOUNDARY_LAYER_H_
 #define APPLICATIONS_CONVECTION_DIFFUSION_TEST_CASES_BOUNDARY_LAYER_H_
 
+// ExaDG
+#include <exadg/functions_and_boundary_conditions/vectorized_function.h>
+
 // prescribe value of solution at left and right boundary
 // Neumann boundaries at upper and lower boundary
 // use constant advection velocity from left to right -> boundary layer
@@ -31,21 +34,23 @@ namespace ExaDG
 namespace ConvDiff
 {
 template<int dim>
-class Solution : public dealii::Function<dim>
+class Solution : public GenericVectorizedFunction<dim, Solution<dim>>
 {
 public:
-  Solution(double const diffusivity) : dealii::Function<dim>(1, 0.0), diffusivity(diffusivity)
+  Solution(double const diffusivity)
+    : GenericVectorizedFunction<dim, Solution<dim>>(1, 0.0), diffusivity(diffusivity)
   {
   }
 
-  double
-  value(dealii::Point<dim> const & p, unsigned int const /*component*/) const final
+  template<typename Number>
+  Number
+  evaluate(dealii::Point<dim, Number> const & p, unsigned int const /*component*/) const
   {
     double phi_l = 1.0, phi_r = 0.0;
     double U = 1.0, L = 2.0;
     double Pe = U * L / diffusivity;
 
-    double result = phi_l + (phi_r - phi_l) * (std::exp(Pe * p[0] / L) - std::exp(-Pe / 2.0)) /
+    Number result = phi_l + (phi_r - phi_l) * (std::exp(Pe * p[0] / L) - std::exp(-Pe / 2.0)) /
                               (std::exp(Pe / 2.0) - std::exp(-Pe / 2.0));
 
     return result;
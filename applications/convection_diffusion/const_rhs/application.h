@@ -22,6 +22,9 @@
 #ifndef APPLICATIONS_CONVECTION_DIFFUSION_TEST_CASES_CONST_RHS_CONST_AND_CIRCULAR_WIND_H_
 #define APPLICATIONS_CONVECTION_DIFFUSION_TEST_CASES_CONST_RHS_CONST_AND_CIRCULAR_WIND_H_
 
+// ExaDG
+#include <exadg/functions_and_boundary_conditions/vectorized_function.h>
+
 // constant source term inside rectangular domain
 // pure Dirichlet boundary conditions (homogeneous)
 // use constant or circular advection velocity
@@ -39,18 +42,19 @@ enum class VelocityType
 VelocityType const VELOCITY_TYPE = VelocityType::CircularZeroAtBoundary;
 
 template<int dim>
-class VelocityField : public dealii::Function<dim>
+class VelocityField : public GenericVectorizedFunction<dim, VelocityField<dim>>
 {
 public:
   VelocityField(unsigned int const n_components = dim, double const time = 0.)
-    : dealii::Function<dim>(n_components, time)
+    : GenericVectorizedFunction<dim, VelocityField<dim>>(n_components, time)
   {
   }
 
-  double
-  value(dealii::Point<dim> const & point, unsigned int const component = 0) const final
+  template<typename Number>
+  Number
+  evaluate(dealii::Point<dim, Number> const & point, unsigned int const component) const
   {
-    double value = 0.0;
+    Number value = 0.0;
 
     if(VELOCITY_TYPE == VelocityType::Constant)
     {
@@ -72,14 +76,14 @@ public:
     else if(VELOCITY_TYPE == VelocityType::CircularZeroAtBoundary)
     {
       double const pi    = dealii::numbers::PI;
-      double       sinx  = std::sin(pi * point[0]);
-      double       siny  = std::sin(pi * point[1]);
-      double       sin2x = std::sin(2. * pi * point[0]);
-      double       sin2y = std::sin(2. * pi * point[1]);
+      Number       sinx  = std::sin(pi * point[0]);
+      Number       siny  = std::sin(pi * point[1]);
+      Number       sin2x = std::sin(2. * pi * point[0]);
+      Number       sin2y = std::sin(2. * pi * point[1]);
       if(component == 0)
-        value = pi * sin2y * std::pow(sinx, 2.);
+        value = pi * sin2y * sinx * sinx;
       else if(component == 1)
-        value = -pi * sin2x * std::pow(siny, 2.);
+        value = -pi * sin2x * siny * siny;
     }
     else
     {
@@ -22,45 +22,54 @@
 #ifndef APPLICATIONS_CONVECTION_DIFFUSION_TEST_CASES_DEFORMING_HILL_H_
 #define APPLICATIONS_CONVECTION_DIFFUSION_TEST_CASES_DEFORMING_HILL_H_
 
+// ExaDG
+#include <exadg/functions_and_boundary_conditions/vectorized_function.h>
+
 namespace ExaDG
 {
 namespace ConvDiff
 {
 template<int dim>
-class Solution : public dealii::Function<dim>
+class Solution : public GenericVectorizedFunction<dim, Solution<dim>>
 {
 public:
   Solution(unsigned int const n_components = 1, double const time = 0.)
-    : dealii::Function<dim>(n_components, time)
+    : GenericVectorizedFunction<dim, Solution<dim>>(n_components, time)
   {
   }
 
-  double
-  value(dealii::Point<dim> const & p, unsigned int const /*component*/) const final
+  template<typename Number>
+  Number
+  evaluate(dealii::Point<dim, Number> const & p, unsigned int const /*component*/) const
   {
     // The analytical solution is only known at t = start_time and t = end_time
 
     double center_x = 0.5;
     double center_y = 0.75;
     double factor   = 50.0;
-    double result   = std::exp(-factor * (pow(p[0] - center_x, 2.0) + pow(p[1] - center_y, 2.0)));
+
+    Number const dx     = p[0] - center_x;
+    Number const dy     = p[1] - center_y;
+    Number       result = std::exp(-factor * (dx * dx + dy * dy));
 
     return result;
   }
 };
 
 template<int dim>
-class VelocityField : public dealii::Function<dim>
+class VelocityField : public GenericVectorizedFunction<dim, VelocityField<dim>>
 {
 public:
-  VelocityField(double const end_time) : dealii::Function<dim>(dim, 0.0), end_time(end_time)
+  VelocityField(double const end_time)
+    : GenericVectorizedFunction<dim, VelocityField<dim>>(dim, 0.0), end_time(end_time)
   {
   }
 
-  double
-  value(dealii::Point<dim> const & point, unsigned int const component = 0) const final
+  template<typename Number>
+  Number
+  evaluate(dealii::Point<dim, Number> const & point, unsigned int const component) const
   {
-    double value = 0.0;
+    Number value = 0.0;
     double t     = this->get_time();
 
     if(component == 0)
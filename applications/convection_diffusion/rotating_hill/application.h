@@ -23,6 +23,7 @@
 #define APPLICATIONS_CONVECTION_DIFFUSION_TEST_CASES_ROTATING_HILL_H_
 
 // ExaDG
+#include <exadg/functions_and_boundary_conditions/vectorized_function.h>
 #include <exadg/grid/deformed_cube_manifold.h>
 
 namespace ExaDG
@@ -30,16 +31,17 @@ namespace ExaDG
 namespace ConvDiff
 {
 template<int dim>
-class Solution : public dealii::Function<dim>
+class Solution : public GenericVectorizedFunction<dim, Solution<dim>>
 {
 public:
   Solution(unsigned int const n_components = 1, double const time = 0.)
-    : dealii::Function<dim>(n_components, time)
+    : GenericVectorizedFunction<dim, Solution<dim>>(n_components, time)
   {
   }
 
-  double
-  value(dealii::Point<dim> const & p, unsigned int const /*component*/) const final
+  template<typename Number>
+  Number
+  evaluate(dealii::Point<dim, Number> const & p, unsigned int const /*component*/) const
   {
     double t = this->get_time();
 
@@ -47,25 +49,29 @@ public:
     double omega    = 2.0 * dealii::numbers::PI;
     double center_x = -radius * std::sin(omega * t);
     double center_y = +radius * std::cos(omega * t);
-    double result   = std::exp(-50 * pow(p[0] - center_x, 2.0) - 50 * pow(p[1] - center_y, 2.0));
+
+    Number const dx     = p[0] - center_x;
+    Number const dy     = p[1] - center_y;
+    Number       result = std::exp(-50.0 * (dx * dx + dy * dy));
 
     return result;
   }
 };
 
 template<int dim>
-class VelocityField : public dealii::Function<dim>
+class VelocityField : public GenericVectorizedFunction<dim, VelocityField<dim>>
 {
 public:
   VelocityField(unsigned int const n_components = dim, double const time = 0.)
-    : dealii::Function<dim>(n_components, time)
+    : GenericVectorizedFunction<dim, VelocityField<dim>>(n_components, time)
   {
   }
 
-  double
-  value(dealii::Point<dim> const & point, unsigned int const component = 0) const final
+  template<typename Number>
+  Number
+  evaluate(dealii::Point<dim, Number> const & point, unsigned int const component) const
   {
-    double value = 0.0;
+    Number value = 0.0;
 
     if(component == 0)
       value = -point[1] * 2.0 * dealii::numbers::PI;
@@ -144,6 +150,7 @@ private:
     this->param.enable_adaptivity = enable_adaptivity;
 
     this->param.grid.create_coarse_triangulations = enable_adaptivity;
+    this->param.grid.keep_serial_triangulation    = enable_adaptivity;
 
     this->param.amr_data.trigger_every_n_time_steps        = 30;
     this->param.amr_data.maximum_refinement_level          = 4;
@@ -22,6 +22,9 @@
 #ifndef APPLICATIONS_CONVECTION_DIFFUSION_TEST_CASES_PROPAGATING_SINE_WAVE_H_
 #define APPLICATIONS_CONVECTION_DIFFUSION_TEST_CASES_PROPAGATING_SINE_WAVE_H_
 
+// ExaDG
+#include <exadg/functions_and_boundary_conditions/vectorized_function.h>
+
 // test case for a purely convective problem
 // sine wave that is advected from left to right by a constant velocity field
 
@@ -32,20 +35,21 @@ namespace ExaDG
 namespace ConvDiff
 {
 template<int dim>
-class Solution : public dealii::Function<dim>
+class Solution : public GenericVectorizedFunction<dim, Solution<dim>>
 {
 public:
   Solution(unsigned int const n_components = 1, double const time = 0.)
-    : dealii::Function<dim>(n_components, time)
+    : GenericVectorizedFunction<dim, Solution<dim>>(n_components, time)
   {
   }
 
-  double
-  value(dealii::Point<dim> const & p, unsigned int const /*component*/) const final
+  template<typename Number>
+  Number
+  evaluate(dealii::Point<dim, Number> const & p, unsigned int const /*component*/) const
   {
     double t = this->get_time();
 
-    double result = std::sin(dealii::numbers::PI * (p[0] - t));
+    Number result = std::sin(dealii::numbers::PI * (p[0] - t));
 
     return result;
   }
@@ -22,6 +22,8 @@
 #ifndef APPLICATIONS_CONVECTION_DIFFUSION_TEST_CASES_TEMPLATE_H_
 #define APPLICATIONS_CONVECTION_DIFFUSION_TEST_CASES_TEMPLATE_H_
 
+// ExaDG
+#include <exadg/functions_and_boundary_conditions/vectorized_function.h>
 #include <exadg/grid/periodic_box.h>
 
 namespace ExaDG
@@ -29,16 +31,17 @@ namespace ExaDG
 namespace ConvDiff
 {
 template<int dim>
-class Velocity : public dealii::Function<dim>
+class Velocity : public GenericVectorizedFunction<dim, Velocity<dim>>
 {
 public:
   Velocity(unsigned int const n_components = 1, double const time = 0.)
-    : dealii::Function<dim>(n_components, time)
+    : GenericVectorizedFunction<dim, Velocity<dim>>(n_components, time)
   {
   }
 
-  double
-  value(dealii::Point<dim> const & p, unsigned int const component = 0) const final
+  template<typename Number>
+  Number
+  evaluate(dealii::Point<dim, Number> const & p, unsigned int const component) const
   {
     return p[component];
   }
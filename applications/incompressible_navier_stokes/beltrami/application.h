@@ -22,27 +22,32 @@
 #ifndef APPLICATIONS_INCOMPRESSIBLE_NAVIER_STOKES_TEST_CASES_BELTRAMI_H_
 #define APPLICATIONS_INCOMPRESSIBLE_NAVIER_STOKES_TEST_CASES_BELTRAMI_H_
 
+// ExaDG
+#include <exadg/functions_and_boundary_conditions/vectorized_function.h>
+
 namespace ExaDG
 {
 namespace IncNS
 {
 template<int dim>
-class AnalyticalSolutionVelocity : public dealii::Function<dim>
+class AnalyticalSolutionVelocity
+  : public GenericVectorizedFunction<dim, AnalyticalSolutionVelocity<dim>>
 {
 public:
   AnalyticalSolutionVelocity(double const viscosity)
-    : dealii::Function<dim>(dim, 0.0), nu(viscosity)
+    : GenericVectorizedFunction<dim, AnalyticalSolutionVelocity<dim>>(dim, 0.0), nu(viscosity)
   {
   }
 
-  double
-  value(dealii::Point<dim> const & p, unsigned int const component = 0) const final
+  template<typename Number>
+  Number
+  evaluate(dealii::Point<dim, Number> const & p, unsigned int const component) const
   {
     double const t = this->get_time();
     double const a = 0.25 * dealii::numbers::PI;
     double const d = 2 * a;
 
-    double result = 0.0;
+    Number result = 0.0;
     // clang-format off
     if (component == 0)
       result = -a*(std::exp(a*p[0])*std::sin(a*p[1]+d*p[2]) + std::exp(a*p[2])*std::cos(a*p[0]+d*p[1]))*std::exp(-nu*d*d*t);
@@ -60,26 +65,29 @@ private:
 };
 
 template<int dim>
-class AnalyticalSolutionPressure : public dealii::Function<dim>
+class AnalyticalSolutionPressure
+  : public GenericVectorizedFunction<dim, AnalyticalSolutionPressure<dim>>
 {
 public:
   AnalyticalSolutionPressure(double const viscosity)
-    : dealii::Function<dim>(1 /*n_components*/, 0.0), nu(viscosity)
+    : GenericVectorizedFunction<dim, AnalyticalSolutionPressure<dim>>(1 /*n_components*/, 0.0),
+      nu(viscosity)
   {
   }
 
-  double
-  value(dealii::Point<dim> const & p, unsigned int const /*component*/) const final
+  template<typename Number>
+  Number
+  evaluate(dealii::Point<dim, Number> const & p, unsigned int const /*component*/) const
   {
     double const t = this->get_time();
     double const a = 0.25 * dealii::numbers::PI;
     double const d = 2 * a;
 
     // clang-format off
-    double result = -a*a*0.5*(std::exp(2*a*p[0]) + std::exp(2*a*p[1]) + std::exp(2*a*p[2]) +
-                     2*std::sin(a*p[0]+d*p[1])*std::cos(a*p[2]+d*p[0])*std::exp(a*(p[1]+p[2])) +
-                     2*std::sin(a*p[1]+d*p[2])*std::cos(a*p[0]+d*p[1])*std::exp(a*(p[2]+p[0])) +
-                     2*std::sin(a*p[2]+d*p[0])*std::cos(a*p[1]+d*p[2])*std::exp(a*(p[0]+p[1]))) * std::exp(-2*nu*d*d*t);
+    Number result = -a*a*0.5*(std::exp(2*a*p[0]) + std::exp(2*a*p[1]) + std::exp(2*a*p[2]) +
+                     2.0*std::sin(a*p[0]+d*p[1])*std::cos(a*p[2]+d*p[0])*std::exp(a*(p[1]+p[2])) +
+                     2.0*std::sin(a*p[1]+d*p[2])*std::cos(a*p[0]+d*p[1])*std::exp(a*(p[2]+p[0])) +
+                     2.0*std::sin(a*p[2]+d*p[0])*std::cos(a*p[1]+d*p[2])*std::exp(a*(p[0]+p[1]))) * std::exp(-2*nu*d*d*t);
     // clang-format on
 
     return result;
@@ -22,6 +22,9 @@
 #ifndef APPLICATIONS_INCOMPRESSIBLE_NAVIER_STOKES_TEST_CASES_KOVASZNAY_H_
 #define APPLICATIONS_INCOMPRESSIBLE_NAVIER_STOKES_TEST_CASES_KOVASZNAY_H_
 
+// ExaDG
+#include <exadg/functions_and_boundary_conditions/vectorized_function.h>
+
 namespace ExaDG
 {
 namespace IncNS
@@ -33,19 +36,22 @@ enum class InitializeSolutionWith
 };
 
 template<int dim>
-class AnalyticalSolutionVelocity : public dealii::Function<dim>
+class AnalyticalSolutionVelocity
+  : public GenericVectorizedFunction<dim, AnalyticalSolutionVelocity<dim>>
 {
 public:
-  AnalyticalSolutionVelocity(double const lambda) : dealii::Function<dim>(dim, 0.0), lambda(lambda)
+  AnalyticalSolutionVelocity(double const lambda)
+    : GenericVectorizedFunction<dim, AnalyticalSolutionVelocity<dim>>(dim, 0.0), lambda(lambda)
   {
   }
 
-  double
-  value(dealii::Point<dim> const & p, unsigned int const component = 0) const final
+  template<typename Number>
+  Number
+  evaluate(dealii::Point<dim, Number> const & p, unsigned int const component) const
   {
     double const pi = dealii::numbers::PI;
 
-    double result = 0.0;
+    Number result = 0.0;
     if(component == 0)
       result = 1.0 - std::exp(lambda * p[0]) * std::cos(2 * pi * p[1]);
     else if(component == 1)
@@ -59,18 +65,21 @@ private:
 };
 
 template<int dim>
-class AnalyticalSolutionPressure : public dealii::Function<dim>
+class AnalyticalSolutionPressure
+  : public GenericVectorizedFunction<dim, AnalyticalSolutionPressure<dim>>
 {
 public:
   AnalyticalSolutionPressure(double const lambda)
-    : dealii::Function<dim>(1 /*n_components*/, 0.0), lambda(lambda)
+    : GenericVectorizedFunction<dim, AnalyticalSolutionPressure<dim>>(1 /*n_components*/, 0.0),
+      lambda(lambda)
   {
   }
 
-  double
-  value(dealii::Point<dim> const & p, unsigned int const /*component*/) const final
+  template<typename Number>
+  Number
+  evaluate(dealii::Point<dim, Number> const & p, unsigned int const /*component*/) const
   {
-    double const result = 0.5 * (1.0 - std::exp(2.0 * lambda * p[0]));
+    Number const result = 0.5 * (1.0 - std::exp(2.0 * lambda * p[0]));
 
     return result;
   }
@@ -80,20 +89,23 @@ private:
 };
 
 template<int dim>
-class NeumannBoundaryVelocity : public dealii::Function<dim>
+class NeumannBoundaryVelocity : public GenericVectorizedFunction<dim, NeumannBoundaryVelocity<dim>>
 {
 public:
   NeumannBoundaryVelocity(FormulationViscousTerm const & formulation_viscous, double const lambda)
-    : dealii::Function<dim>(dim, 0.0), formulation_viscous(formulation_viscous), lambda(lambda)
+    : GenericVectorizedFunction<dim, NeumannBoundaryVelocity<dim>>(dim, 0.0),
+      formulation_viscous(formulation_viscous),
+      lambda(lambda)
   {
   }
 
-  double
-  value(dealii::Point<dim> const & p, unsigned int const component = 0) const final
+  template<typename Number>
+  Number
+  evaluate(dealii::Point<dim, Number> const & p, unsigned int const component) const
   {
     double const pi = dealii::numbers::PI;
 
-    double result = 0.0;
+    Number result = 0.0;
     if(formulation_viscous == FormulationViscousTerm::LaplaceFormulation)
     {
       if(component == 0)
@@ -22,6 +22,9 @@
 #ifndef APPLICATIONS_INCOMPRESSIBLE_NAVIER_STOKES_TEST_CASES_POISEUILLE_H_
 #define APPLICATIONS_INCOMPRESSIBLE_NAVIER_STOKES_TEST_CASES_POISEUILLE_H_
 
+// ExaDG
+#include <exadg/functions_and_boundary_conditions/vectorized_function.h>
+
 namespace ExaDG
 {
 namespace IncNS
@@ -34,21 +37,28 @@ enum class BoundaryCondition
 };
 
 template<int dim>
-class AnalyticalSolutionVelocity : public dealii::Function<dim>
+class AnalyticalSolutionVelocity
+  : public GenericVectorizedFunction<dim, AnalyticalSolutionVelocity<dim>>
 {
 public:
   AnalyticalSolutionVelocity(double const max_velocity, double const H)
-    : dealii::Function<dim>(dim, 0.0), max_velocity(max_velocity), H(H)
+    : GenericVectorizedFunction<dim, AnalyticalSolutionVelocity<dim>>(dim, 0.0),
+      max_velocity(max_velocity),
+      H(H)
   {
   }
 
-  double
-  value(dealii::Point<dim> const & p, unsigned int const component = 0) const final
+  template<typename Number>
+  Number
+  evaluate(dealii::Point<dim, Number> const & p, unsigned int const component) const
   {
-    double result = 0.0;
+    Number result = 0.0;
 
     if(component == 0)
-      result = -max_velocity * (pow(p[1] / (H / 2.), 2.0) - 1.0);
+    {
+      Number const y = p[1] / (H / 2.);
+      result         = -max_velocity * (y * y - 1.0);
+    }
 
     return result;
   }
@@ -58,14 +68,15 @@ private:
 };
 
 template<int dim>
-class AnalyticalSolutionPressure : public dealii::Function<dim>
+class AnalyticalSolutionPressure
+  : public GenericVectorizedFunction<dim, AnalyticalSolutionPressure<dim>>
 {
 public:
   AnalyticalSolutionPressure(double const viscosity,
                              double const max_velocity,
                              double const L,
                              double const H)
-    : dealii::Function<dim>(1 /*n_components*/, 0.0),
+    : GenericVectorizedFunction<dim, AnalyticalSolutionPressure<dim>>(1 /*n_components*/, 0.0),
       viscosity(viscosity),
       max_velocity(max_velocity),
       L(L),
@@ -73,13 +84,14 @@ public:
   {
   }
 
-  double
-  value(dealii::Point<dim> const & p, unsigned int const /*component*/) const final
+  template<typename Number>
+  Number
+  evaluate(dealii::Point<dim, Number> const & p, unsigned int const /*component*/) const
   {
     // pressure decreases linearly in flow direction
     double pressure_gradient = -2. * viscosity * max_velocity / std::pow(H / 2., 2.0);
 
-    double const result = (p[0] - L) * pressure_gradient;
+    Number const result = (p[0] - L) * pressure_gradient;
 
     return result;
   }
@@ -89,14 +101,14 @@ private:
 };
 
 template<int dim>
-class NeumannBoundaryVelocity : public dealii::Function<dim>
+class NeumannBoundaryVelocity : public GenericVectorizedFunction<dim, NeumannBoundaryVelocity<dim>>
 {
 public:
   NeumannBoundaryVelocity(FormulationViscousTerm const & formulation,
                           double const                   max_velocity,
                           double const                   H,
                           double const                   normal)
-    : dealii::Function<dim>(dim, 0.0),
+    : GenericVectorizedFunction<dim, NeumannBoundaryVelocity<dim>>(dim, 0.0),
       formulation(formulation),
       max_velocity(max_velocity),
       H(H),
@@ -104,13 +116,14 @@ public:
   {
   }
 
-  double
-  value(dealii::Point<dim> const & p, unsigned int const component = 0) const final
+  template<typename Number>
+  Number
+  evaluate(dealii::Point<dim, Number> const & p, unsigned int const component) const
   {
     (void)p;
     (void)component;
 
-    double result = 0.0;
+    Number result = 0.0;
 
     // The Neumann velocity boundary condition that is consistent with the analytical solution
     // (in case of a parabolic inflow profile) is (grad U)*n = 0.
@@ -138,18 +151,22 @@ private:
 };
 
 template<int dim>
-class RightHandSide : public dealii::Function<dim>
+class RightHandSide : public GenericVectorizedFunction<dim, RightHandSide<dim>>
 {
 public:
   RightHandSide(double const viscosity, double const max_velocity, double const H)
-    : dealii::Function<dim>(dim, 0.0), viscosity(viscosity), max_velocity(max_velocity), H(H)
+    : GenericVectorizedFunction<dim, RightHandSide<dim>>(dim, 0.0),
+      viscosity(viscosity),
+      max_velocity(max_velocity),
+      H(H)
   {
   }
 
-  double
-  value(dealii::Point<dim> const & /*p*/, unsigned int const component = 0) const final
+  template<typename Number>
+  Number
+  evaluate(dealii::Point<dim, Number> const & /*p*/, unsigned int const component) const
   {
-    double pressure_gradient = 0.0;
+    Number pressure_gradient = 0.0;
 
     if(component == 0)
       pressure_gradient = -2. * viscosity * max_velocity / std::pow(H / 2., 2.0);
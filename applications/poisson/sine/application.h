@@ -152,7 +152,9 @@ private:
 
       this->param.grid.create_coarse_triangulations = false; // can also be set to true if desired
     }
-    this->param.grid.file_name = this->grid_parameters.file_name;
+    this->param.grid.file_name               = this->grid_parameters.file_name;
+    this->param.grid.partitioned_mesh_cache  = this->grid_parameters.partitioned_mesh_cache;
+    this->param.grid.partitioning_group_size = this->grid_parameters.partitioning_group_size;
 
     this->param.spatial_discretization = SpatialDiscretization::DG;
     this->param.IP_factor              = 1.0e0;
@@ -30,6 +30,7 @@
 #include <exadg/matrix_free/matrix_free_data.h>
 #include <exadg/operators/finite_element.h>
 #include <exadg/utilities/print_general_infos.h>
+#include <exadg/utilities/solver_statistics.h>
 
 namespace ExaDG
 {
@@ -121,6 +122,9 @@ private:
   // unsteady solver
   std::shared_ptr<TimeIntAdamsBashforthMoulton<Number>> time_integrator;
 
+  // machine-readable log of solver statistics (optional)
+  std::shared_ptr<SolverStatistics> solver_statistics;
+
   /*
    * Computation time (wall clock time).
    */
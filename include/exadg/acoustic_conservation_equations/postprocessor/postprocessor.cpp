@@ -55,10 +55,16 @@ PostProcessor<dim, Number>::setup(AcousticsOperator const & pde_operator)
 
   error_calculator_p.setup(pde_operator.get_dof_handler_p(),
                            *pde_operator.get_mapping(),
+                           pde_operator.get_matrix_free(),
+                           pde_operator.get_dof_index_pressure(),
+                           pde_operator.get_quad_index_pressure(),
                            pp_data.error_data_p);
 
   error_calculator_u.setup(pde_operator.get_dof_handler_u(),
                            *pde_operator.get_mapping(),
+                           pde_operator.get_matrix_free(),
+                           pde_operator.get_dof_index_velocity(),
+                           pde_operator.get_quad_index_velocity(),
                            pp_data.error_data_u);
 
   sound_energy_calculator.setup(pde_operator.get_matrix_free(),
@@ -25,6 +25,9 @@
 // deal.II
 #include <deal.II/lac/la_parallel_block_vector.h>
 
+// ExaDG
+#include <exadg/time_integration/local_time_stepping.h>
+
 namespace ExaDG
 {
 namespace Acoustics
@@ -54,6 +57,17 @@ public:
 
   virtual double
   calculate_time_step_cfl() const = 0;
+
+  // local time stepping: partitioning of cells and degrees of freedom into time step levels
+  virtual TimeStepLevels const &
+  get_time_step_levels() const = 0;
+
+  // local time stepping: evaluate for the cells on the levels 0, ..., max_active_level only
+  virtual void
+  evaluate_time_step_levels(BlockVectorType &       dst,
+                            BlockVectorType const & src,
+                            double const            time,
+                            unsigned int const      max_active_level) const = 0;
 };
 
 } // namespace Interface
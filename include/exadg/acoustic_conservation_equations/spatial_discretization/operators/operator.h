@@ -260,6 +260,103 @@ public:
     do_evaluate(dst, src, time, true);
   }
 
+  /*
+   * Evaluates the operator for the given cell batches only and overwrites dst on these cells, the
+   * remaining entries of dst are not touched. Face integrals are computed in a cell-based manner,
+   * i.e., every cell reads the exterior values from its neighbors and only writes to its own
+   * degrees of freedom. This requires a dealii::MatrixFree object set up for cell-based face
+   * loops, see Categorization::do_cell_based_loops().
+   */
+  void
+  evaluate_cell_batches(BlockVectorType &                 dst,
+                        BlockVectorType const &           src,
+                        double const                      time,
+                        std::vector<unsigned int> const & cell_batches) const
+  {
+    evaluation_time = (Number)time;
+
+    src.update_ghost_values();
+
+    CellIntegratorP pressure(*matrix_free, data.dof_index_pressure, data.quad_index);
+    CellIntegratorU velocity(*matrix_free, data.dof_index_velocity, data.quad_index);
+
+    FaceIntegratorP pressure_m(*matrix_free, true, data.dof_index_pressure, data.quad_index);
+    FaceIntegratorP pressure_p(*matrix_free, false, data.dof_index_pressure, data.quad_index);
+
+    FaceIntegratorU velocity_m(*matrix_free, true, data.dof_index_velocity, data.quad_index);
+    FaceIntegratorU velocity_p(*matrix_free, false, data.dof_index_velocity, data.quad_index);
+
+    BoundaryFaceIntegratorP<dim, Number> pressure_bc(pressure_m, *data.bc);
+    BoundaryFaceIntegratorU<dim, Number> velocity_bc(velocity_m,
+                                                     pressure_m,
+                                                     data.speed_of_sound,
+                                                     *data.bc);
+
+    for(unsigned int const cell : cell_batches)
+    {
+      pressure.reinit(cell);
+      pressure.gather_evaluate(src.block(data.block_index_pressure),
+                               integrator_flags_p.cell_evaluate);
+
+      velocity.reinit(cell);
+      velocity.gather_evaluate(src.block(data.block_index_velocity),
+                               integrator_flags_u.cell_evaluate);
+
+      do_cell_integral(pressure, velocity);
+
+      pressure.integrate(integrator_flags_p.cell_integrate);
+      velocity.integrate(integrator_flags_u.cell_integrate);
+
+      unsigned int const n_faces = matrix_free->get_cell_iterator(cell, 0)->n_faces();
+      for(unsigned int face = 0; face < n_faces; ++face)
+      {
+        dealii::types::boundary_id const boundary_id =
+          matrix_free->get_faces_by_cells_boundary_id(cell, face)[0];
+
+        pressure_m.reinit(cell, face);
+        pressure_m.gather_evaluate(src.block(data.block_index_pressure),
+                                   integrator_flags_p.face_evaluate);
+
+        velocity_m.reinit(cell, face);
+        velocity_m.gather_evaluate(src.block(data.block_index_velocity),
+                                   integrator_flags_u.face_evaluate);
+
+        if(boundary_id == dealii::numbers::internal_face_boundary_id) // internal face
+        {
+          pressure_p.reinit(cell, face);
+          pressure_p.gather_evaluate(src.block(data.block_index_pressure),
+                                     integrator_flags_p.face_evaluate);
+
+          velocity_p.reinit(cell, face);
+          velocity_p.gather_evaluate(src.block(data.block_index_velocity),
+                                     integrator_flags_u.face_evaluate);
+
+          do_face_integral<false>(pressure_m, pressure_p, velocity_m, velocity_p);
+        }
+        else // boundary face
+        {
+          pressure_bc.reinit_boundary_id(boundary_id, evaluation_time);
+          velocity_bc.reinit_boundary_id(boundary_id, evaluation_time);
+
+          do_face_integral<false>(pressure_m, pressure_bc, velocity_m, velocity_bc);
+        }
+
+        pressure_m.integrate(integrator_flags_p.face_integrate);
+        velocity_m.integrate(integrator_flags_u.face_integrate);
+
+        for(unsigned int i = 0; i < pressure.dofs_per_cell; ++i)
+          pressure.begin_dof_values()[i] += pressure_m.begin_dof_values()[i];
+        for(unsigned int i = 0; i < velocity.dofs_per_cell; ++i)
+          velocity.begin_dof_values()[i] += velocity_m.begin_dof_values()[i];
+      }
+
+      pressure.set_dof_values(dst.block(data.block_index_pressure));
+      velocity.set_dof_values(dst.block(data.block_index_velocity));
+    }
+
+    src.zero_out_ghost_values();
+  }
+
 private:
   void
   do_evaluate(BlockVectorType &       dst,
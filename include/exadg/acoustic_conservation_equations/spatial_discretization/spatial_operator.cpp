@@ -25,6 +25,7 @@
 // ExaDG
 #include <exadg/acoustic_conservation_equations/spatial_discretization/spatial_operator.h>
 #include <exadg/grid/mapping_dof_vector.h>
+#include <exadg/matrix_free/categorization.h>
 #include <exadg/operators/finite_element.h>
 #include <exadg/operators/grid_related_time_step_restrictions.h>
 #include <exadg/operators/quadrature.h>
@@ -53,6 +54,7 @@ SpatialOperator<dim, Number>::SpatialOperator(
     dof_handler_p(*grid_in->triangulation),
     dof_handler_u(*grid_in->triangulation),
     aero_acoustic_source_term(nullptr),
+    n_time_step_levels(1),
     mpi_comm(mpi_comm_in),
     pcout(std::cout, dealii::Utilities::MPI::this_mpi_process(mpi_comm_in) == 0)
 {
@@ -121,6 +123,26 @@ SpatialOperator<dim, Number>::setup()
 
   fill_matrix_free_data(*mf_data);
 
+  // Local time stepping evaluates the operator for subsets of cells. This requires cell-based
+  // face loops and cell batches that contain cells of a single time step level only.
+  if(param.local_time_stepping)
+  {
+    AssertThrow(not grid->triangulation->has_hanging_nodes(),
+                dealii::ExcMessage("Local time stepping requires cell-based face loops, which do "
+                                   "not support faces with hanging nodes. Use a graded mesh "
+                                   "without hanging nodes instead of local refinement."));
+
+    n_time_step_levels = calculate_time_step_levels(cell_time_step_levels,
+                                                    *grid->triangulation,
+                                                    param.max_number_of_time_step_levels,
+                                                    mpi_comm);
+
+    Categorization::do_cell_based_loops(*grid->triangulation, mf_data->data);
+    Categorization::split_categories_by_level(*grid->triangulation,
+                                              mf_data->data,
+                                              cell_time_step_levels);
+  }
+
   mf->reinit(*get_mapping(),
              mf_data->get_dof_handler_vector(),
              mf_data->get_constraint_vector(),
@@ -148,6 +170,9 @@ SpatialOperator<dim, Number>::setup(
 
   initialize_operators();
 
+  if(param.local_time_stepping)
+    initialize_time_step_levels();
+
   pcout << std::endl << "... done!" << std::endl << std::flush;
 }
 
@@ -390,6 +415,65 @@ SpatialOperator<dim, Number>::calculate_time_step_cfl() const
     mpi_comm);
 }
 
+template<int dim, typename Number>
+TimeStepLevels const &
+SpatialOperator<dim, Number>::get_time_step_levels() const
+{
+  AssertThrow(param.local_time_stepping,
+              dealii::ExcMessage("Time step levels are only available for local time stepping."));
+
+  return time_step_levels;
+}
+
+template<int dim, typename Number>
+void
+SpatialOperator<dim, Number>::evaluate_time_step_levels(
+  BlockVectorType &       dst,
+  BlockVectorType const & src,
+  double const            time,
+  unsigned int const      max_active_level) const
+{
+  std::vector<unsigned int> const & cell_batches =
+    time_step_levels.cell_batches_up_to_level[max_active_level];
+
+  acoustic_operator.evaluate_cell_batches(dst, src, time, cell_batches);
+
+  // shift to the right-hand side of the equation
+  for(unsigned int level = 0; level <= max_active_level; ++level)
+    scale_dof_ranges(dst, Number{-1.0}, time_step_levels.dof_ranges[level]);
+
+  if(param.right_hand_side)
+    rhs_operator.evaluate_add(dst.block(block_index_pressure), time, cell_batches);
+
+  if(param.aero_acoustic_source_term)
+  {
+    AssertThrow(aero_acoustic_source_term,
+                dealii::ExcMessage("Aero-acoustic source term not valid."));
+
+    for(unsigned int level = 0; level <= max_active_level; ++level)
+    {
+      for(DoFRange const & range : time_step_levels.dof_ranges[level])
+      {
+        if(range.block == block_index_pressure)
+        {
+          for(unsigned int i = range.begin; i < range.end; ++i)
+            dst.block(block_index_pressure).local_element(i) +=
+              aero_acoustic_source_term->local_element(i);
+        }
+      }
+    }
+  }
+
+  inverse_mass_pressure.apply_scale(dst.block(block_index_pressure),
+                                    param.speed_of_sound * param.speed_of_sound,
+                                    dst.block(block_index_pressure),
+                                    cell_batches);
+  inverse_mass_velocity.apply_scale(dst.block(block_index_velocity),
+                                    1.0,
+                                    dst.block(block_index_velocity),
+                                    cell_batches);
+}
+
 template<int dim, typename Number>
 void
 SpatialOperator<dim, Number>::initialize_dof_handler_and_constraints()
@@ -470,6 +554,43 @@ SpatialOperator<dim, Number>::initialize_operators()
   }
 }
 
+template<int dim, typename Number>
+void
+SpatialOperator<dim, Number>::initialize_time_step_levels()
+{
+  // The time step levels have not been computed in case the dealii::MatrixFree object has been
+  // set up outside of this class. The categories of dealii::MatrixFree then need to be set up as
+  // in setup(), which is checked in setup_time_step_levels().
+  if(cell_time_step_levels.empty())
+  {
+    n_time_step_levels = calculate_time_step_levels(cell_time_step_levels,
+                                                    *grid->triangulation,
+                                                    param.max_number_of_time_step_levels,
+                                                    mpi_comm);
+  }
+
+  std::vector<unsigned int> dof_indices(2);
+  dof_indices[block_index_pressure] = get_dof_index_pressure();
+  dof_indices[block_index_velocity] = get_dof_index_velocity();
+
+  setup_time_step_levels(
+    time_step_levels, *matrix_free, cell_time_step_levels, n_time_step_levels, dof_indices);
+
+  // output number of cells per level
+  std::vector<unsigned int> n_cells(n_time_step_levels, 0);
+  for(auto const & cell : grid->triangulation->active_cell_iterators())
+  {
+    if(cell->is_locally_owned())
+      ++n_cells[cell_time_step_levels[cell->active_cell_index()]];
+  }
+  dealii::Utilities::MPI::sum(n_cells, mpi_comm, n_cells);
+
+  pcout << std::endl << "Local time stepping:" << std::endl;
+  print_parameter(pcout, "number of time step levels", n_time_step_levels);
+  for(unsigned int level = 0; level < n_time_step_levels; ++level)
+    print_parameter(pcout, "number of cells on level " + std::to_string(level), n_cells[level]);
+}
+
 template class SpatialOperator<2, float>;
 template class SpatialOperator<3, float>;
 
@@ -37,6 +37,7 @@
 #include <exadg/matrix_free/matrix_free_data.h>
 #include <exadg/operators/inverse_mass_operator.h>
 #include <exadg/operators/rhs_operator.h>
+#include <exadg/time_integration/local_time_stepping.h>
 #include <exadg/utilities/lazy_ptr.h>
 
 namespace ExaDG
@@ -198,6 +199,22 @@ public:
   double
   calculate_time_step_cfl() const final;
 
+  /*
+   * Local time stepping.
+   */
+  TimeStepLevels const &
+  get_time_step_levels() const final;
+
+  /*
+   * Same as evaluate(), but only for the cells on the time step levels 0, ..., max_active_level.
+   * The remaining entries of dst are not touched.
+   */
+  void
+  evaluate_time_step_levels(BlockVectorType &       dst,
+                            BlockVectorType const & src,
+                            double const            time,
+                            unsigned int const      max_active_level) const final;
+
 private:
   void
   initialize_dof_handler_and_constraints();
@@ -205,6 +222,9 @@ private:
   void
   initialize_operators();
 
+  void
+  initialize_time_step_levels();
+
   /*
    * Grid
    */
@@ -276,6 +296,14 @@ private:
   // The aero-acoustic source term has been computed externally.
   VectorType const * aero_acoustic_source_term;
 
+  /*
+   * Local time stepping: time step level of each cell (indexed by the active cell index) and the
+   * resulting partitioning of cell batches and degrees of freedom.
+   */
+  std::vector<unsigned int> cell_time_step_levels;
+  unsigned int              n_time_step_levels;
+  TimeStepLevels            time_step_levels;
+
   MPI_Comm const mpi_comm;
 
   dealii::ConditionalOStream pcout;
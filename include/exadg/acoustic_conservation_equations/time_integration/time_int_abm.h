@@ -52,6 +52,7 @@ public:
         param_in.order_time_integrator,
         param_in.start_with_low_order,
         param_in.adaptive_time_stepping,
+        param_in.local_time_stepping,
         param_in.restart_data,
         mpi_comm_in,
         is_test_in),
@@ -95,6 +96,19 @@ private:
       print_parameter(this->pcout, "time step size", initial_time_step_size);
     }
 
+    // In case of local time stepping, the time step size computed above refers to the finest
+    // level and the time integrator advances with the time step size of the coarsest level.
+    if(param.local_time_stepping)
+    {
+      unsigned int const n_levels = this->get_underlying_operator().get_time_step_levels().n_levels;
+
+      initial_time_step_size *= (double)(1u << (n_levels - 1));
+
+      this->pcout << std::endl << "Local time stepping:" << std::endl << std::endl;
+      print_parameter(this->pcout, "number of time step levels", n_levels);
+      print_parameter(this->pcout, "time step size (coarsest level)", initial_time_step_size);
+    }
+
     return initial_time_step_size;
   }
 
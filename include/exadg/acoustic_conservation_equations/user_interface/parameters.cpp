@@ -53,6 +53,8 @@ Parameters::Parameters()
     start_with_low_order(true),
     restarted_simulation(false),
     adaptive_time_stepping(false),
+    local_time_stepping(false),
+    max_number_of_time_step_levels(4),
     restart_data(RestartData()),
     solver_info_data(SolverInfoData()),
 
@@ -88,6 +90,15 @@ Parameters::check() const
     AssertThrow(cfl_exponent_fe_degree > 0., dealii::ExcMessage("cfl_exponent_fe_degree > 0."));
   }
 
+  if(local_time_stepping)
+  {
+    AssertThrow(max_number_of_time_step_levels > 0,
+                dealii::ExcMessage("parameter max_number_of_time_step_levels must be > 0."));
+    AssertThrow(grid.element_type == ElementType::Hypercube,
+                dealii::ExcMessage(
+                  "Local time stepping is currently only implemented for hypercube elements."));
+  }
+
   // SPATIAL DISCRETIZATION
   grid.check();
 }
@@ -155,6 +166,11 @@ Parameters::print_parameters_temporal_discretization(dealii::ConditionalOStream
 
   // adaptive time-stepping
   print_parameter(pcout, "Adaptive time stepping", adaptive_time_stepping);
+
+  // local time stepping
+  print_parameter(pcout, "Local time stepping", local_time_stepping);
+  if(local_time_stepping)
+    print_parameter(pcout, "Max. number of time step levels", max_number_of_time_step_levels);
 }
 
 void
@@ -132,6 +132,19 @@ public:
   // use adaptive timestepping
   bool adaptive_time_stepping;
 
+  // Use local time stepping: cells are grouped into levels with time step sizes dt, 2*dt, 4*dt,
+  // ... according to their size, where dt is the time step size of the smallest cells (calculated
+  // as specified by calculation_of_time_step_size). Each level is advanced with its own time step
+  // size using a multirate Adams-Bashforth scheme of order order_time_integrator, i.e., the
+  // Adams-Moulton corrector is not applied in this case. The time step size of the time
+  // integrator is the one of the coarsest level. Local time stepping is only implemented for meshes
+  // without hanging nodes.
+  bool local_time_stepping;
+
+  // maximum number of time step levels, i.e., the time step size of the coarsest level is at most
+  // 2^(max_number_of_time_step_levels-1) * dt
+  unsigned int max_number_of_time_step_levels;
+
   // restart
   RestartData restart_data;
 
@@ -1,8 +1,10 @@
 #ifndef INCLUDE_EXADG_AERO_ACOUSTIC_SOURCE_TERM_CALCULATOR_H_
 #define INCLUDE_EXADG_AERO_ACOUSTIC_SOURCE_TERM_CALCULATOR_H_
 
+#include <exadg/functions_and_boundary_conditions/evaluate_functions.h>
 #include <exadg/matrix_free/integrators.h>
 #include <exadg/utilities/lazy_ptr.h>
+#include <exadg/utilities/spatial_aware_function.h>
 
 namespace ExaDG
 {
@@ -24,6 +26,11 @@ struct SourceTermCalculatorData
   // function if blend in is required.
   bool                                                  blend_in;
   std::shared_ptr<Utilities::SpatialAwareFunction<dim>> blend_in_function;
+
+  // Optional indicator of the source region. The source term is only computed in cells in which
+  // this function is non-zero in at least one quadrature point. If not provided, the source term
+  // is computed in the whole fluid domain.
+  std::shared_ptr<dealii::Function<dim>> source_region;
 };
 
 /**
@@ -59,6 +66,18 @@ public:
   {
     matrix_free = &matrix_free_in;
     data        = data_in;
+
+    setup_source_region();
+  }
+
+  /*
+   * Cell batches of the fluid MatrixFree object in which the source term is computed. All other
+   * cell batches are skipped, i.e., the source term is zero there.
+   */
+  std::vector<unsigned int> const &
+  get_active_cell_batches() const
+  {
+    return active_cell_batches;
   }
 
   void
@@ -101,6 +120,40 @@ public:
   }
 
 private:
+  void
+  setup_source_region()
+  {
+    cell_batch_is_active.assign(matrix_free->n_cell_batches(), true);
+
+    if(data.source_region.get())
+    {
+      CellIntegratorScalar integrator(*matrix_free, data.dof_index_pressure, data.quad_index);
+
+      for(unsigned int cell = 0; cell < matrix_free->n_cell_batches(); ++cell)
+      {
+        integrator.reinit(cell);
+
+        bool is_active = false;
+        for(unsigned int q = 0; q < integrator.n_q_points and not is_active; ++q)
+        {
+          scalar const indicator =
+            FunctionEvaluator<0, dim, Number>::value(*data.source_region,
+                                                     integrator.quadrature_point(q));
+
+          for(unsigned int v = 0; v < matrix_free->n_active_entries_per_cell_batch(cell); ++v)
+            is_active = is_active or (indicator[v] != 0.0);
+        }
+
+        cell_batch_is_active[cell] = is_active;
+      }
+    }
+
+    active_cell_batches.clear();
+    for(unsigned int cell = 0; cell < matrix_free->n_cell_batches(); ++cell)
+      if(cell_batch_is_active[cell])
+        active_cell_batches.push_back(cell);
+  }
+
   void
   compute_source_term(dealii::MatrixFree<dim, Number> const &       matrix_free_in,
                       VectorType &                                  dst,
@@ -117,6 +170,9 @@ private:
 
     for(unsigned int cell = cell_range.first; cell < cell_range.second; ++cell)
     {
+      if(not cell_batch_is_active[cell])
+        continue;
+
       dpdt.reinit(cell);
       dpdt.gather_evaluate(dp_cfd_dt, dealii::EvaluationFlags::values);
 
@@ -168,6 +224,9 @@ private:
 
     for(unsigned int cell = cell_range.first; cell < cell_range.second; ++cell)
     {
+      if(not cell_batch_is_active[cell])
+        continue;
+
       dpdt.reinit(cell);
 
       for(unsigned int q = 0; q < dpdt.n_q_points; ++q)
@@ -221,6 +280,10 @@ private:
 
   SourceTermCalculatorData<dim> data;
 
+  // cell batches in the source region
+  std::vector<bool>         cell_batch_is_active;
+  std::vector<unsigned int> active_cell_batches;
+
   lazy_ptr<VectorType> velocity_cfd;
   lazy_ptr<VectorType> pressure_cfd;
 
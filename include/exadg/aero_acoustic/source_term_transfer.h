@@ -0,0 +1,234 @@
+/*  ______________________________________________________________________
+ *
+ *  ExaDG - High-Order Discontinuous Galerkin for the Exa-Scale
+ *
+ *  Copyright (C) 2023 by the ExaDG authors
+ *
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation, either version 3 of the License, or
+ *  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ *  ______________________________________________________________________
+ */
+
+#ifndef INCLUDE_EXADG_AERO_ACOUSTIC_SOURCE_TERM_TRANSFER_H_
+#define INCLUDE_EXADG_AERO_ACOUSTIC_SOURCE_TERM_TRANSFER_H_
+
+// C/C++
+#include <algorithm>
+#include <vector>
+
+// deal.II
+#include <deal.II/base/mpi_remote_point_evaluation.h>
+#include <deal.II/dofs/dof_handler.h>
+#include <deal.II/fe/mapping.h>
+#include <deal.II/lac/la_parallel_vector.h>
+#include <deal.II/matrix_free/matrix_free.h>
+
+namespace ExaDG
+{
+namespace AeroAcoustic
+{
+/**
+ * Conservative transfer of an integrated source term from the fluid mesh to a non-matching
+ * acoustic mesh. Each fluid degree of freedom is associated with its support point, and its value
+ * is distributed to the acoustic degrees of freedom with the weights given by the acoustic shape
+ * functions evaluated at that point. This is the transpose of interpolating the acoustic field to
+ * the fluid support points, i.e., the same operator as the restriction of
+ * dealii::MGTwoLevelTransferNonNested.
+ *
+ * Only the fluid degrees of freedom of a given set of cell batches (the source region) are
+ * considered. The overlap between fluid support points and acoustic cells, as well as the acoustic
+ * shape function values, are computed once in reinit(). The application of the operator consists
+ * of a gather of the source region values on the fluid side, point-to-point communication of these
+ * values to the owners of the acoustic cells, and small dense cell-wise products on the acoustic
+ * side.
+ */
+template<int dim, typename Number>
+class SourceTermTransfer
+{
+  using VectorType = dealii::LinearAlgebra::distributed::Vector<Number>;
+  using CellData   = typename dealii::Utilities::MPI::RemotePointEvaluation<dim>::CellData;
+
+public:
+  SourceTermTransfer() : rpe(1.e-6 /* tolerance */, true /* unique mapping */, 0)
+  {
+  }
+
+  /**
+   * Setup of the transfer operator.
+   *
+   * @param[in] matrix_free_fluid Fluid MatrixFree object.
+   * @param[in] dof_index_fluid Index of the fluid DoFHandler in matrix_free_fluid.
+   * @param[in] active_cell_batches Cell batches of matrix_free_fluid with non-zero source terms.
+   * @param[in] mapping_fluid Fluid mapping.
+   * @param[in] dof_handler_acoustic Acoustic DoFHandler.
+   * @param[in] mapping_acoustic Acoustic mapping.
+   */
+  void
+  reinit(dealii::MatrixFree<dim, Number> const & matrix_free_fluid,
+         unsigned int const                      dof_index_fluid,
+         std::vector<unsigned int> const &       active_cell_batches,
+         dealii::Mapping<dim> const &            mapping_fluid,
+         dealii::DoFHandler<dim> const &         dof_handler_acoustic,
+         dealii::Mapping<dim> const &            mapping_acoustic)
+  {
+    // fluid side: degrees of freedom in the source region and their support points
+    dealii::DoFHandler<dim> const & dof_handler_fluid =
+      matrix_free_fluid.get_dof_handler(dof_index_fluid);
+
+    AssertThrow(dof_handler_fluid.get_fe().has_support_points(),
+                dealii::ExcMessage("The fluid finite element needs to have support points."));
+
+    std::vector<dealii::Point<dim>> const & unit_support_points =
+      dof_handler_fluid.get_fe().get_unit_support_points();
+
+    dealii::IndexSet const & locally_owned_dofs = dof_handler_fluid.locally_owned_dofs();
+
+    std::vector<bool> dof_is_visited(locally_owned_dofs.n_elements(), false);
+
+    std::vector<dealii::types::global_dof_index> dof_indices(
+      dof_handler_fluid.get_fe().n_dofs_per_cell());
+
+    std::vector<dealii::Point<dim>> points;
+    fluid_dof_indices.clear();
+
+    for(auto const & batch : active_cell_batches)
+    {
+      for(unsigned int v = 0; v < matrix_free_fluid.n_active_entries_per_cell_batch(batch); ++v)
+      {
+        auto const cell = matrix_free_fluid.get_cell_iterator(batch, v, dof_index_fluid);
+
+        cell->get_dof_indices(dof_indices);
+        for(unsigned int i = 0; i < dof_indices.size(); ++i)
+        {
+          if(not locally_owned_dofs.is_element(dof_indices[i]))
+            continue;
+
+          unsigned int const local_index = locally_owned_dofs.index_within_set(dof_indices[i]);
+          if(dof_is_visited[local_index])
+            continue;
+          dof_is_visited[local_index] = true;
+
+          fluid_dof_indices.push_back(local_index);
+          points.push_back(mapping_fluid.transform_unit_to_real_cell(cell, unit_support_points[i]));
+        }
+      }
+    }
+
+    // acoustic side: find acoustic cells containing the fluid support points
+    rpe.reinit(points, dof_handler_acoustic.get_triangulation(), mapping_acoustic);
+
+    // precompute the acoustic DoF indices and the shape function values in the received points
+    dealii::FiniteElement<dim> const & fe_acoustic = dof_handler_acoustic.get_fe();
+
+    dofs_per_cell_acoustic = fe_acoustic.n_dofs_per_cell();
+
+    auto const & cell_data = rpe.get_cell_data();
+
+    acoustic_dof_indices.clear();
+    shape_values.clear();
+    shape_values_offsets.assign(1, 0);
+
+    std::vector<dealii::types::global_dof_index> dof_indices_acoustic(dofs_per_cell_acoustic);
+
+    for(auto const c : cell_data.cell_indices())
+    {
+      auto const cell =
+        cell_data.get_active_cell_iterator(c)->as_dof_handler_iterator(dof_handler_acoustic);
+
+      cell->get_dof_indices(dof_indices_acoustic);
+      for(auto const & index : dof_indices_acoustic)
+        acoustic_dof_indices.push_back(index);
+
+      auto const unit_points = cell_data.get_unit_points(c);
+      for(auto const & unit_point : unit_points)
+        for(unsigned int i = 0; i < dofs_per_cell_acoustic; ++i)
+          shape_values.push_back(fe_acoustic.shape_value(i, unit_point));
+
+      shape_values_offsets.push_back(shape_values.size());
+    }
+
+    point_values.resize(fluid_dof_indices.size());
+    cell_values.resize(dofs_per_cell_acoustic);
+  }
+
+  /**
+   * Transfer the integrated source term src on the fluid mesh to the acoustic mesh. The vector dst
+   * is overwritten.
+   */
+  void
+  restrict(VectorType & dst, VectorType const & src) const
+  {
+    for(unsigned int i = 0; i < fluid_dof_indices.size(); ++i)
+      point_values[i] = src.local_element(fluid_dof_indices[i]);
+
+    dst.zero_out_ghost_values();
+    dst = 0.0;
+
+    // the partitioner of dst is only known at this point, local indices are therefore computed on
+    // the fly (which also allows writing into ghost entries for continuous elements)
+    auto const & partitioner = *dst.get_partitioner();
+
+    rpe.template process_and_evaluate<Number>(
+      point_values,
+      buffer,
+      [&](dealii::ArrayView<Number const> const & values, CellData const & cell_data) {
+        for(auto const c : cell_data.cell_indices())
+        {
+          dealii::ArrayView<Number const> const cell_point_values =
+            cell_data.get_data_view(c, values);
+
+          Number const * shape = &shape_values[shape_values_offsets[c]];
+
+          std::fill(cell_values.begin(), cell_values.end(), Number(0.0));
+          for(unsigned int q = 0; q < cell_point_values.size(); ++q)
+          {
+            Number const value = cell_point_values[q];
+            for(unsigned int i = 0; i < dofs_per_cell_acoustic; ++i)
+              cell_values[i] += value * shape[q * dofs_per_cell_acoustic + i];
+          }
+
+          dealii::types::global_dof_index const * indices =
+            &acoustic_dof_indices[c * dofs_per_cell_acoustic];
+          for(unsigned int i = 0; i < dofs_per_cell_acoustic; ++i)
+            dst.local_element(partitioner.global_to_local(indices[i])) += cell_values[i];
+        }
+      });
+
+    dst.compress(dealii::VectorOperation::add);
+  }
+
+private:
+  dealii::Utilities::MPI::RemotePointEvaluation<dim> rpe;
+
+  // locally owned fluid DoFs in the source region (local indices), ordered as the points in rpe
+  std::vector<unsigned int> fluid_dof_indices;
+
+  // acoustic DoF indices of the cells in rpe.get_cell_data()
+  std::vector<dealii::types::global_dof_index> acoustic_dof_indices;
+
+  // acoustic shape function values in the received points, index [q * dofs_per_cell + i] per cell
+  std::vector<Number>       shape_values;
+  std::vector<unsigned int> shape_values_offsets;
+
+  unsigned int dofs_per_cell_acoustic;
+
+  // buffers for the application of the operator
+  mutable std::vector<Number> point_values;
+  mutable std::vector<Number> buffer;
+  mutable std::vector<Number> cell_values;
+};
+
+} // namespace AeroAcoustic
+} // namespace ExaDG
+
+#endif /* INCLUDE_EXADG_AERO_ACOUSTIC_SOURCE_TERM_TRANSFER_H_ */
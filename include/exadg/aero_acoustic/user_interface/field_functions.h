@@ -53,6 +53,14 @@ struct FieldFunctions
    * acoustic propagation.
    */
   std::shared_ptr<dealii::Function<dim>> analytical_aero_acoustic_source_term;
+
+  /*
+   * Optional indicator function of the region in which aero acoustic source terms occur, e.g.,
+   * the support of a spatial fade out function. The source term is only computed and transferred
+   * to the acoustic mesh for fluid cells in which this function is non-zero. If not provided, the
+   * whole fluid domain is considered.
+   */
+  std::shared_ptr<dealii::Function<dim>> source_term_region;
 };
 
 } // namespace AeroAcoustic
@@ -25,6 +25,7 @@
 #include <exadg/aero_acoustic/calculators/source_term_calculator.h>
 #include <exadg/aero_acoustic/single_field_solvers/acoustics.h>
 #include <exadg/aero_acoustic/single_field_solvers/fluid.h>
+#include <exadg/aero_acoustic/source_term_transfer.h>
 #include <exadg/aero_acoustic/user_interface/parameters.h>
 
 namespace ExaDG
@@ -54,20 +55,6 @@ public:
     acoustic_solver_in->pde_operator->initialize_dof_vector_pressure(source_term_acoustic);
     fluid_solver_in->pde_operator->initialize_vector_pressure(source_term_fluid);
 
-    // setup the transfer operator
-    if(parameters.fluid_to_acoustic_coupling_strategy ==
-       FluidToAcousticCouplingStrategy::ConservativeInterpolation)
-    {
-      non_nested_grid_transfer.reinit(fluid_solver_in->pde_operator->get_dof_handler_p(),
-                                      acoustic_solver_in->pde_operator->get_dof_handler_p(),
-                                      *fluid_solver_in->pde_operator->get_mapping(),
-                                      *acoustic_solver_in->pde_operator->get_mapping());
-    }
-    else
-    {
-      AssertThrow(false, dealii::ExcMessage("FluidToAcousticCouplingStrategy not implemented."));
-    }
-
     // setup aeroacoustic source term calculator
     SourceTermCalculatorData<dim> data;
     data.dof_index_pressure  = fluid_solver_in->pde_operator->get_dof_index_pressure();
@@ -77,8 +64,25 @@ public:
     data.consider_convection = parameters_in.source_term_with_convection;
     data.blend_in            = parameters.blend_in_source_term;
     data.blend_in_function   = field_functions_in->source_term_blend_in;
+    data.source_region       = field_functions_in->source_term_region;
 
     source_term_calculator.setup(fluid_solver_in->pde_operator->get_matrix_free(), data);
+
+    // setup the transfer operator, restricted to the source region
+    if(parameters.fluid_to_acoustic_coupling_strategy ==
+       FluidToAcousticCouplingStrategy::ConservativeInterpolation)
+    {
+      source_term_transfer.reinit(fluid_solver_in->pde_operator->get_matrix_free(),
+                                  fluid_solver_in->pde_operator->get_dof_index_pressure(),
+                                  source_term_calculator.get_active_cell_batches(),
+                                  *fluid_solver_in->pde_operator->get_mapping(),
+                                  acoustic_solver_in->pde_operator->get_dof_handler_p(),
+                                  *acoustic_solver_in->pde_operator->get_mapping());
+    }
+    else
+    {
+      AssertThrow(false, dealii::ExcMessage("FluidToAcousticCouplingStrategy not implemented."));
+    }
   }
 
   void
@@ -109,7 +113,7 @@ public:
         AssertThrow(false, dealii::ExcMessage("AcousticSourceTermComputation not implemented."));
       }
 
-      non_nested_grid_transfer.restrict_and_add(source_term_acoustic, source_term_fluid);
+      source_term_transfer.restrict(source_term_acoustic, source_term_fluid);
     }
     else
     {
@@ -134,7 +138,7 @@ private:
   bool compute_acoustic_from_analytical_source_term;
 
   // Transfer operator
-  dealii::MGTwoLevelTransferNonNested<dim, VectorType> non_nested_grid_transfer;
+  SourceTermTransfer<dim, Number> source_term_transfer;
 
   // Class that knows how to compute the source term
   SourceTermCalculator<dim, Number> source_term_calculator;
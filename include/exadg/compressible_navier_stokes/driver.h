@@ -33,6 +33,7 @@
 #include <exadg/grid/mapping_dof_vector.h>
 #include <exadg/matrix_free/matrix_free_data.h>
 #include <exadg/utilities/print_general_infos.h>
+#include <exadg/utilities/solver_statistics.h>
 
 namespace ExaDG
 {
@@ -102,6 +103,9 @@ private:
 
   std::shared_ptr<TimeIntExplRK<Number>> time_integrator;
 
+  // machine-readable log of solver statistics (optional)
+  std::shared_ptr<SolverStatistics> solver_statistics;
+
   // Computation time (wall clock time)
   mutable TimerTree timer_tree;
 };
@@ -65,6 +65,9 @@ PostProcessor<dim, Number>::setup(Operator<dim, Number> const & pde_operator)
 
   error_calculator.setup(pde_operator.get_dof_handler(),
                          pde_operator.get_mapping(),
+                         pde_operator.get_matrix_free(),
+                         pde_operator.get_dof_index_all(),
+                         pde_operator.get_quad_index_standard(),
                          pp_data.error_data);
 
   lift_and_drag_calculator.setup(pde_operator.get_dof_handler(),
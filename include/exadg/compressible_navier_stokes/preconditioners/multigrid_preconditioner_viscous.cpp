@@ -0,0 +1,289 @@
+/*  ______________________________________________________________________
+ *
+ *  ExaDG - High-Order Discontinuous Galerkin for the Exa-Scale
+ *
+ *  Copyright (C) 2021 by the ExaDG authors
+ *
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation, either version 3 of the License, or
+ *  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ *  ______________________________________________________________________
+ */
+
+// deal.II
+#include <deal.II/base/function.h>
+
+// ExaDG
+#include <exadg/compressible_navier_stokes/preconditioners/multigrid_preconditioner_viscous.h>
+#include <exadg/convection_diffusion/user_interface/enum_types.h>
+
+namespace ExaDG
+{
+namespace CompNS
+{
+template<int dim, typename Number>
+MultigridPreconditionerViscous<dim, Number>::MultigridPreconditionerViscous(
+  MPI_Comm const & mpi_comm_in)
+  : mpi_comm(mpi_comm_in), matrix_free(nullptr), scaling_factor_viscous(1.0), component(0)
+{
+}
+
+template<int dim, typename Number>
+void
+MultigridPreconditionerViscous<dim, Number>::initialize(
+  MultigridPreconditionerViscousData<dim> const &       data_in,
+  dealii::MatrixFree<dim, Number> const &               matrix_free_in,
+  dealii::AffineConstraints<Number> const &             affine_constraints,
+  std::shared_ptr<Grid<dim> const>                      grid,
+  std::shared_ptr<MultigridMappings<dim, Number>> const multigrid_mappings,
+  dealii::FiniteElement<dim> const &                    fe_scalar)
+{
+  data        = data_in;
+  matrix_free = &matrix_free_in;
+
+  // momentum components
+  initialize_scalar_problem(pde_operator_momentum,
+                            multigrid_momentum,
+                            bc_momentum,
+                            data.bc->velocity,
+                            data.kinematic_viscosity,
+                            affine_constraints,
+                            grid,
+                            multigrid_mappings,
+                            fe_scalar);
+
+  // energy component
+  initialize_scalar_problem(pde_operator_energy,
+                            multigrid_energy,
+                            bc_energy,
+                            data.bc->energy,
+                            data.thermal_diffusivity,
+                            affine_constraints,
+                            grid,
+                            multigrid_mappings,
+                            fe_scalar);
+
+  // density component
+  InverseMassOperatorData inverse_mass_operator_data;
+  inverse_mass_operator_data.dof_index  = data.dof_index_scalar;
+  inverse_mass_operator_data.quad_index = data.quad_index;
+  inverse_mass_scalar.initialize(*matrix_free, inverse_mass_operator_data);
+
+  matrix_free->initialize_dof_vector(src_scalar, data.dof_index_scalar);
+  matrix_free->initialize_dof_vector(dst_scalar, data.dof_index_scalar);
+
+  this->update_needed = true;
+}
+
+template<int dim, typename Number>
+void
+MultigridPreconditionerViscous<dim, Number>::initialize_scalar_problem(
+  PDEOperatorScalar &                                   pde_operator,
+  std::shared_ptr<MultigridScalar> &                    multigrid,
+  std::shared_ptr<ConvDiff::BoundaryDescriptor<dim>> &  bc_scalar,
+  BoundaryDescriptorStd<dim> const &                    bc,
+  double const                                          diffusivity,
+  dealii::AffineConstraints<Number> const &             affine_constraints,
+  std::shared_ptr<Grid<dim> const>                      grid,
+  std::shared_ptr<MultigridMappings<dim, Number>> const multigrid_mappings,
+  dealii::FiniteElement<dim> const &                    fe_scalar)
+{
+  // The preconditioner is applied to residuals, i.e. only the boundary type is relevant.
+  bc_scalar = std::make_shared<ConvDiff::BoundaryDescriptor<dim>>();
+  for(auto const & it : bc.dirichlet_bc)
+    bc_scalar->dirichlet_bc.insert(
+      std::make_pair(it.first, std::make_shared<dealii::Functions::ZeroFunction<dim>>(1)));
+  for(auto const & it : bc.neumann_bc)
+    bc_scalar->neumann_bc.insert(
+      std::make_pair(it.first, std::make_shared<dealii::Functions::ZeroFunction<dim>>(1)));
+
+  ConvDiff::CombinedOperatorData<dim> operator_data;
+  operator_data.dof_index                         = data.dof_index_scalar;
+  operator_data.quad_index                        = data.quad_index;
+  operator_data.bc                                = bc_scalar;
+  operator_data.unsteady_problem                  = true;
+  operator_data.convective_problem                = false;
+  operator_data.diffusive_problem                 = true;
+  operator_data.diffusive_kernel_data.IP_factor   = data.IP_factor;
+  operator_data.diffusive_kernel_data.diffusivity = diffusivity;
+
+  pde_operator.initialize(*matrix_free, affine_constraints, operator_data);
+  pde_operator.set_scaling_factor_mass_operator(1.0 / scaling_factor_viscous);
+
+  std::map<dealii::types::boundary_id, std::shared_ptr<dealii::Function<dim>>>
+    dirichlet_boundary_conditions = bc_scalar->dirichlet_bc;
+
+  typedef std::map<dealii::types::boundary_id, dealii::ComponentMask> Map_DBC_ComponentMask;
+  Map_DBC_ComponentMask                                               dirichlet_bc_component_mask;
+
+  multigrid = std::make_shared<MultigridScalar>(mpi_comm);
+  multigrid->initialize(data.multigrid_data,
+                        grid,
+                        multigrid_mappings,
+                        fe_scalar,
+                        pde_operator,
+                        ConvDiff::MultigridOperatorType::ReactionDiffusion,
+                        false /* mesh_is_moving */,
+                        dirichlet_boundary_conditions,
+                        dirichlet_bc_component_mask);
+}
+
+template<int dim, typename Number>
+void
+MultigridPreconditionerViscous<dim, Number>::set_scaling_factor_viscous_operator(
+  double const scaling_factor)
+{
+  AssertThrow(scaling_factor > 0.0,
+              dealii::ExcMessage("The scaling factor of the viscous operator has to be positive."));
+
+  if(scaling_factor != scaling_factor_viscous)
+  {
+    scaling_factor_viscous = scaling_factor;
+
+    // (M + factor * V') = factor * (1/factor * M + V')
+    pde_operator_momentum.set_scaling_factor_mass_operator(1.0 / scaling_factor_viscous);
+    pde_operator_energy.set_scaling_factor_mass_operator(1.0 / scaling_factor_viscous);
+
+    this->update_needed = true;
+  }
+}
+
+template<int dim, typename Number>
+double
+MultigridPreconditionerViscous<dim, Number>::get_scaling_factor_viscous_operator() const
+{
+  return scaling_factor_viscous;
+}
+
+template<int dim, typename Number>
+void
+MultigridPreconditionerViscous<dim, Number>::update()
+{
+  multigrid_momentum->update();
+  multigrid_energy->update();
+
+  this->update_needed = false;
+}
+
+template<int dim, typename Number>
+void
+MultigridPreconditionerViscous<dim, Number>::vmult(VectorType & dst, VectorType const & src) const
+{
+  // density
+  extract_component(src_scalar, src, 0);
+  inverse_mass_scalar.apply(dst_scalar, src_scalar);
+  insert_component(dst, dst_scalar, 0);
+
+  // momentum
+  for(unsigned int d = 0; d < dim; ++d)
+  {
+    extract_component(src_scalar, src, 1 + d);
+    multigrid_momentum->vmult(dst_scalar, src_scalar);
+    dst_scalar *= 1.0 / scaling_factor_viscous;
+    insert_component(dst, dst_scalar, 1 + d);
+  }
+
+  // energy
+  extract_component(src_scalar, src, 1 + dim);
+  multigrid_energy->vmult(dst_scalar, src_scalar);
+  dst_scalar *= 1.0 / scaling_factor_viscous;
+  insert_component(dst, dst_scalar, 1 + dim);
+}
+
+template<int dim, typename Number>
+std::shared_ptr<TimerTree>
+MultigridPreconditionerViscous<dim, Number>::get_timings() const
+{
+  std::shared_ptr<TimerTree> timer_tree = std::make_shared<TimerTree>();
+
+  timer_tree->insert({"Multigrid momentum"}, multigrid_momentum->get_timings());
+  timer_tree->insert({"Multigrid energy"}, multigrid_energy->get_timings());
+
+  return timer_tree;
+}
+
+template<int dim, typename Number>
+void
+MultigridPreconditionerViscous<dim, Number>::extract_component(VectorType &       dst,
+                                                               VectorType const & src,
+                                                               unsigned int const c) const
+{
+  component = c;
+  matrix_free->cell_loop(&This::cell_loop_extract_component, this, dst, src);
+}
+
+template<int dim, typename Number>
+void
+MultigridPreconditionerViscous<dim, Number>::insert_component(VectorType &       dst,
+                                                              VectorType const & src,
+                                                              unsigned int const c) const
+{
+  component = c;
+  matrix_free->cell_loop(&This::cell_loop_insert_component, this, dst, src);
+}
+
+template<int dim, typename Number>
+void
+MultigridPreconditionerViscous<dim, Number>::cell_loop_extract_component(
+  dealii::MatrixFree<dim, Number> const &       matrix_free,
+  VectorType &                                  dst,
+  VectorType const &                            src,
+  std::pair<unsigned int, unsigned int> const & cell_range) const
+{
+  CellIntegratorScalar integrator_all(matrix_free, data.dof_index_all, data.quad_index, component);
+  CellIntegratorScalar integrator_scalar(matrix_free, data.dof_index_scalar, data.quad_index);
+
+  for(unsigned int cell = cell_range.first; cell < cell_range.second; ++cell)
+  {
+    integrator_all.reinit(cell);
+    integrator_all.read_dof_values(src);
+
+    integrator_scalar.reinit(cell);
+    for(unsigned int i = 0; i < integrator_scalar.dofs_per_cell; ++i)
+      integrator_scalar.begin_dof_values()[i] = integrator_all.begin_dof_values()[i];
+
+    integrator_scalar.set_dof_values(dst);
+  }
+}
+
+template<int dim, typename Number>
+void
+MultigridPreconditionerViscous<dim, Number>::cell_loop_insert_component(
+  dealii::MatrixFree<dim, Number> const &       matrix_free,
+  VectorType &                                  dst,
+  VectorType const &                            src,
+  std::pair<unsigned int, unsigned int> const & cell_range) const
+{
+  CellIntegratorScalar integrator_scalar(matrix_free, data.dof_index_scalar, data.quad_index);
+  CellIntegratorScalar integrator_all(matrix_free, data.dof_index_all, data.quad_index, component);
+
+  for(unsigned int cell = cell_range.first; cell < cell_range.second; ++cell)
+  {
+    integrator_scalar.reinit(cell);
+    integrator_scalar.read_dof_values(src);
+
+    integrator_all.reinit(cell);
+    for(unsigned int i = 0; i < integrator_all.dofs_per_cell; ++i)
+      integrator_all.begin_dof_values()[i] = integrator_scalar.begin_dof_values()[i];
+
+    integrator_all.set_dof_values(dst);
+  }
+}
+
+template class MultigridPreconditionerViscous<2, float>;
+template class MultigridPreconditionerViscous<3, float>;
+
+template class MultigridPreconditionerViscous<2, double>;
+template class MultigridPreconditionerViscous<3, double>;
+
+} // namespace CompNS
+} // namespace ExaDG
@@ -0,0 +1,187 @@
+/*  ______________________________________________________________________
+ *
+ *  ExaDG - High-Order Discontinuous Galerkin for the Exa-Scale
+ *
+ *  Copyright (C) 2021 by the ExaDG authors
+ *
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation, either version 3 of the License, or
+ *  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ *  ______________________________________________________________________
+ */
+
+#ifndef INCLUDE_EXADG_COMPRESSIBLE_NAVIER_STOKES_PRECONDITIONERS_MULTIGRID_PRECONDITIONER_VISCOUS_H_
+#define INCLUDE_EXADG_COMPRESSIBLE_NAVIER_STOKES_PRECONDITIONERS_MULTIGRID_PRECONDITIONER_VISCOUS_H_
+
+// deal.II
+#include <deal.II/lac/affine_constraints.h>
+#include <deal.II/matrix_free/matrix_free.h>
+
+// ExaDG
+#include <exadg/compressible_navier_stokes/user_interface/boundary_descriptor.h>
+#include <exadg/convection_diffusion/preconditioners/multigrid_preconditioner.h>
+#include <exadg/convection_diffusion/spatial_discretization/operators/combined_operator.h>
+#include <exadg/convection_diffusion/user_interface/boundary_descriptor.h>
+#include <exadg/grid/grid.h>
+#include <exadg/matrix_free/integrators.h>
+#include <exadg/operators/inverse_mass_operator.h>
+#include <exadg/solvers_and_preconditioners/multigrid/multigrid_parameters.h>
+#include <exadg/solvers_and_preconditioners/preconditioners/preconditioner_base.h>
+
+namespace ExaDG
+{
+namespace CompNS
+{
+template<int dim>
+struct MultigridPreconditionerViscousData
+{
+  MultigridPreconditionerViscousData()
+    : dof_index_all(0),
+      dof_index_scalar(0),
+      quad_index(0),
+      IP_factor(1.0),
+      kinematic_viscosity(0.0),
+      thermal_diffusivity(0.0)
+  {
+  }
+
+  unsigned int dof_index_all;
+  unsigned int dof_index_scalar;
+  unsigned int quad_index;
+
+  double IP_factor;
+  double kinematic_viscosity;
+  double thermal_diffusivity;
+
+  MultigridData multigrid_data;
+
+  std::shared_ptr<BoundaryDescriptor<dim> const> bc;
+};
+
+/*
+ * Preconditioner for the linearized viscous problem M + factor * V'(u) of IMEX Runge-Kutta
+ * methods, where M denotes the mass matrix and V'(u) the linearized viscous operator.
+ *
+ * The coupling between the components and the dependency of the viscous term on the density are
+ * neglected. The momentum components are preconditioned by a scalar reaction-diffusion multigrid
+ * preconditioner with the kinematic viscosity mu / rho_ref as diffusivity, the energy component by
+ * the same type of preconditioner with the thermal diffusivity lambda / (rho_ref * c_v). Since the
+ * viscous term does not act on the density, the inverse mass operator is applied to the density
+ * component. Inhomogeneous boundary data is irrelevant for the preconditioner, i.e., only the
+ * boundary type (Dirichlet/Neumann) of the velocity and energy boundary conditions is used.
+ */
+template<int dim, typename Number>
+class MultigridPreconditionerViscous : public PreconditionerBase<Number>
+{
+private:
+  typedef MultigridPreconditionerViscous<dim, Number> This;
+
+  typedef typename PreconditionerBase<Number>::VectorType VectorType;
+
+  typedef ConvDiff::CombinedOperator<dim, Number>        PDEOperatorScalar;
+  typedef ConvDiff::MultigridPreconditioner<dim, Number> MultigridScalar;
+
+  typedef CellIntegrator<dim, 1, Number> CellIntegratorScalar;
+
+public:
+  MultigridPreconditionerViscous(MPI_Comm const & mpi_comm);
+
+  void
+  initialize(MultigridPreconditionerViscousData<dim> const &       data,
+             dealii::MatrixFree<dim, Number> const &               matrix_free,
+             dealii::AffineConstraints<Number> const &             affine_constraints,
+             std::shared_ptr<Grid<dim> const>                      grid,
+             std::shared_ptr<MultigridMappings<dim, Number>> const multigrid_mappings,
+             dealii::FiniteElement<dim> const &                    fe_scalar);
+
+  /*
+   * Sets the factor in front of the viscous operator. The multigrid preconditioners have to be
+   * updated afterwards, see update().
+   */
+  void
+  set_scaling_factor_viscous_operator(double const scaling_factor);
+
+  double
+  get_scaling_factor_viscous_operator() const;
+
+  void
+  vmult(VectorType & dst, VectorType const & src) const final;
+
+  void
+  update() final;
+
+  std::shared_ptr<TimerTree>
+  get_timings() const final;
+
+private:
+  void
+  initialize_scalar_problem(
+    PDEOperatorScalar &                                   pde_operator,
+    std::shared_ptr<MultigridScalar> &                    multigrid,
+    std::shared_ptr<ConvDiff::BoundaryDescriptor<dim>> &  bc_scalar,
+    BoundaryDescriptorStd<dim> const &                    bc,
+    double const                                          diffusivity,
+    dealii::AffineConstraints<Number> const &             affine_constraints,
+    std::shared_ptr<Grid<dim> const>                      grid,
+    std::shared_ptr<MultigridMappings<dim, Number>> const multigrid_mappings,
+    dealii::FiniteElement<dim> const &                    fe_scalar);
+
+  void
+  extract_component(VectorType & dst, VectorType const & src, unsigned int const component) const;
+
+  void
+  insert_component(VectorType & dst, VectorType const & src, unsigned int const component) const;
+
+  void
+  cell_loop_extract_component(dealii::MatrixFree<dim, Number> const &       matrix_free,
+                              VectorType &                                  dst,
+                              VectorType const &                            src,
+                              std::pair<unsigned int, unsigned int> const & cell_range) const;
+
+  void
+  cell_loop_insert_component(dealii::MatrixFree<dim, Number> const &       matrix_free,
+                             VectorType &                                  dst,
+                             VectorType const &                            src,
+                             std::pair<unsigned int, unsigned int> const & cell_range) const;
+
+  MPI_Comm const mpi_comm;
+
+  MultigridPreconditionerViscousData<dim> data;
+
+  dealii::MatrixFree<dim, Number> const * matrix_free;
+
+  double scaling_factor_viscous;
+
+  // momentum components
+  std::shared_ptr<ConvDiff::BoundaryDescriptor<dim>> bc_momentum;
+  PDEOperatorScalar                                  pde_operator_momentum;
+  std::shared_ptr<MultigridScalar>                   multigrid_momentum;
+
+  // energy component
+  std::shared_ptr<ConvDiff::BoundaryDescriptor<dim>> bc_energy;
+  PDEOperatorScalar                                  pde_operator_energy;
+  std::shared_ptr<MultigridScalar>                   multigrid_energy;
+
+  // density component
+  InverseMassOperator<dim, 1, Number> inverse_mass_scalar;
+
+  // component of the (dim+2)-component vector currently extracted/inserted
+  mutable unsigned int component;
+
+  mutable VectorType src_scalar, dst_scalar;
+};
+
+} // namespace CompNS
+} // namespace ExaDG
+
+#endif /* INCLUDE_EXADG_COMPRESSIBLE_NAVIER_STOKES_PRECONDITIONERS_MULTIGRID_PRECONDITIONER_VISCOUS_H_ \
+        */
@@ -22,6 +22,10 @@
 #ifndef INCLUDE_EXADG_COMPRESSIBLE_NAVIER_STOKES_SPATIAL_DISCRETIZATION_INTERFACE_H_
 #define INCLUDE_EXADG_COMPRESSIBLE_NAVIER_STOKES_SPATIAL_DISCRETIZATION_INTERFACE_H_
 
+// C/C++
+#include <tuple>
+
+// deal.II
 #include <deal.II/lac/la_parallel_vector.h>
 
 namespace ExaDG
@@ -64,6 +68,28 @@ public:
   virtual void
   evaluate(VectorType & dst, VectorType const & src, Number const evaluation_time) const = 0;
 
+  // IMEX time integration: evaluate the explicit part of the operator (convective term and body
+  // force term)
+  virtual void
+  evaluate_explicit_part(VectorType &       dst,
+                         VectorType const & src,
+                         Number const       evaluation_time) const = 0;
+
+  // IMEX time integration: evaluate the implicit part of the operator (viscous term)
+  virtual void
+  evaluate_implicit_part(VectorType &       dst,
+                         VectorType const & src,
+                         Number const       evaluation_time) const = 0;
+
+  // IMEX time integration: solve the nonlinear problem dst - factor * f_implicit(dst) = rhs,
+  // where f_implicit denotes the implicit part of the operator. Returns the number of Newton
+  // iterations and the accumulated number of linear iterations.
+  virtual std::tuple<unsigned int, unsigned int>
+  solve_implicit_part(VectorType &       dst,
+                      VectorType const & rhs,
+                      Number const       evaluation_time,
+                      double const       scaling_factor) = 0;
+
   // analysis of computational costs
   virtual double
   get_wall_time_operator_evaluation() const = 0;
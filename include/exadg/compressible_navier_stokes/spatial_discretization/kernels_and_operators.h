@@ -26,6 +26,8 @@
 #include <iostream>
 
 // deal.II
+#include <deal.II/base/aligned_vector.h>
+#include <deal.II/base/polynomial.h>
 #include <deal.II/lac/la_parallel_vector.h>
 
 // ExaDG
@@ -147,7 +149,7 @@ inline DEAL_II_ALWAYS_INLINE //
  * Calculates exterior state "+" for a scalar/vectorial quantity depending on interior state "-" and
  * boundary conditions.
  */
-template<int dim, typename Number, int rank>
+template<int dim, typename Number, int rank, typename Integrator>
 inline DEAL_II_ALWAYS_INLINE //
   dealii::Tensor<rank, dim, dealii::VectorizedArray<Number>>
   calculate_exterior_value(
@@ -155,7 +157,8 @@ inline DEAL_II_ALWAYS_INLINE //
     BoundaryType const                                                 boundary_type,
     BoundaryDescriptorStd<dim> const &                                 boundary_descriptor,
     dealii::types::boundary_id const &                                 boundary_id,
-    dealii::Point<dim, dealii::VectorizedArray<Number>> const &        q_point,
+    Integrator const &                                                 integrator,
+    unsigned int const                                                 q,
     Number const &                                                     time)
 {
   dealii::Tensor<rank, dim, dealii::VectorizedArray<Number>> value_p;
@@ -163,7 +166,8 @@ inline DEAL_II_ALWAYS_INLINE //
   if(boundary_type == BoundaryType::Dirichlet)
   {
     auto bc = boundary_descriptor.dirichlet_bc.find(boundary_id)->second;
-    auto g  = FunctionEvaluator<rank, dim, Number>::value(*bc, q_point, time);
+    auto g  = evaluate_boundary_function<rank, dim, Number>(
+      *bc, boundary_descriptor, boundary_id, integrator, q, time);
 
     value_p = -value_m + dealii::Tensor<rank, dim, dealii::VectorizedArray<Number>>(2.0 * g);
   }
@@ -183,7 +187,7 @@ inline DEAL_II_ALWAYS_INLINE //
  * Calculates exterior state of normal gradient (Neumann type boundary conditions)
  * depending on interior data and boundary conditions.
  */
-template<int dim, typename Number, int rank>
+template<int dim, typename Number, int rank, typename Integrator>
 inline DEAL_II_ALWAYS_INLINE //
   dealii::Tensor<rank, dim, dealii::VectorizedArray<Number>>
   calculate_exterior_normal_grad(
@@ -191,7 +195,8 @@ inline DEAL_II_ALWAYS_INLINE //
     BoundaryType const &                                               boundary_type,
     BoundaryDescriptorStd<dim> const &                                 boundary_descriptor,
     dealii::types::boundary_id const &                                 boundary_id,
-    dealii::Point<dim, dealii::VectorizedArray<Number>> const &        q_point,
+    Integrator const &                                                 integrator,
+    unsigned int const                                                 q,
     Number const &                                                     time)
 {
   dealii::Tensor<rank, dim, dealii::VectorizedArray<Number>> grad_P_normal;
@@ -204,7 +209,8 @@ inline DEAL_II_ALWAYS_INLINE //
   else if(boundary_type == BoundaryType::Neumann)
   {
     auto bc = boundary_descriptor.neumann_bc.find(boundary_id)->second;
-    auto h  = FunctionEvaluator<rank, dim, Number>::value(*bc, q_point, time);
+    auto h  = evaluate_boundary_function<rank, dim, Number>(
+      *bc, boundary_descriptor, boundary_id, integrator, q, time);
 
     grad_P_normal =
       -grad_M_normal + dealii::Tensor<rank, dim, dealii::VectorizedArray<Number>>(2.0 * h);
@@ -281,6 +287,110 @@ inline DEAL_II_ALWAYS_INLINE //
   return std::max(lambda_m, lambda_p);
 }
 
+/*
+ * This function calculates the logarithmic mean (a - b) / (log(a) - log(b)) of two positive
+ * quantities. A series expansion is used for a -> b, see Ismail and Roe (2009) and Ranocha (2018).
+ */
+template<typename Number>
+inline DEAL_II_ALWAYS_INLINE //
+  dealii::VectorizedArray<Number>
+  calculate_logarithmic_mean(dealii::VectorizedArray<Number> const & a,
+                             dealii::VectorizedArray<Number> const & b)
+{
+  typedef dealii::VectorizedArray<Number> scalar;
+
+  // u = ((a - b) / (a + b))^2
+  scalar const u = (a * (a - 2.0 * b) + b * b) / (a * (a + 2.0 * b) + b * b);
+
+  scalar const threshold = dealii::make_vectorized_array<Number>(1.e-4);
+
+  scalar const series = (a + b) * 52.5 / (105.0 + u * (35.0 + u * (21.0 + u * 15.0)));
+
+  // avoid the evaluation of log(1) = 0 in the denominator for lanes where the series is used
+  scalar const ratio = dealii::compare_and_apply_mask<dealii::SIMDComparison::less_than>(
+    u, threshold, dealii::make_vectorized_array<Number>(2.0), b / a);
+
+  return dealii::compare_and_apply_mask<dealii::SIMDComparison::less_than>(
+    u, threshold, series, (b - a) / std::log(ratio));
+}
+
+/*
+ * This function calculates the kinetic energy and entropy preserving two-point flux by
+ * Ranocha (2018) in direction n (which is not necessarily a unit vector), i.e., the fluxes
+ * of density, momentum, and energy.
+ */
+template<int dim, typename Number>
+inline DEAL_II_ALWAYS_INLINE //
+  std::tuple<dealii::VectorizedArray<Number>,
+             dealii::Tensor<1, dim, dealii::VectorizedArray<Number>>,
+             dealii::VectorizedArray<Number>>
+  calculate_two_point_flux(dealii::VectorizedArray<Number> const &                         rho_1,
+                           dealii::VectorizedArray<Number> const &                         rho_2,
+                           dealii::Tensor<1, dim, dealii::VectorizedArray<Number>> const & u_1,
+                           dealii::Tensor<1, dim, dealii::VectorizedArray<Number>> const & u_2,
+                           dealii::VectorizedArray<Number> const &                         p_1,
+                           dealii::VectorizedArray<Number> const &                         p_2,
+                           dealii::Tensor<1, dim, dealii::VectorizedArray<Number>> const & n,
+                           Number const &                                                  gamma)
+{
+  typedef dealii::VectorizedArray<Number>                         scalar;
+  typedef dealii::Tensor<1, dim, dealii::VectorizedArray<Number>> vector;
+
+  scalar const rho_mean = calculate_logarithmic_mean(rho_1, rho_2);
+  scalar const p_over_rho_mean =
+    1.0 / calculate_logarithmic_mean<Number>(rho_1 / p_1, rho_2 / p_2);
+
+  vector const u_average = 0.5 * (u_1 + u_2);
+  scalar const p_average = 0.5 * (p_1 + p_2);
+
+  scalar const u_n_1 = u_1 * n;
+  scalar const u_n_2 = u_2 * n;
+
+  scalar const flux_density = rho_mean * (u_average * n);
+
+  vector const flux_momentum = flux_density * u_average + p_average * n;
+
+  scalar const flux_energy =
+    flux_density * (0.5 * (u_1 * u_2) + p_over_rho_mean / (gamma - 1.0)) +
+    0.5 * (p_1 * u_n_2 + p_2 * u_n_1);
+
+  return std::make_tuple(flux_density, flux_momentum, flux_energy);
+}
+
+/*
+ * This function calculates the entropy stable numerical flux on faces, i.e., the two-point flux
+ * by Ranocha augmented by Lax-Friedrichs dissipation for the conserved variables.
+ */
+template<int dim, typename Number>
+inline DEAL_II_ALWAYS_INLINE //
+  std::tuple<dealii::VectorizedArray<Number>,
+             dealii::Tensor<1, dim, dealii::VectorizedArray<Number>>,
+             dealii::VectorizedArray<Number>>
+  calculate_entropy_stable_flux(
+    dealii::VectorizedArray<Number> const &                         rho_M,
+    dealii::VectorizedArray<Number> const &                         rho_P,
+    dealii::Tensor<1, dim, dealii::VectorizedArray<Number>> const & u_M,
+    dealii::Tensor<1, dim, dealii::VectorizedArray<Number>> const & u_P,
+    dealii::VectorizedArray<Number> const &                         p_M,
+    dealii::VectorizedArray<Number> const &                         p_P,
+    dealii::VectorizedArray<Number> const &                         rho_E_M,
+    dealii::VectorizedArray<Number> const &                         rho_E_P,
+    dealii::VectorizedArray<Number> const &                         lambda,
+    dealii::Tensor<1, dim, dealii::VectorizedArray<Number>> const & normal,
+    Number const &                                                  gamma)
+{
+  std::tuple<dealii::VectorizedArray<Number>,
+             dealii::Tensor<1, dim, dealii::VectorizedArray<Number>>,
+             dealii::VectorizedArray<Number>>
+    flux = calculate_two_point_flux<dim, Number>(rho_M, rho_P, u_M, u_P, p_M, p_P, normal, gamma);
+
+  std::get<0>(flux) += 0.5 * lambda * (rho_M - rho_P);
+  std::get<1>(flux) += 0.5 * lambda * (rho_M * u_M - rho_P * u_P);
+  std::get<2>(flux) += 0.5 * lambda * (rho_E_M - rho_E_P);
+
+  return flux;
+}
+
 template<int dim>
 struct BodyForceOperatorData
 {
@@ -322,6 +432,10 @@ public:
   {
     this->matrix_free = &matrix_free_in;
     this->data        = data_in;
+
+    rhs_rho_vectorized = get_vectorized_function(data.rhs_rho.get());
+    rhs_u_vectorized   = get_vectorized_function(data.rhs_u.get());
+    rhs_E_vectorized   = get_vectorized_function(data.rhs_E.get());
   }
 
   void
@@ -349,12 +463,18 @@ public:
     scalar rho      = density.get_value(q);
     vector u        = momentum.get_value(q) / rho;
 
-    scalar rhs_density =
-      FunctionEvaluator<0, dim, Number>::value(*(data.rhs_rho), q_points, eval_time);
-    vector rhs_momentum =
-      FunctionEvaluator<1, dim, Number>::value(*(data.rhs_u), q_points, eval_time);
-    scalar rhs_energy =
-      FunctionEvaluator<0, dim, Number>::value(*(data.rhs_E), q_points, eval_time);
+    scalar rhs_density  = FunctionEvaluator<0, dim, Number>::value(*(data.rhs_rho),
+                                                                   rhs_rho_vectorized,
+                                                                   q_points,
+                                                                   eval_time);
+    vector rhs_momentum = FunctionEvaluator<1, dim, Number>::value(*(data.rhs_u),
+                                                                   rhs_u_vectorized,
+                                                                   q_points,
+                                                                   eval_time);
+    scalar rhs_energy   = FunctionEvaluator<0, dim, Number>::value(*(data.rhs_E),
+                                                                   rhs_E_vectorized,
+                                                                   q_points,
+                                                                   eval_time);
 
     return std::make_tuple(rhs_density, rhs_momentum, rhs_momentum * u + rhs_energy);
   }
@@ -399,6 +519,11 @@ private:
 
   BodyForceOperatorData<dim> data;
 
+  // vectorized interfaces of the functions in data (nullptr if not available)
+  VectorizedFunction<dim> const * rhs_rho_vectorized = nullptr;
+  VectorizedFunction<dim> const * rhs_u_vectorized   = nullptr;
+  VectorizedFunction<dim> const * rhs_E_vectorized   = nullptr;
+
   double mutable eval_time;
 };
 
@@ -492,13 +617,21 @@ template<int dim>
 struct ConvectiveOperatorData
 {
   ConvectiveOperatorData()
-    : dof_index(0), quad_index(0), heat_capacity_ratio(1.4), specific_gas_constant(287.0)
+    : dof_index(0),
+      quad_index(0),
+      formulation(FormulationConvectiveTerm::DivergenceForm),
+      heat_capacity_ratio(1.4),
+      specific_gas_constant(287.0)
   {
   }
 
   unsigned int dof_index;
   unsigned int quad_index;
 
+  // in case of the entropy stable split form, quad_index has to refer to the Gauss-Lobatto
+  // quadrature with degree + 1 points (collocation)
+  FormulationConvectiveTerm formulation;
+
   std::shared_ptr<BoundaryDescriptor<dim> const> bc;
 
   double heat_capacity_ratio;
@@ -537,6 +670,9 @@ public:
     gamma = data.heat_capacity_ratio;
     R     = data.specific_gas_constant;
     c_v   = R / (gamma - 1.0);
+
+    if(data.formulation == FormulationConvectiveTerm::EntropyStableSplitForm)
+      setup_split_form();
   }
 
   void
@@ -551,8 +687,16 @@ public:
   {
     this->eval_time = evaluation_time;
 
-    matrix_free->loop(
-      &This::cell_loop, &This::face_loop, &This::boundary_face_loop, this, dst, src);
+    if(data.formulation == FormulationConvectiveTerm::EntropyStableSplitForm)
+    {
+      matrix_free->loop(
+        &This::cell_loop_split_form, &This::face_loop, &This::boundary_face_loop, this, dst, src);
+    }
+    else
+    {
+      matrix_free->loop(
+        &This::cell_loop, &This::face_loop, &This::boundary_face_loop, this, dst, src);
+    }
   }
 
   void
@@ -612,6 +756,12 @@ public:
     // calculate lambda
     scalar lambda = calculate_lambda(rho_M, rho_P, u_M, u_P, p_M, p_P, gamma);
 
+    if(data.formulation == FormulationConvectiveTerm::EntropyStableSplitForm)
+    {
+      return calculate_entropy_stable_flux<dim, Number>(
+        rho_M, rho_P, u_M, u_P, p_M, p_P, rho_E_M, rho_E_P, lambda, normal, gamma);
+    }
+
     // flux density
     scalar flux_density = calculate_flux(rho_u_M, rho_u_P, rho_M, rho_P, lambda, normal);
 
@@ -667,7 +817,8 @@ public:
                                                             boundary_type_density,
                                                             data.bc->density,
                                                             boundary_id,
-                                                            density.quadrature_point(q),
+                                                            density,
+                                                            q,
                                                             this->eval_time);
 
     // calculate u_P
@@ -675,7 +826,8 @@ public:
                                                           boundary_type_velocity,
                                                           data.bc->velocity,
                                                           boundary_id,
-                                                          momentum.quadrature_point(q),
+                                                          momentum,
+                                                          q,
                                                           this->eval_time);
 
     vector rho_u_P = rho_P * u_P;
@@ -685,7 +837,8 @@ public:
                                                           boundary_type_pressure,
                                                           data.bc->pressure,
                                                           boundary_id,
-                                                          density.quadrature_point(q),
+                                                          density,
+                                                          q,
                                                           this->eval_time);
 
     // calculate E_P
@@ -696,7 +849,8 @@ public:
                                                      boundary_type_energy,
                                                      data.bc->energy,
                                                      boundary_id,
-                                                     energy.quadrature_point(q),
+                                                     energy,
+                                                     q,
                                                      this->eval_time);
     }
     else if(boundary_variable == EnergyBoundaryVariable::Temperature)
@@ -706,7 +860,8 @@ public:
                                                             boundary_type_energy,
                                                             data.bc->energy,
                                                             boundary_id,
-                                                            energy.quadrature_point(q),
+                                                            energy,
+                                                            q,
                                                             this->eval_time);
 
       E_P = calculate_energy(T_P, u_P, c_v);
@@ -716,6 +871,12 @@ public:
     // calculate lambda
     scalar lambda = calculate_lambda(rho_M, rho_P, u_M, u_P, p_M, p_P, gamma);
 
+    if(data.formulation == FormulationConvectiveTerm::EntropyStableSplitForm)
+    {
+      return calculate_entropy_stable_flux<dim, Number>(
+        rho_M, rho_P, u_M, u_P, p_M, p_P, rho_E_M, rho_E_P, lambda, normal, gamma);
+    }
+
     // flux density
     scalar flux_density = calculate_flux(rho_u_M, rho_u_P, rho_M, rho_P, lambda, normal);
 
@@ -741,6 +902,59 @@ public:
   }
 
 private:
+  /*
+   * Sets up the skew-symmetric matrix S = Q - Q^T of the one-dimensional summation-by-parts
+   * operator Q_ab = w_a l_b'(x_a) on the Gauss-Lobatto points x_a, where l_b are the Lagrange
+   * polynomials on these points, as well as the quadrature weights.
+   */
+  void
+  setup_split_form()
+  {
+    auto const & shape_data = matrix_free->get_shape_info(data.dof_index, data.quad_index).data[0];
+
+    dealii::Quadrature<1> const & quadrature_1d = shape_data.quadrature;
+
+    unsigned int const n_points_1d = quadrature_1d.size();
+
+    AssertThrow(n_points_1d == shape_data.fe_degree + 1 and
+                  std::abs(quadrature_1d.point(0)[0]) < 1.e-12,
+                dealii::ExcMessage("The entropy stable split form requires the Gauss-Lobatto "
+                                   "quadrature with degree + 1 points (collocation)."));
+
+    std::vector<dealii::Polynomials::Polynomial<double>> const lagrange_basis =
+      dealii::Polynomials::generate_complete_Lagrange_basis(quadrature_1d.get_points());
+
+    std::vector<double> Q(n_points_1d * n_points_1d);
+    std::vector<double> values(2);
+    for(unsigned int a = 0; a < n_points_1d; ++a)
+    {
+      for(unsigned int b = 0; b < n_points_1d; ++b)
+      {
+        lagrange_basis[b].value(quadrature_1d.point(a)[0], values);
+        Q[a * n_points_1d + b] = quadrature_1d.weight(a) * values[1];
+      }
+    }
+
+    skew_matrix_1d.resize(n_points_1d * n_points_1d);
+    for(unsigned int a = 0; a < n_points_1d; ++a)
+      for(unsigned int b = 0; b < n_points_1d; ++b)
+        skew_matrix_1d[a * n_points_1d + b] = Q[a * n_points_1d + b] - Q[b * n_points_1d + a];
+
+    weights_1d.resize(n_points_1d);
+    for(unsigned int a = 0; a < n_points_1d; ++a)
+      weights_1d[a] = quadrature_1d.weight(a);
+
+    // tensor product weights in lexicographic numbering
+    unsigned int const n_q_points = dealii::Utilities::pow(n_points_1d, dim);
+    quadrature_weights.resize(n_q_points);
+    for(unsigned int q = 0; q < n_q_points; ++q)
+    {
+      quadrature_weights[q] = 1.0;
+      for(unsigned int d = 0, stride = 1; d < dim; ++d, stride *= n_points_1d)
+        quadrature_weights[q] *= weights_1d[(q / stride) % n_points_1d];
+    }
+  }
+
   void
   cell_loop(dealii::MatrixFree<dim, Number> const &       matrix_free,
             VectorType &                                  dst,
@@ -777,6 +991,113 @@ private:
     }
   }
 
+  /*
+   * Flux differencing form of the volume term on the collocated Gauss-Lobatto points. Using the
+   * summation-by-parts property, the volume integral of the divergence form is replaced by
+   *
+   *   r_i = sum_d sum_j (Q^d_ij - Q^d_ji) F#(u_i, u_j) * (J a^d_i + J a^d_j) / 2 ,
+   *
+   * where j runs over the points on the same line as point i in direction d, F# is the two-point
+   * flux, and J a^d are the contravariant metric terms. Since S = Q - Q^T is skew-symmetric and
+   * the two-point flux is symmetric, every pair of points is visited only once.
+   */
+  void
+  cell_loop_split_form(dealii::MatrixFree<dim, Number> const &       matrix_free,
+                       VectorType &                                  dst,
+                       VectorType const &                            src,
+                       std::pair<unsigned int, unsigned int> const & cell_range) const
+  {
+    CellIntegratorScalar density(matrix_free, data.dof_index, data.quad_index, 0);
+    CellIntegratorVector momentum(matrix_free, data.dof_index, data.quad_index, 1);
+    CellIntegratorScalar energy(matrix_free, data.dof_index, data.quad_index, 1 + dim);
+
+    unsigned int const n_points_1d = weights_1d.size();
+    unsigned int const n_q_points  = density.n_q_points;
+
+    dealii::AlignedVector<scalar> rho(n_q_points), p(n_q_points);
+    dealii::AlignedVector<vector> u(n_q_points);
+    dealii::AlignedVector<tensor> metric(n_q_points);
+
+    dealii::AlignedVector<scalar> residual_density(n_q_points), residual_energy(n_q_points);
+    dealii::AlignedVector<vector> residual_momentum(n_q_points);
+
+    for(unsigned int cell = cell_range.first; cell < cell_range.second; ++cell)
+    {
+      density.reinit(cell);
+      density.gather_evaluate(src, dealii::EvaluationFlags::values);
+
+      momentum.reinit(cell);
+      momentum.gather_evaluate(src, dealii::EvaluationFlags::values);
+
+      energy.reinit(cell);
+      energy.gather_evaluate(src, dealii::EvaluationFlags::values);
+
+      for(unsigned int q = 0; q < n_q_points; ++q)
+      {
+        rho[q] = density.get_value(q);
+        u[q]   = momentum.get_value(q) / rho[q];
+        p[q]   = calculate_pressure(rho[q], u[q], energy.get_value(q) / rho[q], gamma);
+
+        // contravariant metric terms, J a^d = det(J) * (row d of J^{-1}), where inverse_jacobian()
+        // returns the transposed inverse J^{-T}
+        metric[q] =
+          (density.JxW(q) / quadrature_weights[q]) * transpose(density.inverse_jacobian(q));
+
+        residual_density[q]  = scalar();
+        residual_momentum[q] = vector();
+        residual_energy[q]   = scalar();
+      }
+
+      for(unsigned int d = 0, stride = 1; d < dim; ++d, stride *= n_points_1d)
+      {
+        for(unsigned int i = 0; i < n_q_points; ++i)
+        {
+          unsigned int const a = (i / stride) % n_points_1d;
+
+          // product of the quadrature weights in all directions except d
+          Number const weight = quadrature_weights[i] / weights_1d[a];
+
+          for(unsigned int b = a + 1; b < n_points_1d; ++b)
+          {
+            unsigned int const j = i + (b - a) * stride;
+
+            vector const normal = 0.5 * (metric[i][d] + metric[j][d]);
+
+            std::tuple<scalar, vector, scalar> const flux = calculate_two_point_flux<dim, Number>(
+              rho[i], rho[j], u[i], u[j], p[i], p[j], normal, gamma);
+
+            Number const factor = weight * skew_matrix_1d[a * n_points_1d + b];
+
+            residual_density[i] += factor * std::get<0>(flux);
+            residual_density[j] -= factor * std::get<0>(flux);
+
+            residual_momentum[i] += factor * std::get<1>(flux);
+            residual_momentum[j] -= factor * std::get<1>(flux);
+
+            residual_energy[i] += factor * std::get<2>(flux);
+            residual_energy[j] -= factor * std::get<2>(flux);
+          }
+        }
+      }
+
+      // The residual already contains the integration weights. Since the shape functions are
+      // the identity on the collocation points, dividing by JxW yields the residual after
+      // integration.
+      for(unsigned int q = 0; q < n_q_points; ++q)
+      {
+        scalar const JxW_inv = 1.0 / density.JxW(q);
+
+        density.submit_value(JxW_inv * residual_density[q], q);
+        momentum.submit_value(JxW_inv * residual_momentum[q], q);
+        energy.submit_value(JxW_inv * residual_energy[q], q);
+      }
+
+      density.integrate_scatter(dealii::EvaluationFlags::values, dst);
+      momentum.integrate_scatter(dealii::EvaluationFlags::values, dst);
+      energy.integrate_scatter(dealii::EvaluationFlags::values, dst);
+    }
+  }
+
   void
   face_loop(dealii::MatrixFree<dim, Number> const &       matrix_free,
             VectorType &                                  dst,
@@ -912,6 +1233,12 @@ private:
   Number c_v;
 
   mutable Number eval_time;
+
+  // entropy stable split form: skew-symmetric part of the one-dimensional summation-by-parts
+  // operator and quadrature weights (1D and tensor product) of the collocation points
+  std::vector<Number> skew_matrix_1d;
+  std::vector<Number> weights_1d;
+  std::vector<Number> quadrature_weights;
 };
 
 
@@ -1162,7 +1489,8 @@ public:
                                                             boundary_type_density,
                                                             data.bc->density,
                                                             boundary_id,
-                                                            density.quadrature_point(q),
+                                                            density,
+                                                            q,
                                                             this->eval_time);
 
     scalar jump_density          = rho_M - rho_P;
@@ -1179,7 +1507,8 @@ public:
                                                           boundary_type_velocity,
                                                           data.bc->velocity,
                                                           boundary_id,
-                                                          momentum.quadrature_point(q),
+                                                          momentum,
+                                                          q,
                                                           this->eval_time);
 
     vector rho_u_P = rho_P * u_P;
@@ -1192,7 +1521,8 @@ public:
                                                      boundary_type_velocity,
                                                      data.bc->velocity,
                                                      boundary_id,
-                                                     momentum.quadrature_point(q),
+                                                     momentum,
+                                                     q,
                                                      this->eval_time);
 
     vector jump_momentum          = rho_u_M - rho_u_P;
@@ -1210,7 +1540,8 @@ public:
                                                      boundary_type_energy,
                                                      data.bc->energy,
                                                      boundary_id,
-                                                     energy.quadrature_point(q),
+                                                     energy,
+                                                     q,
                                                      this->eval_time);
     }
     else if(boundary_variable == EnergyBoundaryVariable::Temperature)
@@ -1221,7 +1552,8 @@ public:
                                                             boundary_type_energy,
                                                             data.bc->energy,
                                                             boundary_id,
-                                                            energy.quadrature_point(q),
+                                                            energy,
+                                                            q,
                                                             this->eval_time);
 
       E_P = calculate_energy(T_P, u_P, c_v);
@@ -1238,7 +1570,8 @@ public:
                                                      boundary_type_energy,
                                                      data.bc->energy,
                                                      boundary_id,
-                                                     energy.quadrature_point(q),
+                                                     energy,
+                                                     q,
                                                      this->eval_time);
 
     scalar jump_energy          = rho_E_M - rho_E_P;
@@ -1352,7 +1685,8 @@ public:
                                                             boundary_type_density,
                                                             data.bc->density,
                                                             boundary_id,
-                                                            density.quadrature_point(q),
+                                                            density,
+                                                            q,
                                                             this->eval_time);
 
     scalar rho_inv_M = 1.0 / rho_M;
@@ -1365,7 +1699,8 @@ public:
                                                           boundary_type_velocity,
                                                           data.bc->velocity,
                                                           boundary_id,
-                                                          momentum.quadrature_point(q),
+                                                          momentum,
+                                                          q,
                                                           this->eval_time);
 
     vector rho_u_P = rho_P * u_P;
@@ -1381,7 +1716,8 @@ public:
                                                      boundary_type_energy,
                                                      data.bc->energy,
                                                      boundary_id,
-                                                     energy.quadrature_point(q),
+                                                     energy,
+                                                     q,
                                                      this->eval_time);
     }
     else if(boundary_variable == EnergyBoundaryVariable::Temperature)
@@ -1392,7 +1728,8 @@ public:
                                                             boundary_type_energy,
                                                             data.bc->energy,
                                                             boundary_id,
-                                                            energy.quadrature_point(q),
+                                                            energy,
+                                                            q,
                                                             this->eval_time);
 
       E_P = calculate_energy(T_P, u_P, c_v);
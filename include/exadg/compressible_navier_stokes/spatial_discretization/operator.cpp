@@ -19,15 +19,21 @@
  *  ______________________________________________________________________
  */
 
+// C/C++
+#include <cmath>
+#include <limits>
+
 // deal.II
 #include <deal.II/base/timer.h>
 #include <deal.II/numerics/vector_tools.h>
 
 // ExaDG
+#include <exadg/compressible_navier_stokes/preconditioners/multigrid_preconditioner_viscous.h>
 #include <exadg/compressible_navier_stokes/spatial_discretization/operator.h>
 #include <exadg/operators/finite_element.h>
 #include <exadg/operators/grid_related_time_step_restrictions.h>
 #include <exadg/operators/quadrature.h>
+#include <exadg/solvers_and_preconditioners/preconditioners/inverse_mass_preconditioner.h>
 
 namespace ExaDG
 {
@@ -52,6 +58,9 @@ Operator<dim, Number>::Operator(
     dof_handler(*grid_in->triangulation),
     dof_handler_vector(*grid_in->triangulation),
     dof_handler_scalar(*grid_in->triangulation),
+    norm_solution_linearization_viscous(0.0),
+    time_viscous(0.0),
+    scaling_factor_viscous(1.0),
     mpi_comm(mpi_comm_in),
     pcout(std::cout, dealii::Utilities::MPI::this_mpi_process(mpi_comm_in) == 0),
     wall_time_operator_evaluation(0.0)
@@ -145,28 +154,82 @@ Operator<dim, Number>::fill_matrix_free_data(MatrixFreeData<dim, Number> & matri
   std::shared_ptr<dealii::Quadrature<dim>> quadrature_standard =
     create_quadrature<dim>(param.grid.element_type, param.degree + 1);
   matrix_free_data.insert_quadrature(*quadrature_standard, field + quad_index_standard);
-  std::shared_ptr<dealii::Quadrature<dim>> quadrature_conv =
-    create_quadrature<dim>(param.grid.element_type, n_q_points_conv);
-  matrix_free_data.insert_quadrature(*quadrature_conv, field + quad_index_overintegration_conv);
+  if(param.formulation_convective_term == FormulationConvectiveTerm::EntropyStableSplitForm)
+  {
+    // the split form requires a quadrature rule whose points coincide with the nodes of the
+    // shape functions (Gauss-Lobatto) in order to obtain the summation-by-parts property
+    matrix_free_data.insert_quadrature(dealii::QGaussLobatto<1>(n_q_points_conv),
+                                       field + quad_index_overintegration_conv);
+  }
+  else
+  {
+    std::shared_ptr<dealii::Quadrature<dim>> quadrature_conv =
+      create_quadrature<dim>(param.grid.element_type, n_q_points_conv);
+    matrix_free_data.insert_quadrature(*quadrature_conv, field + quad_index_overintegration_conv);
+  }
   std::shared_ptr<dealii::Quadrature<dim>> quadrature_vis =
     create_quadrature<dim>(param.grid.element_type, n_q_points_vis);
   matrix_free_data.insert_quadrature(*quadrature_vis, field + quad_index_overintegration_vis);
 }
 
+template<int dim, typename Number>
+void
+Operator<dim, Number>::initialize_precomputed_bc()
+{
+  // the boundary kernels are evaluated with the quadrature rules of all operators
+  std::vector<unsigned int> quad_indices;
+  quad_indices.emplace_back(get_quad_index_standard());
+  quad_indices.emplace_back(get_quad_index_overintegration_conv());
+  quad_indices.emplace_back(get_quad_index_overintegration_vis());
+
+  std::array<BoundaryDescriptorStd<dim> const *, 4> const descriptors = {
+    {&boundary_descriptor->density,
+     &boundary_descriptor->velocity,
+     &boundary_descriptor->pressure,
+     &boundary_descriptor->energy}};
+
+  for(unsigned int i = 0; i < descriptors.size(); ++i)
+  {
+    // resolve the vectorized interface of the boundary functions
+    descriptors[i]->set_vectorized_functions();
+
+    if(not(descriptors[i]->precomputed_bc.empty()))
+    {
+      // the tabulation only depends on the quadrature points, i.e., the scalar DoFHandler can be
+      // used for all variables
+      precomputed_data[i] = std::make_shared<PrecomputedBoundaryData<dim>>();
+      precomputed_data[i]->setup(*matrix_free,
+                                 get_dof_index_scalar(),
+                                 quad_indices,
+                                 descriptors[i]->get_precomputed_functions());
+
+      descriptors[i]->set_precomputed_data(precomputed_data[i]);
+    }
+  }
+}
+
 template<int dim, typename Number>
 void
 Operator<dim, Number>::setup_operators()
 {
+  // In case of the entropy stable split form, the mass matrix is evaluated with the collocated
+  // Gauss-Lobatto quadrature of the convective term (diagonal mass matrix), i.e., the norm
+  // associated to the summation-by-parts operator.
+  unsigned int const quad_index_mass =
+    param.formulation_convective_term == FormulationConvectiveTerm::EntropyStableSplitForm ?
+      get_quad_index_overintegration_conv() :
+      get_quad_index_standard();
+
   // mass operator
   MassOperatorData mass_operator_data;
   mass_operator_data.dof_index  = get_dof_index_all();
-  mass_operator_data.quad_index = get_quad_index_standard();
+  mass_operator_data.quad_index = quad_index_mass;
   mass_operator.initialize(*matrix_free, mass_operator_data);
 
   // inverse mass operator
   InverseMassOperatorData inverse_mass_operator_data_all;
   inverse_mass_operator_data_all.dof_index  = get_dof_index_all();
-  inverse_mass_operator_data_all.quad_index = get_quad_index_standard();
+  inverse_mass_operator_data_all.quad_index = quad_index_mass;
   inverse_mass_operator_data_all.parameters = param.inverse_mass_operator;
   inverse_mass_all.initialize(*matrix_free, inverse_mass_operator_data_all);
 
@@ -195,6 +258,7 @@ Operator<dim, Number>::setup_operators()
   ConvectiveOperatorData<dim> convective_operator_data;
   convective_operator_data.dof_index             = get_dof_index_all();
   convective_operator_data.quad_index            = get_quad_index_overintegration_conv();
+  convective_operator_data.formulation           = param.formulation_convective_term;
   convective_operator_data.bc                    = boundary_descriptor;
   convective_operator_data.heat_capacity_ratio   = param.heat_capacity_ratio;
   convective_operator_data.specific_gas_constant = param.specific_gas_constant;
@@ -252,6 +316,96 @@ Operator<dim, Number>::setup_operators()
                                    get_quad_index_standard());
 }
 
+template<int dim, typename Number>
+void
+Operator<dim, Number>::setup_solver_viscous()
+{
+  // preconditioner
+  if(param.preconditioner_viscous == PreconditionerViscous::InverseMassMatrix)
+  {
+    InverseMassOperatorData inverse_mass_operator_data;
+    inverse_mass_operator_data.dof_index  = get_dof_index_all();
+    inverse_mass_operator_data.quad_index = get_quad_index_standard();
+    inverse_mass_operator_data.parameters = param.inverse_mass_operator;
+
+    preconditioner_viscous =
+      std::make_shared<InverseMassPreconditioner<dim, dim + 2, Number>>(*matrix_free,
+                                                                        inverse_mass_operator_data);
+  }
+  else if(param.preconditioner_viscous == PreconditionerViscous::Multigrid)
+  {
+    // Only p-multigrid is supported, i.e. the fine-level mapping can be used on all levels.
+    std::shared_ptr<dealii::Mapping<dim>> mapping_multigrid =
+      std::const_pointer_cast<dealii::Mapping<dim>>(mapping);
+    multigrid_mappings =
+      std::make_shared<MultigridMappings<dim, Number>>(mapping_multigrid, mapping_multigrid);
+
+    // specific heat at constant volume
+    double const c_v = param.specific_gas_constant / (param.heat_capacity_ratio - 1.0);
+
+    MultigridPreconditionerViscousData<dim> mg_data;
+    mg_data.dof_index_all       = get_dof_index_all();
+    mg_data.dof_index_scalar    = get_dof_index_scalar();
+    mg_data.quad_index          = get_quad_index_standard();
+    mg_data.IP_factor           = param.IP_factor;
+    mg_data.kinematic_viscosity = param.dynamic_viscosity / param.reference_density;
+    mg_data.thermal_diffusivity = param.thermal_conductivity / (param.reference_density * c_v);
+    mg_data.multigrid_data      = param.multigrid_data_viscous;
+    mg_data.bc                  = boundary_descriptor;
+
+    std::shared_ptr<MultigridPreconditionerViscous<dim, Number>> mg_preconditioner =
+      std::make_shared<MultigridPreconditionerViscous<dim, Number>>(mpi_comm);
+    mg_preconditioner->initialize(
+      mg_data, *matrix_free, constraint, grid, multigrid_mappings, *fe_scalar);
+
+    preconditioner_viscous = mg_preconditioner;
+  }
+  else
+  {
+    AssertThrow(param.preconditioner_viscous == PreconditionerViscous::None,
+                dealii::ExcMessage("Specified preconditioner is not implemented!"));
+  }
+
+  // linear solver
+  linear_operator_viscous.initialize(*this);
+
+  Krylov::SolverDataGMRES solver_data;
+  solver_data.max_iter             = param.solver_data_viscous.max_iter;
+  solver_data.solver_tolerance_abs = param.solver_data_viscous.abs_tol;
+  solver_data.solver_tolerance_rel = param.solver_data_viscous.rel_tol;
+  solver_data.max_n_tmp_vectors    = param.solver_data_viscous.max_krylov_size;
+  solver_data.n_recycle_vectors    = param.solver_data_viscous.n_recycle_vectors;
+
+  if(param.preconditioner_viscous != PreconditionerViscous::None)
+    solver_data.use_preconditioner = true;
+
+  typedef Krylov::
+    SolverGMRES<LinearOperatorViscous<dim, Number>, PreconditionerBase<Number>, VectorType>
+      SolverGMRES;
+
+  linear_solver_viscous = std::make_shared<SolverGMRES>(linear_operator_viscous,
+                                                        *preconditioner_viscous,
+                                                        solver_data,
+                                                        mpi_comm);
+
+  // Newton solver
+  nonlinear_operator_viscous.initialize(*this);
+
+  newton_solver_viscous = std::make_shared<Newton::Solver<VectorType,
+                                                          NonlinearOperatorViscous<dim, Number>,
+                                                          LinearOperatorViscous<dim, Number>,
+                                                          Krylov::SolverBase<VectorType>>>(
+    param.newton_solver_data_viscous,
+    nonlinear_operator_viscous,
+    linear_operator_viscous,
+    *linear_solver_viscous);
+
+  initialize_dof_vector(solution_linearization_viscous);
+  initialize_dof_vector(viscous_term_linearization);
+  initialize_dof_vector(temp_viscous);
+  initialize_dof_vector(viscous_term_perturbed);
+}
+
 template<int dim, typename Number>
 void
 Operator<dim, Number>::setup()
@@ -286,8 +440,14 @@ Operator<dim, Number>::setup(std::shared_ptr<dealii::MatrixFree<dim, Number> con
   matrix_free_data = matrix_free_data_in;
 
   // perform setup of data structures that depend on matrix-free object
+  initialize_precomputed_bc();
+
   setup_operators();
 
+  // setup solvers in case the viscous term is treated implicitly
+  if(param.temporal_discretization == TemporalDiscretization::IMEXRK)
+    setup_solver_viscous();
+
   pcout << std::endl << "... done!" << std::endl;
 }
 
@@ -427,6 +587,135 @@ Operator<dim, Number>::apply_inverse_mass(VectorType & dst, VectorType const & s
   inverse_mass_all.apply(dst, src);
 }
 
+template<int dim, typename Number>
+void
+Operator<dim, Number>::evaluate_explicit_part(VectorType &       dst,
+                                              VectorType const & src,
+                                              Number const       time) const
+{
+  dealii::Timer timer;
+  timer.restart();
+
+  convective_operator.evaluate(dst, src, time);
+
+  // shift convective term to the right-hand side of the equation
+  dst *= -1.0;
+
+  // body force term
+  if(param.right_hand_side == true)
+  {
+    body_force_operator.evaluate_add(dst, src, time);
+  }
+
+  // apply inverse mass operator
+  inverse_mass_all.apply(dst, dst);
+
+  wall_time_operator_evaluation += timer.wall_time();
+}
+
+template<int dim, typename Number>
+void
+Operator<dim, Number>::evaluate_implicit_part(VectorType &       dst,
+                                              VectorType const & src,
+                                              Number const       time) const
+{
+  dealii::Timer timer;
+  timer.restart();
+
+  viscous_operator.evaluate(dst, src, time);
+
+  // shift viscous term to the right-hand side of the equation
+  dst *= -1.0;
+
+  // apply inverse mass operator
+  inverse_mass_all.apply(dst, dst);
+
+  wall_time_operator_evaluation += timer.wall_time();
+}
+
+template<int dim, typename Number>
+std::tuple<unsigned int, unsigned int>
+Operator<dim, Number>::solve_implicit_part(VectorType &       dst,
+                                           VectorType const & rhs,
+                                           Number const       time,
+                                           double const       scaling_factor)
+{
+  time_viscous           = time;
+  scaling_factor_viscous = scaling_factor;
+
+  // The multigrid preconditioner only depends on the scaling factor and needs to be updated only
+  // if the scaling factor changes, see PreconditionerBase::needs_update().
+  if(param.preconditioner_viscous == PreconditionerViscous::Multigrid)
+  {
+    std::shared_ptr<MultigridPreconditionerViscous<dim, Number>> mg_preconditioner =
+      std::dynamic_pointer_cast<MultigridPreconditionerViscous<dim, Number>>(
+        preconditioner_viscous);
+
+    mg_preconditioner->set_scaling_factor_viscous_operator(scaling_factor);
+  }
+
+  nonlinear_operator_viscous.update(rhs, time, scaling_factor);
+
+  Newton::UpdateData update;
+  update.do_update = false;
+
+  return newton_solver_viscous->solve(dst, update);
+}
+
+template<int dim, typename Number>
+void
+Operator<dim, Number>::evaluate_nonlinear_residual_viscous(VectorType &       dst,
+                                                           VectorType const & src,
+                                                           VectorType const & rhs,
+                                                           double const       time,
+                                                           double const       scaling_factor) const
+{
+  temp_viscous.equ(1.0, src);
+  temp_viscous.add(-1.0, rhs);
+  mass_operator.apply(dst, temp_viscous);
+
+  viscous_operator.evaluate(temp_viscous, src, time);
+  dst.add(scaling_factor, temp_viscous);
+}
+
+template<int dim, typename Number>
+void
+Operator<dim, Number>::set_solution_linearization_viscous(
+  VectorType const & solution_linearization) const
+{
+  solution_linearization_viscous      = solution_linearization;
+  norm_solution_linearization_viscous = solution_linearization_viscous.l2_norm();
+
+  viscous_operator.evaluate(viscous_term_linearization,
+                            solution_linearization_viscous,
+                            time_viscous);
+}
+
+template<int dim, typename Number>
+void
+Operator<dim, Number>::apply_linearized_viscous(VectorType & dst, VectorType const & src) const
+{
+  mass_operator.apply(dst, src);
+
+  double const norm_src = src.l2_norm();
+
+  if(norm_src > 0.0)
+  {
+    // step size of the finite difference approximation
+    double const eps = std::sqrt(std::numeric_limits<Number>::epsilon()) *
+                       (1.0 + norm_solution_linearization_viscous) / norm_src;
+
+    temp_viscous.equ(1.0, solution_linearization_viscous);
+    temp_viscous.add(eps, src);
+
+    // inhomogeneous boundary data cancels out in the difference
+    viscous_operator.evaluate(viscous_term_perturbed, temp_viscous, time_viscous);
+    viscous_term_perturbed.add(-1.0, viscous_term_linearization);
+
+    dst.add(scaling_factor_viscous / eps, viscous_term_perturbed);
+  }
+}
+
 template<int dim, typename Number>
 dealii::MatrixFree<dim, Number> const &
 Operator<dim, Number>::get_matrix_free() const
@@ -38,11 +38,116 @@
 #include <exadg/matrix_free/matrix_free_data.h>
 #include <exadg/operators/inverse_mass_operator.h>
 #include <exadg/operators/navier_stokes_calculators.h>
+#include <exadg/solvers_and_preconditioners/newton/newton_solver.h>
+#include <exadg/solvers_and_preconditioners/preconditioners/preconditioner_base.h>
+#include <exadg/solvers_and_preconditioners/solvers/iterative_solvers_dealii_wrapper.h>
 
 namespace ExaDG
 {
 namespace CompNS
 {
+// forward declaration
+template<int dim, typename Number>
+class Operator;
+
+/*
+ * Nonlinear operator of an implicit stage of IMEX Runge-Kutta methods, see
+ * Operator::evaluate_nonlinear_residual_viscous().
+ */
+template<int dim, typename Number>
+class NonlinearOperatorViscous
+{
+private:
+  typedef dealii::LinearAlgebra::distributed::Vector<Number> VectorType;
+
+  typedef Operator<dim, Number> PDEOperator;
+
+public:
+  NonlinearOperatorViscous()
+    : pde_operator(nullptr), rhs_vector(nullptr), time(0.0), scaling_factor_viscous(1.0)
+  {
+  }
+
+  void
+  initialize(PDEOperator const & pde_operator)
+  {
+    this->pde_operator = &pde_operator;
+  }
+
+  void
+  update(VectorType const & rhs_vector, double const & time, double const & scaling_factor)
+  {
+    this->rhs_vector             = &rhs_vector;
+    this->time                   = time;
+    this->scaling_factor_viscous = scaling_factor;
+  }
+
+  /*
+   * The implementation of the Newton solver requires a function called
+   * 'evaluate_residual'.
+   */
+  void
+  evaluate_residual(VectorType & dst, VectorType const & src) const
+  {
+    pde_operator->evaluate_nonlinear_residual_viscous(
+      dst, src, *rhs_vector, time, scaling_factor_viscous);
+  }
+
+private:
+  PDEOperator const * pde_operator;
+
+  VectorType const * rhs_vector;
+  double             time;
+  double             scaling_factor_viscous;
+};
+
+/*
+ * Linearized operator of an implicit stage of IMEX Runge-Kutta methods, see
+ * Operator::apply_linearized_viscous().
+ */
+template<int dim, typename Number>
+class LinearOperatorViscous : public dealii::Subscriptor
+{
+private:
+  typedef dealii::LinearAlgebra::distributed::Vector<Number> VectorType;
+
+  typedef Operator<dim, Number> PDEOperator;
+
+public:
+  LinearOperatorViscous() : dealii::Subscriptor(), pde_operator(nullptr)
+  {
+  }
+
+  void
+  initialize(PDEOperator const & pde_operator)
+  {
+    this->pde_operator = &pde_operator;
+  }
+
+  /*
+   * The implementation of the Newton solver requires a function called
+   * 'set_solution_linearization'.
+   */
+  void
+  set_solution_linearization(VectorType const & solution_linearization) const
+  {
+    pde_operator->set_solution_linearization_viscous(solution_linearization);
+  }
+
+  /*
+   * The implementation of linear solvers in deal.ii requires that a function called 'vmult' is
+   * provided.
+   */
+  void
+  vmult(VectorType & dst, VectorType const & src) const
+  {
+    pde_operator->apply_linearized_viscous(dst, src);
+  }
+
+private:
+  PDEOperator const * pde_operator;
+};
+
 template<int dim, typename Number>
 class Operator : public dealii::Subscriptor, public Interface::Operator<Number>
 {
@@ -117,6 +222,52 @@ public:
   void
   apply_inverse_mass(VectorType & dst, VectorType const & src) const;
 
+  /*
+   *  The following functions are used in case of IMEX Runge-Kutta methods, where the convective
+   *  term and the body force term are treated explicitly and the viscous term implicitly.
+   */
+  void
+  evaluate_explicit_part(VectorType &       dst,
+                         VectorType const & src,
+                         Number const       time) const final;
+
+  void
+  evaluate_implicit_part(VectorType &       dst,
+                         VectorType const & src,
+                         Number const       time) const final;
+
+  std::tuple<unsigned int, unsigned int>
+  solve_implicit_part(VectorType &       dst,
+                      VectorType const & rhs,
+                      Number const       time,
+                      double const       scaling_factor) final;
+
+  /*
+   * Residual of the nonlinear problem of an implicit stage, i.e. the equation
+   * src - scaling_factor * f_implicit(src) = rhs multiplied by the mass matrix:
+   *
+   *   dst = M * (src - rhs) + scaling_factor * V(src)
+   */
+  void
+  evaluate_nonlinear_residual_viscous(VectorType &       dst,
+                                      VectorType const & src,
+                                      VectorType const & rhs,
+                                      double const       time,
+                                      double const       scaling_factor) const;
+
+  void
+  set_solution_linearization_viscous(VectorType const & solution_linearization) const;
+
+  /*
+   * Jacobian-free application of the linearized problem of an implicit stage,
+   *
+   *   dst = M * src + scaling_factor * (V(u + eps * src) - V(u)) / eps ,
+   *
+   * where u denotes the linearization point.
+   */
+  void
+  apply_linearized_viscous(VectorType & dst, VectorType const & src) const;
+
   // getters
   dealii::MatrixFree<dim, Number> const &
   get_matrix_free() const;
@@ -136,6 +287,9 @@ public:
   dealii::DoFHandler<dim> const &
   get_dof_handler_vector() const;
 
+  unsigned int
+  get_dof_index_all() const;
+
   unsigned int
   get_dof_index_vector() const;
 
@@ -184,11 +338,14 @@ private:
   void
   initialize_dof_handler_and_constraints();
 
+  void
+  initialize_precomputed_bc();
+
   void
   setup_operators();
 
-  unsigned int
-  get_dof_index_all() const;
+  void
+  setup_solver_viscous();
 
   unsigned int
   get_quad_index_overintegration_conv() const;
@@ -258,6 +415,11 @@ private:
   std::shared_ptr<MatrixFreeData<dim, Number> const>     matrix_free_data;
   std::shared_ptr<dealii::MatrixFree<dim, Number> const> matrix_free;
 
+  /*
+   * Precomputed boundary data (density, velocity, pressure, energy).
+   */
+  std::array<std::shared_ptr<PrecomputedBoundaryData<dim>>, 4> precomputed_data;
+
   /*
    * Basic operators.
    */
@@ -275,6 +437,31 @@ private:
   InverseMassOperator<dim, dim, Number>     inverse_mass_vector;
   InverseMassOperator<dim, 1, Number>       inverse_mass_scalar;
 
+  /*
+   * Implicit treatment of the viscous term (IMEX Runge-Kutta methods).
+   */
+  std::shared_ptr<MultigridMappings<dim, Number>> multigrid_mappings;
+
+  NonlinearOperatorViscous<dim, Number> nonlinear_operator_viscous;
+  LinearOperatorViscous<dim, Number>    linear_operator_viscous;
+
+  std::shared_ptr<PreconditionerBase<Number>>     preconditioner_viscous;
+  std::shared_ptr<Krylov::SolverBase<VectorType>> linear_solver_viscous;
+
+  std::shared_ptr<Newton::Solver<VectorType,
+                                 NonlinearOperatorViscous<dim, Number>,
+                                 LinearOperatorViscous<dim, Number>,
+                                 Krylov::SolverBase<VectorType>>>
+    newton_solver_viscous;
+
+  // linearization point and viscous operator evaluated at the linearization point
+  mutable VectorType solution_linearization_viscous, viscous_term_linearization;
+  mutable double     norm_solution_linearization_viscous;
+  mutable VectorType temp_viscous, viscous_term_perturbed;
+
+  double time_viscous;
+  double scaling_factor_viscous;
+
   // L2 projections to calculate derived quantities
   p_u_T_Calculator<dim, Number>     p_u_T_calculator;
   VorticityCalculator<dim, Number>  vorticity_calculator;
@@ -19,6 +19,10 @@
  *  ______________________________________________________________________
  */
 
+// C/C++
+#include <limits>
+
+// ExaDG
 #include <exadg/compressible_navier_stokes/postprocessor/postprocessor_base.h>
 #include <exadg/compressible_navier_stokes/spatial_discretization/interface.h>
 #include <exadg/compressible_navier_stokes/time_integration/time_int_explicit_runge_kutta.h>
@@ -48,6 +52,7 @@ TimeIntExplRK<Number>::TimeIntExplRK(
     param(param_in),
     refine_steps_time(param_in.n_refine_time),
     postprocessor(postprocessor_in),
+    iterations({0, {0, 0}}),
     l2_norm(0.0),
     cfl_number(param.cfl_number / std::pow(2.0, refine_steps_time)),
     diffusion_number(param.diffusion_number / std::pow(2.0, refine_steps_time))
@@ -98,6 +103,11 @@ TimeIntExplRK<Number>::initialize_time_integrator()
                                                                        param.order_time_integrator,
                                                                        param.stages);
   }
+  else if(this->param.temporal_discretization == TemporalDiscretization::IMEXRK)
+  {
+    imex_time_integrator = std::make_shared<IMEXRungeKuttaTimeIntegrator<Operator, VectorType>>(
+      param.order_time_integrator, pde_operator);
+  }
 }
 
 /*
@@ -241,18 +251,66 @@ TimeIntExplRK<Number>::do_timestep_solve()
   dealii::Timer timer;
   timer.restart();
 
-  rk_time_integrator->solve_timestep(this->solution_np,
-                                     this->solution_n,
-                                     this->time,
-                                     this->time_step);
+  if(param.temporal_discretization == TemporalDiscretization::IMEXRK)
+  {
+    imex_time_integrator->solve_timestep(this->solution_np,
+                                         this->solution_n,
+                                         this->time,
+                                         this->time_step);
+
+    std::tuple<unsigned int, unsigned int> const iter = imex_time_integrator->get_iterations();
+
+    iterations.first += 1;
+    std::get<0>(iterations.second) += std::get<0>(iter);
+    std::get<1>(iterations.second) += std::get<1>(iter);
+
+    if(print_solver_info() and not(this->is_test))
+    {
+      this->pcout << std::endl << "Solve compressible Navier-Stokes equations (IMEX):";
+      print_solver_info_nonlinear(this->pcout,
+                                  std::get<0>(iter),
+                                  std::get<1>(iter),
+                                  timer.wall_time());
+    }
 
-  if(print_solver_info() and not(this->is_test))
+    this->timer_tree->insert({"Timeloop", "Solve-IMEX"}, timer.wall_time());
+  }
+  else
   {
-    this->pcout << std::endl << "Solve compressible Navier-Stokes equations explicitly:";
-    print_wall_time(this->pcout, timer.wall_time());
+    rk_time_integrator->solve_timestep(this->solution_np,
+                                       this->solution_n,
+                                       this->time,
+                                       this->time_step);
+
+    if(print_solver_info() and not(this->is_test))
+    {
+      this->pcout << std::endl << "Solve compressible Navier-Stokes equations explicitly:";
+      print_wall_time(this->pcout, timer.wall_time());
+    }
+
+    this->timer_tree->insert({"Timeloop", "Solve-explicit"}, timer.wall_time());
   }
+}
+
+template<typename Number>
+void
+TimeIntExplRK<Number>::print_iterations() const
+{
+  std::vector<std::string> names = {"Nonlinear iterations",
+                                    "Linear iterations (accumulated)",
+                                    "Linear iterations (per nonlinear it.)"};
+
+  std::vector<double> iterations_avg(3);
+  iterations_avg[0] =
+    (double)std::get<0>(iterations.second) / std::max(1., (double)iterations.first);
+  iterations_avg[1] =
+    (double)std::get<1>(iterations.second) / std::max(1., (double)iterations.first);
+  if(iterations_avg[0] > std::numeric_limits<double>::min())
+    iterations_avg[2] = iterations_avg[1] / iterations_avg[0];
+  else
+    iterations_avg[2] = iterations_avg[1];
 
-  this->timer_tree->insert({"Timeloop", "Solve-explicit"}, timer.wall_time());
+  print_list_of_iterations(this->pcout, names, iterations_avg);
 }
 
 template<typename Number>
@@ -264,6 +322,22 @@ TimeIntExplRK<Number>::print_solver_info() const
                                       this->time_step_number);
 }
 
+template<typename Number>
+std::vector<std::pair<std::string, unsigned long long>>
+TimeIntExplRK<Number>::get_accumulated_iterations() const
+{
+  // iterations are only relevant for the implicit stages of IMEX Runge-Kutta methods
+  if(imex_time_integrator.get())
+  {
+    return {{"Nonlinear iterations", std::get<0>(iterations.second)},
+            {"Linear iterations", std::get<1>(iterations.second)}};
+  }
+  else
+  {
+    return {};
+  }
+}
+
 // instantiations
 template class TimeIntExplRK<float>;
 template class TimeIntExplRK<double>;
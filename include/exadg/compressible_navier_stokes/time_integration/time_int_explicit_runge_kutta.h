@@ -28,6 +28,7 @@
 
 // ExaDG
 #include <exadg/time_integration/explicit_runge_kutta.h>
+#include <exadg/time_integration/imex_runge_kutta.h>
 #include <exadg/time_integration/ssp_runge_kutta.h>
 #include <exadg/time_integration/time_int_explicit_runge_kutta_base.h>
 
@@ -64,6 +65,12 @@ public:
   void
   get_wall_times(std::vector<std::string> & name, std::vector<double> & wall_time) const;
 
+  /*
+   * Prints the average number of iterations of the implicit stages (IMEX Runge-Kutta methods).
+   */
+  void
+  print_iterations() const;
+
 private:
   void
   initialize_time_integrator() final;
@@ -83,6 +90,9 @@ private:
   void
   do_timestep_solve() final;
 
+  std::vector<std::pair<std::string, unsigned long long>>
+  get_accumulated_iterations() const final;
+
   bool
   print_solver_info() const final;
 
@@ -111,12 +121,21 @@ private:
 
   std::shared_ptr<ExplicitTimeIntegrator<Operator, VectorType>> rk_time_integrator;
 
+  // IMEX Runge-Kutta methods (implicit treatment of the viscous term)
+  std::shared_ptr<IMEXRungeKuttaTimeIntegrator<Operator, VectorType>> imex_time_integrator;
+
   Parameters const & param;
 
   unsigned int const refine_steps_time;
 
   std::shared_ptr<PostProcessorInterface<Number>> postprocessor;
 
+  // iteration counts of the implicit stages (IMEX Runge-Kutta methods)
+  std::pair<
+    unsigned int /* number of calls */,
+    std::tuple<unsigned long long, unsigned long long> /* iteration counts {Newton, linear}*/>
+    iterations;
+
   // monitor the L2-norm of the solution vector in order to detect instabilities
   mutable double l2_norm;
 
@@ -30,6 +30,7 @@
 
 // ExaDG
 #include <exadg/compressible_navier_stokes/user_interface/parameters.h>
+#include <exadg/functions_and_boundary_conditions/precomputed_boundary_data.h>
 #include <exadg/functions_and_boundary_conditions/verify_boundary_conditions.h>
 
 namespace ExaDG
@@ -44,7 +45,7 @@ enum class BoundaryType
 };
 
 template<int dim>
-struct BoundaryDescriptorStd
+struct BoundaryDescriptorStd : public PrecomputedBoundaryConditions<dim>
 {
   std::map<dealii::types::boundary_id, std::shared_ptr<dealii::Function<dim>>> dirichlet_bc;
   std::map<dealii::types::boundary_id, std::shared_ptr<dealii::Function<dim>>> neumann_bc;
@@ -83,6 +84,23 @@ struct BoundaryDescriptorStd
     AssertThrow(counter == 1,
                 dealii::ExcMessage("Boundary face with non-unique boundary type found."));
   }
+
+  // returns the boundary functions of all boundary IDs in precomputed_bc, which need to be part
+  // of dirichlet_bc or neumann_bc
+  std::map<dealii::types::boundary_id, std::shared_ptr<dealii::Function<dim>>>
+  get_precomputed_functions() const
+  {
+    return this->collect_precomputed_functions({&dirichlet_bc, &neumann_bc},
+                                               "dirichlet_bc or neumann_bc");
+  }
+
+  // resolves the vectorized interface of the boundary functions evaluated by
+  // evaluate_boundary_function() once per boundary ID
+  void
+  set_vectorized_functions() const
+  {
+    this->resolve_vectorized_functions({&dirichlet_bc, &neumann_bc});
+  }
 };
 
 template<int dim>
@@ -75,6 +75,9 @@ enum class EnergyBoundaryVariable
  *  Temporal discretization method:
  *
  *    Explicit Runge-Kutta methods
+ *
+ *    IMEX Runge-Kutta methods: additive Runge-Kutta methods treating the convective term
+ *    (and the body force) explicitly and the viscous term implicitly
  */
 enum class TemporalDiscretization
 {
@@ -86,7 +89,8 @@ enum class TemporalDiscretization
   ExplRK4Stage8Reg2, // optimized for maximum time step sizes in DG context
   ExplRK4Stage5Reg3C,
   ExplRK5Stage9Reg2S,
-  SSPRK // specify order and stages of time integration scheme
+  SSPRK, // specify order and stages of time integration scheme
+  IMEXRK // specify order of time integration scheme (1, 2, or 3)
 };
 
 /*
@@ -117,6 +121,24 @@ enum class QuadratureRule
   Overintegration2k
 };
 
+/*
+ *  Formulation of the convective term
+ *
+ *    DivergenceForm: standard discretization of the convective term in divergence form,
+ *    integrated with the quadrature rule specified by QuadratureRule
+ *
+ *    EntropyStableSplitForm: collocated discretization on the Gauss-Lobatto points (summation-
+ *    by-parts property) using flux differencing with the kinetic energy and entropy preserving
+ *    two-point flux by Ranocha in the volume and the same two-point flux augmented by
+ *    Lax-Friedrichs dissipation on the faces. This formulation is robust for under-resolved
+ *    flows without over-integration of the convective term.
+ */
+enum class FormulationConvectiveTerm
+{
+  DivergenceForm,
+  EntropyStableSplitForm
+};
+
 
 /**************************************************************************************/
 /*                                                                                    */
@@ -124,6 +146,19 @@ enum class QuadratureRule
 /*                                                                                    */
 /**************************************************************************************/
 
+/*
+ *  Preconditioner for the linearized viscous problem (IMEX Runge-Kutta methods)
+ *
+ *    Multigrid: the scalar reaction-diffusion multigrid preconditioner of the
+ *    convection-diffusion module is applied to each momentum component and to the energy
+ *    component, the inverse mass operator is applied to the density component
+ */
+enum class PreconditionerViscous
+{
+  None,
+  InverseMassMatrix,
+  Multigrid
+};
 
 
 /**************************************************************************************/
@@ -71,14 +71,23 @@ Parameters::Parameters()
     degree(1),
     n_q_points_convective(QuadratureRule::Standard),
     n_q_points_viscous(QuadratureRule::Standard),
+    formulation_convective_term(FormulationConvectiveTerm::DivergenceForm),
 
     // viscous term
     IP_factor(1.0),
 
+    // SOLVER
+    newton_solver_data_viscous(Newton::SolverData(1e2, 1.e-12, 1.e-6)),
+    solver_data_viscous(SolverData(1e3, 1.e-12, 1.e-3, 30)),
+    preconditioner_viscous(PreconditionerViscous::Multigrid),
+    multigrid_data_viscous(MultigridData()),
+
     // NUMERICAL PARAMETERS
     detect_instabilities(true),
     use_combined_operator(false)
 {
+  // the triangulation is not set up with a multigrid hierarchy
+  multigrid_data_viscous.type = MultigridType::pMG;
 }
 
 void
@@ -114,6 +123,26 @@ Parameters::check() const
     AssertThrow(stages >= 1, dealii::ExcMessage("Specify number of RK stages!"));
   }
 
+  if(temporal_discretization == TemporalDiscretization::IMEXRK)
+  {
+    AssertThrow(order_time_integrator >= 1 and order_time_integrator <= 3,
+                dealii::ExcMessage("Specified order of time integrator IMEXRK not implemented!"));
+
+    AssertThrow(equation_type == EquationType::NavierStokes,
+                dealii::ExcMessage("IMEX Runge-Kutta methods require a viscous term, i.e. "
+                                   "EquationType::NavierStokes."));
+
+    AssertThrow(not use_combined_operator,
+                dealii::ExcMessage("IMEX Runge-Kutta methods evaluate the convective term and the "
+                                   "viscous term separately, set use_combined_operator = false."));
+
+    AssertThrow(calculation_of_time_step_size == TimeStepCalculation::UserSpecified or
+                  calculation_of_time_step_size == TimeStepCalculation::CFL,
+                dealii::ExcMessage("The viscous term is treated implicitly for IMEX Runge-Kutta "
+                                   "methods, i.e. the time step size is restricted by the CFL "
+                                   "condition only."));
+  }
+
   if(calculation_of_time_step_size == TimeStepCalculation::CFLAndDiffusion)
   {
     AssertThrow(max_velocity >= 0.0, dealii::ExcMessage("Invalid parameter max_velocity."));
@@ -135,6 +164,32 @@ Parameters::check() const
         "For the combined operator, both convective and viscous terms have to be integrated with the same number of quadrature points."));
   }
 
+  if(formulation_convective_term == FormulationConvectiveTerm::EntropyStableSplitForm)
+  {
+    AssertThrow(grid.element_type == ElementType::Hypercube,
+                dealii::ExcMessage("The entropy stable split form of the convective term is only "
+                                   "implemented for hypercube elements."));
+
+    AssertThrow(n_q_points_convective == QuadratureRule::Standard,
+                dealii::ExcMessage("The entropy stable split form of the convective term uses "
+                                   "the collocated Gauss-Lobatto quadrature with degree + 1 points "
+                                   "and does not require over-integration. Set "
+                                   "n_q_points_convective = QuadratureRule::Standard."));
+
+    AssertThrow(not use_combined_operator,
+                dealii::ExcMessage("The entropy stable split form of the convective term is not "
+                                   "implemented for the combined operator."));
+  }
+
+  // SOLVER
+  if(temporal_discretization == TemporalDiscretization::IMEXRK and
+     preconditioner_viscous == PreconditionerViscous::Multigrid)
+  {
+    AssertThrow(not multigrid_data_viscous.involves_h_transfer(),
+                dealii::ExcMessage("The multigrid preconditioner for the viscous problem does not "
+                                   "support h-transfers. Use p-multigrid instead."));
+  }
+
   // NUMERICAL PARAMETERS
 }
 
@@ -157,8 +212,9 @@ Parameters::print(dealii::ConditionalOStream const & pcout, std::string const &
   print_parameters_spatial_discretization(pcout);
 
   // SOLVER
-  // If a system of equations has to be solved (currently not used)
-  print_parameters_solver(pcout);
+  // If a system of equations has to be solved
+  if(temporal_discretization == TemporalDiscretization::IMEXRK)
+    print_parameters_solver(pcout);
 
   // NUMERICAL PARAMETERS
   print_parameters_numerical_parameters(pcout);
@@ -206,6 +262,11 @@ Parameters::print_parameters_temporal_discretization(dealii::ConditionalOStream
     print_parameter(pcout, "Number of stages", stages);
   }
 
+  if(temporal_discretization == TemporalDiscretization::IMEXRK)
+  {
+    print_parameter(pcout, "Order of time integrator", order_time_integrator);
+  }
+
   print_parameter(pcout, "Calculation of time step size", calculation_of_time_step_size);
 
   // maximum number of time steps
@@ -236,6 +297,7 @@ Parameters::print_parameters_spatial_discretization(dealii::ConditionalOStream c
 
   print_parameter(pcout, "Polynomial degree", degree);
 
+  print_parameter(pcout, "Formulation convective term", formulation_convective_term);
   print_parameter(pcout, "Quadrature rule convective term", n_q_points_convective);
   print_parameter(pcout, "Quadrature rule viscous term", n_q_points_viscous);
 
@@ -243,12 +305,24 @@ Parameters::print_parameters_spatial_discretization(dealii::ConditionalOStream c
 }
 
 void
-Parameters::print_parameters_solver(dealii::ConditionalOStream const & /*pcout*/) const
+Parameters::print_parameters_solver(dealii::ConditionalOStream const & pcout) const
 {
-  /*
-  pcout << std::endl
-        << "Solver:" << std::endl;
-  */
+  pcout << std::endl << "Solver:" << std::endl;
+
+  // Newton solver
+  pcout << std::endl << "Newton solver (viscous term):" << std::endl;
+
+  newton_solver_data_viscous.print(pcout);
+
+  // Solver linearized problem
+  pcout << std::endl << "Linear solver (GMRES, viscous term):" << std::endl;
+
+  solver_data_viscous.print(pcout);
+
+  print_parameter(pcout, "Preconditioner", preconditioner_viscous);
+
+  if(preconditioner_viscous == PreconditionerViscous::Multigrid)
+    multigrid_data_viscous.print(pcout);
 }
 
 void
@@ -24,6 +24,9 @@
 #include <exadg/compressible_navier_stokes/user_interface/enum_types.h>
 #include <exadg/grid/grid_data.h>
 #include <exadg/operators/inverse_mass_parameters.h>
+#include <exadg/solvers_and_preconditioners/multigrid/multigrid_parameters.h>
+#include <exadg/solvers_and_preconditioners/newton/newton_solver_data.h>
+#include <exadg/solvers_and_preconditioners/solvers/solver_data.h>
 #include <exadg/time_integration/restart_data.h>
 #include <exadg/time_integration/solver_info_data.h>
 #include <exadg/utilities/print_functions.h>
@@ -178,10 +181,37 @@ public:
 
   QuadratureRule n_q_points_convective, n_q_points_viscous;
 
+  // convective term: description see enum declaration
+  FormulationConvectiveTerm formulation_convective_term;
+
   // diffusive term: Symmetric interior penalty Galerkin (SIPG) discretization
   // interior penalty parameter scaling factor: default value is 1.0
   double IP_factor;
 
+  /**************************************************************************************/
+  /*                                                                                    */
+  /*                                       SOLVER                                       */
+  /*                                                                                    */
+  /**************************************************************************************/
+
+  // The parameters in this section are only relevant for IMEX Runge-Kutta methods, where a
+  // nonlinear system of equations has to be solved for the viscous term in every implicit stage.
+
+  // Newton solver
+  Newton::SolverData newton_solver_data_viscous;
+
+  // Solver data for the linearized problem. The linearized problem is solved by a GMRES solver
+  // using a Jacobian-free (finite difference) approximation of the linearized viscous operator.
+  SolverData solver_data_viscous;
+
+  // description: see enum declaration
+  PreconditionerViscous preconditioner_viscous;
+
+  // Multigrid data (only relevant for PreconditionerViscous::Multigrid). Note that only
+  // p-multigrid and c-transfers are supported since the triangulation is not set up with a
+  // multigrid hierarchy.
+  MultigridData multigrid_data_viscous;
+
   /**************************************************************************************/
   /*                                                                                    */
   /*                                NUMERICAL PARAMETERS                                */
@@ -120,6 +120,17 @@ Driver<dim, Number>::setup()
         pde_operator, helpers_ale, postprocessor, application->get_parameters(), mpi_comm, is_test);
 
       time_integrator->setup(application->get_parameters().restarted_simulation);
+
+      // machine-readable log of solver statistics
+      std::string const & statistics_filename =
+        application->get_parameters().solver_info_data.statistics_filename;
+      if(not statistics_filename.empty())
+      {
+        solver_statistics = std::make_shared<SolverStatistics>(statistics_filename, mpi_comm);
+        solver_statistics->write_run(application->get_parameters(),
+                                     pde_operator->get_number_of_dofs());
+        time_integrator->set_solver_statistics(solver_statistics);
+      }
     }
     else if(application->get_parameters().problem_type == ProblemType::Steady)
     {
@@ -195,7 +206,24 @@ Driver<dim, Number>::do_adaptive_refinement()
 
   if(any_cells_flagged_for_coarsening_or_refinement(*grid->triangulation))
   {
-    grid->triangulation->prepare_coarsening_and_refinement();
+    // A dealii::parallel::fullydistributed::Triangulation can not be refined. Instead, a new
+    // triangulation is created from the refined serial triangulation, see
+    // GridUtilities::FullyDistributedRefinement.
+    bool const is_fully_distributed = application->get_parameters().grid.triangulation_type ==
+                                      TriangulationType::FullyDistributed;
+
+    if(is_fully_distributed)
+    {
+      AssertThrow(grid->fully_distributed_refinement.get(),
+                  dealii::ExcMessage("Adaptive mesh refinement with TriangulationType::"
+                                     "FullyDistributed requires keep_serial_triangulation."));
+
+      grid->fully_distributed_refinement->prepare_coarsening_and_refinement(*grid->triangulation);
+    }
+    else
+    {
+      grid->triangulation->prepare_coarsening_and_refinement();
+    }
 
     if(application->get_parameters().problem_type == ProblemType::Unsteady)
     {
@@ -206,17 +234,30 @@ Driver<dim, Number>::do_adaptive_refinement()
       AssertThrow(false, dealii::ExcNotImplemented());
     }
 
-    grid->triangulation->execute_coarsening_and_refinement();
+    // The old triangulation has to outlive the DoFHandlers attached to it, which are reinitialized
+    // in setup_after_coarsening_and_refinement().
+    std::shared_ptr<dealii::Triangulation<dim>> const old_triangulation = grid->triangulation;
+
+    if(is_fully_distributed)
+    {
+      grid->triangulation =
+        grid->fully_distributed_refinement->create_triangulation(*old_triangulation);
+    }
+    else
+    {
+      grid->triangulation->execute_coarsening_and_refinement();
+    }
 
     if(application->get_parameters().involves_h_multigrid())
     {
-      GridUtilities::create_coarse_triangulations_after_coarsening_and_refinement(
+      GridUtilities::create_coarse_triangulations_after_coarsening_and_refinement<dim>(
         *grid->triangulation,
         grid->periodic_face_pairs,
         grid->coarse_triangulations,
         grid->coarse_periodic_face_pairs,
         application->get_parameters().grid,
-        application->get_parameters().amr_data.preserve_boundary_cells);
+        application->get_parameters().amr_data.preserve_boundary_cells,
+        grid->fully_distributed_refinement);
     }
 
     setup_after_coarsening_and_refinement();
@@ -355,6 +396,9 @@ Driver<dim, Number>::print_performance_results(double const total_time) const
   pcout << std::endl << "Timings for level 2:" << std::endl;
   timer_tree.print_level(pcout, 2);
 
+  if(solver_statistics.get())
+    solver_statistics->write_summary(time_integrator->get_number_of_time_steps(), timer_tree);
+
   // Throughput in DoFs/s per time step per core
   dealii::types::global_dof_index const DoFs = pde_operator->get_number_of_dofs();
   unsigned int N_mpi_processes               = dealii::Utilities::MPI::n_mpi_processes(mpi_comm);
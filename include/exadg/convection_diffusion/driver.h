@@ -48,6 +48,7 @@
 #include <exadg/operators/adaptive_mesh_refinement.h>
 #include <exadg/utilities/print_functions.h>
 #include <exadg/utilities/print_general_infos.h>
+#include <exadg/utilities/solver_statistics.h>
 
 namespace ExaDG
 {
@@ -139,6 +140,9 @@ private:
 
   std::shared_ptr<TimeIntBase> time_integrator;
 
+  // machine-readable log of solver statistics (optional)
+  std::shared_ptr<SolverStatistics> solver_statistics;
+
   std::shared_ptr<DriverSteadyProblems<Number>> driver_steady;
 
   // Computation time (wall clock time)
@@ -42,6 +42,9 @@ PostProcessor<dim, Number>::setup(Operator<dim, Number> const & pde_operator)
 {
   error_calculator.setup(pde_operator.get_dof_handler(),
                          *pde_operator.get_mapping(),
+                         pde_operator.get_matrix_free(),
+                         pde_operator.get_dof_index(),
+                         pde_operator.get_quad_index(),
                          pp_data.error_data);
 
   output_generator.setup(pde_operator.get_dof_handler(),
@@ -112,11 +112,7 @@ MultigridPreconditioner<dim, Number>::update()
   // Update matrix-free objects and operators
   if(mesh_is_moving)
   {
-    this->initialize_mapping();
-
-    this->update_matrix_free_objects();
-
-    this->for_all_levels(
+    this->update_after_grid_motion(
       [&](unsigned int const level) { this->get_operator(level)->update_after_grid_motion(); });
   }
 
@@ -165,7 +161,8 @@ MultigridPreconditioner<dim, Number>::update()
   }
 
   // Once the operators are updated, the update of smoothers and the coarse grid solver is generic
-  // functionality implemented in the base class.
+  // functionality implemented in the base class. Since the operators on all levels depend on the
+  // time, all levels are updated even if update_after_grid_motion() kept the coarser h-levels.
   this->update_smoothers();
   this->update_coarse_solver();
 
@@ -155,6 +155,30 @@ Operator<dim, Number>::fill_matrix_free_data(MatrixFreeData<dim, Number> & matri
   }
 }
 
+template<int dim, typename Number>
+void
+Operator<dim, Number>::initialize_precomputed_bc()
+{
+  // resolve the vectorized interface of the boundary functions
+  boundary_descriptor->set_vectorized_functions();
+
+  if(not(boundary_descriptor->precomputed_bc.empty()))
+  {
+    std::vector<unsigned int> quad_indices;
+    quad_indices.emplace_back(get_quad_index());
+    if(param.use_overintegration)
+      quad_indices.emplace_back(get_quad_index_overintegration());
+
+    precomputed_data = std::make_shared<PrecomputedBoundaryData<dim>>();
+    precomputed_data->setup(*matrix_free,
+                            get_dof_index(),
+                            quad_indices,
+                            boundary_descriptor->get_precomputed_functions());
+
+    boundary_descriptor->set_precomputed_data(precomputed_data);
+  }
+}
+
 template<int dim, typename Number>
 void
 Operator<dim, Number>::setup_operators()
@@ -361,6 +385,8 @@ Operator<dim, Number>::setup(std::shared_ptr<dealii::MatrixFree<dim, Number> con
 
   dof_index_velocity_external = dof_index_velocity_external_in;
 
+  initialize_precomputed_bc();
+
   setup_operators();
 
   if(param.linear_system_has_to_be_solved())
@@ -375,6 +401,18 @@ template<int dim, typename Number>
 void
 Operator<dim, Number>::setup_after_coarsening_and_refinement()
 {
+  // In case of a fully-distributed triangulation, adaptive mesh refinement creates a new
+  // triangulation, see GridUtilities::FullyDistributedRefinement.
+  if(&dof_handler.get_triangulation() != grid->triangulation.get())
+  {
+    dof_handler.reinit(*grid->triangulation);
+
+    if(needs_own_dof_handler_velocity())
+    {
+      dof_handler_velocity->reinit(*grid->triangulation);
+    }
+  }
+
   initialize_dof_handler_and_constraints();
 
   print_parameter(pcout,
@@ -798,6 +836,8 @@ Operator<dim, Number>::update_after_grid_motion(bool const update_matrix_free)
     matrix_free_own_storage->update_mapping(*get_mapping());
   }
 
+  // precomputed boundary data depends on the position of the quadrature points
+  initialize_precomputed_bc();
 
   // update SIPG penalty parameter of diffusive operator which depends on the deformation
   // of elements
@@ -815,7 +855,9 @@ template<int dim, typename Number>
 void
 Operator<dim, Number>::prepare_coarsening_and_refinement(std::vector<VectorType *> & vectors)
 {
-  solution_transfer = std::make_shared<ExaDG::SolutionTransfer<dim, VectorType>>(dof_handler);
+  solution_transfer =
+    std::make_shared<ExaDG::SolutionTransfer<dim, VectorType>>(dof_handler,
+                                                               grid->fully_distributed_refinement);
 
   solution_transfer->prepare_coarsening_and_refinement(vectors);
 }
@@ -301,6 +301,12 @@ private:
   void
   initialize_dof_handler_and_constraints();
 
+  /**
+   * Tabulates time-independent or separable boundary conditions in the boundary quadrature points.
+   */
+  void
+  initialize_precomputed_bc();
+
   /**
    * Performs setup of operators.
    */
@@ -418,6 +424,11 @@ private:
   // matrix_free_own_storage. This variable is needed for ALE formulations.
   std::shared_ptr<dealii::MatrixFree<dim, Number>> matrix_free_own_storage;
 
+  /*
+   * Precomputed boundary data.
+   */
+  std::shared_ptr<PrecomputedBoundaryData<dim>> precomputed_data;
+
   /*
    * Basic operators.
    */
@@ -87,6 +87,8 @@ public:
   {
     data = data_in;
 
+    velocity_vectorized = get_vectorized_function(data.velocity.get());
+
     if(data.velocity_type == TypeVelocityField::DoFVector)
     {
       integrator_velocity =
@@ -312,7 +314,10 @@ public:
     {
       dealii::Point<dim, scalar> q_points = integrator.quadrature_point(q);
 
-      vector velocity = FunctionEvaluator<1, dim, Number>::value(*(data.velocity), q_points, time);
+      vector velocity = FunctionEvaluator<1, dim, Number>::value(*(data.velocity),
+                                                                 velocity_vectorized,
+                                                                 q_points,
+                                                                 time);
 
       scalar normal_velocity = velocity * normal_m;
 
@@ -389,7 +394,10 @@ public:
     {
       dealii::Point<dim, scalar> q_points = integrator.quadrature_point(q);
 
-      velocity = FunctionEvaluator<1, dim, Number>::value(*(data.velocity), q_points, time);
+      velocity = FunctionEvaluator<1, dim, Number>::value(*(data.velocity),
+                                                          velocity_vectorized,
+                                                          q_points,
+                                                          time);
     }
     else if(data.velocity_type == TypeVelocityField::DoFVector)
     {
@@ -480,6 +488,7 @@ public:
     if(data.velocity_type == TypeVelocityField::Function)
     {
       velocity = FunctionEvaluator<1, dim, Number>::value(*(data.velocity),
+                                                          velocity_vectorized,
                                                           integrator.quadrature_point(q),
                                                           time);
     }
@@ -507,6 +516,7 @@ public:
     if(data.velocity_type == TypeVelocityField::Function)
     {
       velocity = FunctionEvaluator<1, dim, Number>::value(*(data.velocity),
+                                                          velocity_vectorized,
                                                           integrator.quadrature_point(q),
                                                           time);
     }
@@ -525,6 +535,9 @@ public:
 private:
   ConvectiveKernelData<dim> data;
 
+  // vectorized interface of data.velocity (nullptr if not available)
+  VectorizedFunction<dim> const * velocity_vectorized = nullptr;
+
   mutable lazy_ptr<VectorType> velocity;
 
   std::shared_ptr<CellIntegratorVelocity> integrator_velocity;
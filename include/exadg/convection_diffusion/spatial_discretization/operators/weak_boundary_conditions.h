@@ -91,10 +91,10 @@ inline DEAL_II_ALWAYS_INLINE //
     {
       dealii::VectorizedArray<Number> g;
 
-      auto bc       = boundary_descriptor->dirichlet_bc.find(boundary_id)->second;
-      auto q_points = integrator.quadrature_point(q);
+      auto bc = boundary_descriptor->dirichlet_bc.find(boundary_id)->second;
 
-      g = FunctionEvaluator<0, dim, Number>::value(*bc, q_points, time);
+      g = evaluate_boundary_function<0, dim, Number>(
+        *bc, *boundary_descriptor, boundary_id, integrator, q, time);
 
       value_p = -value_m + 2.0 * g;
     }
@@ -194,10 +194,10 @@ inline DEAL_II_ALWAYS_INLINE //
   {
     if(operator_type == OperatorType::full or operator_type == OperatorType::inhomogeneous)
     {
-      auto bc       = boundary_descriptor->neumann_bc.find(boundary_id)->second;
-      auto q_points = integrator.quadrature_point(q);
+      auto bc = boundary_descriptor->neumann_bc.find(boundary_id)->second;
 
-      auto h = FunctionEvaluator<0, dim, Number>::value(*bc, q_points, time);
+      auto h = evaluate_boundary_function<0, dim, Number>(
+        *bc, *boundary_descriptor, boundary_id, integrator, q, time);
 
       normal_gradient_p = -normal_gradient_m + 2.0 * h;
     }
@@ -75,15 +75,21 @@ private:
 
     IntegratorCell integrator(matrix_free, dof_index, quad_index);
 
+    VectorizedFunction<dim> const * function_vectorized = get_vectorized_function(function.get());
+
     for(unsigned int cell = cell_range.first; cell < cell_range.second; ++cell)
     {
       integrator.reinit(cell);
 
       for(unsigned int q = 0; q < integrator.n_q_points; ++q)
       {
-        integrator.submit_value(
-          FunctionEvaluator<1, dim, Number>::value(*function, integrator.quadrature_point(q), time),
-          q);
+        dealii::Tensor<1, dim, dealii::VectorizedArray<Number>> const velocity =
+          FunctionEvaluator<1, dim, Number>::value(*function,
+                                                   function_vectorized,
+                                                   integrator.quadrature_point(q),
+                                                   time);
+
+        integrator.submit_value(velocity, q);
       }
 
       integrator.integrate(dealii::EvaluationFlags::values);
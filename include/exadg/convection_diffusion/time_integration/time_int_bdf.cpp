@@ -53,7 +53,8 @@ TimeIntBDF<dim, Number>::TimeIntBDF(
     refine_steps_time(param_in.n_refine_time),
     cfl(param.cfl / std::pow(2.0, refine_steps_time)),
     solution(param_in.order_time_integrator),
-    vec_convective_term(param_in.order_time_integrator),
+    vec_convective_term(param_in.order_time_integrator,
+                        param_in.store_convective_term_single_precision),
     iterations({0, 0}),
     postprocessor(postprocessor_in),
     helpers_ale(helpers_ale_in),
@@ -118,8 +119,7 @@ TimeIntBDF<dim, Number>::allocate_vectors()
   {
     if(param.treatment_of_convective_term == TreatmentOfConvectiveTerm::Explicit)
     {
-      for(unsigned int i = 0; i < vec_convective_term.size(); ++i)
-        pde_operator->initialize_dof_vector(vec_convective_term[i]);
+      vec_convective_term.reinit(solution_np);
 
       if(param.ale_formulation == false)
         pde_operator->initialize_dof_vector(convective_term_np);
@@ -230,15 +230,19 @@ TimeIntBDF<dim, Number>::initialize_vec_convective_term()
 {
   if(this->param.get_type_velocity_field() != TypeVelocityField::DoFVector)
   {
-    pde_operator->evaluate_convective_term(vec_convective_term[0], solution[0], this->get_time());
+    // convective_term_np is used as temporary vector since the history might be stored in
+    // reduced precision
+    pde_operator->evaluate_convective_term(convective_term_np, solution[0], this->get_time());
+    vec_convective_term.set(0, convective_term_np);
 
     if(this->param.start_with_low_order == false)
     {
       for(unsigned int i = 1; i < vec_convective_term.size(); ++i)
       {
-        pde_operator->evaluate_convective_term(vec_convective_term[i],
+        pde_operator->evaluate_convective_term(convective_term_np,
                                                solution[i],
                                                this->get_previous_time(i));
+        vec_convective_term.set(i, convective_term_np);
       }
     }
   }
@@ -388,8 +392,7 @@ TimeIntBDF<dim, Number>::prepare_vectors_for_next_timestep()
   {
     if(param.ale_formulation == false)
     {
-      push_back(vec_convective_term);
-      vec_convective_term[0].swap(convective_term_np);
+      vec_convective_term.push_back(convective_term_np);
     }
   }
 
@@ -441,7 +444,9 @@ TimeIntBDF<dim, Number>::read_restart_vectors(boost::archive::binary_iarchive &
     {
       for(unsigned int i = 0; i < this->order; i++)
       {
-        ia >> vec_convective_term[i];
+        VectorType tmp = convective_term_np;
+        ia >> tmp;
+        vec_convective_term.set(i, tmp);
       }
     }
   }
@@ -471,7 +476,9 @@ TimeIntBDF<dim, Number>::write_restart_vectors(boost::archive::binary_oarchive &
     {
       for(unsigned int i = 0; i < this->order; i++)
       {
-        oa << vec_convective_term[i];
+        VectorType tmp;
+        vec_convective_term.get(i, tmp);
+        oa << tmp;
       }
     }
   }
@@ -548,8 +555,7 @@ TimeIntBDF<dim, Number>::do_timestep_solve()
       }
     }
 
-    for(unsigned int i = 0; i < vec_convective_term.size(); ++i)
-      rhs_vector.add(-this->extra.get_beta(i), vec_convective_term[i]);
+    vec_convective_term.add_extrapolation(rhs_vector, -1.0, this->extra);
   }
 
   VectorType sum_alphai_ui(solution[0]);
@@ -647,6 +653,13 @@ TimeIntBDF<dim, Number>::print_iterations() const
   print_list_of_iterations(this->pcout, names, iterations_avg);
 }
 
+template<int dim, typename Number>
+std::vector<std::pair<std::string, unsigned long long>>
+TimeIntBDF<dim, Number>::get_accumulated_iterations() const
+{
+  return {{"Linear system", iterations.second}};
+}
+
 template<int dim, typename Number>
 void
 TimeIntBDF<dim, Number>::set_velocities_and_times(
@@ -28,6 +28,7 @@
 // ExaDG
 #include <exadg/time_integration/lambda_functions_ale.h>
 #include <exadg/time_integration/time_int_bdf_base.h>
+#include <exadg/time_integration/vector_history.h>
 
 namespace ExaDG
 {
@@ -108,6 +109,9 @@ private:
   void
   do_timestep_solve() final;
 
+  std::vector<std::pair<std::string, unsigned long long>>
+  get_accumulated_iterations() const final;
+
   void
   setup_derived() final;
 
@@ -134,7 +138,7 @@ private:
   // solution vectors
   VectorType              solution_np;
   std::vector<VectorType> solution;
-  std::vector<VectorType> vec_convective_term;
+  VectorHistory<Number>   vec_convective_term;
   VectorType              convective_term_np;
 
   VectorType rhs_vector;
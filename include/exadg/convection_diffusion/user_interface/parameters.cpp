@@ -47,6 +47,7 @@ Parameters::Parameters()
     order_time_integrator(1),
     start_with_low_order(true),
     treatment_of_convective_term(TreatmentOfConvectiveTerm::Undefined),
+    store_convective_term_single_precision(false),
     calculation_of_time_step_size(TimeStepCalculation::Undefined),
     adaptive_time_stepping(false),
     adaptive_time_stepping_limiting_factor(1.2),
@@ -177,6 +178,16 @@ Parameters::check() const
       }
     }
 
+    if(store_convective_term_single_precision)
+    {
+      // In case of ALE, the convective term is recomputed for all previous instants of time in
+      // each time step, i.e. there is no history to be stored. In case of adaptive mesh
+      // refinement, the history vectors are transferred to the new mesh in full precision.
+      AssertThrow(ale_formulation == false and enable_adaptivity == false,
+                  dealii::ExcMessage("Storing the convective term in single precision is not "
+                                     "possible for ALE formulations or adaptive meshes."));
+    }
+
     if(temporal_discretization == TemporalDiscretization::ExplRK)
     {
       AssertThrow(time_integrator_rk != TimeIntegratorRK::Undefined,
@@ -271,6 +282,13 @@ Parameters::check() const
     AssertThrow(grid.element_type == ElementType::Hypercube,
                 dealii::ExcMessage("Adaptive mesh refinement is currently "
                                    "only supported for hypercube elements."));
+
+    if(grid.triangulation_type == TriangulationType::FullyDistributed)
+    {
+      AssertThrow(grid.keep_serial_triangulation,
+                  dealii::ExcMessage("Adaptive mesh refinement with TriangulationType::"
+                                     "FullyDistributed requires keep_serial_triangulation."));
+    }
   }
 
   AssertThrow(degree > 0, dealii::ExcMessage("Polynomial degree must be larger than zero."));
@@ -487,6 +505,9 @@ Parameters::print_parameters_temporal_discretization(dealii::ConditionalOStream
     print_parameter(pcout, "Order of time integrator", order_time_integrator);
     print_parameter(pcout, "Start with low order method", start_with_low_order);
     print_parameter(pcout, "Treatment of convective term", treatment_of_convective_term);
+    print_parameter(pcout,
+                    "Store convective term in single precision",
+                    store_convective_term_single_precision);
   }
 
   print_parameter(pcout, "Calculation of time step size", calculation_of_time_step_size);
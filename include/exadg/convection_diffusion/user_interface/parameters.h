@@ -158,6 +158,11 @@ public:
   // a purely diffusive problem, one also does not have to specify this parameter.
   TreatmentOfConvectiveTerm treatment_of_convective_term;
 
+  // Store the history of the explicitly treated convective term in single precision. This
+  // reduces memory consumption and memory transfer of the extrapolation of the convective term,
+  // at the price of a rounding error of order 1e-7 relative to the convective term.
+  bool store_convective_term_single_precision;
+
   // calculation of time step size
   TimeStepCalculation calculation_of_time_step_size;
 
@@ -334,7 +339,9 @@ public:
   // is necessary to perform the face-loop as a loop over all faces of a cell with an
   // outer loop over all cells, e.g., preconditioners operating on the level of
   // individual cells (for example block Jacobi). With this parameter, the loop structure
-  // can be changed to such an algorithm (cell_based_face_loops).
+  // can be changed to such an algorithm (cell_based_face_loops). On locally refined meshes,
+  // cell-based face loops are only supported for the multigrid levels, and mixed meshes are not
+  // supported, see Categorization::do_cell_based_loops().
   bool use_cell_based_face_loops;
 
   // Evaluate convective term and diffusive term at once instead of implementing each
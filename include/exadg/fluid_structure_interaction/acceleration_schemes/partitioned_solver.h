@@ -60,6 +60,16 @@ public:
   std::shared_ptr<TimerTree>
   get_timings() const;
 
+  /*
+   * Write/read the history of the quasi-Newton methods (which is reused over several time steps)
+   * to/from restart archives.
+   */
+  void
+  write_restart(boost::archive::binary_oarchive & oa) const;
+
+  void
+  read_restart(boost::archive::binary_iarchive & ia);
+
 private:
   bool
   check_convergence(VectorType const & residual) const;
@@ -172,6 +182,54 @@ PartitionedSolver<dim, Number>::get_timings() const
   return timer_tree;
 }
 
+template<int dim, typename Number>
+void
+PartitionedSolver<dim, Number>::write_restart(boost::archive::binary_oarchive & oa) const
+{
+  auto const write_history =
+    [&](std::vector<std::shared_ptr<std::vector<VectorType>>> const & history) {
+      unsigned int const n_time_steps = history.size();
+      oa &               n_time_steps;
+      for(auto const & vectors : history)
+      {
+        unsigned int const n_vectors = vectors->size();
+        oa &               n_vectors;
+        for(auto const & vector : *vectors)
+          oa << vector;
+      }
+    };
+
+  write_history(D_history);
+  write_history(R_history);
+  write_history(Z_history);
+}
+
+template<int dim, typename Number>
+void
+PartitionedSolver<dim, Number>::read_restart(boost::archive::binary_iarchive & ia)
+{
+  auto const read_history = [&](std::vector<std::shared_ptr<std::vector<VectorType>>> & history) {
+    unsigned int n_time_steps = 0;
+    ia &         n_time_steps;
+    history.resize(n_time_steps);
+    for(auto & vectors : history)
+    {
+      unsigned int n_vectors = 0;
+      ia &         n_vectors;
+      vectors = std::make_shared<std::vector<VectorType>>(n_vectors);
+      for(auto & vector : *vectors)
+      {
+        structure->pde_operator->initialize_dof_vector(vector);
+        ia >> vector;
+      }
+    }
+  };
+
+  read_history(D_history);
+  read_history(R_history);
+  read_history(Z_history);
+}
+
 template<int dim, typename Number>
 void
 PartitionedSolver<dim, Number>::solve(
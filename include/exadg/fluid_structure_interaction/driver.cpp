@@ -22,6 +22,7 @@
 // ExaDG
 #include <exadg/fluid_structure_interaction/driver.h>
 #include <exadg/grid/marked_vertices.h>
+#include <exadg/time_integration/restart.h>
 #include <exadg/utilities/print_general_infos.h>
 
 namespace ExaDG
@@ -59,6 +60,26 @@ Driver<dim, Number>::setup()
 
   pcout << std::endl << "Setting up fluid-structure interaction solver:" << std::endl;
 
+  // restart
+  {
+    auto const & param_fluid     = application->fluid->get_parameters();
+    auto const & param_structure = application->structure->get_parameters();
+
+    AssertThrow(param_fluid.restarted_simulation == param_structure.restarted_simulation,
+                dealii::ExcMessage("Fluid and structure have to be restarted together."));
+
+    AssertThrow(param_structure.restart_data.write_restart == false,
+                dealii::ExcMessage("Restart files of the structure are written whenever the fluid "
+                                   "writes restart files. Set write_restart = false for the "
+                                   "structure."));
+
+    if(param_fluid.restart_data.write_restart or param_fluid.restarted_simulation)
+    {
+      AssertThrow(param_fluid.restart_data.filename != param_structure.restart_data.filename,
+                  dealii::ExcMessage("Fluid and structure need different restart filenames."));
+    }
+  }
+
   // setup structure
   {
     dealii::Timer timer_local;
@@ -81,6 +102,9 @@ Driver<dim, Number>::setup()
 
   partitioned_solver->setup(fluid, structure);
 
+  if(application->fluid->get_parameters().restarted_simulation)
+    read_restart();
+
   timer_tree.insert({"FSI", "Setup"}, timer.wall_time());
 }
 
@@ -286,6 +310,95 @@ Driver<dim, Number>::apply_dirichlet_neumann_scheme(VectorType &       d_tilde,
   d_tilde = structure->time_integrator->get_displacement_np();
 }
 
+template<int dim, typename Number>
+std::string
+Driver<dim, Number>::restart_filename_fsi() const
+{
+  return restart_filename(application->fluid->get_parameters().restart_data.filename + "_fsi",
+                          mpi_comm);
+}
+
+template<int dim, typename Number>
+void
+Driver<dim, Number>::write_restart() const
+{
+  dealii::Timer timer;
+  timer.restart();
+
+  // structure
+  structure->time_integrator->force_write_restart();
+
+  // FSI coupling
+  std::string const filename = restart_filename_fsi();
+
+  rename_restart_files(filename);
+
+  std::ostringstream oss;
+
+  boost::archive::binary_oarchive oa(oss);
+
+  unsigned int n_ranks = dealii::Utilities::MPI::n_mpi_processes(mpi_comm);
+
+  // 1. ranks
+  oa & n_ranks;
+
+  // 2. time
+  double const time = fluid->time_integrator->get_time();
+  oa &         time;
+
+  // 3. ALE grid deformation
+  fluid->ale_mapping->write_restart(oa);
+
+  // 4. history of quasi-Newton methods
+  partitioned_solver->write_restart(oa);
+
+  write_restart_file(oss, filename);
+
+  timer_tree.insert({"FSI", "Write restart"}, timer.wall_time());
+}
+
+template<int dim, typename Number>
+void
+Driver<dim, Number>::read_restart()
+{
+  pcout << std::endl << "Reading FSI restart file ..." << std::endl;
+
+  std::string const filename = restart_filename_fsi();
+  std::ifstream     in(filename, std::ios::binary);
+  AssertThrow(in, dealii::ExcMessage("File " + filename + " does not exist."));
+
+  boost::archive::binary_iarchive ia(in);
+
+  // Note that the operations done here must be in sync with the output.
+
+  // 1. ranks
+  unsigned int n_old_ranks = 1;
+  ia &         n_old_ranks;
+
+  unsigned int n_ranks = dealii::Utilities::MPI::n_mpi_processes(mpi_comm);
+  AssertThrow(n_old_ranks == n_ranks,
+              dealii::ExcMessage("Tried to restart with " + dealii::Utilities::to_string(n_ranks) +
+                                 " processes, "
+                                 "but restart was written on " +
+                                 dealii::Utilities::to_string(n_old_ranks) + " processes."));
+
+  // 2. time
+  double time = 0.0;
+  ia &   time;
+  AssertThrow(std::abs(time - fluid->time_integrator->get_time()) <
+                1.e-10 * std::max(1.0, std::abs(time)),
+              dealii::ExcMessage("FSI restart file does not match restart file of the fluid."));
+
+  // 3. ALE grid deformation: move the grid to the position at the time of the restart
+  fluid->ale_mapping->read_restart(ia);
+  fluid->helpers_ale->update_pde_operator_after_grid_motion();
+
+  // 4. history of quasi-Newton methods
+  partitioned_solver->read_restart(ia);
+
+  pcout << std::endl << "... done!" << std::endl;
+}
+
 template<int dim, typename Number>
 void
 Driver<dim, Number>::solve() const
@@ -320,6 +433,9 @@ Driver<dim, Number>::solve() const
     fluid->time_integrator->advance_one_timestep_post_solve();
     structure->time_integrator->advance_one_timestep_post_solve();
 
+    if(fluid->time_integrator->restart_written_in_last_time_step())
+      write_restart();
+
     if(application->fluid->get_parameters().adaptive_time_stepping)
       synchronize_time_step_size();
   }
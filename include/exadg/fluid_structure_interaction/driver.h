@@ -84,6 +84,20 @@ private:
                                  VectorType const & d,
                                  unsigned int       iteration) const;
 
+  /*
+   * Restart: The fluid time integrator decides when restart files are written. At the same time,
+   * the restart files of the structure are written as well as the state of the FSI coupling (ALE
+   * grid deformation, history of quasi-Newton methods).
+   */
+  void
+  write_restart() const;
+
+  void
+  read_restart();
+
+  std::string
+  restart_filename_fsi() const;
+
   // MPI communicator
   MPI_Comm const mpi_comm;
 
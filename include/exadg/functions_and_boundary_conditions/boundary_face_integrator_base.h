@@ -43,9 +43,18 @@ public:
   void
   reinit(unsigned int const face, Number const time)
   {
-    evaluation_time = time;
+    reinit_boundary_id(matrix_free.get_boundary_id(face), time);
+  }
 
-    auto const boundary_id_new = matrix_free.get_boundary_id(face);
+  /*
+   * Same as above, but with the boundary ID given explicitly. This variant is needed for
+   * cell-based face loops, where the boundary ID is obtained from
+   * dealii::MatrixFree::get_faces_by_cells_boundary_id().
+   */
+  void
+  reinit_boundary_id(dealii::types::boundary_id const boundary_id_new, Number const time)
+  {
+    evaluation_time = time;
 
     // only update boundary_type if needed to avoid an unnecessary search in boundary_descriptor
     if(boundary_id_new != boundary_id)
@@ -26,33 +26,10 @@ namespace ExaDG
 {
 template<int rank, int dim, typename number_type>
 ContainerInterfaceData<rank, dim, number_type>::ContainerInterfaceData()
+  : n_lanes(1), face_batch_begin(0)
 {
 }
 
-template<int rank, int dim, typename number_type>
-typename ContainerInterfaceData<rank, dim, number_type>::data_type
-ContainerInterfaceData<rank, dim, number_type>::get_data(unsigned int const q_index,
-                                                         unsigned int const face,
-                                                         unsigned int const q,
-                                                         unsigned int const v) const
-{
-  Assert(map_vector_index.find(q_index) != map_vector_index.end(),
-         dealii::ExcMessage("Specified q_index = " + std::to_string(q_index) +
-                            " does not exist in map_vector_index."));
-
-  Assert(map_solution.find(q_index) != map_solution.end(),
-         dealii::ExcMessage("Specified q_index = " + std::to_string(q_index) +
-                            " does not exist in map_solution."));
-
-  Id                              id    = std::make_tuple(face, q, v);
-  dealii::types::global_dof_index index = map_vector_index.find(q_index)->second.find(id)->second;
-
-  ArraySolutionValues const & array_solution = map_solution.find(q_index)->second;
-  Assert(index < array_solution.size(), dealii::ExcMessage("Index exceeds dimensions of vector."));
-
-  return array_solution[index];
-}
-
 template<int rank, int dim, typename number_type>
 std::vector<typename ContainerInterfaceData<rank, dim, number_type>::quad_index> const &
 ContainerInterfaceData<rank, dim, number_type>::get_quad_indices()
@@ -64,14 +41,25 @@ template<int rank, int dim, typename number_type>
 typename ContainerInterfaceData<rank, dim, number_type>::ArrayQuadraturePoints &
 ContainerInterfaceData<rank, dim, number_type>::get_array_q_points(quad_index const & q_index)
 {
-  return map_q_points[q_index];
+  AssertIndexRange(q_index, array_q_points.size());
+
+  return array_q_points[q_index];
 }
 
 template<int rank, int dim, typename number_type>
 typename ContainerInterfaceData<rank, dim, number_type>::ArraySolutionValues &
 ContainerInterfaceData<rank, dim, number_type>::get_array_solution(quad_index const & q_index)
 {
-  return map_solution[q_index];
+  AssertIndexRange(q_index, array_solution.size());
+
+  return array_solution[q_index];
+}
+
+template<int rank, int dim, typename number_type>
+unsigned int
+ContainerInterfaceData<rank, dim, number_type>::get_n_lanes() const
+{
+  return n_lanes;
 }
 
 template class ContainerInterfaceData<0, 2, double>;
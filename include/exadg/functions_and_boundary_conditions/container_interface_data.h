@@ -23,10 +23,12 @@
 #define INCLUDE_EXADG_FUNCTIONS_AND_BOUNDARY_CONDITIONS_CONTAINER_INTERFACE_DATA_H_
 
 // deal.II
+#include <deal.II/base/numbers.h>
 #include <deal.II/base/tensor.h>
 
-#include <map>
-#include <tuple>
+#include <algorithm>
+#include <set>
+#include <string>
 #include <vector>
 
 // ExaDG
@@ -39,6 +41,11 @@ namespace ExaDG
  * A data structure storing quadrature point information for each quadrature point on boundary faces
  * of a given set of boundary IDs. The type of data stored for each q-point is dealii::Tensor<rank,
  * dim, number_type>.
+ *
+ * The data is stored in a flat array in face-batch-major order, i.e., the values of all SIMD lanes
+ * of a quadrature point of a face batch are contiguous in memory, followed by the next quadrature
+ * point and the next face batch. An offset table per face batch allows O(1) access in boundary face
+ * integrals.
  */
 template<int rank, int dim, typename number_type>
 class ContainerInterfaceData
@@ -53,14 +60,13 @@ private:
 
   using quad_index = unsigned int;
 
-  using Id = std::tuple<unsigned int /*face*/, unsigned int /*q*/, unsigned int /*v*/>;
-
-  using MapVectorIndex = std::map<Id, dealii::types::global_dof_index>;
-
   using ArrayQuadraturePoints = std::vector<dealii::Point<dim>>;
 
   using ArraySolutionValues = std::vector<data_type>;
 
+  // offset of the first entry of a face batch, relative to the first boundary face batch
+  using ArrayFaceOffsets = std::vector<unsigned int>;
+
 public:
   ContainerInterfaceData();
 
@@ -73,20 +79,30 @@ public:
   {
     quad_indices = quad_indices_;
 
+    n_lanes = dealii::VectorizedArray<Number>::size();
+
+    face_batch_begin = matrix_free_.n_inner_face_batches();
+    unsigned int const n_boundary_face_batches = matrix_free_.n_boundary_face_batches();
+
+    unsigned int max_quad_index = 0;
+    for(auto q_index : quad_indices)
+      max_quad_index = std::max(max_quad_index, q_index);
+
+    face_offsets.resize(max_quad_index + 1);
+    array_q_points.resize(max_quad_index + 1);
+    array_solution.resize(max_quad_index + 1);
+
     for(auto q_index : quad_indices)
     {
-      // initialize maps
-      map_vector_index.emplace(q_index, MapVectorIndex());
-      map_q_points.emplace(q_index, ArrayQuadraturePoints());
-      map_solution.emplace(q_index, ArraySolutionValues());
-
-      MapVectorIndex &        map_index          = map_vector_index.find(q_index)->second;
-      ArrayQuadraturePoints & array_q_points_dst = map_q_points.find(q_index)->second;
-      ArraySolutionValues &   array_solution_dst = map_solution.find(q_index)->second;
-
-      // create map "ID = {face, q, v} <-> vector_index" and fill array of quadrature points
-      for(unsigned int face = matrix_free_.n_inner_face_batches();
-          face < matrix_free_.n_inner_face_batches() + matrix_free_.n_boundary_face_batches();
+      ArrayFaceOffsets &      offsets            = face_offsets[q_index];
+      ArrayQuadraturePoints & array_q_points_dst = array_q_points[q_index];
+      ArraySolutionValues &   array_solution_dst = array_solution[q_index];
+
+      offsets.assign(n_boundary_face_batches, dealii::numbers::invalid_unsigned_int);
+      array_q_points_dst.clear();
+
+      // fill offset table and array of quadrature points in the order {face, q, v}
+      for(unsigned int face = face_batch_begin; face < face_batch_begin + n_boundary_face_batches;
           ++face)
       {
         // only consider relevant boundary IDs
@@ -98,27 +114,26 @@ public:
                                                                q_index);
           integrator.reinit(face);
 
+          offsets[face - face_batch_begin] = array_q_points_dst.size();
+
           for(unsigned int q = 0; q < integrator.n_q_points; ++q)
           {
             dealii::Point<dim, dealii::VectorizedArray<Number>> q_points =
               integrator.quadrature_point(q);
 
-            for(unsigned int v = 0; v < dealii::VectorizedArray<Number>::size(); ++v)
+            for(unsigned int v = 0; v < n_lanes; ++v)
             {
               dealii::Point<dim> q_point;
               for(unsigned int d = 0; d < dim; ++d)
                 q_point[d] = q_points[d][v];
 
-              Id                              id    = std::make_tuple(face, q, v);
-              dealii::types::global_dof_index index = array_q_points_dst.size();
-              map_index.emplace(id, index);
               array_q_points_dst.push_back(q_point);
             }
           }
         }
       }
 
-      array_solution_dst.resize(array_q_points_dst.size(), data_type());
+      array_solution_dst.assign(array_q_points_dst.size(), data_type());
     }
   }
 
@@ -135,14 +150,52 @@ public:
   get_data(unsigned int const q_index,
            unsigned int const face,
            unsigned int const q,
-           unsigned int const v) const;
+           unsigned int const v) const
+  {
+    return get_data(q_index, face, q)[v];
+  }
+
+  /**
+   * Returns a pointer to the contiguous data of all SIMD lanes of quadrature point q of face batch
+   * face.
+   */
+  inline DEAL_II_ALWAYS_INLINE //
+    data_type const *
+    get_data(unsigned int const q_index, unsigned int const face, unsigned int const q) const
+  {
+    Assert(q_index < face_offsets.size() and face_offsets[q_index].size() > 0,
+           dealii::ExcMessage("Specified q_index = " + std::to_string(q_index) +
+                              " does not exist in ContainerInterfaceData."));
+    Assert(face >= face_batch_begin and face - face_batch_begin < face_offsets[q_index].size(),
+           dealii::ExcMessage("Face batch " + std::to_string(face) + " is not a boundary face."));
+
+    unsigned int const offset = face_offsets[q_index][face - face_batch_begin];
+
+    Assert(offset != dealii::numbers::invalid_unsigned_int,
+           dealii::ExcMessage("Face batch " + std::to_string(face) +
+                              " is not part of the coupling interface."));
+    Assert(offset + (q + 1) * n_lanes <= array_solution[q_index].size(),
+           dealii::ExcMessage("Index exceeds dimensions of vector."));
+
+    return array_solution[q_index].data() + offset + q * n_lanes;
+  }
+
+  unsigned int
+  get_n_lanes() const;
 
 private:
   std::vector<quad_index> quad_indices;
 
-  mutable std::map<quad_index, MapVectorIndex>        map_vector_index;
-  mutable std::map<quad_index, ArrayQuadraturePoints> map_q_points;
-  mutable std::map<quad_index, ArraySolutionValues>   map_solution;
+  // number of SIMD lanes of the face batches the data has been set up for
+  unsigned int n_lanes;
+
+  // index of the first boundary face batch
+  unsigned int face_batch_begin;
+
+  // the following arrays are indexed by the quadrature index
+  std::vector<ArrayFaceOffsets>      face_offsets;
+  std::vector<ArrayQuadraturePoints> array_q_points;
+  std::vector<ArraySolutionValues>   array_solution;
 };
 } // namespace ExaDG
 
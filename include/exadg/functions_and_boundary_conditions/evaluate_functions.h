@@ -30,11 +30,43 @@
 
 #include <exadg/functions_and_boundary_conditions/container_interface_data.h>
 #include <exadg/functions_and_boundary_conditions/function_with_normal.h>
+#include <exadg/functions_and_boundary_conditions/vectorized_function.h>
 
+#include <array>
 #include <memory>
 
 namespace ExaDG
 {
+/*
+ * Returns the vectorized interface of a function, or a nullptr if the function only implements the
+ * point-wise interface of dealii::Function. The dynamic_cast should not be done in the loops over
+ * quadrature points. Instead, the result is determined once during setup, stored next to the
+ * function, and passed to FunctionEvaluator::value() together with the function.
+ */
+template<int dim>
+inline VectorizedFunction<dim> const *
+get_vectorized_function(dealii::Function<dim> const * function)
+{
+  return dynamic_cast<VectorizedFunction<dim> const *>(function);
+}
+
+/*
+ * Evaluates the first n_components components of a function for all SIMD lanes at once.
+ */
+template<int dim, typename Number, std::size_t n_components>
+inline DEAL_II_ALWAYS_INLINE //
+  std::array<dealii::VectorizedArray<Number>, n_components>
+  evaluate_vectorized_function(VectorizedFunction<dim> const &                             function,
+                               dealii::Point<dim, dealii::VectorizedArray<Number>> const & q_points)
+{
+  std::array<dealii::VectorizedArray<Number>, n_components> values;
+
+  function.vectorized_value(
+    q_points, dealii::ArrayView<dealii::VectorizedArray<Number>>(values.data(), values.size()));
+
+  return values;
+}
+
 template<int rank, int dim, typename Number>
 struct FunctionEvaluator
 {
@@ -61,6 +93,43 @@ struct FunctionEvaluator
     return value(function, q_points);
   }
 
+  static inline DEAL_II_ALWAYS_INLINE //
+    dealii::Tensor<rank, dim, dealii::VectorizedArray<Number>>
+    value(VectorizedFunction<dim> const &                             function,
+          dealii::Point<dim, dealii::VectorizedArray<Number>> const & q_points)
+  {
+    std::array<dealii::VectorizedArray<Number>,
+               dealii::Tensor<rank, dim>::n_independent_components> const values =
+      evaluate_vectorized_function<dim,
+                                   Number,
+                                   dealii::Tensor<rank, dim>::n_independent_components>(function,
+                                                                                        q_points);
+
+    dealii::Tensor<rank, dim, dealii::VectorizedArray<Number>> value;
+    for(unsigned int c = 0; c < dealii::Tensor<rank, dim>::n_independent_components; ++c)
+      value[dealii::Tensor<rank, dim>::unrolled_to_component_indices(c)] = values[c];
+
+    return value;
+  }
+
+  /*
+   * Uses the vectorized interface of the function if available, see get_vectorized_function().
+   */
+  static inline DEAL_II_ALWAYS_INLINE //
+    dealii::Tensor<rank, dim, dealii::VectorizedArray<Number>>
+    value(dealii::Function<dim> &                                     function,
+          VectorizedFunction<dim> const *                             vectorized_function,
+          dealii::Point<dim, dealii::VectorizedArray<Number>> const & q_points,
+          double const &                                              time)
+  {
+    function.set_time(time);
+
+    if(vectorized_function != nullptr)
+      return value(*vectorized_function, q_points);
+
+    return value(function, q_points);
+  }
+
   static inline DEAL_II_ALWAYS_INLINE //
     dealii::Tensor<rank, dim, dealii::VectorizedArray<Number>>
     value(ContainerInterfaceData<rank, dim, double> const & function,
@@ -167,6 +236,14 @@ struct FunctionEvaluator<0, dim, Number>
     return value;
   }
 
+  static inline DEAL_II_ALWAYS_INLINE //
+    dealii::Tensor<0, dim, dealii::VectorizedArray<Number>>
+    value(VectorizedFunction<dim> const &                             function,
+          dealii::Point<dim, dealii::VectorizedArray<Number>> const & q_points)
+  {
+    return evaluate_vectorized_function<dim, Number, 1>(function, q_points)[0];
+  }
+
   static inline DEAL_II_ALWAYS_INLINE //
     dealii::Tensor<0, dim, dealii::VectorizedArray<Number>>
     value(dealii::Function<dim> &                                     function,
@@ -177,6 +254,24 @@ struct FunctionEvaluator<0, dim, Number>
     return value(function, q_points);
   }
 
+  /*
+   * Uses the vectorized interface of the function if available, see get_vectorized_function().
+   */
+  static inline DEAL_II_ALWAYS_INLINE //
+    dealii::Tensor<0, dim, dealii::VectorizedArray<Number>>
+    value(dealii::Function<dim> &                                     function,
+          VectorizedFunction<dim> const *                             vectorized_function,
+          dealii::Point<dim, dealii::VectorizedArray<Number>> const & q_points,
+          double const &                                              time)
+  {
+    function.set_time(time);
+
+    if(vectorized_function != nullptr)
+      return value(*vectorized_function, q_points);
+
+    return value(function, q_points);
+  }
+
 
   static inline DEAL_II_ALWAYS_INLINE //
     dealii::Tensor<0, dim, dealii::VectorizedArray<Number>>
@@ -185,10 +280,13 @@ struct FunctionEvaluator<0, dim, Number>
           unsigned int const                             q,
           unsigned int const                             quad_index)
   {
+    AssertDimension(function.get_n_lanes(), dealii::VectorizedArray<Number>::size());
+
     dealii::VectorizedArray<Number> value = dealii::make_vectorized_array<Number>(0.0);
 
+    dealii::Tensor<0, dim, double> const * data = function.get_data(quad_index, face, q);
     for(unsigned int v = 0; v < dealii::VectorizedArray<Number>::size(); ++v)
-      value[v] = function.get_data(quad_index, face, q, v);
+      value[v] = data[v];
 
     return value;
   }
@@ -219,13 +317,46 @@ struct FunctionEvaluator<1, dim, Number>
     return value;
   }
 
+  static inline DEAL_II_ALWAYS_INLINE //
+    dealii::Tensor<1, dim, dealii::VectorizedArray<Number>>
+    value(VectorizedFunction<dim> const &                             function,
+          dealii::Point<dim, dealii::VectorizedArray<Number>> const & q_points)
+  {
+    std::array<dealii::VectorizedArray<Number>, dim> const values =
+      evaluate_vectorized_function<dim, Number, dim>(function, q_points);
+
+    dealii::Tensor<1, dim, dealii::VectorizedArray<Number>> value;
+    for(unsigned int d = 0; d < dim; ++d)
+      value[d] = values[d];
+
+    return value;
+  }
+
+  static inline DEAL_II_ALWAYS_INLINE //
+    dealii::Tensor<1, dim, dealii::VectorizedArray<Number>>
+    value(dealii::Function<dim> &                                     function,
+          dealii::Point<dim, dealii::VectorizedArray<Number>> const & q_points,
+          double const &                                              time)
+  {
+    function.set_time(time);
+    return value(function, q_points);
+  }
+
+  /*
+   * Uses the vectorized interface of the function if available, see get_vectorized_function().
+   */
   static inline DEAL_II_ALWAYS_INLINE //
     dealii::Tensor<1, dim, dealii::VectorizedArray<Number>>
     value(dealii::Function<dim> &                                     function,
+          VectorizedFunction<dim> const *                             vectorized_function,
           dealii::Point<dim, dealii::VectorizedArray<Number>> const & q_points,
           double const &                                              time)
   {
     function.set_time(time);
+
+    if(vectorized_function != nullptr)
+      return value(*vectorized_function, q_points);
+
     return value(function, q_points);
   }
 
@@ -238,11 +369,10 @@ struct FunctionEvaluator<1, dim, Number>
   {
     dealii::Tensor<1, dim, dealii::VectorizedArray<Number>> value;
 
-    std::array<dealii::Tensor<1, dim, Number>, dealii::VectorizedArray<Number>::size()>
-      tensor_array;
+    AssertDimension(function.get_n_lanes(), dealii::VectorizedArray<Number>::size());
 
-    for(unsigned int v = 0; v < dealii::VectorizedArray<Number>::size(); ++v)
-      tensor_array[v] = function.get_data(quad_index, face, q, v);
+    // values of all SIMD lanes are stored contiguously
+    dealii::Tensor<1, dim, double> const * tensor_array = function.get_data(quad_index, face, q);
 
     for(unsigned int d = 0; d < dim; ++d)
     {
@@ -324,13 +454,50 @@ struct FunctionEvaluator<2, dim, Number>
     return value;
   }
 
+  static inline DEAL_II_ALWAYS_INLINE //
+    dealii::Tensor<2, dim, dealii::VectorizedArray<Number>>
+    value(VectorizedFunction<dim> const &                             function,
+          dealii::Point<dim, dealii::VectorizedArray<Number>> const & q_points)
+  {
+    std::array<dealii::VectorizedArray<Number>, dealii::Tensor<2, dim>::n_independent_components>
+      const values =
+        evaluate_vectorized_function<dim, Number, dealii::Tensor<2, dim>::n_independent_components>(
+          function, q_points);
+
+    dealii::Tensor<2, dim, dealii::VectorizedArray<Number>> value;
+    for(unsigned int d1 = 0; d1 < dim; ++d1)
+      for(unsigned int d2 = 0; d2 < dim; ++d2)
+        value[d1][d2] = values[dealii::Tensor<2, dim>::component_to_unrolled_index(
+          dealii::TableIndices<2>(d1, d2))];
+
+    return value;
+  }
+
+  static inline DEAL_II_ALWAYS_INLINE //
+    dealii::Tensor<2, dim, dealii::VectorizedArray<Number>>
+    value(dealii::Function<dim> &                                     function,
+          dealii::Point<dim, dealii::VectorizedArray<Number>> const & q_points,
+          double const &                                              time)
+  {
+    function.set_time(time);
+    return value(function, q_points);
+  }
+
+  /*
+   * Uses the vectorized interface of the function if available, see get_vectorized_function().
+   */
   static inline DEAL_II_ALWAYS_INLINE //
     dealii::Tensor<2, dim, dealii::VectorizedArray<Number>>
     value(dealii::Function<dim> &                                     function,
+          VectorizedFunction<dim> const *                             vectorized_function,
           dealii::Point<dim, dealii::VectorizedArray<Number>> const & q_points,
           double const &                                              time)
   {
     function.set_time(time);
+
+    if(vectorized_function != nullptr)
+      return value(*vectorized_function, q_points);
+
     return value(function, q_points);
   }
 
@@ -343,11 +510,10 @@ struct FunctionEvaluator<2, dim, Number>
   {
     dealii::Tensor<2, dim, dealii::VectorizedArray<Number>> value;
 
-    std::array<dealii::Tensor<2, dim, Number>, dealii::VectorizedArray<Number>::size()>
-      tensor_array;
+    AssertDimension(function.get_n_lanes(), dealii::VectorizedArray<Number>::size());
 
-    for(unsigned int v = 0; v < dealii::VectorizedArray<Number>::size(); ++v)
-      tensor_array[v] = function.get_data(quad_index, face, q, v);
+    // values of all SIMD lanes are stored contiguously
+    dealii::Tensor<2, dim, double> const * tensor_array = function.get_data(quad_index, face, q);
 
     for(unsigned int d1 = 0; d1 < dim; ++d1)
     {
@@ -390,6 +556,27 @@ struct FunctionEvaluator<2, dim, Number>
     return value;
   }
 
+  static inline DEAL_II_ALWAYS_INLINE //
+    dealii::SymmetricTensor<2, dim, dealii::VectorizedArray<Number>>
+    value_symmetric(VectorizedFunction<dim> const &                             function,
+                    dealii::Point<dim, dealii::VectorizedArray<Number>> const & q_points)
+  {
+    std::array<dealii::VectorizedArray<Number>,
+               dealii::SymmetricTensor<2, dim>::n_independent_components> const values =
+      evaluate_vectorized_function<dim,
+                                   Number,
+                                   dealii::SymmetricTensor<2, dim>::n_independent_components>(
+        function, q_points);
+
+    dealii::SymmetricTensor<2, dim, dealii::VectorizedArray<Number>> value;
+    for(unsigned int d1 = 0; d1 < dim; ++d1)
+      for(unsigned int d2 = d1; d2 < dim; ++d2)
+        value[d1][d2] = values[dealii::SymmetricTensor<2, dim>::component_to_unrolled_index(
+          dealii::TableIndices<2>(d1, d2))];
+
+    return value;
+  }
+
   static inline DEAL_II_ALWAYS_INLINE //
     dealii::SymmetricTensor<2, dim, dealii::VectorizedArray<Number>>
     value_symmetric(dealii::Function<dim> &                                     function,
@@ -409,11 +596,10 @@ struct FunctionEvaluator<2, dim, Number>
   {
     dealii::SymmetricTensor<2, dim, dealii::VectorizedArray<Number>> value;
 
-    std::array<dealii::SymmetricTensor<2, dim, Number>, dealii::VectorizedArray<Number>::size()>
-      tensor_array;
+    AssertDimension(function.get_n_lanes(), dealii::VectorizedArray<Number>::size());
 
-    for(unsigned int v = 0; v < dealii::VectorizedArray<Number>::size(); ++v)
-      tensor_array[v] = function.get_data(quad_index, face, q, v);
+    // values of all SIMD lanes are stored contiguously
+    dealii::Tensor<2, dim, double> const * tensor_array = function.get_data(quad_index, face, q);
 
     for(unsigned int d1 = 0; d1 < dim; ++d1)
     {
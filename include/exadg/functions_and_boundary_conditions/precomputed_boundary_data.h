@@ -0,0 +1,437 @@
+/*  ______________________________________________________________________
+ *
+ *  ExaDG - High-Order Discontinuous Galerkin for the Exa-Scale
+ *
+ *  Copyright (C) 2021 by the ExaDG authors
+ *
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation, either version 3 of the License, or
+ *  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ *  ______________________________________________________________________
+ */
+
+#ifndef INCLUDE_EXADG_FUNCTIONS_AND_BOUNDARY_CONDITIONS_PRECOMPUTED_BOUNDARY_DATA_H_
+#define INCLUDE_EXADG_FUNCTIONS_AND_BOUNDARY_CONDITIONS_PRECOMPUTED_BOUNDARY_DATA_H_
+
+// C/C++
+#include <algorithm>
+#include <cmath>
+#include <map>
+#include <memory>
+#include <set>
+#include <string>
+#include <type_traits>
+#include <vector>
+
+// deal.II
+#include <deal.II/base/aligned_vector.h>
+#include <deal.II/base/function.h>
+#include <deal.II/base/numbers.h>
+#include <deal.II/base/vectorization.h>
+#include <deal.II/matrix_free/matrix_free.h>
+
+// ExaDG
+#include <exadg/functions_and_boundary_conditions/evaluate_functions.h>
+#include <exadg/functions_and_boundary_conditions/separable_function.h>
+#include <exadg/matrix_free/integrators.h>
+
+namespace ExaDG
+{
+/*
+ * Boundary functions that are time-independent or separable in space and time (see
+ * SeparableFunction) only need to be evaluated once in the quadrature points of the boundary
+ * faces. This class tabulates the (spatial part of the) boundary functions for all boundary face
+ * batches with the given boundary IDs, and scales the tabulated data by the temporal factor when
+ * accessed.
+ *
+ * The data of a quadrature point is stored in a flat array in the order {component, lane}, i.e.,
+ * the values of all SIMD lanes of a component are contiguous in memory and can be loaded directly
+ * into a dealii::VectorizedArray. The quadrature points of a face batch and the face batches follow
+ * each other. The tabulation depends on the position of the quadrature points and has to be
+ * repeated after the mesh has been moved.
+ */
+template<int dim>
+class PrecomputedBoundaryData
+{
+  using FunctionMap = std::map<dealii::types::boundary_id, std::shared_ptr<dealii::Function<dim>>>;
+
+  // offset of the first entry of a face batch, relative to the first boundary face batch
+  using ArrayFaceOffsets = std::vector<unsigned int>;
+
+public:
+  PrecomputedBoundaryData() : n_lanes(0), n_components(0), face_batch_begin(0)
+  {
+  }
+
+  template<typename Number>
+  void
+  setup(dealii::MatrixFree<dim, Number> const & matrix_free,
+        unsigned int const                      dof_index,
+        std::vector<unsigned int> const &       quad_indices,
+        FunctionMap const &                     functions)
+  {
+    n_lanes = dealii::VectorizedArray<Number>::size();
+
+    n_components = 0;
+    separable_functions.clear();
+    for(auto const & it : functions)
+    {
+      AssertThrow(n_components == 0 or it.second->n_components == n_components,
+                  dealii::ExcMessage("All precomputed boundary functions of a boundary "
+                                     "descriptor need to have the same number of components."));
+      n_components = it.second->n_components;
+
+      auto const separable_function = std::dynamic_pointer_cast<SeparableFunction<dim>>(it.second);
+      if(separable_function.get())
+        separable_functions.insert({it.first, separable_function});
+    }
+
+    face_batch_begin = matrix_free.n_inner_face_batches();
+    unsigned int const n_boundary_face_batches = matrix_free.n_boundary_face_batches();
+
+    unsigned int max_quad_index = 0;
+    for(auto const quad_index : quad_indices)
+      max_quad_index = std::max(max_quad_index, quad_index);
+
+    face_offsets.assign(max_quad_index + 1, ArrayFaceOffsets());
+    data.assign(max_quad_index + 1, dealii::AlignedVector<double>());
+
+    for(auto const quad_index : quad_indices)
+    {
+      ArrayFaceOffsets &              offsets = face_offsets[quad_index];
+      dealii::AlignedVector<double> & values  = data[quad_index];
+
+      offsets.assign(n_boundary_face_batches, dealii::numbers::invalid_unsigned_int);
+
+      FaceIntegrator<dim, 1, Number> integrator(matrix_free, true, dof_index, quad_index);
+
+      // count entries first to avoid reallocations
+      unsigned int n_entries = 0;
+      for(unsigned int face = face_batch_begin; face < face_batch_begin + n_boundary_face_batches;
+          ++face)
+      {
+        if(functions.find(matrix_free.get_boundary_id(face)) != functions.end())
+        {
+          integrator.reinit(face);
+          offsets[face - face_batch_begin] = n_entries;
+          n_entries += integrator.n_q_points * n_components * n_lanes;
+        }
+      }
+
+      values.resize_fast(n_entries);
+
+      for(unsigned int face = face_batch_begin; face < face_batch_begin + n_boundary_face_batches;
+          ++face)
+      {
+        auto const it = functions.find(matrix_free.get_boundary_id(face));
+        if(it == functions.end())
+          continue;
+
+        auto const separable_function = separable_functions.find(it->first);
+        bool const is_separable       = separable_function != separable_functions.end();
+
+        dealii::Function<dim> const & function =
+          is_separable ? separable_function->second->get_spatial_function() : *it->second;
+
+        integrator.reinit(face);
+
+        double * face_values = values.data() + offsets[face - face_batch_begin];
+        for(unsigned int q = 0; q < integrator.n_q_points; ++q)
+        {
+          dealii::Point<dim, dealii::VectorizedArray<Number>> const q_points =
+            integrator.quadrature_point(q);
+
+          for(unsigned int v = 0; v < n_lanes; ++v)
+          {
+            dealii::Point<dim> q_point;
+            for(unsigned int d = 0; d < dim; ++d)
+              q_point[d] = q_points[d][v];
+
+            for(unsigned int c = 0; c < n_components; ++c)
+              face_values[(q * n_components + c) * n_lanes + v] = function.value(q_point, c);
+
+            AssertThrow(is_separable or is_time_independent(*it->second, q_point),
+                        dealii::ExcMessage(
+                          "The boundary function of boundary ID " + std::to_string(it->first) +
+                          " in precomputed_bc depends on time, but is not a SeparableFunction."));
+          }
+        }
+      }
+    }
+  }
+
+  /*
+   * Returns true if data has been tabulated for the given face batch and quadrature index.
+   */
+  inline DEAL_II_ALWAYS_INLINE //
+    bool
+    is_available(unsigned int const face, unsigned int const quad_index) const
+  {
+    return quad_index < face_offsets.size() and face >= face_batch_begin and
+           face - face_batch_begin < face_offsets[quad_index].size() and
+           face_offsets[quad_index][face - face_batch_begin] !=
+             dealii::numbers::invalid_unsigned_int;
+  }
+
+  template<int rank, typename Number>
+  inline DEAL_II_ALWAYS_INLINE //
+    dealii::Tensor<rank, dim, dealii::VectorizedArray<Number>>
+    get_value(dealii::types::boundary_id const boundary_id,
+              unsigned int const               face,
+              unsigned int const               q,
+              unsigned int const               quad_index,
+              double const                     time) const
+  {
+    static_assert(rank == 0 or rank == 1, "Only implemented for scalar and vectorial functions.");
+
+    AssertDimension(n_lanes, dealii::VectorizedArray<Number>::size());
+    AssertThrow(is_available(face, quad_index),
+                dealii::ExcMessage("No precomputed boundary data available for this face batch."));
+    Assert((rank == 0 ? 1 : dim) <= n_components,
+           dealii::ExcMessage("Precomputed boundary data has too few components."));
+
+    auto const   separable_function = separable_functions.find(boundary_id);
+    Number const factor             = separable_function != separable_functions.end() ?
+                                        separable_function->second->get_time_factor(time) :
+                                        1.0;
+
+    double const * values = data[quad_index].data() +
+                            face_offsets[quad_index][face - face_batch_begin] +
+                            q * n_components * n_lanes;
+
+    dealii::Tensor<rank, dim, dealii::VectorizedArray<Number>> value;
+    for(unsigned int c = 0; c < (rank == 0 ? 1 : dim); ++c)
+    {
+      dealii::VectorizedArray<Number> component_value;
+      if constexpr(std::is_same_v<Number, double>)
+      {
+        component_value.load(values + c * n_lanes);
+      }
+      else
+      {
+        for(unsigned int v = 0; v < n_lanes; ++v)
+          component_value[v] = values[c * n_lanes + v];
+      }
+
+      if constexpr(rank == 0)
+        value = factor * component_value;
+      else
+        value[c] = factor * component_value;
+    }
+
+    return value;
+  }
+
+private:
+  /*
+   * Boundary functions in precomputed_bc that are not separable need to be time-independent, which
+   * is checked by comparing the values at the current time of the function with the values at a
+   * few other times. The time of the function is restored afterwards.
+   */
+  static bool
+  is_time_independent(dealii::Function<dim> & function, dealii::Point<dim> const & point)
+  {
+    double const time = function.get_time();
+
+    std::vector<double> values(function.n_components);
+    for(unsigned int c = 0; c < function.n_components; ++c)
+      values[c] = function.value(point, c);
+
+    bool time_independent = true;
+    for(double const other_time : {time + 0.5, time + 1.0, time + 1.0e3})
+    {
+      function.set_time(other_time);
+      for(unsigned int c = 0; c < function.n_components; ++c)
+      {
+        double const tolerance = 1.e-12 * std::max(1.0, std::abs(values[c]));
+        if(std::abs(function.value(point, c) - values[c]) > tolerance)
+          time_independent = false;
+      }
+    }
+
+    function.set_time(time);
+
+    return time_independent;
+  }
+
+  // number of SIMD lanes of the face batches the data has been set up for
+  unsigned int n_lanes;
+
+  // number of components stored per quadrature point
+  unsigned int n_components;
+
+  // index of the first boundary face batch
+  unsigned int face_batch_begin;
+
+  // the following arrays are indexed by the quadrature index
+  std::vector<ArrayFaceOffsets>              face_offsets;
+  std::vector<dealii::AlignedVector<double>> data;
+
+  // temporal factors of boundary functions that are separable in space and time
+  std::map<dealii::types::boundary_id, std::shared_ptr<SeparableFunction<dim> const>>
+    separable_functions;
+};
+
+/*
+ * Base class of the boundary descriptors that support tabulated boundary functions: The boundary
+ * descriptor lists the boundary IDs in precomputed_bc, the spatial operator tabulates the boundary
+ * functions of these boundary IDs (see PrecomputedBoundaryData) and attaches the tabulated data to
+ * the boundary descriptor via set_precomputed_data().
+ */
+template<int dim>
+struct PrecomputedBoundaryConditions
+{
+  typedef std::map<dealii::types::boundary_id, std::shared_ptr<dealii::Function<dim>>> FunctionMap;
+
+  // Boundary IDs for which the boundary function is time-independent or separable in space and time
+  // (see SeparableFunction). For these boundary IDs, the boundary function is evaluated only once
+  // in the quadrature points, see PrecomputedBoundaryData.
+  std::set<dealii::types::boundary_id> precomputed_bc;
+
+  void
+  set_precomputed_data(std::shared_ptr<PrecomputedBoundaryData<dim> const> data) const
+  {
+    precomputed_data = data;
+  }
+
+  // returns a nullptr if no precomputed data is available for the given boundary ID
+  inline DEAL_II_ALWAYS_INLINE //
+    PrecomputedBoundaryData<dim> const *
+    get_precomputed_data(dealii::types::boundary_id const boundary_id) const
+  {
+    if(precomputed_data.get() and precomputed_bc.find(boundary_id) != precomputed_bc.end())
+      return precomputed_data.get();
+
+    return nullptr;
+  }
+
+  // returns a nullptr if the boundary function of the given boundary ID does not implement the
+  // vectorized interface (or if the vectorized interfaces have not been resolved yet)
+  inline DEAL_II_ALWAYS_INLINE //
+    VectorizedFunction<dim> const *
+    get_vectorized_boundary_function(dealii::types::boundary_id const boundary_id) const
+  {
+    auto const it = vectorized_functions.find(boundary_id);
+    if(it != vectorized_functions.end())
+      return it->second;
+
+    return nullptr;
+  }
+
+protected:
+  /*
+   * Resolves the vectorized interface (see get_vectorized_function()) of the boundary functions in
+   * the given maps once per boundary ID, so that evaluate_boundary_function() does not need a
+   * dynamic_cast in the loops over quadrature points.
+   */
+  void
+  resolve_vectorized_functions(std::vector<FunctionMap const *> const & function_maps) const
+  {
+    vectorized_functions.clear();
+    for(auto const function_map : function_maps)
+    {
+      for(auto const & it : *function_map)
+      {
+        VectorizedFunction<dim> const * vectorized_function =
+          get_vectorized_function(it.second.get());
+        if(vectorized_function != nullptr)
+          vectorized_functions.insert({it.first, vectorized_function});
+      }
+    }
+  }
+
+  /*
+   * Returns the boundary functions of all boundary IDs in precomputed_bc. The boundary functions
+   * are taken from the given maps, where map_names is used in the error message for boundary IDs
+   * contained in none of the maps.
+   */
+  FunctionMap
+  collect_precomputed_functions(std::vector<FunctionMap const *> const & function_maps,
+                                std::string const &                      map_names) const
+  {
+    FunctionMap functions;
+    for(auto const & boundary_id : precomputed_bc)
+    {
+      bool found = false;
+      for(auto const function_map : function_maps)
+      {
+        auto const it = function_map->find(boundary_id);
+        if(it != function_map->end())
+        {
+          functions.insert(*it);
+          found = true;
+          break;
+        }
+      }
+
+      AssertThrow(found,
+                  dealii::ExcMessage("Boundary IDs in precomputed_bc need to be part of " +
+                                     map_names + "."));
+    }
+
+    return functions;
+  }
+
+private:
+  mutable std::shared_ptr<PrecomputedBoundaryData<dim> const> precomputed_data;
+
+  mutable std::map<dealii::types::boundary_id, VectorizedFunction<dim> const *>
+    vectorized_functions;
+};
+
+/*
+ * Evaluates a boundary function in quadrature point q of the face batch the integrator is
+ * currently initialized for. If the boundary descriptor provides precomputed data for this
+ * boundary ID and face batch, the function is not evaluated but the precomputed data is used.
+ * Otherwise, the function is evaluated via its vectorized interface if the boundary descriptor has
+ * resolved one for this boundary ID, and point by point for all SIMD lanes else. Since the
+ * precomputed data is indexed by face batches, integrators initialized in cell-based face loops
+ * always evaluate the function directly.
+ */
+template<int rank, int dim, typename Number, typename BoundaryDescriptorType, typename Integrator>
+inline DEAL_II_ALWAYS_INLINE //
+  dealii::Tensor<rank, dim, dealii::VectorizedArray<Number>>
+  evaluate_boundary_function(dealii::Function<dim> &          function,
+                             BoundaryDescriptorType const &   boundary_descriptor,
+                             dealii::types::boundary_id const boundary_id,
+                             Integrator const &               integrator,
+                             unsigned int const               q,
+                             double const                     time)
+{
+  PrecomputedBoundaryData<dim> const * const precomputed_data =
+    boundary_descriptor.get_precomputed_data(boundary_id);
+
+  bool const is_cell_based_face_loop =
+    integrator.get_dof_access_index() ==
+    dealii::internal::MatrixFreeFunctions::DoFInfo::dof_access_cell;
+
+  if(precomputed_data != nullptr and not(is_cell_based_face_loop) and
+     precomputed_data->is_available(integrator.get_current_cell_index(),
+                                    integrator.get_quadrature_index()))
+  {
+    return precomputed_data->template get_value<rank, Number>(boundary_id,
+                                                              integrator.get_current_cell_index(),
+                                                              q,
+                                                              integrator.get_quadrature_index(),
+                                                              time);
+  }
+
+  return FunctionEvaluator<rank, dim, Number>::value(
+    function,
+    boundary_descriptor.get_vectorized_boundary_function(boundary_id),
+    integrator.quadrature_point(q),
+    time);
+}
+
+} // namespace ExaDG
+
+#endif /* INCLUDE_EXADG_FUNCTIONS_AND_BOUNDARY_CONDITIONS_PRECOMPUTED_BOUNDARY_DATA_H_ */
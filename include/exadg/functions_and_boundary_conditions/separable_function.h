@@ -0,0 +1,76 @@
+/*  ______________________________________________________________________
+ *
+ *  ExaDG - High-Order Discontinuous Galerkin for the Exa-Scale
+ *
+ *  Copyright (C) 2021 by the ExaDG authors
+ *
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation, either version 3 of the License, or
+ *  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ *  ______________________________________________________________________
+ */
+
+#ifndef INCLUDE_EXADG_FUNCTIONS_AND_BOUNDARY_CONDITIONS_SEPARABLE_FUNCTION_H_
+#define INCLUDE_EXADG_FUNCTIONS_AND_BOUNDARY_CONDITIONS_SEPARABLE_FUNCTION_H_
+
+// C/C++
+#include <functional>
+#include <memory>
+
+// deal.II
+#include <deal.II/base/function.h>
+
+namespace ExaDG
+{
+/*
+ * A function that is separable in space and time, f(x,t) = f(x) * g(t), where f(x) is a
+ * (time-independent) dealii::Function and g(t) a scalar factor. Boundary conditions of this type
+ * can be precomputed in the quadrature points, see PrecomputedBoundaryData.
+ */
+template<int dim>
+class SeparableFunction : public dealii::Function<dim>
+{
+public:
+  SeparableFunction(std::shared_ptr<dealii::Function<dim>> spatial_function,
+                    std::function<double(double const)>    temporal_factor)
+    : dealii::Function<dim>(spatial_function->n_components, 0.0),
+      spatial_function(spatial_function),
+      temporal_factor(temporal_factor)
+  {
+  }
+
+  double
+  value(dealii::Point<dim> const & p, unsigned int const component = 0) const final
+  {
+    return get_time_factor(this->get_time()) * spatial_function->value(p, component);
+  }
+
+  dealii::Function<dim> const &
+  get_spatial_function() const
+  {
+    return *spatial_function;
+  }
+
+  double
+  get_time_factor(double const time) const
+  {
+    return temporal_factor(time);
+  }
+
+private:
+  std::shared_ptr<dealii::Function<dim>> spatial_function;
+  std::function<double(double const)>    temporal_factor;
+};
+
+} // namespace ExaDG
+
+#endif /* INCLUDE_EXADG_FUNCTIONS_AND_BOUNDARY_CONDITIONS_SEPARABLE_FUNCTION_H_ */
@@ -0,0 +1,157 @@
+/*  ______________________________________________________________________
+ *
+ *  ExaDG - High-Order Discontinuous Galerkin for the Exa-Scale
+ *
+ *  Copyright (C) 2021 by the ExaDG authors
+ *
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation, either version 3 of the License, or
+ *  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ *  ______________________________________________________________________
+ */
+
+#ifndef INCLUDE_EXADG_FUNCTIONS_AND_BOUNDARY_CONDITIONS_VECTORIZED_FUNCTION_H_
+#define INCLUDE_EXADG_FUNCTIONS_AND_BOUNDARY_CONDITIONS_VECTORIZED_FUNCTION_H_
+
+// deal.II
+#include <deal.II/base/array_view.h>
+#include <deal.II/base/function.h>
+#include <deal.II/base/point.h>
+#include <deal.II/base/vectorization.h>
+
+namespace ExaDG
+{
+/*
+ * Extends the Function class of deal.II by an interface that evaluates a function for all SIMD
+ * lanes of a batch of points at once, returning all requested components in a single call. This
+ * avoids unpacking the points into lanes and calling the virtual function value() once per lane
+ * and component, see FunctionEvaluator.
+ *
+ * The time is the same for all SIMD lanes and is accessed via get_time() as for any
+ * dealii::Function.
+ *
+ * The default implementation of the vectorized interface falls back to the point-wise interface,
+ * so that a class deriving from VectorizedFunction only has to implement value() for
+ * correctness.
+ */
+template<int dim>
+class VectorizedFunction : public dealii::Function<dim>
+{
+public:
+  VectorizedFunction(unsigned int const n_components = 1, double const time = 0.0)
+    : dealii::Function<dim>(n_components, time)
+  {
+  }
+
+  virtual ~VectorizedFunction()
+  {
+  }
+
+  /*
+   * Evaluates the first values.size() components of the function in the points of all SIMD
+   * lanes.
+   */
+  virtual void
+  vectorized_value(dealii::Point<dim, dealii::VectorizedArray<double>> const & points,
+                   dealii::ArrayView<dealii::VectorizedArray<double>> const &  values) const
+  {
+    do_vectorized_value_lane_by_lane(points, values);
+  }
+
+  virtual void
+  vectorized_value(dealii::Point<dim, dealii::VectorizedArray<float>> const & points,
+                   dealii::ArrayView<dealii::VectorizedArray<float>> const &  values) const
+  {
+    do_vectorized_value_lane_by_lane(points, values);
+  }
+
+private:
+  template<typename Number>
+  void
+  do_vectorized_value_lane_by_lane(
+    dealii::Point<dim, dealii::VectorizedArray<Number>> const & points,
+    dealii::ArrayView<dealii::VectorizedArray<Number>> const &  values) const
+  {
+    AssertIndexRange(values.size(), this->n_components + 1);
+
+    for(unsigned int v = 0; v < dealii::VectorizedArray<Number>::size(); ++v)
+    {
+      dealii::Point<dim> point;
+      for(unsigned int d = 0; d < dim; ++d)
+        point[d] = points[d][v];
+
+      for(unsigned int c = 0; c < values.size(); ++c)
+        values[c][v] = this->value(point, c);
+    }
+  }
+};
+
+/*
+ * Helper class to implement a VectorizedFunction with a single code path for the point-wise and
+ * the vectorized interface. The derived class Derived (curiously recurring template pattern) has
+ * to provide the member function template
+ *
+ *   template<typename Number>
+ *   Number
+ *   evaluate(dealii::Point<dim, Number> const & p, unsigned int const component) const;
+ *
+ * which is instantiated for Number = double as well as Number = dealii::VectorizedArray<double>
+ * and dealii::VectorizedArray<float>. Hence, the implementation has to be free of branches that
+ * depend on the coordinates of the point.
+ */
+template<int dim, typename Derived>
+class GenericVectorizedFunction : public VectorizedFunction<dim>
+{
+public:
+  GenericVectorizedFunction(unsigned int const n_components = 1, double const time = 0.0)
+    : VectorizedFunction<dim>(n_components, time)
+  {
+  }
+
+  double
+  value(dealii::Point<dim> const & p, unsigned int const component = 0) const final
+  {
+    return static_cast<Derived const &>(*this).evaluate(p, component);
+  }
+
+  void
+  vectorized_value(dealii::Point<dim, dealii::VectorizedArray<double>> const & points,
+                   dealii::ArrayView<dealii::VectorizedArray<double>> const &  values) const final
+  {
+    do_vectorized_value(points, values);
+  }
+
+  void
+  vectorized_value(dealii::Point<dim, dealii::VectorizedArray<float>> const & points,
+                   dealii::ArrayView<dealii::VectorizedArray<float>> const &  values) const final
+  {
+    do_vectorized_value(points, values);
+  }
+
+private:
+  template<typename Number>
+  void
+  do_vectorized_value(dealii::Point<dim, dealii::VectorizedArray<Number>> const & points,
+                      dealii::ArrayView<dealii::VectorizedArray<Number>> const &  values) const
+  {
+    AssertIndexRange(values.size(), this->n_components + 1);
+
+    Derived const & derived = static_cast<Derived const &>(*this);
+
+    for(unsigned int c = 0; c < values.size(); ++c)
+      values[c] = derived.evaluate(points, c);
+  }
+};
+
+} // namespace ExaDG
+
+#endif /* INCLUDE_EXADG_FUNCTIONS_AND_BOUNDARY_CONDITIONS_VECTORIZED_FUNCTION_H_ */
@@ -0,0 +1,511 @@
+/*  ______________________________________________________________________
+ *
+ *  ExaDG - High-Order Discontinuous Galerkin for the Exa-Scale
+ *
+ *  Copyright (C) 2021 by the ExaDG authors
+ *
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation, either version 3 of the License, or
+ *  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ *  ______________________________________________________________________
+ */
+
+#ifndef INCLUDE_EXADG_GRID_FULLY_DISTRIBUTED_REFINEMENT_H_
+#define INCLUDE_EXADG_GRID_FULLY_DISTRIBUTED_REFINEMENT_H_
+
+// C/C++
+#include <algorithm>
+#include <array>
+#include <map>
+#include <memory>
+#include <vector>
+
+// deal.II
+#include <deal.II/base/mpi.h>
+#include <deal.II/distributed/fully_distributed_tria.h>
+#include <deal.II/grid/grid_tools.h>
+#include <deal.II/grid/tria.h>
+#include <deal.II/grid/tria_description.h>
+#include <deal.II/multigrid/mg_transfer_global_coarsening.h>
+
+// ExaDG
+#include <exadg/grid/balanced_granularity_partition_policy.h>
+#include <exadg/grid/grid_data.h>
+
+namespace ExaDG
+{
+namespace GridUtilities
+{
+/**
+ * Partitions a serial triangulation into n_partitions parts by setting the subdomain IDs of the
+ * active cells.
+ */
+template<int dim>
+void
+partition_serial_triangulation(dealii::Triangulation<dim> & tria,
+                               unsigned int const           n_partitions,
+                               PartitioningType const &     partitioning_type)
+{
+  if(partitioning_type == PartitioningType::Metis)
+  {
+    dealii::GridTools::partition_triangulation(n_partitions, tria);
+  }
+  else if(partitioning_type == PartitioningType::z_order)
+  {
+    dealii::GridTools::partition_triangulation_zorder(n_partitions, tria);
+  }
+  else
+  {
+    AssertThrow(false, dealii::ExcNotImplemented());
+  }
+}
+
+/**
+ * dealii::parallel::fullydistributed::Triangulation does not support adaptive mesh refinement. This
+ * class realizes adaptive mesh refinement for fully-distributed triangulations by keeping a copy of
+ * the serial triangulation on the first process of each partitioning group (see
+ * GridData::partitioning_group_size):
+ *
+ *   1) The refinement flags of the locally owned cells are collected on the first process of the
+ *      own partitioning group, exchanged between the first processes of all groups and applied to
+ *      the serial triangulation, which is then refined and partitioned again.
+ *   2) Every process receives the information where the data of its locally owned cells has to be
+ *      sent to (see get_cell_transfers() and ExaDG::SolutionTransfer).
+ *   3) A new fully-distributed triangulation and the coarse triangulations required for global
+ *      coarsening multigrid are created from the serial triangulation, where the coarse levels
+ *      are repartitioned using BalancedGranularityPartitionPolicy.
+ *
+ * Hence, the memory requirements correspond to those of the initial setup of the fully-distributed
+ * triangulation, but persist during the simulation. They can be reduced by choosing a larger
+ * partitioning group size, which has to be larger than 1 for parallel runs. Periodic boundary
+ * conditions are currently not supported.
+ */
+template<int dim>
+class FullyDistributedRefinement
+{
+public:
+  // return type of dealii::CellId::to_binary()
+  typedef std::array<unsigned int, 4> CellIdBinary;
+
+  enum class TransferType : unsigned int
+  {
+    Keep,
+    Refine,
+    Coarsen
+  };
+
+  /*
+   * Describes the transfer of the data of a locally owned cell of the triangulation before
+   * adaptive mesh refinement (old_cell) to the triangulation after adaptive mesh refinement
+   * (new_cell). For TransferType::Refine, there is one entry per child, where child_index is the
+   * index of new_cell within old_cell. For TransferType::Coarsen, child_index is the index of
+   * old_cell within new_cell.
+   */
+  struct CellTransfer
+  {
+    CellIdBinary old_cell;
+    CellIdBinary new_cell;
+    TransferType type;
+    unsigned int child_index;
+    unsigned int new_owner;
+  };
+
+  FullyDistributedRefinement(MPI_Comm const & mpi_comm_in, GridData const & data)
+    : mpi_comm(mpi_comm_in),
+      partitioning_type(data.partitioning_type),
+      group_size(data.partitioning_group_size),
+      mesh_smoothing(dealii::Triangulation<dim>::none),
+      settings(dealii::TriangulationDescription::default_setting),
+      group_comm(MPI_COMM_NULL),
+      leader_comm(MPI_COMM_NULL)
+  {
+    unsigned int const rank        = dealii::Utilities::MPI::this_mpi_process(mpi_comm);
+    unsigned int const n_processes = dealii::Utilities::MPI::n_mpi_processes(mpi_comm);
+
+    AssertThrow(group_size > 1 or n_processes == 1,
+                dealii::ExcMessage("Keeping the serial triangulation with a partitioning group "
+                                   "size of 1 stores a copy of the serial triangulation on every "
+                                   "process. Choose GridData::partitioning_group_size > 1."));
+
+    // communicator of the processes of the own partitioning group
+    MPI_Comm_split(mpi_comm, rank / group_size, rank, &group_comm);
+
+    // communicator of the processes holding the serial triangulation
+    int const color = (rank % group_size == 0) ? 0 : MPI_UNDEFINED;
+    MPI_Comm_split(mpi_comm, color, rank, &leader_comm);
+  }
+
+  FullyDistributedRefinement(FullyDistributedRefinement const &) = delete;
+
+  FullyDistributedRefinement &
+  operator=(FullyDistributedRefinement const &) = delete;
+
+  ~FullyDistributedRefinement()
+  {
+    if(leader_comm != MPI_COMM_NULL)
+      MPI_Comm_free(&leader_comm);
+
+    if(group_comm != MPI_COMM_NULL)
+      MPI_Comm_free(&group_comm);
+  }
+
+  /*
+   * Sets the parameters used to create the fully-distributed triangulation. This function has to
+   * be called on all processes.
+   */
+  void
+  reinit(typename dealii::Triangulation<dim>::MeshSmoothing const mesh_smoothing_in,
+         dealii::TriangulationDescription::Settings const         settings_in)
+  {
+    mesh_smoothing = mesh_smoothing_in;
+    settings       = settings_in;
+  }
+
+  /*
+   * Stores a copy of the partitioned serial triangulation. This function is called on the first
+   * process of each partitioning group only.
+   */
+  void
+  set_serial_triangulation(dealii::Triangulation<dim> const & tria_serial)
+  {
+    serial_triangulation = std::make_shared<dealii::Triangulation<dim>>(mesh_smoothing);
+    serial_triangulation->copy_triangulation(tria_serial);
+  }
+
+  /*
+   * Applies the refinement flags set on the fully-distributed triangulation to the serial
+   * triangulation, refines and repartitions the serial triangulation, and determines the cell
+   * transfers of the locally owned cells. The fully-distributed triangulation itself is not
+   * changed, see create_triangulation().
+   */
+  void
+  prepare_coarsening_and_refinement(dealii::Triangulation<dim> const & triangulation)
+  {
+    unsigned int const rank        = dealii::Utilities::MPI::this_mpi_process(mpi_comm);
+    unsigned int const n_processes = dealii::Utilities::MPI::n_mpi_processes(mpi_comm);
+
+    bool const is_leader = (leader_comm != MPI_COMM_NULL);
+
+    AssertThrow(not is_leader or serial_triangulation.get(),
+                dealii::ExcMessage("Serial triangulation has not been set. Adaptive mesh "
+                                   "refinement for TriangulationType::FullyDistributed requires "
+                                   "GridData::keep_serial_triangulation."));
+
+    // collect refinement flags of locally owned cells (cell id and 1 for refinement, 0 for
+    // coarsening) on the first process of each partitioning group
+    std::vector<unsigned int> local_flags;
+    for(auto const & cell : triangulation.active_cell_iterators())
+    {
+      if(cell->is_locally_owned() and (cell->refine_flag_set() or cell->coarsen_flag_set()))
+      {
+        CellIdBinary const id = cell->id().template to_binary<dim>();
+        local_flags.insert(local_flags.end(), id.begin(), id.end());
+        local_flags.push_back(cell->refine_flag_set() ? 1 : 0);
+      }
+    }
+
+    std::vector<std::vector<unsigned int>> const group_flags =
+      dealii::Utilities::MPI::gather(group_comm, local_flags, 0);
+
+    std::map<unsigned int, std::vector<unsigned int>> send_data;
+
+    if(is_leader)
+    {
+      std::vector<unsigned int> flags_of_group;
+      for(auto const & flags_of_process : group_flags)
+        flags_of_group.insert(flags_of_group.end(),
+                              flags_of_process.begin(),
+                              flags_of_process.end());
+
+      // every copy of the serial triangulation has to be refined with the flags of all groups
+      std::vector<std::vector<unsigned int>> const all_flags =
+        dealii::Utilities::MPI::all_gather(leader_comm, flags_of_group);
+
+      std::vector<unsigned int> flags;
+      for(auto const & flags_of_leader : all_flags)
+        flags.insert(flags.end(), flags_of_leader.begin(), flags_of_leader.end());
+
+      std::map<CellIdBinary, bool> refine;
+      for(unsigned int i = 0; i < flags.size(); i += 5)
+      {
+        CellIdBinary id;
+        std::copy(flags.begin() + i, flags.begin() + i + 4, id.begin());
+        refine[id] = (flags[i + 4] == 1);
+      }
+
+      // refine serial triangulation, where mesh smoothing is applied by
+      // prepare_coarsening_and_refinement()
+      std::map<CellIdBinary, unsigned int> old_owners;
+      for(auto const & cell : serial_triangulation->active_cell_iterators())
+      {
+        CellIdBinary const id = cell->id().template to_binary<dim>();
+
+        auto const it = refine.find(id);
+        if(it != refine.end())
+        {
+          if(it->second)
+            cell->set_refine_flag();
+          else
+            cell->set_coarsen_flag();
+        }
+
+        old_owners[id] = cell->subdomain_id();
+      }
+
+      serial_triangulation->prepare_coarsening_and_refinement();
+      serial_triangulation->execute_coarsening_and_refinement();
+
+      partition_serial_triangulation(*serial_triangulation, n_processes, partitioning_type);
+
+      // send the cell transfers to the old owners of the cells in the own partitioning group
+      unsigned int const group = rank / group_size;
+
+      auto const add_cell_transfer = [&](CellIdBinary const & old_cell,
+                                         CellIdBinary const & new_cell,
+                                         TransferType const   type,
+                                         unsigned int const   child_index,
+                                         unsigned int const   new_owner) {
+        unsigned int const old_owner = old_owners.at(old_cell);
+        if(old_owner / group_size == group)
+        {
+          std::vector<unsigned int> & buffer = send_data[old_owner];
+          buffer.insert(buffer.end(), old_cell.begin(), old_cell.end());
+          buffer.insert(buffer.end(), new_cell.begin(), new_cell.end());
+          buffer.push_back(static_cast<unsigned int>(type));
+          buffer.push_back(child_index);
+          buffer.push_back(new_owner);
+        }
+      };
+
+      for(auto const & cell : serial_triangulation->active_cell_iterators())
+      {
+        CellIdBinary const id        = cell->id().template to_binary<dim>();
+        unsigned int const new_owner = cell->subdomain_id();
+
+        if(old_owners.find(id) != old_owners.end())
+        {
+          add_cell_transfer(id, id, TransferType::Keep, 0, new_owner);
+        }
+        else if(cell->level() > 0 and
+                old_owners.find(cell->parent()->id().template to_binary<dim>()) !=
+                  old_owners.end())
+        {
+          // cell has been created by refinement of its parent
+          unsigned int child_index = 0;
+          while(cell->parent()->child_index(child_index) != cell->index())
+            ++child_index;
+
+          add_cell_transfer(cell->parent()->id().template to_binary<dim>(),
+                            id,
+                            TransferType::Refine,
+                            child_index,
+                            new_owner);
+        }
+        else
+        {
+          // cell has been created by coarsening of its children
+          for(unsigned int c = 0; c < cell->reference_cell().n_isotropic_children(); ++c)
+          {
+            add_cell_transfer(cell->id().child_cell_id(c).template to_binary<dim>(),
+                              id,
+                              TransferType::Coarsen,
+                              c,
+                              new_owner);
+          }
+        }
+      }
+    }
+
+    std::map<unsigned int, std::vector<unsigned int>> const received_data =
+      dealii::Utilities::MPI::some_to_some(mpi_comm, send_data);
+
+    cell_transfers.clear();
+    for(auto const & [process, buffer] : received_data)
+    {
+      (void)process;
+      for(unsigned int i = 0; i < buffer.size(); i += 11)
+      {
+        CellTransfer transfer;
+        std::copy(buffer.begin() + i, buffer.begin() + i + 4, transfer.old_cell.begin());
+        std::copy(buffer.begin() + i + 4, buffer.begin() + i + 8, transfer.new_cell.begin());
+        transfer.type        = static_cast<TransferType>(buffer[i + 8]);
+        transfer.child_index = buffer[i + 9];
+        transfer.new_owner   = buffer[i + 10];
+        cell_transfers.push_back(transfer);
+      }
+    }
+  }
+
+  /*
+   * Returns the cell transfers of the locally owned cells determined by
+   * prepare_coarsening_and_refinement().
+   */
+  std::vector<CellTransfer> const &
+  get_cell_transfers() const
+  {
+    return cell_transfers;
+  }
+
+  /*
+   * Creates a new fully-distributed triangulation from the refined serial triangulation. The
+   * manifolds are copied from old_triangulation.
+   */
+  std::shared_ptr<dealii::Triangulation<dim>>
+  create_triangulation(dealii::Triangulation<dim> const & old_triangulation) const
+  {
+    auto const serial_grid_generator = [&](dealii::Triangulation<dim, dim> & tria_serial) {
+      tria_serial.copy_triangulation(*serial_triangulation);
+    };
+
+    // the serial triangulation has already been partitioned
+    auto const serial_grid_partitioner =
+      [](dealii::Triangulation<dim, dim> &, MPI_Comm const, unsigned int const) {};
+
+    auto triangulation =
+      std::make_shared<dealii::parallel::fullydistributed::Triangulation<dim>>(mpi_comm);
+
+    copy_manifolds(*triangulation, old_triangulation);
+
+    triangulation->create_triangulation(
+      dealii::TriangulationDescription::Utilities::create_description_from_triangulation_in_groups<
+        dim,
+        dim>(serial_grid_generator,
+             serial_grid_partitioner,
+             mpi_comm,
+             group_size,
+             mesh_smoothing,
+             settings));
+
+    return triangulation;
+  }
+
+  /*
+   * Creates the coarse triangulations for global coarsening multigrid from the serial
+   * triangulation. Each level is first distributed among all processes and then repartitioned
+   * with BalancedGranularityPartitionPolicy, going from fine to coarse levels. According to the
+   * convention in ExaDG, only the levels coarser than fine_triangulation are included.
+   */
+  void
+  create_coarse_triangulations(
+    std::vector<std::shared_ptr<dealii::Triangulation<dim> const>> & coarse_triangulations,
+    dealii::Triangulation<dim> const &                               fine_triangulation) const
+  {
+    unsigned int const n_processes = dealii::Utilities::MPI::n_mpi_processes(mpi_comm);
+
+    std::vector<std::shared_ptr<dealii::Triangulation<dim> const>> serial_levels;
+    unsigned int                                                   n_levels = 0;
+    if(leader_comm != MPI_COMM_NULL)
+    {
+      serial_levels =
+        dealii::MGTransferGlobalCoarseningTools::create_geometric_coarsening_sequence(
+          *serial_triangulation);
+      n_levels = serial_levels.size();
+    }
+    n_levels = dealii::Utilities::MPI::broadcast(mpi_comm, n_levels, 0);
+
+    coarse_triangulations.clear();
+    coarse_triangulations.resize(n_levels - 1);
+
+    BalancedGranularityPartitionPolicy<dim> const policy(n_processes);
+
+    for(int level = static_cast<int>(n_levels) - 2; level >= 0; --level)
+    {
+      auto const serial_grid_generator = [&](dealii::Triangulation<dim, dim> & tria_serial) {
+        tria_serial.copy_triangulation(*serial_levels[level]);
+      };
+
+      auto const serial_grid_partitioner = [&](dealii::Triangulation<dim, dim> & tria_serial,
+                                                MPI_Comm const,
+                                                unsigned int const) {
+        partition_serial_triangulation(tria_serial,
+                                       std::min<unsigned int>(n_processes,
+                                                              tria_serial.n_active_cells()),
+                                       partitioning_type);
+      };
+
+      auto tria_level =
+        std::make_shared<dealii::parallel::fullydistributed::Triangulation<dim>>(mpi_comm);
+
+      copy_manifolds(*tria_level, fine_triangulation);
+
+      tria_level->create_triangulation(
+        dealii::TriangulationDescription::Utilities::
+          create_description_from_triangulation_in_groups<dim, dim>(
+            serial_grid_generator,
+            serial_grid_partitioner,
+            mpi_comm,
+            group_size,
+            mesh_smoothing,
+            dealii::TriangulationDescription::default_setting));
+
+      dealii::LinearAlgebra::distributed::Vector<double> partition = policy.partition(*tria_level);
+
+      if(partition.size() == 0)
+      {
+        coarse_triangulations[level] = tria_level;
+      }
+      else
+      {
+        partition.update_ghost_values();
+
+        auto tria_repartitioned =
+          std::make_shared<dealii::parallel::fullydistributed::Triangulation<dim>>(mpi_comm);
+
+        copy_manifolds(*tria_repartitioned, fine_triangulation);
+
+        tria_repartitioned->create_triangulation(
+          dealii::TriangulationDescription::Utilities::create_description_from_triangulation(
+            *tria_level, partition));
+
+        coarse_triangulations[level] = tria_repartitioned;
+      }
+    }
+  }
+
+private:
+  static void
+  copy_manifolds(dealii::Triangulation<dim> & dst, dealii::Triangulation<dim> const & src)
+  {
+    for(auto const manifold_id : src.get_manifold_ids())
+    {
+      if(manifold_id != dealii::numbers::flat_manifold_id)
+        dst.set_manifold(manifold_id, src.get_manifold(manifold_id));
+    }
+  }
+
+  MPI_Comm const mpi_comm;
+
+  PartitioningType const partitioning_type;
+
+  unsigned int const group_size;
+
+  typename dealii::Triangulation<dim>::MeshSmoothing mesh_smoothing;
+
+  dealii::TriangulationDescription::Settings settings;
+
+  // communicator of the processes of the own partitioning group
+  MPI_Comm group_comm;
+
+  // communicator of the first processes of all partitioning groups (MPI_COMM_NULL on all other
+  // processes)
+  MPI_Comm leader_comm;
+
+  // serial triangulation, only available on the first process of each partitioning group
+  std::shared_ptr<dealii::Triangulation<dim>> serial_triangulation;
+
+  std::vector<CellTransfer> cell_transfers;
+};
+
+} // namespace GridUtilities
+} // namespace ExaDG
+
+#endif /* INCLUDE_EXADG_GRID_FULLY_DISTRIBUTED_REFINEMENT_H_ */
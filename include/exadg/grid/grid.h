@@ -27,6 +27,7 @@
 #include <deal.II/grid/tria.h>
 
 // ExaDG
+#include <exadg/grid/fully_distributed_refinement.h>
 #include <exadg/grid/mapping_dof_vector.h>
 
 namespace ExaDG
@@ -70,6 +71,13 @@ public:
    * corresponds to the coarsest triangulation.
    */
   std::vector<PeriodicFacePairs> coarse_periodic_face_pairs;
+
+  /**
+   * Serial copy of the triangulation required for adaptive mesh refinement in case of
+   * TriangulationType::FullyDistributed. Only initialized if GridData::keep_serial_triangulation
+   * is set.
+   */
+  std::shared_ptr<GridUtilities::FullyDistributedRefinement<dim>> fully_distributed_refinement;
 };
 
 /**
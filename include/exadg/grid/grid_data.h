@@ -91,6 +91,9 @@ struct GridData
       element_type(ElementType::Hypercube),
       partitioning_type(PartitioningType::Metis),
       n_refine_global(0),
+      partitioning_group_size(1),
+      partitioned_mesh_cache(),
+      keep_serial_triangulation(false),
       file_name(),
       create_coarse_triangulations(false)
   {
@@ -99,6 +102,15 @@ struct GridData
   void
   check() const
   {
+    AssertThrow(partitioning_group_size > 0,
+                dealii::ExcMessage("Parameter partitioning_group_size must be positive."));
+
+    if(keep_serial_triangulation)
+    {
+      AssertThrow(partitioned_mesh_cache.empty(),
+                  dealii::ExcMessage("Parameter keep_serial_triangulation can not be combined "
+                                     "with a partitioned mesh cache."));
+    }
   }
 
   void
@@ -109,7 +121,13 @@ struct GridData
     print_parameter(pcout, "Element type", element_type);
 
     if(triangulation_type == TriangulationType::FullyDistributed)
+    {
       print_parameter(pcout, "Partitioning type (fully-distributed)", partitioning_type);
+      print_parameter(pcout, "Partitioning group size", partitioning_group_size);
+      if(not partitioned_mesh_cache.empty())
+        print_parameter(pcout, "Partitioned mesh cache", partitioned_mesh_cache);
+      print_parameter(pcout, "Keep serial triangulation", keep_serial_triangulation);
+    }
 
     print_parameter(pcout, "Number of global refinements", n_refine_global);
 
@@ -126,6 +144,25 @@ struct GridData
   // only relevant for TriangulationType::FullyDistributed
   PartitioningType partitioning_type;
 
+  // Only relevant for TriangulationType::FullyDistributed: Number of processes sharing one serial
+  // triangulation. Only the first process of each group creates (i.e. reads) the serial
+  // triangulation and partitions it, while the other processes receive their part of the mesh.
+  // The default value of 1 means that every process creates the serial triangulation.
+  unsigned int partitioning_group_size;
+
+  // Only relevant for TriangulationType::FullyDistributed: Directory in which the partitioned
+  // triangulation is stored in the first run. Subsequent runs with the same number of processes,
+  // grid parameters, and coarse mesh (or grid file contents) read their part of the triangulation
+  // from this directory instead of creating and partitioning the serial triangulation. No cache is
+  // used if the string is empty.
+  std::string partitioned_mesh_cache;
+
+  // Only relevant for TriangulationType::FullyDistributed: Keep a copy of the serial triangulation
+  // on the first process of each partitioning group. This is required for adaptive mesh refinement
+  // with fully-distributed triangulations, see GridUtilities::FullyDistributedRefinement. For
+  // parallel runs, partitioning_group_size has to be larger than 1.
+  bool keep_serial_triangulation;
+
   unsigned int n_refine_global;
 
   // path to a grid file
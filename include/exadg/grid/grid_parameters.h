@@ -36,11 +36,23 @@ struct GridParameters
     prm.enter_subsection(subsection_name);
     {
       prm.add_parameter("FileName", file_name, "External input grid file.");
+      prm.add_parameter("PartitionedMeshCache",
+                        partitioned_mesh_cache,
+                        "Directory of the partitioned mesh cache (fully-distributed "
+                        "triangulations only). Leave empty to disable.");
+      prm.add_parameter("PartitioningGroupSize",
+                        partitioning_group_size,
+                        "Number of processes sharing one reader of the serial mesh "
+                        "(fully-distributed triangulations only).");
     }
     prm.leave_subsection();
   }
 
   std::string file_name;
+
+  std::string partitioned_mesh_cache;
+
+  unsigned int partitioning_group_size = 1;
 };
 
 } // namespace ExaDG
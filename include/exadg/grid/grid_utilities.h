@@ -23,6 +23,7 @@
 #define INCLUDE_EXADG_GRID_GRID_UTILITIES_H_
 
 // deal.II
+#include <deal.II/base/timer.h>
 #include <deal.II/fe/fe_simplex_p.h>
 #include <deal.II/fe/mapping_fe.h>
 #include <deal.II/fe/mapping_q.h>
@@ -32,8 +33,10 @@
 
 // ExaDG
 #include <exadg/grid/balanced_granularity_partition_policy.h>
+#include <exadg/grid/fully_distributed_refinement.h>
 #include <exadg/grid/grid.h>
 #include <exadg/grid/grid_data.h>
+#include <exadg/grid/partitioned_mesh_cache.h>
 #include <exadg/grid/perform_local_refinements.h>
 
 namespace ExaDG
@@ -138,6 +141,9 @@ transform_periodic_face_pairs_to_dof_cell_iterator(
  * one hand and the coarse triangulations required for multigrid (if needed) on the other hand.
  *
  * This function expects that the argument tria has already been constructed.
+ *
+ * In case of TriangulationType::FullyDistributed, a copy of the serial triangulation is stored in
+ * fully_distributed_refinement if the latter is initialized.
  */
 
 template<int dim>
@@ -153,7 +159,8 @@ create_triangulation(
                      unsigned int const,
                      std::vector<unsigned int> const &)> const & lambda_create_triangulation,
   unsigned int const                                             global_refinements,
-  std::vector<unsigned int> const &                              vector_local_refinements)
+  std::vector<unsigned int> const &                              vector_local_refinements,
+  std::shared_ptr<FullyDistributedRefinement<dim>> const &       fully_distributed_refinement)
 {
   if(vector_local_refinements.size() != 0)
   {
@@ -218,23 +225,13 @@ create_triangulation(
                                              MPI_Comm const                    comm,
                                              unsigned int const                group_size) {
       (void)group_size;
-      if(data.partitioning_type == PartitioningType::Metis)
-      {
-        dealii::GridTools::partition_triangulation(dealii::Utilities::MPI::n_mpi_processes(comm),
-                                                   tria_serial);
-      }
-      else if(data.partitioning_type == PartitioningType::z_order)
-      {
-        dealii::GridTools::partition_triangulation_zorder(
-          dealii::Utilities::MPI::n_mpi_processes(comm), tria_serial);
-      }
-      else
-      {
-        AssertThrow(false, dealii::ExcNotImplemented());
-      }
-    };
+      partition_serial_triangulation(tria_serial,
+                                     dealii::Utilities::MPI::n_mpi_processes(comm),
+                                     data.partitioning_type);
 
-    unsigned int const group_size = 1;
+      if(fully_distributed_refinement)
+        fully_distributed_refinement->set_serial_triangulation(tria_serial);
+    };
 
     typename dealii::TriangulationDescription::Settings triangulation_description_setting =
       dealii::TriangulationDescription::default_setting;
@@ -245,18 +242,108 @@ create_triangulation(
         dealii::TriangulationDescription::construct_multigrid_hierarchy;
     }
 
+    if(fully_distributed_refinement)
+    {
+      fully_distributed_refinement->reinit(mesh_smoothing, triangulation_description_setting);
+    }
+
     triangulation =
       std::make_shared<dealii::parallel::fullydistributed::Triangulation<dim>>(mpi_comm);
 
-    auto const description = dealii::TriangulationDescription::Utilities::
-      create_description_from_triangulation_in_groups<dim, dim>(serial_grid_generator,
-                                                                serial_grid_partitioner,
-                                                                triangulation->get_communicator(),
-                                                                group_size,
-                                                                mesh_smoothing,
-                                                                triangulation_description_setting);
+    std::string cache_directory;
+    if(not data.partitioned_mesh_cache.empty())
+    {
+      // The cache is identified by the contents of the grid file or, for meshes created by the
+      // application, by the serial coarse mesh, so that a modified mesh does not read a stale
+      // cache.
+      std::uint64_t mesh_hash = 0;
+      if(not data.file_name.empty())
+      {
+        mesh_hash = compute_grid_file_hash(data.file_name, mpi_comm);
+      }
+      else
+      {
+        if(dealii::Utilities::MPI::this_mpi_process(mpi_comm) == 0)
+        {
+          dealii::Triangulation<dim, dim> tria_coarse;
+          PeriodicFacePairs<dim>          periodic_face_pairs_coarse;
+          lambda_create_triangulation(tria_coarse,
+                                      periodic_face_pairs_coarse,
+                                      0 /* global_refinements */,
+                                      {} /* vector_local_refinements */);
+          mesh_hash = compute_coarse_mesh_hash(tria_coarse);
+        }
+        mesh_hash = dealii::Utilities::MPI::broadcast(mpi_comm, mesh_hash, 0);
+      }
+
+      cache_directory = get_partitioned_mesh_cache_directory(data,
+                                                             global_refinements,
+                                                             vector_local_refinements,
+                                                             construct_multigrid_hierarchy,
+                                                             mesh_hash,
+                                                             mpi_comm);
+    }
+
+    bool const read_from_cache =
+      not cache_directory.empty() and partitioned_mesh_cache_exists(cache_directory, mpi_comm);
+
+    dealii::Timer timer;
+
+    dealii::TriangulationDescription::Description<dim, dim> description;
+    double                                                  wall_time_create = 0.0;
+
+    if(read_from_cache)
+    {
+      // Every process reads its own part of the mesh only. Note that the lambda function creating
+      // the serial triangulation is not called in this case.
+      wall_time_create = read_partitioned_mesh_cache(description, cache_directory, mpi_comm);
+    }
+    else
+    {
+      description = dealii::TriangulationDescription::Utilities::
+        create_description_from_triangulation_in_groups<dim, dim>(
+          serial_grid_generator,
+          serial_grid_partitioner,
+          triangulation->get_communicator(),
+          data.partitioning_group_size,
+          mesh_smoothing,
+          triangulation_description_setting);
+
+      wall_time_create = dealii::Utilities::MPI::max(timer.wall_time(), mpi_comm);
+
+      if(not cache_directory.empty())
+      {
+        // The periodic face pairs refer to the serial triangulation and can not be restored from
+        // the cache.
+        AssertThrow(dealii::Utilities::MPI::max(periodic_face_pairs.size(), mpi_comm) == 0,
+                    dealii::ExcMessage("The partitioned mesh cache does not support periodic "
+                                       "boundary conditions."));
+
+        write_partitioned_mesh_cache(description, wall_time_create, cache_directory, mpi_comm);
+      }
+    }
+
+    double const wall_time = dealii::Utilities::MPI::max(timer.wall_time(), mpi_comm);
 
     triangulation->create_triangulation(description);
+
+    if(not cache_directory.empty())
+    {
+      dealii::ConditionalOStream pcout(std::cout,
+                                       dealii::Utilities::MPI::this_mpi_process(mpi_comm) == 0);
+
+      pcout << std::endl << "Partitioned mesh cache " << cache_directory << ":" << std::endl;
+      if(read_from_cache)
+      {
+        print_parameter(pcout, "Wall time read partitioned mesh", wall_time);
+        print_parameter(pcout, "Wall time create partitioned mesh", wall_time_create);
+        print_parameter(pcout, "Wall time saved", wall_time_create - wall_time);
+      }
+      else
+      {
+        print_parameter(pcout, "Wall time create and write partitioned mesh", wall_time);
+      }
+    }
   }
   else
   {
@@ -377,7 +464,8 @@ create_coarse_triangulations_for_fully_distributed_triangulation(
                                                  false /*construct_multigrid_hierarchy */,
                                                  lambda_create_triangulation,
                                                  refine_global,
-                                                 refine_local);
+                                                 refine_local,
+                                                 nullptr /*fully_distributed_refinement*/);
 
         if(level > 0)
         {
@@ -406,7 +494,8 @@ create_coarse_triangulations_for_fully_distributed_triangulation(
                                                  false /*construct_multigrid_hierarchy */,
                                                  lambda_create_triangulation,
                                                  0 /*refine_global*/,
-                                                 refine_local);
+                                                 refine_local,
+                                                 nullptr /*fully_distributed_refinement*/);
 
         if(level > 0)
         {
@@ -487,6 +576,13 @@ create_triangulation(
                      std::vector<unsigned int> const &)> const & lambda_create_triangulation,
   std::vector<unsigned int> const                                vector_local_refinements)
 {
+  if(data.triangulation_type == TriangulationType::FullyDistributed and
+     data.keep_serial_triangulation)
+  {
+    grid.fully_distributed_refinement =
+      std::make_shared<FullyDistributedRefinement<dim>>(mpi_comm, data);
+  }
+
   GridUtilities::create_triangulation(grid.triangulation,
                                       grid.periodic_face_pairs,
                                       mpi_comm,
@@ -494,7 +590,8 @@ create_triangulation(
                                       false /*construct_multigrid_hierarchy */,
                                       lambda_create_triangulation,
                                       data.n_refine_global,
-                                      vector_local_refinements);
+                                      vector_local_refinements,
+                                      grid.fully_distributed_refinement);
 }
 
 /**
@@ -526,6 +623,13 @@ create_triangulation_with_multigrid(
                     "in order to use h-multigrid for simplex meshes."));
     }
 
+    if(data.triangulation_type == TriangulationType::FullyDistributed and
+       data.keep_serial_triangulation)
+    {
+      grid.fully_distributed_refinement =
+        std::make_shared<FullyDistributedRefinement<dim>>(mpi_comm, data);
+    }
+
     // create fine triangulation
     GridUtilities::create_triangulation(grid.triangulation,
                                         grid.periodic_face_pairs,
@@ -534,7 +638,8 @@ create_triangulation_with_multigrid(
                                         not data.create_coarse_triangulations,
                                         lambda_create_triangulation,
                                         data.n_refine_global,
-                                        vector_local_refinements);
+                                        vector_local_refinements,
+                                        grid.fully_distributed_refinement);
 
     // Make sure that we create coarse triangulations in case of meshes with hanging nodes.
     if(grid.triangulation->has_hanging_nodes())
@@ -568,7 +673,9 @@ create_triangulation_with_multigrid(
 
 /**
  * Function to create the coarse_triangulations and coarse_periodic_face_pairs given the
- * fine_triangulation and fine_periodic_face_pairs.
+ * fine_triangulation and fine_periodic_face_pairs. In case of TriangulationType::FullyDistributed,
+ * the coarse triangulations are created from the serial triangulation stored in
+ * fully_distributed_refinement.
  */
 template<int dim>
 inline void
@@ -578,7 +685,8 @@ create_coarse_triangulations_after_coarsening_and_refinement(
   std::vector<std::shared_ptr<dealii::Triangulation<dim> const>> & coarse_triangulations_const,
   std::vector<PeriodicFacePairs<dim>> &                            coarse_periodic_face_pairs,
   GridData const &                                                 data,
-  bool const                                                       amr_preserves_boundary_cells)
+  bool const                                                       amr_preserves_boundary_cells,
+  std::shared_ptr<FullyDistributedRefinement<dim> const> const &   fully_distributed_refinement)
 {
   if(data.triangulation_type == TriangulationType::Serial or
      data.triangulation_type == TriangulationType::Distributed)
@@ -600,9 +708,19 @@ create_coarse_triangulations_after_coarsening_and_refinement(
   }
   else if(data.triangulation_type == TriangulationType::FullyDistributed)
   {
-    AssertThrow(false,
-                dealii::ExcMessage("Combination of adaptive mesh refinement and "
-                                   "TriangulationType::FullyDistributed not implemented."));
+    AssertThrow(fully_distributed_refinement.get(),
+                dealii::ExcMessage("Adaptive mesh refinement with TriangulationType::"
+                                   "FullyDistributed requires keep_serial_triangulation."));
+
+    AssertThrow(fine_periodic_face_pairs.size() == 0,
+                dealii::ExcMessage("Combination of adaptive mesh refinement, periodic face pairs "
+                                   "and TriangulationType::FullyDistributed not implemented."));
+
+    fully_distributed_refinement->create_coarse_triangulations(coarse_triangulations_const,
+                                                               fine_triangulation);
+
+    coarse_periodic_face_pairs.clear();
+    coarse_periodic_face_pairs.resize(coarse_triangulations_const.size());
   }
   else
   {
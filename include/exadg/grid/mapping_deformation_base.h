@@ -22,6 +22,10 @@
 #ifndef INCLUDE_EXADG_GRID_MAPPING_DEFORMATION_BASE_H_
 #define INCLUDE_EXADG_GRID_MAPPING_DEFORMATION_BASE_H_
 
+// C/C++
+#include <boost/archive/binary_iarchive.hpp>
+#include <boost/archive/binary_oarchive.hpp>
+
 // deal.II
 #include <deal.II/dofs/dof_handler.h>
 #include <deal.II/fe/mapping.h>
@@ -99,6 +103,29 @@ public:
     AssertThrow(false, dealii::ExcMessage("Has to be overwritten by derived classes."));
   }
 
+  /**
+   * Write the current grid deformation to a restart archive.
+   *
+   * TODO: this function is only relevant for PDE-type grid deformation problems, and should
+   * therefore not appear in this base class.
+   */
+  virtual void
+  write_restart(boost::archive::binary_oarchive & oa) const
+  {
+    (void)oa;
+    AssertThrow(false, dealii::ExcMessage("Has to be overwritten by derived classes."));
+  }
+
+  /**
+   * Read the grid deformation from a restart archive and update the mapping accordingly.
+   */
+  virtual void
+  read_restart(boost::archive::binary_iarchive & ia)
+  {
+    (void)ia;
+    AssertThrow(false, dealii::ExcMessage("Has to be overwritten by derived classes."));
+  }
+
 protected:
   /**
    * mapping describing undeformed reference state
@@ -194,6 +194,28 @@ public:
     print_list_of_iterations(pcout, names, iterations_avg);
   }
 
+  /**
+   * Writes the grid displacement to a restart archive.
+   */
+  void
+  write_restart(boost::archive::binary_oarchive & oa) const override
+  {
+    oa << displacement;
+  }
+
+  /**
+   * Reads the grid displacement from a restart archive and moves the grid accordingly.
+   */
+  void
+  read_restart(boost::archive::binary_iarchive & ia) override
+  {
+    ia >> displacement;
+
+    this->initialize_mapping_from_dof_vector(this->mapping_undeformed,
+                                             displacement,
+                                             pde_operator->get_dof_handler());
+  }
+
 private:
   // matrix-free
   std::shared_ptr<MatrixFreeData<dim, Number>>     matrix_free_data;
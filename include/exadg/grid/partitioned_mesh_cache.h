@@ -0,0 +1,270 @@
+/*  ______________________________________________________________________
+ *
+ *  ExaDG - High-Order Discontinuous Galerkin for the Exa-Scale
+ *
+ *  Copyright (C) 2021 by the ExaDG authors
+ *
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation, either version 3 of the License, or
+ *  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ *  ______________________________________________________________________
+ */
+
+#ifndef INCLUDE_EXADG_GRID_PARTITIONED_MESH_CACHE_H_
+#define INCLUDE_EXADG_GRID_PARTITIONED_MESH_CACHE_H_
+
+// C/C++
+#include <boost/archive/binary_iarchive.hpp>
+#include <boost/archive/binary_oarchive.hpp>
+#include <cstdint>
+#include <filesystem>
+#include <fstream>
+#include <iomanip>
+#include <sstream>
+#include <string>
+#include <vector>
+
+// deal.II
+#include <deal.II/base/mpi.h>
+#include <deal.II/grid/tria.h>
+#include <deal.II/grid/tria_description.h>
+
+// ExaDG
+#include <exadg/grid/grid_data.h>
+#include <exadg/utilities/create_directories.h>
+#include <exadg/utilities/enum_utilities.h>
+
+namespace ExaDG
+{
+namespace GridUtilities
+{
+/**
+ * 64-bit FNV-1a hash of a sequence of bytes. In contrast to std::hash, the result does not depend
+ * on the implementation of the standard library, which is required since the hash is part of the
+ * name of the cache directory.
+ */
+inline std::uint64_t
+hash_bytes(void const *      data,
+           std::size_t const n_bytes,
+           std::uint64_t     hash = 14695981039346656037ull)
+{
+  unsigned char const * bytes = static_cast<unsigned char const *>(data);
+  for(std::size_t i = 0; i < n_bytes; ++i)
+  {
+    hash ^= static_cast<std::uint64_t>(bytes[i]);
+    hash *= 1099511628211ull;
+  }
+
+  return hash;
+}
+
+/**
+ * Hash of the contents of a grid file. The file is read by the first process only and the result
+ * is broadcast to all processes. Reading the file without parsing it is cheap compared to creating
+ * and partitioning the serial triangulation.
+ */
+inline std::uint64_t
+compute_grid_file_hash(std::string const & file_name, MPI_Comm const & mpi_comm)
+{
+  std::uint64_t hash = 0;
+
+  if(dealii::Utilities::MPI::this_mpi_process(mpi_comm) == 0)
+  {
+    std::ifstream in(file_name, std::ios::binary);
+    AssertThrow(in, dealii::ExcMessage("Could not open grid file " + file_name));
+
+    hash = hash_bytes(nullptr, 0);
+
+    std::vector<char> buffer(1 << 20);
+    while(in.read(buffer.data(), buffer.size()) or in.gcount() > 0)
+      hash = hash_bytes(buffer.data(), in.gcount(), hash);
+  }
+
+  return dealii::Utilities::MPI::broadcast(mpi_comm, hash, 0);
+}
+
+/**
+ * Hash of the coarse cells of a (serial) triangulation, i.e., of the vertex coordinates, the
+ * reference cells and vertex indices of the cells as well as of the material, manifold, and
+ * boundary ids.
+ */
+template<int dim>
+std::uint64_t
+compute_coarse_mesh_hash(dealii::Triangulation<dim> const & tria)
+{
+  std::uint64_t hash = hash_bytes(nullptr, 0);
+
+  auto const add = [&](auto const value) { hash = hash_bytes(&value, sizeof(value), hash); };
+
+  std::vector<dealii::Point<dim>> const & vertices      = tria.get_vertices();
+  std::vector<bool> const &               used_vertices = tria.get_used_vertices();
+  for(unsigned int v = 0; v < vertices.size(); ++v)
+  {
+    if(used_vertices[v])
+    {
+      add(v);
+      for(unsigned int d = 0; d < dim; ++d)
+        add(vertices[v][d]);
+    }
+  }
+
+  for(auto const & cell : tria.cell_iterators_on_level(0))
+  {
+    add(static_cast<unsigned int>(cell->reference_cell()));
+    for(auto const v : cell->vertex_indices())
+      add(cell->vertex_index(v));
+
+    add(cell->material_id());
+    add(cell->manifold_id());
+
+    for(auto const f : cell->face_indices())
+    {
+      if(cell->face(f)->at_boundary())
+      {
+        add(f);
+        add(cell->face(f)->boundary_id());
+        add(cell->face(f)->manifold_id());
+      }
+    }
+  }
+
+  return hash;
+}
+
+/**
+ * The partitioned mesh cache stores the dealii::TriangulationDescription::Description of each
+ * process of a fully-distributed triangulation in a separate file. In subsequent runs with the
+ * same number of processes and the same grid parameters, every process only reads its own part of
+ * the mesh, avoiding to read the (potentially very large) serial mesh and to partition it again.
+ *
+ * The cache is identified by the grid parameters, the number of processes, and mesh_hash, which is
+ * the hash of the grid file (see compute_grid_file_hash()) or, for meshes created by the
+ * application, the hash of the serial coarse mesh (see compute_coarse_mesh_hash()). Hence, a
+ * modified grid file or coarse mesh results in a new cache directory. Refinements performed by the
+ * application other than the global and local refinements passed to this function are not
+ * detected.
+ */
+inline std::string
+get_partitioned_mesh_cache_directory(GridData const &                  data,
+                                     unsigned int const                refine_global,
+                                     std::vector<unsigned int> const & vector_local_refinements,
+                                     bool const                        multigrid_hierarchy,
+                                     std::uint64_t const               mesh_hash,
+                                     MPI_Comm const &                  mpi_comm)
+{
+  std::string key = data.file_name.empty() ?
+                      std::string("grid") :
+                      std::filesystem::path(data.file_name).stem().string();
+
+  key += "_" + Utilities::enum_to_string(data.element_type);
+  key += "_" + Utilities::enum_to_string(data.partitioning_type);
+  key += "_refine_global_" + std::to_string(refine_global);
+  if(not vector_local_refinements.empty())
+  {
+    key += "_refine_local";
+    for(auto const n : vector_local_refinements)
+      key += "_" + std::to_string(n);
+  }
+  if(multigrid_hierarchy)
+    key += "_mg";
+  key += "_np_" + std::to_string(dealii::Utilities::MPI::n_mpi_processes(mpi_comm));
+
+  std::ostringstream hash;
+  hash << std::hex << std::setw(16) << std::setfill('0') << mesh_hash;
+  key += "_" + hash.str();
+
+  return data.partitioned_mesh_cache + "/" + key + "/";
+}
+
+inline std::string
+get_partitioned_mesh_cache_filename(std::string const & directory, MPI_Comm const & mpi_comm)
+{
+  return directory + "description_" +
+         std::to_string(dealii::Utilities::MPI::this_mpi_process(mpi_comm)) + ".bin";
+}
+
+/**
+ * Returns true if the cache files of all processes exist.
+ */
+inline bool
+partitioned_mesh_cache_exists(std::string const & directory, MPI_Comm const & mpi_comm)
+{
+  bool const exists =
+    std::filesystem::exists(get_partitioned_mesh_cache_filename(directory, mpi_comm));
+
+  return dealii::Utilities::MPI::min(exists ? 1u : 0u, mpi_comm) == 1u;
+}
+
+/**
+ * Writes the description of the current process to the cache. The wall time needed to create the
+ * description is stored as well in order to report the time saved when reading the cache.
+ */
+template<int dim>
+void
+write_partitioned_mesh_cache(
+  dealii::TriangulationDescription::Description<dim, dim> const & description,
+  double const                                                    wall_time_create,
+  std::string const &                                             directory,
+  MPI_Comm const &                                                mpi_comm)
+{
+  create_directories(directory, mpi_comm);
+
+  std::ofstream out(get_partitioned_mesh_cache_filename(directory, mpi_comm), std::ios::binary);
+  AssertThrow(out, dealii::ExcMessage("Could not write partitioned mesh cache to " + directory));
+
+  boost::archive::binary_oarchive oa(out);
+
+  unsigned int n_ranks = dealii::Utilities::MPI::n_mpi_processes(mpi_comm);
+  double       time    = wall_time_create;
+
+  oa & n_ranks;
+  oa & time;
+  oa & description;
+}
+
+/**
+ * Reads the description of the current process from the cache. Returns the wall time that was
+ * needed to create the description when writing the cache.
+ */
+template<int dim>
+double
+read_partitioned_mesh_cache(dealii::TriangulationDescription::Description<dim, dim> & description,
+                            std::string const &                                       directory,
+                            MPI_Comm const &                                          mpi_comm)
+{
+  std::ifstream in(get_partitioned_mesh_cache_filename(directory, mpi_comm), std::ios::binary);
+  AssertThrow(in, dealii::ExcMessage("Could not read partitioned mesh cache from " + directory));
+
+  boost::archive::binary_iarchive ia(in);
+
+  unsigned int n_ranks          = 0;
+  double       wall_time_create = 0.0;
+
+  ia & n_ranks;
+  ia & wall_time_create;
+
+  AssertThrow(n_ranks == dealii::Utilities::MPI::n_mpi_processes(mpi_comm),
+              dealii::ExcMessage("The partitioned mesh cache in " + directory +
+                                 " was written for " + std::to_string(n_ranks) + " processes."));
+
+  ia & description;
+
+  // the communicator is not part of the serialized data
+  description.comm = mpi_comm;
+
+  return wall_time_create;
+}
+
+} // namespace GridUtilities
+} // namespace ExaDG
+
+#endif /* INCLUDE_EXADG_GRID_PARTITIONED_MESH_CACHE_H_ */
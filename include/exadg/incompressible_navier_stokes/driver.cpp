@@ -39,13 +39,21 @@ template<int dim, typename Number>
 Driver<dim, Number>::Driver(MPI_Comm const &                              comm,
                             std::shared_ptr<ApplicationBase<dim, Number>> app,
                             bool const                                    is_test,
-                            bool const                                    is_throughput_study)
+                            bool const                                    is_throughput_study,
+                            std::shared_ptr<InTransitCommunicator const>  in_transit_in)
   : mpi_comm(comm),
-    pcout(std::cout, dealii::Utilities::MPI::this_mpi_process(comm) == 0),
+    pcout(std::cout,
+          dealii::Utilities::MPI::this_mpi_process(comm) == 0 and
+            not(in_transit_in.get() and in_transit_in->is_postprocessing_process())),
     is_test(is_test),
     is_throughput_study(is_throughput_study),
-    application(app)
+    application(app),
+    in_transit(in_transit_in),
+    setup_profiler("Setup")
 {
+  if(in_transit.get() and not in_transit->is_active())
+    in_transit.reset();
+
   print_general_info<Number>(pcout, mpi_comm, is_test);
 }
 
@@ -58,11 +66,15 @@ Driver<dim, Number>::setup()
 
   pcout << std::endl << "Setting up incompressible Navier-Stokes solver:" << std::endl;
 
-  application->setup(grid, mapping, multigrid_mappings);
+  setup_profiler.measure({"Grid"},
+                         [&]() { application->setup(grid, mapping, multigrid_mappings); });
 
   // moving mesh (ALE formulation)
   bool const ale = application->get_parameters().ale_formulation;
 
+  AssertThrow(not(ale and in_transit.get()),
+              dealii::ExcMessage("In-transit postprocessing is not available for moving meshes."));
+
   if(ale)
   {
     if(application->get_parameters().mesh_movement_type == MeshMovementType::Function)
@@ -145,21 +157,56 @@ Driver<dim, Number>::setup()
     AssertThrow(false, dealii::ExcMessage("Not implemented."));
   }
 
-  // setup Navier-Stokes operator
-  pde_operator->setup();
+  // setup Navier-Stokes operator (the dedicated postprocessing processes do not solve any systems
+  // of equations and, therefore, skip the setup of preconditioners and solvers)
+  setup_profiler.measure({"Spatial discretization"},
+                         [&]() { pde_operator->setup(not is_postprocessing_process()); });
+  setup_profiler.insert({"Spatial discretization"}, pde_operator->get_setup_profiler());
 
   if(not is_throughput_study)
   {
     // setup postprocessor
-    postprocessor = application->create_postprocessor();
-    postprocessor->setup(*pde_operator);
+    setup_profiler.measure({"Postprocessor"}, [&]() {
+      if(in_transit.get() and not in_transit->is_postprocessing_process())
+      {
+        postprocessor_in_transit =
+          std::make_shared<PostProcessorInTransit<dim, Number>>(in_transit);
+        postprocessor = postprocessor_in_transit;
+      }
+      else
+      {
+        postprocessor = application->create_postprocessor();
+      }
+      postprocessor->setup(*pde_operator);
+    });
 
-    if(application->get_parameters().solver_type == SolverType::Unsteady)
+    if(is_postprocessing_process())
+    {
+      // the dedicated postprocessing processes do not integrate in time
+      snapshot_transfer = std::make_shared<SnapshotTransfer<dim, Number>>(
+        *in_transit,
+        std::vector<dealii::DoFHandler<dim> const *>{&pde_operator->get_dof_handler_u(),
+                                                     &pde_operator->get_dof_handler_p()});
+    }
+    else if(application->get_parameters().solver_type == SolverType::Unsteady)
     {
       time_integrator = create_time_integrator<dim, Number>(
         pde_operator, helpers_ale, postprocessor, application->get_parameters(), mpi_comm, is_test);
 
-      time_integrator->setup(application->get_parameters().restarted_simulation);
+      setup_profiler.measure({"Time integrator"}, [&]() {
+        time_integrator->setup(application->get_parameters().restarted_simulation);
+      });
+
+      // machine-readable log of solver statistics
+      std::string const & statistics_filename =
+        application->get_parameters().solver_info_data.statistics_filename;
+      if(not statistics_filename.empty())
+      {
+        solver_statistics = std::make_shared<SolverStatistics>(statistics_filename, mpi_comm);
+        solver_statistics->write_run(application->get_parameters(),
+                                     pde_operator->get_number_of_dofs());
+        time_integrator->set_solver_statistics(solver_statistics);
+      }
     }
     else if(application->get_parameters().solver_type == SolverType::Steady)
     {
@@ -170,7 +217,7 @@ Driver<dim, Number>::setup()
       driver_steady = std::make_shared<DriverSteadyProblems<dim, Number>>(
         operator_coupled, postprocessor, application->get_parameters(), mpi_comm, is_test);
 
-      driver_steady->setup();
+      setup_profiler.measure({"Steady solver"}, [&]() { driver_steady->setup(); });
     }
     else
     {
@@ -209,10 +256,47 @@ Driver<dim, Number>::ale_update() const
 }
 
 
+template<int dim, typename Number>
+bool
+Driver<dim, Number>::is_postprocessing_process() const
+{
+  return in_transit.get() and in_transit->is_postprocessing_process();
+}
+
+template<int dim, typename Number>
+void
+Driver<dim, Number>::postprocessing_service() const
+{
+  VectorType velocity, pressure;
+  pde_operator->initialize_vector_velocity(velocity);
+  pde_operator->initialize_vector_pressure(pressure);
+
+  double           time             = 0.0;
+  types::time_step time_step_number = numbers::steady_timestep;
+
+  dealii::Timer timer;
+  double        wall_time = 0.0;
+
+  while(snapshot_transfer->receive({&velocity, &pressure}, time, time_step_number))
+  {
+    timer.restart();
+    postprocessor->do_postprocessing(velocity, pressure, time, time_step_number);
+    wall_time += timer.wall_time();
+  }
+
+  snapshot_transfer->send_statistics(wall_time);
+}
+
 template<int dim, typename Number>
 void
 Driver<dim, Number>::solve() const
 {
+  if(is_postprocessing_process())
+  {
+    postprocessing_service();
+    return;
+  }
+
   if(application->get_parameters().problem_type == ProblemType::Unsteady)
   {
     // stability analysis (uncomment if desired)
@@ -256,12 +340,20 @@ Driver<dim, Number>::solve() const
   {
     AssertThrow(false, dealii::ExcMessage("Not implemented."));
   }
+
+  // complete the last snapshot and terminate the postprocessing service
+  if(postprocessor_in_transit.get())
+    postprocessor_in_transit->finalize();
 }
 
 template<int dim, typename Number>
 void
 Driver<dim, Number>::print_performance_results(double const total_time) const
 {
+  // the performance results refer to the solver processes
+  if(is_postprocessing_process())
+    return;
+
   pcout << std::endl
         << "_________________________________________________________________________________"
         << std::endl
@@ -295,6 +387,23 @@ Driver<dim, Number>::print_performance_results(double const total_time) const
   pcout << std::endl << "Timings for level 2:" << std::endl;
   timer_tree.print_level(pcout, 2);
 
+  setup_profiler.print(pcout, mpi_comm);
+
+  if(postprocessor_in_transit.get())
+  {
+    pcout << std::endl << "In-transit postprocessing:" << std::endl;
+    print_parameter(pcout,
+                    "Number of dedicated MPI processes",
+                    in_transit->get_n_postprocessing_processes());
+    print_parameter(pcout, "Number of snapshots", postprocessor_in_transit->get_n_snapshots());
+    print_parameter(pcout,
+                    "Wall time removed from solver",
+                    postprocessor_in_transit->get_postprocessing_wall_time());
+  }
+
+  if(solver_statistics.get())
+    solver_statistics->write_summary(time_integrator->get_number_of_time_steps(), timer_tree);
+
   // Throughput in DoFs/s per time step per core
   dealii::types::global_dof_index const DoFs = pde_operator->get_number_of_dofs();
   unsigned int const N_mpi_processes         = dealii::Utilities::MPI::n_mpi_processes(mpi_comm);
@@ -26,6 +26,7 @@
 #include <exadg/grid/mapping_deformation_function.h>
 #include <exadg/grid/mapping_deformation_poisson.h>
 #include <exadg/incompressible_navier_stokes/postprocessor/postprocessor_base.h>
+#include <exadg/incompressible_navier_stokes/postprocessor/postprocessor_in_transit.h>
 #include <exadg/incompressible_navier_stokes/spatial_discretization/operator_coupled.h>
 #include <exadg/incompressible_navier_stokes/spatial_discretization/operator_dual_splitting.h>
 #include <exadg/incompressible_navier_stokes/spatial_discretization/operator_pressure_correction.h>
@@ -36,7 +37,10 @@
 #include <exadg/incompressible_navier_stokes/user_interface/application_base.h>
 #include <exadg/matrix_free/matrix_free_data.h>
 #include <exadg/operators/finite_element.h>
+#include <exadg/utilities/in_transit_communicator.h>
 #include <exadg/utilities/print_general_infos.h>
+#include <exadg/utilities/setup_profiler.h>
+#include <exadg/utilities/solver_statistics.h>
 
 namespace ExaDG
 {
@@ -120,10 +124,16 @@ template<int dim, typename Number>
 class Driver
 {
 public:
+  /*
+   * If in_transit is provided and active, comm is the local communicator of in_transit. On the
+   * dedicated postprocessing processes, the driver then only receives snapshots from the solver
+   * processes and applies the postprocessor to them.
+   */
   Driver(MPI_Comm const &                              comm,
          std::shared_ptr<ApplicationBase<dim, Number>> application,
          bool const                                    is_test,
-         bool const                                    is_throughput_study);
+         bool const                                    is_throughput_study,
+         std::shared_ptr<InTransitCommunicator const>  in_transit = nullptr);
 
   void
   setup();
@@ -148,6 +158,16 @@ private:
   void
   ale_update() const;
 
+  bool
+  is_postprocessing_process() const;
+
+  /*
+   * Receive snapshots and apply the postprocessor until the solver processes have finished (only
+   * on dedicated postprocessing processes).
+   */
+  void
+  postprocessing_service() const;
+
   // MPI communicator
   MPI_Comm const mpi_comm;
 
@@ -190,6 +210,17 @@ private:
 
   std::shared_ptr<Postprocessor> postprocessor;
 
+  /*
+   * In-transit postprocessing on dedicated MPI processes (optional)
+   */
+  std::shared_ptr<InTransitCommunicator const> in_transit;
+
+  // solver processes: postprocessor shipping snapshots to the dedicated processes
+  std::shared_ptr<PostProcessorInTransit<dim, Number>> postprocessor_in_transit;
+
+  // postprocessing processes: receives snapshots from the solver processes
+  std::shared_ptr<SnapshotTransfer<dim, Number>> snapshot_transfer;
+
   /*
    * Temporal discretization
    */
@@ -197,6 +228,9 @@ private:
   // unsteady solver
   std::shared_ptr<TimeIntBDF<dim, Number>> time_integrator;
 
+  // machine-readable log of solver statistics (optional)
+  std::shared_ptr<SolverStatistics> solver_statistics;
+
   // steady solver
   std::shared_ptr<DriverSteadyProblems<dim, Number>> driver_steady;
 
@@ -204,6 +238,11 @@ private:
    * Computation time (wall clock time).
    */
   mutable TimerTree timer_tree;
+
+  /*
+   * Wall times and memory high-water marks of the setup phases.
+   */
+  SetupProfiler setup_profiler;
 };
 
 } // namespace IncNS
@@ -21,6 +21,7 @@
 
 // C/C++
 #include <fstream>
+#include <sstream>
 
 // ExaDG
 #include <exadg/incompressible_navier_stokes/postprocessor/divergence_and_mass_error.h>
@@ -38,12 +39,33 @@ DivergenceAndMassErrorCalculator<dim, Number>::DivergenceAndMassErrorCalculator(
     number_of_samples(0),
     divergence_sample(0.0),
     mass_sample(0.0),
+    writer_timeseries(comm),
+    writer_average(comm),
     matrix_free(nullptr),
     dof_index(0),
     quad_index(0)
 {
 }
 
+template<int dim, typename Number>
+DivergenceAndMassErrorCalculator<dim, Number>::~DivergenceAndMassErrorCalculator()
+{
+  // The averages are written once at the end of the simulation, the file is written by the
+  // destructor of writer_average.
+  if(number_of_samples > 0)
+  {
+    std::ostringstream average;
+    average << "Divergence and mass error (averaged over time)" << std::endl;
+    average << "Number of samples:   " << number_of_samples << std::endl;
+    average << "Mean error incompressibility constraint:   "
+            << divergence_sample / number_of_samples << std::endl;
+    average << "Mean error mass flux over interior element faces:  "
+            << mass_sample / number_of_samples << std::endl;
+
+    writer_average.start_file(average.str());
+  }
+}
+
 template<int dim, typename Number>
 void
 DivergenceAndMassErrorCalculator<dim, Number>::setup(
@@ -60,7 +82,16 @@ DivergenceAndMassErrorCalculator<dim, Number>::setup(
   time_control.setup(data_in.time_control_data);
 
   if(data.time_control_data.is_active)
+  {
     create_directories(data.directory, mpi_comm);
+
+    writer_timeseries.setup(data.directory + data.filename + ".div_mass_error_timeseries",
+                            data.time_series_data,
+                            7,
+                            15);
+    writer_average.setup(data.directory + data.filename + ".div_mass_error_average",
+                         data.time_series_data);
+  }
 }
 
 template<int dim, typename Number>
@@ -68,11 +99,31 @@ void
 DivergenceAndMassErrorCalculator<dim, Number>::evaluate(VectorType const & velocity,
                                                         double const       time,
                                                         const bool         unsteady)
+{
+  Number div_error = 1.0, div_error_reference = 1.0, mass_error = 1.0, mass_error_reference = 1.0;
+
+  // calculate divergence and mass error
+  do_evaluate(
+    *matrix_free, velocity, div_error, div_error_reference, mass_error, mass_error_reference);
+
+  evaluate(div_error, div_error_reference, mass_error, mass_error_reference, time, unsteady);
+}
+
+template<int dim, typename Number>
+void
+DivergenceAndMassErrorCalculator<dim, Number>::evaluate(Number const div_error,
+                                                        Number const div_error_reference,
+                                                        Number const mass_error,
+                                                        Number const mass_error_reference,
+                                                        double const time,
+                                                        bool const   unsteady)
 {
   if(unsteady)
-    analyze_div_and_mass_error_unsteady(velocity, time);
+    analyze_div_and_mass_error_unsteady(
+      div_error, div_error_reference, mass_error, mass_error_reference, time);
   else
-    analyze_div_and_mass_error_steady(velocity);
+    analyze_div_and_mass_error_steady(
+      div_error, div_error_reference, mass_error, mass_error_reference);
 }
 
 template<int dim, typename Number>
@@ -201,15 +252,12 @@ DivergenceAndMassErrorCalculator<dim, Number>::local_compute_div_boundary_face(
 template<int dim, typename Number>
 void
 DivergenceAndMassErrorCalculator<dim, Number>::analyze_div_and_mass_error_unsteady(
-  VectorType const & velocity,
-  double const       time)
+  Number const div_error,
+  Number const div_error_reference,
+  Number const mass_error,
+  Number const mass_error_reference,
+  double const time)
 {
-  Number div_error = 1.0, div_error_reference = 1.0, mass_error = 1.0, mass_error_reference = 1.0;
-
-  // calculate divergence and mass error
-  do_evaluate(
-    *matrix_free, velocity, div_error, div_error_reference, mass_error, mass_error_reference);
-
   Number div_error_normalized  = div_error / div_error_reference;
   Number mass_error_normalized = 1.0;
   if(mass_error_reference > 1.e-12)
@@ -218,69 +266,40 @@ DivergenceAndMassErrorCalculator<dim, Number>::analyze_div_and_mass_error_unstea
     mass_error_normalized = mass_error;
 
   // write output file
-  if(dealii::Utilities::MPI::this_mpi_process(mpi_comm) == 0)
+  if(clear_files_mass_error == true)
   {
-    std::string filename = data.directory + data.filename + ".div_mass_error_timeseries";
-
-    std::ofstream f;
-    if(clear_files_mass_error == true)
-    {
-      f.open(filename.c_str(), std::ios::trunc);
-      f << "Error incompressibility constraint:" << std::endl
-        << std::endl
-        << "  (1,|divu|)_Omega/(1,1)_Omega" << std::endl
-        << std::endl
-        << "Error mass flux over interior element faces:" << std::endl
-        << std::endl
-        << "  (1,|(um - up)*n|)_dOmegaI / (1,|0.5(um + up)*n|)_dOmegaI" << std::endl
-        << std::endl
-        << "       t        |  divergence  |    mass       " << std::endl;
-
-      clear_files_mass_error = false;
-    }
-    else
-    {
-      f.open(filename.c_str(), std::ios::app);
-    }
-
-    f << std::scientific << std::setprecision(7) << std::setw(15) << time << std::setw(15)
-      << div_error_normalized << std::setw(15) << mass_error_normalized << std::endl;
+    std::ostringstream header;
+    header << "Error incompressibility constraint:" << std::endl
+           << std::endl
+           << "  (1,|divu|)_Omega/(1,1)_Omega" << std::endl
+           << std::endl
+           << "Error mass flux over interior element faces:" << std::endl
+           << std::endl
+           << "  (1,|(um - up)*n|)_dOmegaI / (1,|0.5(um + up)*n|)_dOmegaI" << std::endl
+           << std::endl
+           << "       t        |  divergence  |    mass       " << std::endl;
+
+    writer_timeseries.start_file(header.str());
+
+    clear_files_mass_error = false;
   }
 
+  writer_timeseries.write_row({time, div_error_normalized, mass_error_normalized});
+
   // calculate average error
   ++number_of_samples;
   divergence_sample += div_error_normalized;
   mass_sample += mass_error_normalized;
-
-  // write output file
-  if(dealii::Utilities::MPI::this_mpi_process(mpi_comm) == 0)
-  {
-    std::string filename = data.directory + data.filename + ".div_mass_error_average";
-
-    std::ofstream f;
-
-    f.open(filename.c_str(), std::ios::trunc);
-    f << "Divergence and mass error (averaged over time)" << std::endl;
-    f << "Number of samples:   " << number_of_samples << std::endl;
-    f << "Mean error incompressibility constraint:   " << divergence_sample / number_of_samples
-      << std::endl;
-    f << "Mean error mass flux over interior element faces:  " << mass_sample / number_of_samples
-      << std::endl;
-    f.close();
-  }
 }
 
 template<int dim, typename Number>
 void
 DivergenceAndMassErrorCalculator<dim, Number>::analyze_div_and_mass_error_steady(
-  VectorType const & velocity)
+  Number const div_error,
+  Number const div_error_reference,
+  Number const mass_error,
+  Number const mass_error_reference)
 {
-  Number div_error = 1.0, div_error_reference = 1.0, mass_error = 1.0, mass_error_reference = 1.0;
-
-  // calculate divergence and mass error
-  do_evaluate(
-    *matrix_free, velocity, div_error, div_error_reference, mass_error, mass_error_reference);
-
   Number div_error_normalized  = div_error / div_error_reference;
   Number mass_error_normalized = 1.0;
   if(mass_error_reference > 1.e-12)
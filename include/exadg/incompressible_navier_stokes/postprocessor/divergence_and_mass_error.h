@@ -28,6 +28,7 @@
 // ExaDG
 #include <exadg/matrix_free/integrators.h>
 #include <exadg/postprocessor/time_control.h>
+#include <exadg/postprocessor/time_series_writer.h>
 #include <exadg/utilities/print_functions.h>
 
 namespace ExaDG
@@ -57,6 +58,8 @@ struct MassConservationData
   std::string directory;
   std::string filename;
   double      reference_length_scale;
+
+  TimeSeriesWriterData time_series_data;
 };
 
 template<int dim, typename Number>
@@ -75,6 +78,8 @@ public:
 
   DivergenceAndMassErrorCalculator(MPI_Comm const & comm);
 
+  ~DivergenceAndMassErrorCalculator();
+
   void
   setup(dealii::MatrixFree<dim, Number> const & matrix_free_in,
         unsigned int const                      dof_index_in,
@@ -84,6 +89,18 @@ public:
   void
   evaluate(VectorType const & velocity, double const time, bool const unsteady);
 
+  /*
+   * Same as above, but for integrals that have already been computed and summed over all MPI
+   * processes, e.g., in a loop together with other integral quantities.
+   */
+  void
+  evaluate(Number const div_error,
+           Number const div_error_reference,
+           Number const mass_error,
+           Number const mass_error_reference,
+           double const time,
+           bool const   unsteady);
+
   TimeControl time_control;
 
 private:
@@ -127,10 +144,17 @@ private:
                                   const std::pair<unsigned int, unsigned int> &);
 
   void
-  analyze_div_and_mass_error_unsteady(VectorType const & velocity, double const time);
+  analyze_div_and_mass_error_unsteady(Number const div_error,
+                                      Number const div_error_reference,
+                                      Number const mass_error,
+                                      Number const mass_error_reference,
+                                      double const time);
 
   void
-  analyze_div_and_mass_error_steady(VectorType const & velocity);
+  analyze_div_and_mass_error_steady(Number const div_error,
+                                    Number const div_error_reference,
+                                    Number const mass_error,
+                                    Number const mass_error_reference);
 
   MPI_Comm const mpi_comm;
 
@@ -139,6 +163,9 @@ private:
   Number divergence_sample;
   Number mass_sample;
 
+  TimeSeriesWriter writer_timeseries;
+  TimeSeriesWriter writer_average;
+
   dealii::MatrixFree<dim, Number> const * matrix_free;
   unsigned int                            dof_index, quad_index;
   MassConservationData                    data;
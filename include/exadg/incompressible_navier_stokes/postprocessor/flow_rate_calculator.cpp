@@ -19,9 +19,6 @@
  *  ______________________________________________________________________
  */
 
-// C/C++
-#include <fstream>
-
 // ExaDG
 #include <exadg/incompressible_navier_stokes/postprocessor/flow_rate_calculator.h>
 #include <exadg/utilities/create_directories.h>
@@ -42,10 +39,16 @@ FlowRateCalculator<dim, Number>::FlowRateCalculator(
     dof_index(dof_index_in),
     quad_index(quad_index_in),
     clear_files(true),
-    mpi_comm(comm)
+    mpi_comm(comm),
+    writer(comm)
 {
   if(data.calculate)
+  {
     create_directories(data.directory, mpi_comm);
+
+    if(data.write_to_file)
+      writer.setup(data.directory + data.filename, data.time_series_data);
+  }
 }
 
 template<int dim, typename Number>
@@ -83,26 +86,16 @@ FlowRateCalculator<dim, Number>::write_output(Number const &      value,
                                               std::string const & name)
 {
   // write output file
-  if(data.write_to_file == true and dealii::Utilities::MPI::this_mpi_process(mpi_comm) == 0)
+  if(data.write_to_file == true)
   {
-    std::string filename = data.directory + data.filename;
-
-    std::ofstream f;
     if(clear_files == true)
     {
-      f.open(filename.c_str(), std::ios::trunc);
-      f << std::endl << "  Time                " + name << std::endl;
+      writer.start_file("\n  Time                " + name + "\n");
 
       clear_files = false;
     }
-    else
-    {
-      f.open(filename.c_str(), std::ios::app);
-    }
 
-    unsigned int precision = 12;
-    f << std::scientific << std::setprecision(precision) << std::setw(precision + 8) << time
-      << std::setw(precision + 8) << value << std::endl;
+    writer.write_row({time, value});
   }
 }
 
@@ -23,6 +23,7 @@
 #define INCLUDE_EXADG_INCOMPRESSIBLE_NAVIER_STOKES_POSTPROCESSOR_FLOW_RATE_CALCULATOR_H_
 
 #include <exadg/matrix_free/integrators.h>
+#include <exadg/postprocessor/time_series_writer.h>
 #include <exadg/utilities/print_functions.h>
 
 namespace ExaDG
@@ -62,6 +63,8 @@ struct FlowRateCalculatorData
   // directory and filename
   std::string directory;
   std::string filename;
+
+  TimeSeriesWriterData time_series_data;
 };
 
 
@@ -115,6 +118,8 @@ private:
   bool                                    clear_files;
 
   MPI_Comm const mpi_comm;
+
+  TimeSeriesWriter writer;
 };
 
 } // namespace IncNS
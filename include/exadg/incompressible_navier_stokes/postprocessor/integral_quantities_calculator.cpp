@@ -0,0 +1,318 @@
+/*  ______________________________________________________________________
+ *
+ *  ExaDG - High-Order Discontinuous Galerkin for the Exa-Scale
+ *
+ *  Copyright (C) 2021 by the ExaDG authors
+ *
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation, either version 3 of the License, or
+ *  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ *  ______________________________________________________________________
+ */
+
+// ExaDG
+#include <exadg/incompressible_navier_stokes/postprocessor/integral_quantities_calculator.h>
+
+namespace ExaDG
+{
+namespace IncNS
+{
+template<int dim, typename Number>
+IntegralQuantitiesCalculator<dim, Number>::IntegralQuantitiesCalculator(MPI_Comm const & comm)
+  : mpi_comm(comm),
+    matrix_free(nullptr),
+    dof_index_velocity(0),
+    dof_index_pressure(1),
+    quad_index(0),
+    viscosity_kinetic_energy(1.0),
+    reference_length_scale(1.0),
+    viscosity_lift_and_drag(1.0),
+    evaluate_kinetic_energy(false),
+    evaluate_div_and_mass_error(false),
+    evaluate_lift_and_drag(false),
+    pressure(nullptr),
+    max_vorticity(0.0)
+{
+}
+
+template<int dim, typename Number>
+void
+IntegralQuantitiesCalculator<dim, Number>::setup(
+  dealii::MatrixFree<dim, Number> const &      matrix_free_in,
+  unsigned int const                           dof_index_velocity_in,
+  unsigned int const                           dof_index_pressure_in,
+  unsigned int const                           quad_index_in,
+  double const                                 viscosity_kinetic_energy_in,
+  double const                                 reference_length_scale_in,
+  double const                                 viscosity_lift_and_drag_in,
+  std::set<dealii::types::boundary_id> const & boundary_IDs_lift_and_drag_in)
+{
+  matrix_free                = &matrix_free_in;
+  dof_index_velocity         = dof_index_velocity_in;
+  dof_index_pressure         = dof_index_pressure_in;
+  quad_index                 = quad_index_in;
+  viscosity_kinetic_energy   = viscosity_kinetic_energy_in;
+  reference_length_scale     = reference_length_scale_in;
+  viscosity_lift_and_drag    = viscosity_lift_and_drag_in;
+  boundary_IDs_lift_and_drag = boundary_IDs_lift_and_drag_in;
+}
+
+template<int dim, typename Number>
+IntegralQuantities<dim, Number>
+IntegralQuantitiesCalculator<dim, Number>::evaluate(VectorType const & velocity,
+                                                    VectorType const & pressure_in,
+                                                    bool const         kinetic_energy,
+                                                    bool const         div_and_mass_error,
+                                                    bool const         lift_and_drag) const
+{
+  AssertThrow(matrix_free != nullptr, dealii::ExcMessage("Invalid pointer."));
+
+  evaluate_kinetic_energy     = kinetic_energy;
+  evaluate_div_and_mass_error = div_and_mass_error;
+  evaluate_lift_and_drag      = lift_and_drag and boundary_IDs_lift_and_drag.size() > 0;
+  pressure                    = &pressure_in;
+  max_vorticity               = 0.0;
+
+  std::vector<Number> dst(n_entries, 0.0);
+
+  std::pair<unsigned int, unsigned int> const boundary_face_range(
+    matrix_free->n_inner_face_batches(),
+    matrix_free->n_inner_face_batches() + matrix_free->n_boundary_face_batches());
+
+  // Interior faces (and the ghost exchange of the velocity) are only needed for the mass error.
+  // Otherwise, the cell integrals are computed by a cell loop and the boundary faces, which only
+  // require locally owned data, are processed directly.
+  if(evaluate_div_and_mass_error)
+  {
+    matrix_free->loop(
+      &This::cell_loop, &This::face_loop, &This::boundary_face_loop, this, dst, velocity);
+  }
+  else
+  {
+    if(evaluate_kinetic_energy)
+      matrix_free->cell_loop(&This::cell_loop, this, dst, velocity);
+
+    if(evaluate_lift_and_drag)
+      boundary_face_loop(*matrix_free, dst, velocity, boundary_face_range);
+  }
+
+  pressure = nullptr;
+
+  // sum over all MPI processes in a single reduction
+  dealii::Utilities::MPI::sum(dealii::ArrayView<Number const>(dst.data(), dst.size()),
+                              mpi_comm,
+                              dealii::ArrayView<Number>(dst.data(), dst.size()));
+
+  IntegralQuantities<dim, Number> result;
+
+  if(evaluate_kinetic_energy)
+  {
+    result.volume        = dst[index_volume];
+    result.energy        = dst[index_energy] / result.volume;
+    result.enstrophy     = dst[index_enstrophy] / result.volume;
+    result.dissipation   = dst[index_dissipation] / result.volume;
+    result.max_vorticity = dealii::Utilities::MPI::max(max_vorticity, mpi_comm);
+  }
+
+  if(evaluate_div_and_mass_error)
+  {
+    result.div_error            = dst[index_div_error];
+    result.div_error_reference  = dst[index_div_error_reference];
+    result.mass_error           = dst[index_mass_error];
+    result.mass_error_reference = dst[index_mass_error_reference];
+  }
+
+  if(evaluate_lift_and_drag)
+  {
+    for(unsigned int d = 0; d < dim; ++d)
+      result.force[d] = dst[index_force + d];
+  }
+
+  return result;
+}
+
+template<int dim, typename Number>
+void
+IntegralQuantitiesCalculator<dim, Number>::cell_loop(
+  dealii::MatrixFree<dim, Number> const &       matrix_free,
+  std::vector<Number> &                         dst,
+  VectorType const &                            velocity,
+  std::pair<unsigned int, unsigned int> const & cell_range) const
+{
+  if(not(evaluate_kinetic_energy or evaluate_div_and_mass_error))
+    return;
+
+  CellIntegratorU integrator(matrix_free, dof_index_velocity, quad_index);
+
+  for(unsigned int cell = cell_range.first; cell < cell_range.second; ++cell)
+  {
+    integrator.reinit(cell);
+    integrator.read_dof_values(velocity);
+    integrator.evaluate(dealii::EvaluationFlags::values | dealii::EvaluationFlags::gradients);
+
+    scalar volume_vec        = dealii::make_vectorized_array<Number>(0.);
+    scalar energy_vec        = dealii::make_vectorized_array<Number>(0.);
+    scalar enstrophy_vec     = dealii::make_vectorized_array<Number>(0.);
+    scalar dissipation_vec   = dealii::make_vectorized_array<Number>(0.);
+    scalar max_vorticity_vec = dealii::make_vectorized_array<Number>(0.);
+    scalar div_vec           = dealii::make_vectorized_array<Number>(0.);
+    scalar ref_vec           = dealii::make_vectorized_array<Number>(0.);
+
+    for(unsigned int q = 0; q < integrator.n_q_points; ++q)
+    {
+      scalar const JxW      = integrator.JxW(q);
+      vector const u        = integrator.get_value(q);
+      tensor const gradient = integrator.get_gradient(q);
+
+      if(evaluate_kinetic_energy)
+      {
+        volume_vec += JxW;
+        energy_vec += JxW * dealii::make_vectorized_array<Number>(0.5) * u * u;
+        dissipation_vec += JxW * dealii::make_vectorized_array<Number>(viscosity_kinetic_energy) *
+                           scalar_product(gradient, gradient);
+
+        dealii::Tensor<1, number_vorticity_components, scalar> omega = integrator.get_curl(q);
+
+        scalar norm_omega = omega * omega;
+
+        enstrophy_vec += JxW * dealii::make_vectorized_array<Number>(0.5) * norm_omega;
+
+        max_vorticity_vec = std::max(max_vorticity_vec, std::sqrt(norm_omega));
+      }
+
+      if(evaluate_div_and_mass_error)
+      {
+        ref_vec += JxW * u.norm();
+        div_vec += JxW * std::abs(trace(gradient));
+      }
+    }
+
+    // sum over entries of dealii::VectorizedArray, but only over those that are "active"
+    for(unsigned int v = 0; v < matrix_free.n_active_entries_per_cell_batch(cell); ++v)
+    {
+      dst[index_volume] += volume_vec[v];
+      dst[index_energy] += energy_vec[v];
+      dst[index_enstrophy] += enstrophy_vec[v];
+      dst[index_dissipation] += dissipation_vec[v];
+      dst[index_div_error] += div_vec[v] * reference_length_scale;
+      dst[index_div_error_reference] += ref_vec[v];
+
+      max_vorticity = std::max(max_vorticity, max_vorticity_vec[v]);
+    }
+  }
+}
+
+template<int dim, typename Number>
+void
+IntegralQuantitiesCalculator<dim, Number>::face_loop(
+  dealii::MatrixFree<dim, Number> const &       matrix_free,
+  std::vector<Number> &                         dst,
+  VectorType const &                            velocity,
+  std::pair<unsigned int, unsigned int> const & face_range) const
+{
+  if(not evaluate_div_and_mass_error)
+    return;
+
+  FaceIntegratorU integrator_m(matrix_free, true, dof_index_velocity, quad_index);
+  FaceIntegratorU integrator_p(matrix_free, false, dof_index_velocity, quad_index);
+
+  for(unsigned int face = face_range.first; face < face_range.second; ++face)
+  {
+    integrator_m.reinit(face);
+    integrator_m.read_dof_values(velocity);
+    integrator_m.evaluate(dealii::EvaluationFlags::values);
+    integrator_p.reinit(face);
+    integrator_p.read_dof_values(velocity);
+    integrator_p.evaluate(dealii::EvaluationFlags::values);
+
+    scalar diff_mass_flux_vec = dealii::make_vectorized_array<Number>(0.);
+    scalar mean_mass_flux_vec = dealii::make_vectorized_array<Number>(0.);
+
+    for(unsigned int q = 0; q < integrator_m.n_q_points; ++q)
+    {
+      vector const u_m    = integrator_m.get_value(q);
+      vector const u_p    = integrator_p.get_value(q);
+      vector const normal = integrator_m.get_normal_vector(q);
+
+      diff_mass_flux_vec += integrator_m.JxW(q) * std::abs((u_m - u_p) * normal);
+      mean_mass_flux_vec += integrator_m.JxW(q) * std::abs(0.5 * (u_m + u_p) * normal);
+    }
+
+    // sum over entries of dealii::VectorizedArray, but only over those that are "active"
+    for(unsigned int v = 0; v < matrix_free.n_active_entries_per_face_batch(face); ++v)
+    {
+      dst[index_mass_error] += diff_mass_flux_vec[v];
+      dst[index_mass_error_reference] += mean_mass_flux_vec[v];
+    }
+  }
+}
+
+template<int dim, typename Number>
+void
+IntegralQuantitiesCalculator<dim, Number>::boundary_face_loop(
+  dealii::MatrixFree<dim, Number> const &       matrix_free,
+  std::vector<Number> &                         dst,
+  VectorType const &                            velocity,
+  std::pair<unsigned int, unsigned int> const & face_range) const
+{
+  if(not evaluate_lift_and_drag)
+    return;
+
+  AssertThrow(pressure != nullptr, dealii::ExcMessage("Invalid pointer."));
+
+  FaceIntegratorU integrator_velocity(matrix_free, true, dof_index_velocity, quad_index);
+  FaceIntegratorP integrator_pressure(matrix_free, true, dof_index_pressure, quad_index);
+
+  for(unsigned int face = face_range.first; face < face_range.second; ++face)
+  {
+    if(boundary_IDs_lift_and_drag.find(matrix_free.get_boundary_id(face)) ==
+       boundary_IDs_lift_and_drag.end())
+      continue;
+
+    integrator_velocity.reinit(face);
+    integrator_velocity.read_dof_values(velocity);
+    integrator_velocity.evaluate(dealii::EvaluationFlags::gradients);
+
+    integrator_pressure.reinit(face);
+    integrator_pressure.read_dof_values(*pressure);
+    integrator_pressure.evaluate(dealii::EvaluationFlags::values);
+
+    for(unsigned int q = 0; q < integrator_velocity.n_q_points; ++q)
+    {
+      vector const normal   = integrator_velocity.get_normal_vector(q);
+      tensor const gradient = integrator_velocity.get_gradient(q);
+
+      vector const tau = integrator_pressure.get_value(q) * normal -
+                         viscosity_lift_and_drag * (gradient + transpose(gradient)) * normal;
+
+      integrator_velocity.submit_value(tau, q);
+    }
+
+    vector const force_local = integrator_velocity.integrate_value();
+
+    // sum over entries of dealii::VectorizedArray, but only over those that are "active"
+    for(unsigned int d = 0; d < dim; ++d)
+    {
+      for(unsigned int v = 0; v < matrix_free.n_active_entries_per_face_batch(face); ++v)
+        dst[index_force + d] += force_local[d][v];
+    }
+  }
+}
+
+template class IntegralQuantitiesCalculator<2, float>;
+template class IntegralQuantitiesCalculator<2, double>;
+
+template class IntegralQuantitiesCalculator<3, float>;
+template class IntegralQuantitiesCalculator<3, double>;
+
+} // namespace IncNS
+} // namespace ExaDG
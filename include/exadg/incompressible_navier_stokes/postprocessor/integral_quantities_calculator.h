@@ -0,0 +1,182 @@
+/*  ______________________________________________________________________
+ *
+ *  ExaDG - High-Order Discontinuous Galerkin for the Exa-Scale
+ *
+ *  Copyright (C) 2021 by the ExaDG authors
+ *
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation, either version 3 of the License, or
+ *  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ *  ______________________________________________________________________
+ */
+
+#ifndef INCLUDE_EXADG_INCOMPRESSIBLE_NAVIER_STOKES_POSTPROCESSOR_INTEGRAL_QUANTITIES_CALCULATOR_H_
+#define INCLUDE_EXADG_INCOMPRESSIBLE_NAVIER_STOKES_POSTPROCESSOR_INTEGRAL_QUANTITIES_CALCULATOR_H_
+
+// C/C++
+#include <set>
+
+// deal.II
+#include <deal.II/lac/la_parallel_vector.h>
+
+// ExaDG
+#include <exadg/matrix_free/integrators.h>
+
+namespace ExaDG
+{
+namespace IncNS
+{
+/*
+ * Integral quantities that can be computed by IntegralQuantitiesCalculator. The integrals are
+ * summed over all MPI processes and the kinetic energy quantities are normalized by the volume,
+ * i.e., the results are those computed by the individual calculators KineticEnergyCalculator,
+ * DivergenceAndMassErrorCalculator, and LiftAndDragCalculator.
+ */
+template<int dim, typename Number>
+struct IntegralQuantities
+{
+  IntegralQuantities()
+    : volume(0.0),
+      energy(0.0),
+      enstrophy(0.0),
+      dissipation(0.0),
+      max_vorticity(0.0),
+      div_error(0.0),
+      div_error_reference(0.0),
+      mass_error(0.0),
+      mass_error_reference(0.0)
+  {
+  }
+
+  // kinetic energy
+  Number volume;
+  Number energy;
+  Number enstrophy;
+  Number dissipation;
+  Number max_vorticity;
+
+  // divergence and mass error
+  Number div_error;
+  Number div_error_reference;
+  Number mass_error;
+  Number mass_error_reference;
+
+  // lift and drag
+  dealii::Tensor<1, dim, Number> force;
+};
+
+/*
+ * This class evaluates all integral quantities that are requested at a given time in a single
+ * matrix-free loop over cells, interior faces, and boundary faces, so that the solution vectors are
+ * read and interpolated to quadrature points only once. All sums are reduced with a single
+ * MPI_Allreduce operation (and an additional max-reduction for the maximum vorticity). The
+ * results are written to file by the individual calculators, see PostProcessor.
+ */
+template<int dim, typename Number>
+class IntegralQuantitiesCalculator
+{
+public:
+  typedef dealii::LinearAlgebra::distributed::Vector<Number> VectorType;
+
+  typedef CellIntegrator<dim, dim, Number> CellIntegratorU;
+  typedef FaceIntegrator<dim, dim, Number> FaceIntegratorU;
+  typedef FaceIntegrator<dim, 1, Number>   FaceIntegratorP;
+
+  typedef dealii::VectorizedArray<Number>                         scalar;
+  typedef dealii::Tensor<1, dim, dealii::VectorizedArray<Number>> vector;
+  typedef dealii::Tensor<2, dim, dealii::VectorizedArray<Number>> tensor;
+
+  typedef IntegralQuantitiesCalculator<dim, Number> This;
+
+  static unsigned int const number_vorticity_components = (dim == 2) ? 1 : dim;
+
+  IntegralQuantitiesCalculator(MPI_Comm const & comm);
+
+  void
+  setup(dealii::MatrixFree<dim, Number> const &      matrix_free_in,
+        unsigned int const                           dof_index_velocity_in,
+        unsigned int const                           dof_index_pressure_in,
+        unsigned int const                           quad_index_in,
+        double const                                 viscosity_kinetic_energy_in,
+        double const                                 reference_length_scale_in,
+        double const                                 viscosity_lift_and_drag_in,
+        std::set<dealii::types::boundary_id> const & boundary_IDs_lift_and_drag_in);
+
+  /*
+   * Computes the requested quantities. Entries of the result that have not been requested are zero.
+   */
+  IntegralQuantities<dim, Number>
+  evaluate(VectorType const & velocity,
+           VectorType const & pressure,
+           bool const         kinetic_energy,
+           bool const         div_and_mass_error,
+           bool const         lift_and_drag) const;
+
+private:
+  // position of the quantities in the vector of sums (except for the maximum vorticity)
+  enum Index
+  {
+    index_volume               = 0,
+    index_energy               = 1,
+    index_enstrophy            = 2,
+    index_dissipation          = 3,
+    index_div_error            = 4,
+    index_div_error_reference  = 5,
+    index_mass_error           = 6,
+    index_mass_error_reference = 7,
+    index_force                = 8,
+    n_entries                  = 8 + dim
+  };
+
+  void
+  cell_loop(dealii::MatrixFree<dim, Number> const &       matrix_free,
+            std::vector<Number> &                         dst,
+            VectorType const &                            velocity,
+            std::pair<unsigned int, unsigned int> const & cell_range) const;
+
+  void
+  face_loop(dealii::MatrixFree<dim, Number> const &       matrix_free,
+            std::vector<Number> &                         dst,
+            VectorType const &                            velocity,
+            std::pair<unsigned int, unsigned int> const & face_range) const;
+
+  void
+  boundary_face_loop(dealii::MatrixFree<dim, Number> const &       matrix_free,
+                     std::vector<Number> &                         dst,
+                     VectorType const &                            velocity,
+                     std::pair<unsigned int, unsigned int> const & face_range) const;
+
+  MPI_Comm const mpi_comm;
+
+  dealii::MatrixFree<dim, Number> const * matrix_free;
+  unsigned int                            dof_index_velocity, dof_index_pressure, quad_index;
+
+  double                               viscosity_kinetic_energy;
+  double                               reference_length_scale;
+  double                               viscosity_lift_and_drag;
+  std::set<dealii::types::boundary_id> boundary_IDs_lift_and_drag;
+
+  // quantities requested in the current call of evaluate()
+  mutable bool evaluate_kinetic_energy, evaluate_div_and_mass_error, evaluate_lift_and_drag;
+
+  // the pressure is only needed on boundary faces and is therefore not passed through the loop
+  mutable VectorType const * pressure;
+
+  // the maximum can not be reduced with the sums and is therefore stored separately
+  mutable Number max_vorticity;
+};
+
+} // namespace IncNS
+} // namespace ExaDG
+
+#endif /* INCLUDE_EXADG_INCOMPRESSIBLE_NAVIER_STOKES_POSTPROCESSOR_INTEGRAL_QUANTITIES_CALCULATOR_H_ \
+        */
@@ -20,7 +20,7 @@
  */
 
 // C/C++
-#include <fstream>
+#include <sstream>
 
 // ExaDG
 #include <exadg/incompressible_navier_stokes/postprocessor/kinetic_energy_dissipation_detailed.h>
@@ -65,6 +65,27 @@ KineticEnergyCalculatorDetailed<dim, Number>::evaluate(VectorType const & veloci
     this->calculate_basic(velocity, time);
 }
 
+template<int dim, typename Number>
+void
+KineticEnergyCalculatorDetailed<dim, Number>::evaluate(VectorType const & velocity,
+                                                       Number const       volume,
+                                                       Number const       energy,
+                                                       Number const       enstrophy,
+                                                       Number const       dissipation,
+                                                       Number const       max_vorticity,
+                                                       double const       time,
+                                                       bool const         unsteady)
+{
+  AssertThrow(unsteady,
+              dealii::ExcMessage(
+                "This postprocessing tool can only be used for unsteady problems."));
+
+  if(this->data.evaluate_individual_terms)
+    calculate_detailed(velocity, volume, energy, enstrophy, dissipation, max_vorticity, time);
+  else
+    this->write_output_basic(energy, enstrophy, dissipation, max_vorticity, time);
+}
+
 template<int dim, typename Number>
 void
 KineticEnergyCalculatorDetailed<dim, Number>::calculate_detailed(VectorType const & velocity,
@@ -75,6 +96,20 @@ KineticEnergyCalculatorDetailed<dim, Number>::calculate_detailed(VectorType cons
   Number volume = this->integrate(
     *this->matrix_free, velocity, kinetic_energy, enstrophy, dissipation, max_vorticity);
 
+  calculate_detailed(
+    velocity, volume, kinetic_energy, enstrophy, dissipation, max_vorticity, time);
+}
+
+template<int dim, typename Number>
+void
+KineticEnergyCalculatorDetailed<dim, Number>::calculate_detailed(VectorType const & velocity,
+                                                                 Number const       volume,
+                                                                 Number const kinetic_energy,
+                                                                 Number const enstrophy,
+                                                                 Number const dissipation,
+                                                                 Number const max_vorticity,
+                                                                 double const time)
+{
   AssertThrow(navier_stokes_operator != nullptr, dealii::ExcMessage("Invalid pointer."));
   Number dissipation_convective =
     navier_stokes_operator->calculate_dissipation_convective_term(velocity, time) / volume;
@@ -86,49 +121,38 @@ KineticEnergyCalculatorDetailed<dim, Number>::calculate_detailed(VectorType cons
     navier_stokes_operator->calculate_dissipation_continuity_term(velocity) / volume;
 
   // write output file
-  if(dealii::Utilities::MPI::this_mpi_process(this->mpi_comm) == 0)
+  if(this->clear_files == true)
   {
+    std::ostringstream header;
+
     // clang-format off
-      std::ostringstream filename;
-      filename << this->data.filename;
-
-      std::ofstream f;
-      if(this->clear_files == true)
-      {
-        f.open(filename.str().c_str(), std::ios::trunc);
-        f << "Kinetic energy: E_k = 1/V * 1/2 * (u,u)_Omega, where V=(1,1)_Omega" << std::endl
-          << "Dissipation rate: epsilon = nu/V * (grad(u),grad(u))_Omega, where V=(1,1)_Omega" << std::endl
-          << "Enstrophy: E = 1/V * 1/2 * (rot(u),rot(u))_Omega, where V=(1,1)_Omega" << std::endl
-          << "Dissipation convective term: eps_conv = 1/V * c(u,u)_Omega, where V=(1,1)_Omega" << std::endl
-          << "Dissipation viscous term: eps_vis = 1/V * v(u,u)_Omega, where V=(1,1)_Omega" << std::endl
-          << "Dissipation divergence penalty term: eps_div = 1/V * a_D(u,u)_Omega, where V=(1,1)_Omega" << std::endl
-          << "Dissipation continuity penalty term: eps_conti = 1/V * a_C(u,u)_Omega, where V=(1,1)_Omega" << std::endl;
-
-        f << std::endl
-          << "  Time                Kin. energy         dissipation         enstrophy           max_vorticity       convective          viscous             divergence          continuity"
-          << std::endl;
-
-        this->clear_files = false;
-      }
-      else
-      {
-        f.open(filename.str().c_str(), std::ios::app);
-      }
-
-      unsigned int precision = 12;
-      f << std::scientific << std::setprecision(precision)
-        << std::setw(precision + 8) << time
-        << std::setw(precision + 8) << kinetic_energy
-        << std::setw(precision + 8) << dissipation
-        << std::setw(precision + 8) << enstrophy
-        << std::setw(precision + 8) << max_vorticity
-        << std::setw(precision + 8) << dissipation_convective
-        << std::setw(precision + 8) << dissipation_viscous
-        << std::setw(precision + 8) << dissipation_divergence
-        << std::setw(precision + 8) << dissipation_continuity
-        << std::endl;
+    header << "Kinetic energy: E_k = 1/V * 1/2 * (u,u)_Omega, where V=(1,1)_Omega" << std::endl
+           << "Dissipation rate: epsilon = nu/V * (grad(u),grad(u))_Omega, where V=(1,1)_Omega" << std::endl
+           << "Enstrophy: E = 1/V * 1/2 * (rot(u),rot(u))_Omega, where V=(1,1)_Omega" << std::endl
+           << "Dissipation convective term: eps_conv = 1/V * c(u,u)_Omega, where V=(1,1)_Omega" << std::endl
+           << "Dissipation viscous term: eps_vis = 1/V * v(u,u)_Omega, where V=(1,1)_Omega" << std::endl
+           << "Dissipation divergence penalty term: eps_div = 1/V * a_D(u,u)_Omega, where V=(1,1)_Omega" << std::endl
+           << "Dissipation continuity penalty term: eps_conti = 1/V * a_C(u,u)_Omega, where V=(1,1)_Omega" << std::endl;
+
+    header << std::endl
+           << "  Time                Kin. energy         dissipation         enstrophy           max_vorticity       convective          viscous             divergence          continuity"
+           << std::endl;
     // clang-format on
+
+    this->writer.start_file(header.str());
+
+    this->clear_files = false;
   }
+
+  this->writer.write_row({time,
+                          kinetic_energy,
+                          dissipation,
+                          enstrophy,
+                          max_vorticity,
+                          dissipation_convective,
+                          dissipation_viscous,
+                          dissipation_divergence,
+                          dissipation_continuity});
 }
 
 template class KineticEnergyCalculatorDetailed<2, float>;
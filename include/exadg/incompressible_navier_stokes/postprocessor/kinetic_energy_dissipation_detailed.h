@@ -52,10 +52,33 @@ public:
   void
   evaluate(VectorType const & velocity, double const time, bool const unsteady);
 
+  /*
+   * Same as above, but for volume integrals that have already been computed and summed over all
+   * MPI processes. The velocity is only needed to evaluate the individual terms.
+   */
+  void
+  evaluate(VectorType const & velocity,
+           Number const       volume,
+           Number const       energy,
+           Number const       enstrophy,
+           Number const       dissipation,
+           Number const       max_vorticity,
+           double const       time,
+           bool const         unsteady);
+
 private:
   void
   calculate_detailed(VectorType const & velocity, double const time);
 
+  void
+  calculate_detailed(VectorType const & velocity,
+                     Number const       volume,
+                     Number const       kinetic_energy,
+                     Number const       enstrophy,
+                     Number const       dissipation,
+                     Number const       max_vorticity,
+                     double const       time);
+
   dealii::SmartPointer<NavierStokesOperator const> navier_stokes_operator;
 };
 
@@ -23,6 +23,7 @@
 #define INCLUDE_EXADG_INCOMPRESSIBLE_NAVIER_STOKES_POSTPROCESSOR_MEAN_VELOCITY_CALCULATOR_H_
 
 #include <exadg/matrix_free/integrators.h>
+#include <exadg/postprocessor/time_series_writer.h>
 #include <exadg/utilities/print_functions.h>
 
 namespace ExaDG
@@ -76,6 +77,8 @@ struct MeanVelocityCalculatorData
   // directory and filename
   std::string directory;
   std::string filename;
+
+  TimeSeriesWriterData time_series_data;
 };
 
 template<int dim, typename Number>
@@ -168,6 +171,8 @@ private:
   mutable bool                            clear_files;
 
   MPI_Comm const mpi_comm;
+
+  mutable TimeSeriesWriter writer;
 };
 
 } // namespace IncNS
@@ -38,8 +38,10 @@ PostProcessor<dim, Number>::PostProcessor(PostProcessorData<dim> const & postpro
     pressure_difference_calculator(comm),
     div_and_mass_error_calculator(comm),
     kinetic_energy_calculator(comm),
+    integral_quantities_calculator(comm),
     kinetic_energy_spectrum_calculator(comm),
-    line_plot_calculator(comm)
+    line_plot_calculator(comm),
+    running_statistics_calculator(comm)
 {
 }
 
@@ -70,10 +72,16 @@ PostProcessor<dim, Number>::setup(Operator const & pde_operator)
 
   error_calculator_u.setup(pde_operator.get_dof_handler_u(),
                            *pde_operator.get_mapping(),
+                           pde_operator.get_matrix_free(),
+                           pde_operator.get_dof_index_velocity(),
+                           pde_operator.get_quad_index_velocity_error(),
                            pp_data.error_data_u);
 
   error_calculator_p.setup(pde_operator.get_dof_handler_p(),
                            *pde_operator.get_mapping(),
+                           pde_operator.get_matrix_free(),
+                           pde_operator.get_dof_index_pressure(),
+                           pde_operator.get_quad_index_pressure_error(),
                            pp_data.error_data_p);
 
   lift_and_drag_calculator.setup(pde_operator.get_dof_handler_u(),
@@ -98,6 +106,15 @@ PostProcessor<dim, Number>::setup(Operator const & pde_operator)
                                   pde_operator.get_quad_index_velocity_standard(),
                                   pp_data.kinetic_energy_data);
 
+  integral_quantities_calculator.setup(pde_operator.get_matrix_free(),
+                                       pde_operator.get_dof_index_velocity(),
+                                       pde_operator.get_dof_index_pressure(),
+                                       pde_operator.get_quad_index_velocity_standard(),
+                                       pp_data.kinetic_energy_data.viscosity,
+                                       pp_data.mass_data.reference_length_scale,
+                                       pp_data.lift_and_drag_data.viscosity,
+                                       pp_data.lift_and_drag_data.boundary_IDs);
+
   kinetic_energy_spectrum_calculator.setup(pde_operator.get_matrix_free(),
                                            pde_operator.get_dof_handler_u(),
                                            pp_data.kinetic_energy_spectrum_data);
@@ -106,6 +123,12 @@ PostProcessor<dim, Number>::setup(Operator const & pde_operator)
                              pde_operator.get_dof_handler_p(),
                              *pde_operator.get_mapping(),
                              pp_data.line_plot_data);
+
+  running_statistics_calculator.setup(pde_operator.get_matrix_free(),
+                                      pde_operator.get_dof_index_velocity(),
+                                      pde_operator.get_dof_index_pressure(),
+                                      pde_operator.get_quad_index_velocity_standard(),
+                                      pp_data.running_statistics_data);
 }
 
 template<int dim, typename Number>
@@ -208,36 +231,56 @@ PostProcessor<dim, Number>::do_postprocessing(VectorType const &     velocity,
     error_calculator_p.evaluate(pressure, time, Utilities::is_unsteady_timestep(time_step_number));
 
   /*
-   *  calculation of lift and drag coefficients
+   *  Integral quantities (lift and drag coefficients, divergence and mass error, kinetic energy)
+   *  are computed in a single loop and written to file by the individual calculators.
    */
-  if(lift_and_drag_calculator.time_control.needs_evaluation(time, time_step_number))
-    lift_and_drag_calculator.evaluate(velocity, pressure, time);
+  bool const evaluate_lift_and_drag =
+    lift_and_drag_calculator.time_control.needs_evaluation(time, time_step_number);
+  bool const evaluate_div_and_mass_error =
+    div_and_mass_error_calculator.time_control.needs_evaluation(time, time_step_number);
+  bool const evaluate_kinetic_energy =
+    kinetic_energy_calculator.time_control.needs_evaluation(time, time_step_number);
+
+  if(evaluate_lift_and_drag or evaluate_div_and_mass_error or evaluate_kinetic_energy)
+  {
+    IntegralQuantities<dim, Number> const integrals =
+      integral_quantities_calculator.evaluate(velocity,
+                                              pressure,
+                                              evaluate_kinetic_energy,
+                                              evaluate_div_and_mass_error,
+                                              evaluate_lift_and_drag);
 
-  /*
-   *  calculation of pressure difference
-   */
-  if(pressure_difference_calculator.time_control.needs_evaluation(time, time_step_number))
-    pressure_difference_calculator.evaluate(pressure, time);
+    if(evaluate_lift_and_drag)
+      lift_and_drag_calculator.evaluate(integrals.force, time);
 
-  /*
-   *  Analysis of divergence and mass error
-   */
-  if(div_and_mass_error_calculator.time_control.needs_evaluation(time, time_step_number))
-  {
-    div_and_mass_error_calculator.evaluate(velocity,
-                                           time,
-                                           Utilities::is_unsteady_timestep(time_step_number));
+    if(evaluate_div_and_mass_error)
+    {
+      div_and_mass_error_calculator.evaluate(integrals.div_error,
+                                             integrals.div_error_reference,
+                                             integrals.mass_error,
+                                             integrals.mass_error_reference,
+                                             time,
+                                             Utilities::is_unsteady_timestep(time_step_number));
+    }
+
+    if(evaluate_kinetic_energy)
+    {
+      kinetic_energy_calculator.evaluate(velocity,
+                                         integrals.volume,
+                                         integrals.energy,
+                                         integrals.enstrophy,
+                                         integrals.dissipation,
+                                         integrals.max_vorticity,
+                                         time,
+                                         Utilities::is_unsteady_timestep(time_step_number));
+    }
   }
 
   /*
-   *  calculation of kinetic energy
+   *  calculation of pressure difference
    */
-  if(kinetic_energy_calculator.time_control.needs_evaluation(time, time_step_number))
-  {
-    kinetic_energy_calculator.evaluate(velocity,
-                                       time,
-                                       Utilities::is_unsteady_timestep(time_step_number));
-  }
+  if(pressure_difference_calculator.time_control.needs_evaluation(time, time_step_number))
+    pressure_difference_calculator.evaluate(pressure, time);
 
   /*
    *  calculation of kinetic energy spectrum
@@ -254,6 +297,25 @@ PostProcessor<dim, Number>::do_postprocessing(VectorType const &     velocity,
    */
   if(line_plot_calculator.time_control.needs_evaluation(time, time_step_number))
     line_plot_calculator.evaluate(velocity, pressure);
+
+  /*
+   *  Accumulate temporal statistics
+   */
+  if(running_statistics_calculator.time_control_statistics.time_control.needs_evaluation(
+       time, time_step_number))
+  {
+    AssertThrow(Utilities::is_unsteady_timestep(time_step_number),
+                dealii::ExcMessage(
+                  "Calculating running statistics does not make sense for steady problems."));
+
+    running_statistics_calculator.evaluate(velocity, pressure);
+  }
+
+  if(running_statistics_calculator.time_control_statistics.write_preliminary_results(
+       time, time_step_number))
+  {
+    running_statistics_calculator.write_output();
+  }
 }
 
 template<int dim, typename Number>
@@ -23,11 +23,13 @@
 #define INCLUDE_EXADG_INCOMPRESSIBLE_NAVIER_STOKES_POSTPROCESSOR_POSTPROCESSOR_H_
 
 #include <exadg/incompressible_navier_stokes/postprocessor/divergence_and_mass_error.h>
+#include <exadg/incompressible_navier_stokes/postprocessor/integral_quantities_calculator.h>
 #include <exadg/incompressible_navier_stokes/postprocessor/kinetic_energy_dissipation_detailed.h>
 #include <exadg/incompressible_navier_stokes/postprocessor/line_plot_calculation.h>
 #include <exadg/incompressible_navier_stokes/postprocessor/output_generator.h>
 #include <exadg/incompressible_navier_stokes/postprocessor/pointwise_output_generator.h>
 #include <exadg/incompressible_navier_stokes/postprocessor/postprocessor_base.h>
+#include <exadg/incompressible_navier_stokes/postprocessor/running_statistics_calculator.h>
 #include <exadg/incompressible_navier_stokes/spatial_discretization/spatial_operator_base.h>
 #include <exadg/postprocessor/error_calculation.h>
 #include <exadg/postprocessor/kinetic_energy_spectrum.h>
@@ -55,6 +57,7 @@ struct PostProcessorData
   KineticEnergyData           kinetic_energy_data;
   KineticEnergySpectrumData   kinetic_energy_spectrum_data;
   LinePlotData<dim>           line_plot_data;
+  RunningStatisticsData<dim>  running_statistics_data;
 };
 
 template<int dim, typename Number>
@@ -133,11 +136,18 @@ private:
   // flows)
   KineticEnergyCalculatorDetailed<dim, Number> kinetic_energy_calculator;
 
+  // evaluate the integrals needed by the lift and drag, divergence and mass error, and kinetic
+  // energy calculators in a single loop
+  IntegralQuantitiesCalculator<dim, Number> integral_quantities_calculator;
+
   // evaluate kinetic energy in spectral space (i.e., as a function of the wavenumber)
   KineticEnergySpectrumCalculator<dim, Number> kinetic_energy_spectrum_calculator;
 
   // evaluate quantities along lines through the domain
   LinePlotCalculator<dim, Number> line_plot_calculator;
+
+  // accumulate temporal statistics (mean values, Reynolds stresses) at the quadrature points
+  RunningStatisticsCalculator<dim, Number> running_statistics_calculator;
 };
 
 
@@ -0,0 +1,99 @@
+/*  ______________________________________________________________________
+ *
+ *  ExaDG - High-Order Discontinuous Galerkin for the Exa-Scale
+ *
+ *  Copyright (C) 2021 by the ExaDG authors
+ *
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation, either version 3 of the License, or
+ *  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ *  ______________________________________________________________________
+ */
+
+// C/C++
+#include <limits>
+
+// ExaDG
+#include <exadg/incompressible_navier_stokes/postprocessor/postprocessor_in_transit.h>
+#include <exadg/incompressible_navier_stokes/spatial_discretization/spatial_operator_base.h>
+
+namespace ExaDG
+{
+namespace IncNS
+{
+template<int dim, typename Number>
+PostProcessorInTransit<dim, Number>::PostProcessorInTransit(
+  std::shared_ptr<InTransitCommunicator const> in_transit_in)
+  : in_transit(in_transit_in)
+{
+  AssertThrow(in_transit.get() and in_transit->is_active() and
+                not in_transit->is_postprocessing_process(),
+              dealii::ExcMessage("PostProcessorInTransit may only be used on solver processes "
+                                 "in case of in-transit postprocessing."));
+}
+
+template<int dim, typename Number>
+void
+PostProcessorInTransit<dim, Number>::setup(Operator const & pde_operator)
+{
+  snapshot_transfer = std::make_shared<SnapshotTransfer<dim, Number>>(
+    *in_transit,
+    std::vector<dealii::DoFHandler<dim> const *>{&pde_operator.get_dof_handler_u(),
+                                                 &pde_operator.get_dof_handler_p()});
+
+  TimeControlData time_control_data;
+  time_control_data.is_active                = true;
+  time_control_data.start_time               = std::numeric_limits<double>::lowest();
+  time_control_data.trigger_every_time_steps = in_transit->get_snapshot_interval();
+  time_control.setup(time_control_data);
+}
+
+template<int dim, typename Number>
+void
+PostProcessorInTransit<dim, Number>::do_postprocessing(VectorType const &     velocity,
+                                                       VectorType const &     pressure,
+                                                       double const           time,
+                                                       types::time_step const time_step_number)
+{
+  if(time_control.needs_evaluation(time, time_step_number))
+    snapshot_transfer->send({&velocity, &pressure}, time, time_step_number);
+}
+
+template<int dim, typename Number>
+void
+PostProcessorInTransit<dim, Number>::finalize()
+{
+  snapshot_transfer->finalize();
+}
+
+template<int dim, typename Number>
+unsigned int
+PostProcessorInTransit<dim, Number>::get_n_snapshots() const
+{
+  return snapshot_transfer->get_n_snapshots();
+}
+
+template<int dim, typename Number>
+double
+PostProcessorInTransit<dim, Number>::get_postprocessing_wall_time() const
+{
+  return snapshot_transfer->get_postprocessing_wall_time();
+}
+
+template class PostProcessorInTransit<2, float>;
+template class PostProcessorInTransit<2, double>;
+
+template class PostProcessorInTransit<3, float>;
+template class PostProcessorInTransit<3, double>;
+
+} // namespace IncNS
+} // namespace ExaDG
@@ -0,0 +1,91 @@
+/*  ______________________________________________________________________
+ *
+ *  ExaDG - High-Order Discontinuous Galerkin for the Exa-Scale
+ *
+ *  Copyright (C) 2021 by the ExaDG authors
+ *
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation, either version 3 of the License, or
+ *  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ *  ______________________________________________________________________
+ */
+
+#ifndef INCLUDE_EXADG_INCOMPRESSIBLE_NAVIER_STOKES_POSTPROCESSOR_POSTPROCESSOR_IN_TRANSIT_H_
+#define INCLUDE_EXADG_INCOMPRESSIBLE_NAVIER_STOKES_POSTPROCESSOR_POSTPROCESSOR_IN_TRANSIT_H_
+
+// ExaDG
+#include <exadg/incompressible_navier_stokes/postprocessor/postprocessor_base.h>
+#include <exadg/postprocessor/snapshot_transfer.h>
+#include <exadg/postprocessor/time_control.h>
+#include <exadg/utilities/in_transit_communicator.h>
+
+namespace ExaDG
+{
+namespace IncNS
+{
+/*
+ * Postprocessor used on the solver processes in case of in-transit postprocessing. Instead of
+ * evaluating the postprocessing tools, velocity and pressure are shipped to the dedicated
+ * postprocessing processes every InTransitSnapshotInterval time steps (and for every call in the
+ * steady case), where the actual postprocessor is applied. The interval has to be chosen such
+ * that all time steps needed by the postprocessing tools are shipped.
+ */
+template<int dim, typename Number>
+class PostProcessorInTransit : public PostProcessorBase<dim, Number>
+{
+private:
+  typedef PostProcessorBase<dim, Number> Base;
+
+  typedef typename Base::VectorType VectorType;
+
+  typedef typename Base::Operator Operator;
+
+public:
+  PostProcessorInTransit(std::shared_ptr<InTransitCommunicator const> in_transit);
+
+  void
+  setup(Operator const & pde_operator) final;
+
+  void
+  do_postprocessing(VectorType const &     velocity,
+                    VectorType const &     pressure,
+                    double const           time             = 0.0,
+                    types::time_step const time_step_number = numbers::steady_timestep) final;
+
+  /*
+   * Completes the last snapshot and terminates the postprocessing service on the dedicated
+   * processes. Has to be called after the last call to do_postprocessing().
+   */
+  void
+  finalize();
+
+  unsigned int
+  get_n_snapshots() const;
+
+  /*
+   * Wall time spent on the dedicated processes for postprocessing, available after finalize().
+   */
+  double
+  get_postprocessing_wall_time() const;
+
+private:
+  std::shared_ptr<InTransitCommunicator const> in_transit;
+
+  std::shared_ptr<SnapshotTransfer<dim, Number>> snapshot_transfer;
+
+  TimeControl time_control;
+};
+
+} // namespace IncNS
+} // namespace ExaDG
+
+#endif /* INCLUDE_EXADG_INCOMPRESSIBLE_NAVIER_STOKES_POSTPROCESSOR_POSTPROCESSOR_IN_TRANSIT_H_ */
@@ -0,0 +1,426 @@
+/*  ______________________________________________________________________
+ *
+ *  ExaDG - High-Order Discontinuous Galerkin for the Exa-Scale
+ *
+ *  Copyright (C) 2021 by the ExaDG authors
+ *
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation, either version 3 of the License, or
+ *  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ *  ______________________________________________________________________
+ */
+
+// C/C++
+#include <algorithm>
+#include <cmath>
+#include <fstream>
+#include <iomanip>
+
+#include <boost/archive/binary_iarchive.hpp>
+#include <boost/archive/binary_oarchive.hpp>
+#include <boost/serialization/vector.hpp>
+
+// deal.II
+#include <deal.II/base/mpi.h>
+
+// ExaDG
+#include <exadg/incompressible_navier_stokes/postprocessor/running_statistics_calculator.h>
+#include <exadg/time_integration/restart.h>
+#include <exadg/utilities/create_directories.h>
+
+namespace ExaDG
+{
+namespace IncNS
+{
+template<int dim, typename Number>
+RunningStatisticsCalculator<dim, Number>::RunningStatisticsCalculator(MPI_Comm const & comm)
+  : mpi_comm(comm),
+    dof_index_velocity(0),
+    dof_index_pressure(0),
+    quad_index(0),
+    n_q_points(0),
+    n_samples(0),
+    n_bins(0)
+{
+}
+
+template<int dim, typename Number>
+void
+RunningStatisticsCalculator<dim, Number>::setup(
+  dealii::MatrixFree<dim, Number> const & matrix_free_in,
+  unsigned int const                      dof_index_velocity_in,
+  unsigned int const                      dof_index_pressure_in,
+  unsigned int const                      quad_index_in,
+  RunningStatisticsData<dim> const &      data_in)
+{
+  data = data_in;
+
+  time_control_statistics.setup(data.time_control_data_statistics);
+
+  if(not data.time_control_data_statistics.time_control_data.is_active)
+    return;
+
+  for(auto const & direction : data.averaging_directions)
+    AssertThrow(direction < dim, dealii::ExcMessage("Invalid averaging direction."));
+
+  matrix_free        = &matrix_free_in;
+  dof_index_velocity = dof_index_velocity_in;
+  dof_index_pressure = dof_index_pressure_in;
+  quad_index         = quad_index_in;
+
+  CellIntegratorU integrator(*matrix_free, dof_index_velocity, quad_index);
+  n_q_points = integrator.n_q_points;
+
+  n_samples = 0;
+  accumulators.resize_fast(matrix_free->n_cell_batches() * n_components * n_q_points);
+  accumulators.fill(dealii::make_vectorized_array<Number>(0.0));
+
+  setup_bins();
+
+  create_directories(data.directory, mpi_comm);
+
+  if(data.read_restart)
+    read_restart();
+}
+
+template<int dim, typename Number>
+void
+RunningStatisticsCalculator<dim, Number>::setup_bins()
+{
+  // coordinates that are not averaged over identify the bin of a quadrature point
+  std::vector<unsigned int> directions;
+  for(unsigned int d = 0; d < dim; ++d)
+  {
+    if(std::find(data.averaging_directions.begin(), data.averaging_directions.end(), d) ==
+       data.averaging_directions.end())
+      directions.push_back(d);
+  }
+
+  unsigned int const n_lanes = scalar::size();
+
+  bin_indices.assign(matrix_free->n_cell_batches() * n_lanes * n_q_points,
+                     dealii::numbers::invalid_unsigned_int);
+
+  std::vector<std::vector<double>> point_coordinates(bin_indices.size());
+
+  CellIntegratorU integrator(*matrix_free, dof_index_velocity, quad_index);
+
+  for(unsigned int cell = 0; cell < matrix_free->n_cell_batches(); ++cell)
+  {
+    integrator.reinit(cell);
+
+    for(unsigned int v = 0; v < matrix_free->n_active_entries_per_cell_batch(cell); ++v)
+    {
+      for(unsigned int q = 0; q < n_q_points; ++q)
+      {
+        dealii::Point<dim, scalar> const point = integrator.quadrature_point(q);
+
+        std::vector<double> & coordinates =
+          point_coordinates[(cell * n_lanes + v) * n_q_points + q];
+        for(auto const & d : directions)
+          coordinates.push_back(data.tolerance * std::round(point[d][v] / data.tolerance));
+      }
+    }
+  }
+
+  // local list of bins
+  std::vector<std::vector<double>> local_bins = point_coordinates;
+  std::sort(local_bins.begin(), local_bins.end());
+  local_bins.erase(std::unique(local_bins.begin(), local_bins.end()), local_bins.end());
+
+  // The global list of bins is only assembled on the first process, which writes the output. The
+  // other processes only receive the global indices of their local bins.
+  std::vector<std::vector<std::vector<double>>> const all_bins =
+    dealii::Utilities::MPI::gather(mpi_comm, local_bins, 0);
+
+  bin_coordinates.clear();
+  std::vector<std::vector<unsigned int>> all_bin_indices(all_bins.size());
+  if(dealii::Utilities::MPI::this_mpi_process(mpi_comm) == 0)
+  {
+    for(auto const & bins : all_bins)
+      bin_coordinates.insert(bin_coordinates.end(), bins.begin(), bins.end());
+    std::sort(bin_coordinates.begin(), bin_coordinates.end());
+    bin_coordinates.erase(std::unique(bin_coordinates.begin(), bin_coordinates.end()),
+                          bin_coordinates.end());
+
+    for(unsigned int rank = 0; rank < all_bins.size(); ++rank)
+    {
+      for(auto const & bin : all_bins[rank])
+        all_bin_indices[rank].push_back(
+          std::distance(bin_coordinates.begin(),
+                        std::lower_bound(bin_coordinates.begin(), bin_coordinates.end(), bin)));
+    }
+  }
+
+  n_bins = dealii::Utilities::MPI::broadcast(mpi_comm, (unsigned int)bin_coordinates.size(), 0);
+
+  std::vector<unsigned int> const local_bin_indices =
+    dealii::Utilities::MPI::scatter(mpi_comm, all_bin_indices, 0);
+
+  // assign quadrature points to bins
+  for(unsigned int cell = 0; cell < matrix_free->n_cell_batches(); ++cell)
+  {
+    for(unsigned int v = 0; v < matrix_free->n_active_entries_per_cell_batch(cell); ++v)
+    {
+      for(unsigned int q = 0; q < n_q_points; ++q)
+      {
+        unsigned int const index = (cell * n_lanes + v) * n_q_points + q;
+
+        bin_indices[index] = local_bin_indices[std::distance(
+          local_bins.begin(),
+          std::lower_bound(local_bins.begin(), local_bins.end(), point_coordinates[index]))];
+      }
+    }
+  }
+}
+
+template<int dim, typename Number>
+void
+RunningStatisticsCalculator<dim, Number>::evaluate(VectorType const & velocity,
+                                                   VectorType const & pressure)
+{
+  ++n_samples;
+
+  scalar const factor = dealii::make_vectorized_array<Number>(1.0 / (double)n_samples);
+
+  CellIntegratorU integrator_u(*matrix_free, dof_index_velocity, quad_index);
+  CellIntegratorP integrator_p(*matrix_free, dof_index_pressure, quad_index);
+
+  for(unsigned int cell = 0; cell < matrix_free->n_cell_batches(); ++cell)
+  {
+    integrator_u.reinit(cell);
+    integrator_u.read_dof_values(velocity);
+    integrator_u.evaluate(dealii::EvaluationFlags::values);
+
+    integrator_p.reinit(cell);
+    integrator_p.read_dof_values(pressure);
+    integrator_p.evaluate(dealii::EvaluationFlags::values);
+
+    scalar * acc = &accumulators[cell * n_components * n_q_points];
+
+    for(unsigned int q = 0; q < n_q_points; ++q)
+    {
+      dealii::Tensor<1, dim, scalar> const u = integrator_u.get_value(q);
+      scalar const                         p = integrator_p.get_value(q);
+
+      // Welford update: deviations from the old and the updated mean
+      dealii::Tensor<1, dim, scalar> delta_old, delta_new;
+      for(unsigned int d = 0; d < dim; ++d)
+      {
+        scalar & mean = acc[d * n_q_points + q];
+        delta_old[d]  = u[d] - mean;
+        mean += factor * delta_old[d];
+        delta_new[d] = u[d] - mean;
+      }
+
+      unsigned int c = dim;
+      for(unsigned int i = 0; i < dim; ++i)
+        for(unsigned int j = i; j < dim; ++j, ++c)
+          acc[c * n_q_points + q] += delta_old[i] * delta_new[j];
+
+      scalar &     mean_p  = acc[c * n_q_points + q];
+      scalar const delta_p = p - mean_p;
+      mean_p += factor * delta_p;
+      acc[(c + 1) * n_q_points + q] += delta_p * (p - mean_p);
+    }
+  }
+}
+
+template<int dim, typename Number>
+void
+RunningStatisticsCalculator<dim, Number>::write_output() const
+{
+  if(n_samples == 0)
+    return;
+
+  if(data.write_restart)
+    write_restart();
+
+  // Average over the homogeneous directions weighted by JxW. The second moments are combined
+  // according to the law of total covariance, <u_i'u_j'> = <C_ij/N + <u_i><u_j>>_h -
+  // <<u_i>>_h <<u_j>>_h, where <.>_h denotes the spatial average.
+  unsigned int const n_lanes   = scalar::size();
+  unsigned int const n_entries = 1 + n_components;
+
+  std::vector<double> local_sums(n_bins * n_entries, 0.0);
+
+  CellIntegratorU integrator(*matrix_free, dof_index_velocity, quad_index);
+
+  for(unsigned int cell = 0; cell < matrix_free->n_cell_batches(); ++cell)
+  {
+    integrator.reinit(cell);
+
+    scalar const * acc = &accumulators[cell * n_components * n_q_points];
+
+    for(unsigned int v = 0; v < matrix_free->n_active_entries_per_cell_batch(cell); ++v)
+    {
+      for(unsigned int q = 0; q < n_q_points; ++q)
+      {
+        unsigned int const bin  = bin_indices[(cell * n_lanes + v) * n_q_points + q];
+        double const       JxW  = integrator.JxW(q)[v];
+        double *           sums = &local_sums[bin * n_entries];
+
+        sums[0] += JxW;
+
+        dealii::Tensor<1, dim, double> mean;
+        for(unsigned int d = 0; d < dim; ++d)
+        {
+          mean[d] = acc[d * n_q_points + q][v];
+          sums[1 + d] += JxW * mean[d];
+        }
+
+        unsigned int c = dim;
+        for(unsigned int i = 0; i < dim; ++i)
+          for(unsigned int j = i; j < dim; ++j, ++c)
+            sums[1 + c] += JxW * (acc[c * n_q_points + q][v] / n_samples + mean[i] * mean[j]);
+
+        double const mean_p = acc[c * n_q_points + q][v];
+        sums[1 + c] += JxW * mean_p;
+        sums[2 + c] += JxW * (acc[(c + 1) * n_q_points + q][v] / n_samples + mean_p * mean_p);
+      }
+    }
+  }
+
+  // only the first process writes the output
+  std::vector<double> sums(local_sums.size());
+  MPI_Reduce(local_sums.data(), sums.data(), sums.size(), MPI_DOUBLE, MPI_SUM, 0, mpi_comm);
+
+  if(dealii::Utilities::MPI::this_mpi_process(mpi_comm) == 0)
+  {
+    std::ofstream f;
+    f.open((data.directory + data.filename + ".running_statistics").c_str(), std::ios::trunc);
+
+    f << "Running statistics (averaged over directions";
+    for(auto const & direction : data.averaging_directions)
+      f << " " << direction;
+    f << ")" << std::endl << std::endl;
+    f << "number of samples: N = " << n_samples << std::endl << std::endl;
+
+    // header
+    for(unsigned int d = 0; d < bin_coordinates.front().size(); ++d)
+      f << std::setw(15) << ("x_" + dealii::Utilities::to_string(d));
+    for(unsigned int d = 0; d < dim; ++d)
+      f << std::setw(15) << ("<u_" + dealii::Utilities::to_string(d) + ">");
+    for(unsigned int i = 0; i < dim; ++i)
+      for(unsigned int j = i; j < dim; ++j)
+        f << std::setw(15)
+          << ("<u_" + dealii::Utilities::to_string(i) + "'u_" + dealii::Utilities::to_string(j) +
+              "'>");
+    f << std::setw(15) << "<p>" << std::setw(15) << "<p'p'>" << std::endl;
+
+    for(unsigned int bin = 0; bin < bin_coordinates.size(); ++bin)
+    {
+      double const * bin_sums = &sums[bin * n_entries];
+      double const   volume   = bin_sums[0];
+
+      f << std::scientific << std::setprecision(7);
+      for(auto const & coordinate : bin_coordinates[bin])
+        f << std::setw(15) << coordinate;
+
+      dealii::Tensor<1, dim, double> mean;
+      for(unsigned int d = 0; d < dim; ++d)
+      {
+        mean[d] = bin_sums[1 + d] / volume;
+        f << std::setw(15) << mean[d];
+      }
+
+      unsigned int c = dim;
+      for(unsigned int i = 0; i < dim; ++i)
+        for(unsigned int j = i; j < dim; ++j, ++c)
+          f << std::setw(15) << bin_sums[1 + c] / volume - mean[i] * mean[j];
+
+      double const mean_p = bin_sums[1 + c] / volume;
+      f << std::setw(15) << mean_p << std::setw(15) << bin_sums[2 + c] / volume - mean_p * mean_p
+        << std::endl;
+    }
+
+    f.close();
+  }
+}
+
+template<int dim, typename Number>
+void
+RunningStatisticsCalculator<dim, Number>::write_restart() const
+{
+  std::string const filename = restart_filename(data.directory + data.filename, mpi_comm);
+
+  rename_restart_files(filename);
+
+  std::ostringstream oss;
+
+  boost::archive::binary_oarchive oa(oss);
+
+  unsigned int n_ranks        = dealii::Utilities::MPI::n_mpi_processes(mpi_comm);
+  unsigned int n_cell_batches = matrix_free->n_cell_batches();
+  unsigned int n_q            = n_q_points;
+  unsigned int n_comp         = n_components;
+
+  // 1. layout of accumulators
+  oa & n_ranks;
+  oa & n_cell_batches;
+  oa & n_q;
+  oa & n_comp;
+
+  // 2. accumulators
+  oa & n_samples;
+
+  std::vector<Number> values(accumulators.size() * scalar::size());
+  for(unsigned int i = 0; i < accumulators.size(); ++i)
+    accumulators[i].store(&values[i * scalar::size()]);
+  oa & values;
+
+  write_restart_file(oss, filename);
+}
+
+template<int dim, typename Number>
+void
+RunningStatisticsCalculator<dim, Number>::read_restart()
+{
+  std::string const filename = restart_filename(data.directory + data.filename, mpi_comm);
+  std::ifstream     in(filename, std::ios::binary);
+  AssertThrow(in, dealii::ExcMessage("File " + filename + " does not exist."));
+
+  boost::archive::binary_iarchive ia(in);
+
+  // Note that the operations done here must be in sync with the output.
+
+  // 1. layout of accumulators
+  unsigned int n_ranks = 1, n_cell_batches = 0, n_q = 0, n_comp = 0;
+  ia & n_ranks;
+  ia & n_cell_batches;
+  ia & n_q;
+  ia & n_comp;
+
+  AssertThrow(n_ranks == dealii::Utilities::MPI::n_mpi_processes(mpi_comm) and
+                n_cell_batches == matrix_free->n_cell_batches() and n_q == n_q_points and
+                n_comp == n_components,
+              dealii::ExcMessage("The restart file " + filename +
+                                 " of the running statistics has been written for a different "
+                                 "discretization or parallel partitioning."));
+
+  // 2. accumulators
+  ia & n_samples;
+
+  std::vector<Number> values;
+  ia & values;
+  for(unsigned int i = 0; i < accumulators.size(); ++i)
+    accumulators[i].load(&values[i * scalar::size()]);
+}
+
+template class RunningStatisticsCalculator<2, float>;
+template class RunningStatisticsCalculator<2, double>;
+
+template class RunningStatisticsCalculator<3, float>;
+template class RunningStatisticsCalculator<3, double>;
+
+} // namespace IncNS
+} // namespace ExaDG
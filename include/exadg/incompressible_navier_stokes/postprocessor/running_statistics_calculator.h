@@ -0,0 +1,180 @@
+/*  ______________________________________________________________________
+ *
+ *  ExaDG - High-Order Discontinuous Galerkin for the Exa-Scale
+ *
+ *  Copyright (C) 2021 by the ExaDG authors
+ *
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation, either version 3 of the License, or
+ *  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ *  ______________________________________________________________________
+ */
+
+#ifndef INCLUDE_EXADG_INCOMPRESSIBLE_NAVIER_STOKES_POSTPROCESSOR_RUNNING_STATISTICS_CALCULATOR_H_
+#define INCLUDE_EXADG_INCOMPRESSIBLE_NAVIER_STOKES_POSTPROCESSOR_RUNNING_STATISTICS_CALCULATOR_H_
+
+// C/C++
+#include <vector>
+
+// deal.II
+#include <deal.II/base/aligned_vector.h>
+#include <deal.II/lac/la_parallel_vector.h>
+#include <deal.II/matrix_free/matrix_free.h>
+
+// ExaDG
+#include <exadg/matrix_free/integrators.h>
+#include <exadg/postprocessor/time_control_statistics.h>
+#include <exadg/utilities/print_functions.h>
+
+namespace ExaDG
+{
+namespace IncNS
+{
+template<int dim>
+struct RunningStatisticsData
+{
+  RunningStatisticsData()
+    : tolerance(1.e-8),
+      write_restart(false),
+      read_restart(false),
+      directory("output/"),
+      filename("running_statistics")
+  {
+  }
+
+  void
+  print(dealii::ConditionalOStream & pcout) const
+  {
+    if(time_control_data_statistics.time_control_data.is_active)
+    {
+      pcout << "  Running statistics:" << std::endl;
+
+      // only implemented for unsteady problem
+      pcout << "    Time control:" << std::endl;
+      time_control_data_statistics.print(pcout, true /*unsteady*/);
+
+      std::string directions;
+      for(auto const & direction : averaging_directions)
+        directions += dealii::Utilities::to_string(direction) + " ";
+      print_parameter(pcout, "Averaging directions", directions);
+      print_parameter(pcout, "Tolerance coordinates", tolerance);
+      print_parameter(pcout, "Write restart", write_restart);
+      print_parameter(pcout, "Read restart", read_restart);
+      print_parameter(pcout, "Directory of output files", directory);
+      print_parameter(pcout, "Filename", filename);
+    }
+  }
+
+  TimeControlDataStatistics time_control_data_statistics;
+
+  // Homogeneous directions over which the statistics are averaged when writing output, e.g.
+  // {0, 2} for plane averages in a channel with wall-normal direction 1, or {2} for line
+  // averages in spanwise direction for the periodic hill.
+  std::vector<unsigned int> averaging_directions;
+
+  // Quadrature points whose coordinates in the remaining directions coincide up to this tolerance
+  // are averaged together.
+  double tolerance;
+
+  // Write the accumulators to restart files whenever output is written, and read them in setup()
+  // to continue a previous averaging. The parallel partitioning has to be the same.
+  bool write_restart;
+  bool read_restart;
+
+  // directory and filename
+  std::string directory;
+  std::string filename;
+};
+
+/*
+ * Accumulates temporal statistics of velocity and pressure (mean values, Reynolds stresses, and
+ * pressure variance) at the quadrature points of the matrix-free cell batches, using Welford's
+ * algorithm for a numerically stable update of the second moments. The update is a single
+ * vectorized sweep over the cell batches. Averaging over homogeneous directions is only done when
+ * writing output.
+ */
+template<int dim, typename Number>
+class RunningStatisticsCalculator
+{
+public:
+  typedef dealii::LinearAlgebra::distributed::Vector<Number> VectorType;
+
+  typedef CellIntegrator<dim, dim, Number> CellIntegratorU;
+  typedef CellIntegrator<dim, 1, Number>   CellIntegratorP;
+
+  typedef dealii::VectorizedArray<Number> scalar;
+
+  RunningStatisticsCalculator(MPI_Comm const & comm);
+
+  void
+  setup(dealii::MatrixFree<dim, Number> const & matrix_free,
+        unsigned int const                      dof_index_velocity,
+        unsigned int const                      dof_index_pressure,
+        unsigned int const                      quad_index,
+        RunningStatisticsData<dim> const &      data);
+
+  void
+  evaluate(VectorType const & velocity, VectorType const & pressure);
+
+  void
+  write_output() const;
+
+  TimeControlStatistics time_control_statistics;
+
+private:
+  // mean velocity, covariances of velocity (i <= j), mean pressure, variance of pressure
+  static unsigned int const n_components = dim + dim * (dim + 1) / 2 + 2;
+
+  void
+  setup_bins();
+
+  void
+  write_restart() const;
+
+  void
+  read_restart();
+
+  MPI_Comm const mpi_comm;
+
+  dealii::SmartPointer<dealii::MatrixFree<dim, Number> const> matrix_free;
+
+  unsigned int dof_index_velocity;
+  unsigned int dof_index_pressure;
+  unsigned int quad_index;
+
+  RunningStatisticsData<dim> data;
+
+  unsigned int n_q_points;
+
+  // number of samples accumulated so far
+  unsigned int n_samples;
+
+  // Welford accumulators, index (cell_batch * n_components + component) * n_q_points + q. The
+  // covariance entries contain the sums of products of deviations, i.e., they have to be divided
+  // by the number of samples.
+  dealii::AlignedVector<scalar> accumulators;
+
+  // number of averaging bins (all processes)
+  unsigned int n_bins;
+
+  // coordinates of the averaging bins in the non-homogeneous directions (first process only)
+  std::vector<std::vector<double>> bin_coordinates;
+
+  // bin of each quadrature point, index (cell_batch * n_lanes + lane) * n_q_points + q
+  std::vector<unsigned int> bin_indices;
+};
+
+} // namespace IncNS
+} // namespace ExaDG
+
+#endif /* INCLUDE_EXADG_INCOMPRESSIBLE_NAVIER_STOKES_POSTPROCESSOR_RUNNING_STATISTICS_CALCULATOR_H_ \
+        */
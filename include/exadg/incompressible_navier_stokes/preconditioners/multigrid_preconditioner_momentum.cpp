@@ -97,11 +97,7 @@ MultigridPreconditioner<dim, Number>::update()
   // Update matrix-free objects and operators
   if(mesh_is_moving)
   {
-    this->initialize_mapping();
-
-    this->update_matrix_free_objects();
-
-    this->for_all_levels(
+    this->update_after_grid_motion(
       [&](unsigned int const level) { this->get_operator(level)->update_after_grid_motion(); });
   }
 
@@ -151,7 +147,9 @@ MultigridPreconditioner<dim, Number>::update()
   }
 
   // In case the operators have been updated, we also need to update the smoothers and the coarse
-  // grid solver. This is generic functionality implemented in the base class.
+  // grid solver. This is generic functionality implemented in the base class. Since the operators
+  // on all levels may depend on the time and the linearization velocity, all levels are updated
+  // even if update_after_grid_motion() kept the coarser h-levels.
   if(mesh_is_moving or data.unsteady_problem or
      (mg_operator_type == MultigridOperatorType::ReactionConvectionDiffusion) or
      this->update_needed)
@@ -181,6 +179,9 @@ MultigridPreconditioner<dim, Number>::fill_matrix_free_data(
     matrix_free_data.append_mapping_flags(
       Operators::ViscousKernel<dim, Number>::get_mapping_flags(this->level_info[level].is_dg(),
                                                                this->level_info[level].is_dg()));
+  if(data.grad_div_problem)
+    matrix_free_data.append_mapping_flags(
+      Operators::DivergencePenaltyKernel<dim, Number>::get_mapping_flags());
 
   if(data.use_cell_based_loops and this->level_info[level].is_dg())
   {
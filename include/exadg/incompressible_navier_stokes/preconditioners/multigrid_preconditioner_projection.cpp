@@ -69,9 +69,8 @@ MultigridPreconditionerProjection<dim, Number>::update()
 {
   if(mesh_is_moving)
   {
-    this->initialize_mapping();
-
-    this->update_matrix_free_objects();
+    // the operators are updated below on all levels
+    this->update_after_grid_motion([&](unsigned int const level) { (void)level; });
   }
 
   // update operators for all levels
@@ -116,7 +115,8 @@ MultigridPreconditionerProjection<dim, Number>::update()
     });
 
   // Once the operators are updated, the update of smoothers and the coarse grid solver is generic
-  // functionality implemented in the base class.
+  // functionality implemented in the base class. The operators are updated on all levels above, so
+  // all smoothers are updated as well.
   this->update_smoothers();
   this->update_coarse_solver();
 
@@ -29,6 +29,7 @@
 #include <exadg/operators/resolution_parameters.h>
 #include <exadg/time_integration/resolution_parameters.h>
 #include <exadg/utilities/general_parameters.h>
+#include <exadg/utilities/in_transit_communicator.h>
 
 // application
 #include <exadg/incompressible_navier_stokes/user_interface/declare_get_application.h>
@@ -62,12 +63,13 @@ create_input_file(std::string const & input_file)
 
 template<int dim, typename Number>
 void
-run(std::string const & input_file,
-    unsigned int const  degree,
-    unsigned int const  refine_space,
-    unsigned int const  refine_time,
-    MPI_Comm const &    mpi_comm,
-    bool const          is_test)
+run(std::string const &                          input_file,
+    unsigned int const                           degree,
+    unsigned int const                           refine_space,
+    unsigned int const                           refine_time,
+    MPI_Comm const &                             mpi_comm,
+    bool const                                   is_test,
+    std::shared_ptr<InTransitCommunicator const> in_transit)
 {
   dealii::Timer timer;
   timer.restart();
@@ -78,7 +80,7 @@ run(std::string const & input_file,
   application->set_parameters_convergence_study(degree, refine_space, refine_time);
 
   std::shared_ptr<IncNS::Driver<dim, Number>> driver =
-    std::make_shared<IncNS::Driver<dim, Number>>(mpi_comm, application, is_test, false);
+    std::make_shared<IncNS::Driver<dim, Number>>(mpi_comm, application, is_test, false, in_transit);
 
   driver->setup();
 
@@ -151,6 +153,17 @@ main(int argc, char ** argv)
   ExaDG::SpatialResolutionParametersMinMax spatial(input_file);
   ExaDG::TemporalResolutionParameters      temporal(input_file);
 
+  // optionally reserve MPI processes for in-transit postprocessing, the simulation itself runs on
+  // the local communicator of the respective group of processes
+  std::shared_ptr<ExaDG::InTransitCommunicator const> in_transit;
+  MPI_Comm                                            comm = sub_comm;
+  if(general.n_in_transit_processes > 0)
+  {
+    in_transit = std::make_shared<ExaDG::InTransitCommunicator>(
+      sub_comm, general.n_in_transit_processes, general.in_transit_snapshot_interval);
+    comm = in_transit->get_local_communicator();
+  }
+
   // k-refinement
   for(unsigned int degree = spatial.degree_min; degree <= spatial.degree_max; ++degree)
   {
@@ -168,22 +181,22 @@ main(int argc, char ** argv)
         if(general.dim == 2 and general.precision == "float")
         {
           ExaDG::run<2, float>(
-            input_file, degree, refine_space, refine_time, sub_comm, general.is_test);
+            input_file, degree, refine_space, refine_time, comm, general.is_test, in_transit);
         }
         else if(general.dim == 2 and general.precision == "double")
         {
           ExaDG::run<2, double>(
-            input_file, degree, refine_space, refine_time, sub_comm, general.is_test);
+            input_file, degree, refine_space, refine_time, comm, general.is_test, in_transit);
         }
         else if(general.dim == 3 and general.precision == "float")
         {
           ExaDG::run<3, float>(
-            input_file, degree, refine_space, refine_time, sub_comm, general.is_test);
+            input_file, degree, refine_space, refine_time, comm, general.is_test, in_transit);
         }
         else if(general.dim == 3 and general.precision == "double")
         {
           ExaDG::run<3, double>(
-            input_file, degree, refine_space, refine_time, sub_comm, general.is_test);
+            input_file, degree, refine_space, refine_time, comm, general.is_test, in_transit);
         }
         else
         {
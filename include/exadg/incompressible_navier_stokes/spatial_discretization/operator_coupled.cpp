@@ -66,6 +66,28 @@ void
 OperatorCoupled<dim, Number>::setup_derived()
 {
   this->initialize_vector_velocity(temp_vector);
+
+  if(this->param.preconditioner_coupled == PreconditionerCoupled::AugmentedLagrangian)
+  {
+    // Kernel
+    Operators::DivergencePenaltyKernelData grad_div_data;
+    grad_div_data.degree         = this->param.degree_u;
+    grad_div_data.penalty_factor = this->param.augmented_lagrangian_factor;
+
+    grad_div_kernel = std::make_shared<Operators::DivergencePenaltyKernel<dim, Number>>();
+    grad_div_kernel->reinit(this->get_matrix_free(),
+                            this->get_dof_index_velocity(),
+                            this->get_quad_index_velocity_standard(),
+                            grad_div_data);
+    grad_div_kernel->set_constant_penalty_parameter();
+
+    // Operator
+    DivergencePenaltyData operator_data;
+    operator_data.dof_index  = this->get_dof_index_velocity();
+    operator_data.quad_index = this->get_quad_index_velocity_standard();
+
+    grad_div_operator.initialize(this->get_matrix_free(), operator_data, grad_div_kernel);
+  }
 }
 
 template<int dim, typename Number>
@@ -77,8 +99,32 @@ OperatorCoupled<dim, Number>::setup_preconditioners_and_solvers()
   if(this->param.apply_penalty_terms_in_postprocessing_step)
     Base::setup_projection_solver();
 
-  setup_block_preconditioner();
-  setup_solver_coupled();
+  std::vector<std::string> const phase_block = {"Preconditioners and solvers",
+                                                "Block preconditioner"};
+  this->setup_profiler.measure(phase_block, [&]() { setup_block_preconditioner(); });
+
+  // add the setup phases of the multigrid preconditioners of the velocity block and the Schur
+  // complement
+  std::shared_ptr<MultigridPreconditioner<dim, Number>> mg_momentum =
+    std::dynamic_pointer_cast<MultigridPreconditioner<dim, Number>>(preconditioner_momentum);
+  if(mg_momentum.get())
+  {
+    std::vector<std::string> phase_velocity_block = phase_block;
+    phase_velocity_block.push_back("Velocity block");
+    this->setup_profiler.insert(phase_velocity_block, mg_momentum->get_setup_profiler());
+  }
+
+  std::shared_ptr<MultigridPoisson> mg_schur_complement =
+    std::dynamic_pointer_cast<MultigridPoisson>(multigrid_preconditioner_schur_complement);
+  if(mg_schur_complement.get())
+  {
+    std::vector<std::string> phase_schur_complement = phase_block;
+    phase_schur_complement.push_back("Schur complement");
+    this->setup_profiler.insert(phase_schur_complement, mg_schur_complement->get_setup_profiler());
+  }
+
+  this->setup_profiler.measure({"Preconditioners and solvers", "Coupled solver"},
+                               [&]() { setup_solver_coupled(); });
 }
 
 template<int dim, typename Number>
@@ -227,6 +273,10 @@ OperatorCoupled<dim, Number>::apply_linearized_problem(BlockVectorType &       d
       this->conti_penalty_operator.apply_add(dst.block(0), src.block(0));
   }
 
+  // grad-div term of the augmented Lagrangian formulation
+  if(this->param.preconditioner_coupled == PreconditionerCoupled::AugmentedLagrangian)
+    this->grad_div_operator.apply_add(dst.block(0), src.block(0));
+
   // (1,2) block of saddle point matrix
   // gradient operator: dst = velocity, src = pressure
   this->gradient_operator.apply(temp_vector, src.block(1));
@@ -307,6 +357,10 @@ OperatorCoupled<dim, Number>::evaluate_nonlinear_residual(BlockVectorType &
       this->conti_penalty_operator.evaluate_add(dst.block(0), src.block(0), time);
   }
 
+  // grad-div term of the augmented Lagrangian formulation
+  if(this->param.preconditioner_coupled == PreconditionerCoupled::AugmentedLagrangian)
+    this->grad_div_operator.apply_add(dst.block(0), src.block(0));
+
   // gradient operator scaled by scaling_factor_continuity
   this->gradient_operator.evaluate(temp_vector, src.block(1), time);
   dst.block(0).add(scaling_factor_continuity, temp_vector);
@@ -370,6 +424,10 @@ OperatorCoupled<dim, Number>::evaluate_nonlinear_residual_steady(BlockVectorType
       this->conti_penalty_operator.evaluate_add(dst.block(0), src.block(0), time);
   }
 
+  // grad-div term of the augmented Lagrangian formulation
+  if(this->param.preconditioner_coupled == PreconditionerCoupled::AugmentedLagrangian)
+    this->grad_div_operator.apply_add(dst.block(0), src.block(0));
+
   // gradient operator scaled by scaling_factor_continuity
   this->gradient_operator.evaluate(temp_vector, src.block(1), time);
   dst.block(0).add(scaling_factor_continuity, temp_vector);
@@ -392,6 +450,9 @@ OperatorCoupled<dim, Number>::setup_block_preconditioner()
 
   initialize_vectors();
 
+  if(this->param.preconditioner_coupled == PreconditionerCoupled::AugmentedLagrangian)
+    setup_augmented_momentum_operator();
+
   initialize_preconditioner_velocity_block();
 
   initialize_preconditioner_pressure_block();
@@ -403,7 +464,8 @@ OperatorCoupled<dim, Number>::initialize_vectors()
 {
   auto type = this->param.preconditioner_coupled;
 
-  if(type == PreconditionerCoupled::BlockTriangular)
+  if(type == PreconditionerCoupled::BlockTriangular or
+     type == PreconditionerCoupled::AugmentedLagrangian)
   {
     this->initialize_vector_velocity(vec_tmp_velocity);
   }
@@ -415,6 +477,42 @@ OperatorCoupled<dim, Number>::initialize_vectors()
   }
 }
 
+template<int dim, typename Number>
+void
+OperatorCoupled<dim, Number>::setup_augmented_momentum_operator()
+{
+  // same terms as the momentum operator, plus a grad-div term with constant penalty parameter
+  MomentumOperatorData<dim> data = this->momentum_operator.get_data();
+
+  data.grad_div_problem                    = true;
+  data.grad_div_kernel_data.degree         = this->param.degree_u;
+  data.grad_div_kernel_data.penalty_factor = this->param.augmented_lagrangian_factor;
+
+  dealii::AffineConstraints<Number> constraint_dummy;
+  constraint_dummy.close();
+
+  // The viscous and convective kernels are shared with the momentum operator, so that the
+  // linearization point and viscosity are automatically consistent.
+  augmented_momentum_operator.initialize(this->get_matrix_free(),
+                                         constraint_dummy,
+                                         data,
+                                         this->viscous_kernel,
+                                         this->convective_kernel);
+
+  augmented_momentum_operator.set_scaling_factor_mass_operator(
+    this->momentum_operator.get_scaling_factor_mass_operator());
+}
+
+template<int dim, typename Number>
+MomentumOperator<dim, Number> &
+OperatorCoupled<dim, Number>::get_velocity_block_operator()
+{
+  if(this->param.preconditioner_coupled == PreconditionerCoupled::AugmentedLagrangian)
+    return augmented_momentum_operator;
+  else
+    return this->momentum_operator;
+}
+
 template<int dim, typename Number>
 void
 OperatorCoupled<dim, Number>::initialize_preconditioner_velocity_block()
@@ -423,15 +521,14 @@ OperatorCoupled<dim, Number>::initialize_preconditioner_velocity_block()
 
   if(type == MomentumPreconditioner::PointJacobi)
   {
-    preconditioner_momentum =
-      std::make_shared<JacobiPreconditioner<MomentumOperator<dim, Number>>>(this->momentum_operator,
-                                                                            false);
+    preconditioner_momentum = std::make_shared<JacobiPreconditioner<MomentumOperator<dim, Number>>>(
+      get_velocity_block_operator(), false);
   }
   else if(type == MomentumPreconditioner::BlockJacobi)
   {
     preconditioner_momentum =
       std::make_shared<BlockJacobiPreconditioner<MomentumOperator<dim, Number>>>(
-        this->momentum_operator, false);
+        get_velocity_block_operator(), false);
   }
   else if(type == MomentumPreconditioner::InverseMassMatrix)
   {
@@ -470,15 +567,17 @@ OperatorCoupled<dim, Number>::setup_multigrid_preconditioner_momentum()
   std::shared_ptr<Multigrid> mg_preconditioner =
     std::dynamic_pointer_cast<Multigrid>(preconditioner_momentum);
 
+  MomentumOperator<dim, Number> const & velocity_block_operator = get_velocity_block_operator();
+
   std::map<dealii::types::boundary_id, std::shared_ptr<dealii::Function<dim>>>
-    dirichlet_boundary_conditions = this->momentum_operator.get_data().bc->dirichlet_bc;
+    dirichlet_boundary_conditions = velocity_block_operator.get_data().bc->dirichlet_bc;
 
   // We also need to add DirichletCached boundary conditions. From the
   // perspective of multigrid, there is no difference between standard
   // and cached Dirichlet BCs. Since multigrid does not need information
   // about inhomogeneous boundary data, we simply fill the map with
   // dealii::Functions::ZeroFunction for DirichletCached BCs.
-  for(auto iter : this->momentum_operator.get_data().bc->dirichlet_cached_bc)
+  for(auto iter : velocity_block_operator.get_data().bc->dirichlet_cached_bc)
   {
     typedef std::pair<dealii::types::boundary_id, std::shared_ptr<dealii::Function<dim>>> pair;
 
@@ -492,7 +591,7 @@ OperatorCoupled<dim, Number>::setup_multigrid_preconditioner_momentum()
                                 this->grid,
                                 this->multigrid_mappings,
                                 this->get_dof_handler_u().get_fe(),
-                                this->momentum_operator,
+                                velocity_block_operator,
                                 this->param.multigrid_operator_type_velocity_block,
                                 this->param.ale_formulation,
                                 dirichlet_boundary_conditions,
@@ -516,7 +615,7 @@ OperatorCoupled<dim, Number>::setup_iterative_solver_momentum()
 
   solver_velocity_block = std::make_shared<
     Krylov::SolverFGMRES<MomentumOperator<dim, Number>, PreconditionerBase<Number>, VectorType>>(
-    this->momentum_operator, *preconditioner_momentum, gmres_data);
+    get_velocity_block_operator(), *preconditioner_momentum, gmres_data);
 }
 
 template<int dim, typename Number>
@@ -840,6 +939,19 @@ OperatorCoupled<dim, Number>::setup_pressure_convection_diffusion_operator()
  *   4. Pressure convection-diffusion preconditioner
  *
  *      -> -S^{-1} = M_p^{-1} A_p (-L)^{-1} where A_p is a convection-diffusion operator for the pressure
+ *
+ *  Augmented Lagrangian preconditioner:
+ *
+ *   The momentum equation of the coupled system is augmented by the term gamma D u, where D is the
+ *   grad-div operator (divergence penalty kernel with constant penalty parameter gamma). The term
+ *   vanishes for a divergence-free velocity, i.e. the augmentation is consistent. The velocity
+ *   block A_gamma = A + gamma D of the augmented system is used in the preconditioner of the
+ *   velocity block, and the Schur complement of the augmented system is approximated by
+ *
+ *      -> - S_gamma^{-1} = (nu + gamma) M_p^{-1}
+ *
+ *   (variant 1.) or, with nu replaced by (nu + gamma), by variant 3. above. Both approximations
+ *   become independent of the viscosity and the mesh size for sufficiently large gamma.
  */
 // clang-format on
 
@@ -848,6 +960,13 @@ void
 OperatorCoupled<dim, Number>::update_block_preconditioner()
 {
   // momentum block
+  if(this->param.preconditioner_coupled == PreconditionerCoupled::AugmentedLagrangian)
+  {
+    augmented_momentum_operator.set_time(this->momentum_operator.get_time());
+    augmented_momentum_operator.set_scaling_factor_mass_operator(
+      this->momentum_operator.get_scaling_factor_mass_operator());
+  }
+
   preconditioner_momentum->update();
 
   // pressure block
@@ -910,8 +1029,13 @@ OperatorCoupled<dim, Number>::apply_block_preconditioner(BlockVectorType &
     // apply preconditioner for velocity/momentum block
     apply_preconditioner_velocity_block(dst.block(0), src.block(0));
   }
-  else if(type == PreconditionerCoupled::BlockTriangular)
+  else if(type == PreconditionerCoupled::BlockTriangular or
+          type == PreconditionerCoupled::AugmentedLagrangian)
   {
+    // In case of the augmented Lagrangian preconditioner, A is the augmented velocity block
+    // A_gamma and S the Schur complement of the augmented system, see functions
+    // apply_preconditioner_velocity_block() and apply_preconditioner_pressure_block().
+
     /*
      *                         / A^{-1}  0 \   / I  B^{T} \   / I      0    \
      *  -> P_triangular^{-1} = |           | * |          | * |             |
@@ -1093,6 +1217,16 @@ OperatorCoupled<dim, Number>::apply_preconditioner_velocity_block(VectorType &
   }
 }
 
+template<int dim, typename Number>
+double
+OperatorCoupled<dim, Number>::get_viscosity_schur_complement() const
+{
+  if(this->param.preconditioner_coupled == PreconditionerCoupled::AugmentedLagrangian)
+    return this->param.viscosity + this->param.augmented_lagrangian_factor;
+  else
+    return this->param.viscosity;
+}
+
 template<int dim, typename Number>
 void
 OperatorCoupled<dim, Number>::apply_preconditioner_pressure_block(VectorType &       dst,
@@ -1107,10 +1241,10 @@ OperatorCoupled<dim, Number>::apply_preconditioner_pressure_block(VectorType &
   }
   else if(type == SchurComplementPreconditioner::InverseMassMatrix)
   {
-    // - S^{-1} = nu M_p^{-1}
+    // - S^{-1} = nu M_p^{-1}, or (nu + gamma) M_p^{-1} for the augmented system
     // TODO consider variable viscosity here
     inverse_mass_preconditioner_schur_complement->vmult(dst, src);
-    dst *= this->param.viscosity;
+    dst *= get_viscosity_schur_complement();
   }
   else if(type == SchurComplementPreconditioner::LaplaceOperator)
   {
@@ -1120,7 +1254,8 @@ OperatorCoupled<dim, Number>::apply_preconditioner_pressure_block(VectorType &
   }
   else if(type == SchurComplementPreconditioner::CahouetChabard)
   {
-    // - S^{-1} = nu M_p^{-1} + 1/dt (-L)^{-1}
+    // - S^{-1} = nu M_p^{-1} + 1/dt (-L)^{-1}, with nu replaced by (nu + gamma) for the augmented
+    // system
 
     // I. 1/dt (-L)^{-1}
     apply_inverse_negative_laplace_operator(dst, src);
@@ -1132,7 +1267,7 @@ OperatorCoupled<dim, Number>::apply_preconditioner_pressure_block(VectorType &
     inverse_mass_preconditioner_schur_complement->vmult(tmp_scp_pressure, src);
 
     // III. add temporary vector scaled by viscosity
-    dst.add(this->param.viscosity, tmp_scp_pressure);
+    dst.add(get_viscosity_schur_complement(), tmp_scp_pressure);
   }
   else if(type == SchurComplementPreconditioner::PressureConvectionDiffusion)
   {
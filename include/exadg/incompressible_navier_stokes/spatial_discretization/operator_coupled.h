@@ -337,6 +337,17 @@ private:
   void
   initialize_vectors();
 
+  void
+  setup_augmented_momentum_operator();
+
+  /*
+   * Returns the operator approximated by the preconditioner of the velocity block, i.e., the
+   * momentum operator or the augmented momentum operator in case of augmented Lagrangian
+   * preconditioning.
+   */
+  MomentumOperator<dim, Number> &
+  get_velocity_block_operator();
+
   void
   initialize_preconditioner_velocity_block();
 
@@ -361,6 +372,13 @@ private:
   void
   apply_preconditioner_velocity_block(VectorType & dst, VectorType const & src) const;
 
+  /*
+   * Viscosity nu in the Schur-complement approximations involving the pressure mass matrix,
+   * (nu + gamma) in case of the augmented Lagrangian formulation.
+   */
+  double
+  get_viscosity_schur_complement() const;
+
   void
   apply_preconditioner_pressure_block(VectorType & dst, VectorType const & src) const;
 
@@ -376,6 +394,15 @@ private:
 
   double scaling_factor_continuity;
 
+  /*
+   * Augmented Lagrangian: the momentum equation of the coupled system is augmented by a grad-div
+   * term with constant penalty parameter gamma (consistent since div(u) = 0 for the exact
+   * solution), so that the Schur complement can be approximated by -(nu + gamma) M_p^{-1}.
+   */
+  std::shared_ptr<Operators::DivergencePenaltyKernel<dim, Number>> grad_div_kernel;
+
+  DivergencePenaltyOperator<dim, Number> grad_div_operator;
+
   // Nonlinear operator
   NonlinearOperatorCoupled<dim, Number> nonlinear_operator;
 
@@ -398,6 +425,9 @@ private:
   typedef BlockPreconditioner<dim, Number> Preconditioner;
   Preconditioner                           block_preconditioner;
 
+  // momentum operator augmented by the grad-div term (velocity block of the augmented system)
+  MomentumOperator<dim, Number> augmented_momentum_operator;
+
   // preconditioner velocity/momentum block
   std::shared_ptr<PreconditionerBase<Number>> preconditioner_momentum;
 
@@ -92,6 +92,9 @@ OperatorDualSplitting<dim, Number>::local_rhs_ppe_div_term_body_forces_boundary_
 
   FaceIntegratorP integrator(matrix_free, true, dof_index_pressure, quad_index_pressure);
 
+  VectorizedFunction<dim> const * right_hand_side_vectorized =
+    get_vectorized_function(this->field_functions->right_hand_side.get());
+
   for(unsigned int face = face_range.first; face < face_range.second; face++)
   {
     integrator.reinit(face);
@@ -109,6 +112,7 @@ OperatorDualSplitting<dim, Number>::local_rhs_ppe_div_term_body_forces_boundary_
         // evaluate right-hand side
         vector rhs =
           FunctionEvaluator<1, dim, Number>::value(*(this->field_functions->right_hand_side),
+                                                   right_hand_side_vectorized,
                                                    q_points,
                                                    this->evaluation_time);
 
@@ -346,6 +350,9 @@ OperatorDualSplitting<dim, Number>::local_rhs_ppe_nbc_body_force_term_add_bounda
 
   FaceIntegratorP integrator(data, true, dof_index_pressure, quad_index_pressure);
 
+  VectorizedFunction<dim> const * right_hand_side_vectorized =
+    get_vectorized_function(this->field_functions->right_hand_side.get());
+
   for(unsigned int face = face_range.first; face < face_range.second; face++)
   {
     integrator.reinit(face);
@@ -363,6 +370,7 @@ OperatorDualSplitting<dim, Number>::local_rhs_ppe_nbc_body_force_term_add_bounda
         // evaluate right-hand side
         vector rhs =
           FunctionEvaluator<1, dim, Number>::value(*(this->field_functions->right_hand_side),
+                                                   right_hand_side_vectorized,
                                                    q_points,
                                                    this->evaluation_time);
 
@@ -627,9 +635,13 @@ OperatorDualSplitting<dim, Number>::local_interpolate_velocity_dirichlet_bc_boun
         if(boundary_type == BoundaryTypeU::Dirichlet)
         {
           auto bc = this->boundary_descriptor->velocity->dirichlet_bc.find(boundary_id)->second;
-          auto q_points = integrator.quadrature_point(q);
 
-          g = FunctionEvaluator<1, dim, Number>::value(*bc, q_points, this->evaluation_time);
+          g = evaluate_boundary_function<1, dim, Number>(*bc,
+                                                         *this->boundary_descriptor->velocity,
+                                                         boundary_id,
+                                                         integrator,
+                                                         q,
+                                                         this->evaluation_time);
         }
         else if(boundary_type == BoundaryTypeU::DirichletCached)
         {
@@ -253,10 +253,14 @@ OperatorPressureCorrection<dim, Number>::local_interpolate_pressure_dirichlet_bc
         unsigned int const index = matrix_free.get_shape_info(dof_index, quad_index)
                                      .face_to_cell_index_nodal[local_face_number][q];
 
-        auto bc       = this->boundary_descriptor->pressure->dirichlet_bc.find(boundary_id)->second;
-        auto q_points = integrator.quadrature_point(q);
-
-        scalar g = FunctionEvaluator<0, dim, Number>::value(*bc, q_points, this->evaluation_time);
+        auto bc = this->boundary_descriptor->pressure->dirichlet_bc.find(boundary_id)->second;
+
+        scalar g = evaluate_boundary_function<0, dim, Number>(*bc,
+                                                              *this->boundary_descriptor->pressure,
+                                                              boundary_id,
+                                                              integrator,
+                                                              q,
+                                                              this->evaluation_time);
         integrator.submit_dof_value(g, index);
       }
 
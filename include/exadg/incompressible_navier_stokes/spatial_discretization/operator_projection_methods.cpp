@@ -76,13 +76,33 @@ template<int dim, typename Number>
 void
 OperatorProjectionMethods<dim, Number>::setup_preconditioners_and_solvers()
 {
-  setup_preconditioner_pressure_poisson();
-  setup_solver_pressure_poisson();
+  std::vector<std::string> const phase_pressure = {"Preconditioners and solvers",
+                                                   "Pressure Poisson preconditioner"};
+  this->setup_profiler.measure(phase_pressure, [&]() { setup_preconditioner_pressure_poisson(); });
 
-  Base::setup_projection_solver();
+  // add the setup phases of the multigrid preconditioner
+  std::shared_ptr<MultigridPoisson> mg_poisson =
+    std::dynamic_pointer_cast<MultigridPoisson>(preconditioner_pressure_poisson);
+  if(mg_poisson.get())
+    this->setup_profiler.insert(phase_pressure, mg_poisson->get_setup_profiler());
 
-  setup_momentum_preconditioner();
-  setup_momentum_solver();
+  this->setup_profiler.measure({"Preconditioners and solvers", "Pressure Poisson solver"},
+                               [&]() { setup_solver_pressure_poisson(); });
+
+  this->setup_profiler.measure({"Preconditioners and solvers", "Projection solver"},
+                               [&]() { Base::setup_projection_solver(); });
+
+  std::vector<std::string> const phase_momentum = {"Preconditioners and solvers",
+                                                   "Momentum preconditioner"};
+  this->setup_profiler.measure(phase_momentum, [&]() { setup_momentum_preconditioner(); });
+
+  std::shared_ptr<MultigridPreconditioner<dim, Number>> mg_momentum =
+    std::dynamic_pointer_cast<MultigridPreconditioner<dim, Number>>(momentum_preconditioner);
+  if(mg_momentum.get())
+    this->setup_profiler.insert(phase_momentum, mg_momentum->get_setup_profiler());
+
+  this->setup_profiler.measure({"Preconditioners and solvers", "Momentum solver"},
+                               [&]() { setup_momentum_solver(); });
 }
 
 template<int dim, typename Number>
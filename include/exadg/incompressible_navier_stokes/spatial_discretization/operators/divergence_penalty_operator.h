@@ -198,6 +198,17 @@ public:
     }
   }
 
+  /*
+   * Sets the penalty parameter to the constant value tau_div = penalty_factor independently of the
+   * velocity field, as required for augmented Lagrangian preconditioners.
+   */
+  void
+  set_constant_penalty_parameter()
+  {
+    for(unsigned int cell = 0; cell < array_penalty_parameter.size(); ++cell)
+      array_penalty_parameter[cell] = dealii::make_vectorized_array<Number>(data.penalty_factor);
+  }
+
   void
   reinit_cell(IntegratorCell & integrator) const
   {
@@ -66,6 +66,9 @@ MomentumOperator<dim, Number>::initialize(
                                  operator_data.quad_index);
   }
 
+  if(operator_data.grad_div_problem)
+    initialize_grad_div_kernel(matrix_free);
+
   if(operator_data.unsteady_problem)
     this->integrator_flags = this->integrator_flags | this->mass_kernel->get_integrator_flags();
   if(operator_data.convective_problem)
@@ -73,6 +76,8 @@ MomentumOperator<dim, Number>::initialize(
       this->integrator_flags | this->convective_kernel->get_integrator_flags();
   if(operator_data.viscous_problem)
     this->integrator_flags = this->integrator_flags | this->viscous_kernel->get_integrator_flags();
+  if(operator_data.grad_div_problem)
+    this->integrator_flags = this->integrator_flags | this->grad_div_kernel->get_integrator_flags();
 }
 
 template<int dim, typename Number>
@@ -105,6 +110,9 @@ MomentumOperator<dim, Number>::initialize(
   this->convective_kernel = convective_kernel;
   this->viscous_kernel    = viscous_kernel;
 
+  if(operator_data.grad_div_problem)
+    initialize_grad_div_kernel(matrix_free);
+
   if(operator_data.unsteady_problem)
     this->integrator_flags = this->integrator_flags | this->mass_kernel->get_integrator_flags();
   if(operator_data.convective_problem)
@@ -112,6 +120,22 @@ MomentumOperator<dim, Number>::initialize(
       this->integrator_flags | this->convective_kernel->get_integrator_flags();
   if(operator_data.viscous_problem)
     this->integrator_flags = this->integrator_flags | this->viscous_kernel->get_integrator_flags();
+  if(operator_data.grad_div_problem)
+    this->integrator_flags = this->integrator_flags | this->grad_div_kernel->get_integrator_flags();
+}
+
+template<int dim, typename Number>
+void
+MomentumOperator<dim, Number>::initialize_grad_div_kernel(
+  dealii::MatrixFree<dim, Number> const & matrix_free)
+{
+  this->grad_div_kernel = std::make_shared<Operators::DivergencePenaltyKernel<dim, Number>>();
+  this->grad_div_kernel->reinit(matrix_free,
+                                operator_data.dof_index,
+                                operator_data.quad_index,
+                                operator_data.grad_div_kernel_data);
+  // the penalty parameter of the grad-div term does not depend on the velocity
+  this->grad_div_kernel->set_constant_penalty_parameter();
 }
 
 template<int dim, typename Number>
@@ -237,10 +261,11 @@ void
 MomentumOperator<dim, Number>::reinit_cell_derived(IntegratorCell &   integrator,
                                                    unsigned int const cell) const
 {
-  (void)integrator;
-
   if(operator_data.convective_problem)
     convective_kernel->reinit_cell(cell);
+
+  if(operator_data.grad_div_problem)
+    grad_div_kernel->reinit_cell(integrator);
 }
 
 template<int dim, typename Number>
@@ -335,6 +360,14 @@ MomentumOperator<dim, Number>::do_cell_integral(IntegratorCell & integrator) con
       gradient_flux += viscous_kernel->get_volume_flux(gradient, viscosity);
     }
 
+    if(operator_data.grad_div_problem)
+    {
+      // (div(v_h), tau_div * div(u_h)) = (grad(v_h), tau_div * div(u_h) I)
+      scalar const flux = grad_div_kernel->get_volume_flux(integrator, q);
+      for(unsigned int d = 0; d < dim; ++d)
+        gradient_flux[d][d] += flux;
+    }
+
     if(this->integrator_flags.cell_integrate & dealii::EvaluationFlags::values)
       integrator.submit_value(value_flux, q);
 
@@ -23,6 +23,7 @@
 #define INCLUDE_EXADG_INCOMPRESSIBLE_NAVIER_STOKES_SPATIAL_DISCRETIZATION_OPERATORS_MOMENTUM_OPERATOR_H_
 
 #include <exadg/incompressible_navier_stokes/spatial_discretization/operators/convective_operator.h>
+#include <exadg/incompressible_navier_stokes/spatial_discretization/operators/divergence_penalty_operator.h>
 #include <exadg/incompressible_navier_stokes/spatial_discretization/operators/viscous_operator.h>
 #include <exadg/operators/mass_kernel.h>
 #include <exadg/operators/operator_base.h>
@@ -35,7 +36,11 @@ template<int dim>
 struct MomentumOperatorData : public OperatorBaseData
 {
   MomentumOperatorData()
-    : OperatorBaseData(), unsteady_problem(false), convective_problem(false), viscous_problem(false)
+    : OperatorBaseData(),
+      unsteady_problem(false),
+      convective_problem(false),
+      viscous_problem(false),
+      grad_div_problem(false)
   {
   }
 
@@ -43,8 +48,14 @@ struct MomentumOperatorData : public OperatorBaseData
   bool convective_problem;
   bool viscous_problem;
 
-  Operators::ConvectiveKernelData convective_kernel_data;
-  Operators::ViscousKernelData    viscous_kernel_data;
+  // Adds a grad-div term with constant penalty parameter to the operator. This is used to realize
+  // the augmented velocity block of augmented Lagrangian preconditioners and does not belong to
+  // the discretization of the momentum equation.
+  bool grad_div_problem;
+
+  Operators::ConvectiveKernelData        convective_kernel_data;
+  Operators::ViscousKernelData           viscous_kernel_data;
+  Operators::DivergencePenaltyKernelData grad_div_kernel_data;
 
   std::shared_ptr<BoundaryDescriptorU<dim> const> bc;
 };
@@ -137,6 +148,9 @@ public:
   evaluate_add(VectorType & dst, VectorType const & src) const final;
 
 private:
+  void
+  initialize_grad_div_kernel(dealii::MatrixFree<dim, Number> const & matrix_free);
+
   void
   reinit_cell_derived(IntegratorCell & integrator, unsigned int const cell) const final;
 
@@ -193,6 +207,8 @@ private:
   std::shared_ptr<Operators::ConvectiveKernel<dim, Number>> convective_kernel;
   std::shared_ptr<Operators::ViscousKernel<dim, Number>>    viscous_kernel;
 
+  std::shared_ptr<Operators::DivergencePenaltyKernel<dim, Number>> grad_div_kernel;
+
   double scaling_factor_mass;
 };
 
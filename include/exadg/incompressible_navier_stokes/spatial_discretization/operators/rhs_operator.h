@@ -68,6 +68,9 @@ public:
   reinit(RHSKernelData<dim> const & data_in) const
   {
     data = data_in;
+
+    f_vectorized                   = get_vectorized_function(data.f.get());
+    gravitational_force_vectorized = get_vectorized_function(data.gravitational_force.get());
   }
 
   static MappingFlags
@@ -95,12 +98,14 @@ public:
   {
     dealii::Point<dim, scalar> q_points = integrator.quadrature_point(q);
 
-    vector f = FunctionEvaluator<1, dim, Number>::value(*(data.f), q_points, time);
+    vector f = FunctionEvaluator<1, dim, Number>::value(*(data.f), f_vectorized, q_points, time);
 
     if(data.boussinesq_term)
     {
-      vector g =
-        FunctionEvaluator<1, dim, Number>::value(*(data.gravitational_force), q_points, time);
+      vector g = FunctionEvaluator<1, dim, Number>::value(*(data.gravitational_force),
+                                                          gravitational_force_vectorized,
+                                                          q_points,
+                                                          time);
       scalar T     = integrator_temperature.get_value(q);
       scalar T_ref = data.reference_temperature;
       // solve only for the dynamic pressure variations
@@ -115,6 +120,10 @@ public:
 
 private:
   mutable RHSKernelData<dim> data;
+
+  // vectorized interfaces of the functions in data (nullptr if not available)
+  mutable VectorizedFunction<dim> const * f_vectorized                   = nullptr;
+  mutable VectorizedFunction<dim> const * gravitational_force_vectorized = nullptr;
 };
 
 } // namespace Operators
@@ -100,10 +100,10 @@ inline DEAL_II_ALWAYS_INLINE //
 
       if(boundary_type == BoundaryTypeU::Dirichlet)
       {
-        auto bc       = boundary_descriptor->dirichlet_bc.find(boundary_id)->second;
-        auto q_points = integrator.quadrature_point(q);
+        auto bc = boundary_descriptor->dirichlet_bc.find(boundary_id)->second;
 
-        g = FunctionEvaluator<1, dim, Number>::value(*bc, q_points, time);
+        g = evaluate_boundary_function<1, dim, Number>(
+          *bc, *boundary_descriptor, boundary_id, integrator, q, time);
       }
       else if(boundary_type == BoundaryTypeU::DirichletCached)
       {
@@ -180,10 +180,10 @@ inline DEAL_II_ALWAYS_INLINE //
 
     if(boundary_type == BoundaryTypeU::Dirichlet)
     {
-      auto bc       = boundary_descriptor->dirichlet_bc.find(boundary_id)->second;
-      auto q_points = integrator.quadrature_point(q);
+      auto bc = boundary_descriptor->dirichlet_bc.find(boundary_id)->second;
 
-      g = FunctionEvaluator<1, dim, Number>::value(*bc, q_points, time);
+      g = evaluate_boundary_function<1, dim, Number>(
+        *bc, *boundary_descriptor, boundary_id, integrator, q, time);
     }
     else if(boundary_type == BoundaryTypeU::DirichletCached)
     {
@@ -342,11 +342,10 @@ inline DEAL_II_ALWAYS_INLINE //
   {
     if(operator_type == OperatorType::full or operator_type == OperatorType::inhomogeneous)
     {
-      auto bc       = boundary_descriptor->dirichlet_bc.find(boundary_id)->second;
-      auto q_points = integrator.quadrature_point(q);
+      auto bc = boundary_descriptor->dirichlet_bc.find(boundary_id)->second;
 
-      dealii::VectorizedArray<Number> g =
-        FunctionEvaluator<0, dim, Number>::value(*bc, q_points, time);
+      dealii::VectorizedArray<Number> g = evaluate_boundary_function<0, dim, Number>(
+        *bc, *boundary_descriptor, boundary_id, integrator, q, time);
 
       value_p = -value_m + 2.0 * inverse_scaling_factor * g;
     }
@@ -468,16 +467,17 @@ inline DEAL_II_ALWAYS_INLINE //
   {
     if(operator_type == OperatorType::full or operator_type == OperatorType::inhomogeneous)
     {
-      auto bc       = boundary_descriptor->neumann_bc.find(boundary_id)->second;
-      auto q_points = integrator.quadrature_point(q);
+      auto bc = boundary_descriptor->neumann_bc.find(boundary_id)->second;
 
       dealii::Tensor<1, dim, dealii::VectorizedArray<Number>> h;
       if(variable_normal_vector == false)
       {
-        h = FunctionEvaluator<1, dim, Number>::value(*bc, q_points, time);
+        h = evaluate_boundary_function<1, dim, Number>(
+          *bc, *boundary_descriptor, boundary_id, integrator, q, time);
       }
       else
       {
+        auto q_points  = integrator.quadrature_point(q);
         auto normals_m = integrator.get_normal_vector(q);
         h              = FunctionEvaluator<1, dim, Number>::value(
           *(std::dynamic_pointer_cast<FunctionWithNormal<dim>>(bc)), q_points, normals_m, time);
@@ -64,6 +64,7 @@ SpatialOperatorBase<dim, Number>::SpatialOperatorBase(
     pressure_level_is_undefined(false),
     mpi_comm(mpi_comm_in),
     pcout(std::cout, dealii::Utilities::MPI::this_mpi_process(mpi_comm) == 0),
+    setup_profiler("PDE operator"),
     velocity_ptr(nullptr),
     pressure_ptr(nullptr)
 {
@@ -71,11 +72,14 @@ SpatialOperatorBase<dim, Number>::SpatialOperatorBase(
         << "Construct incompressible Navier-Stokes operator ..." << std::endl
         << std::flush;
 
-  initialize_dof_handler_and_constraints();
+  setup_profiler.measure({"DoF handlers and constraints"},
+                         [&]() { initialize_dof_handler_and_constraints(); });
 
-  initialize_boundary_descriptor_laplace();
+  setup_profiler.measure({"Boundary conditions"}, [&]() {
+    initialize_boundary_descriptor_laplace();
 
-  initialization_pure_dirichlet_bc();
+    initialization_pure_dirichlet_bc();
+  });
 
   pcout << std::endl << "... done!" << std::endl << std::flush;
 }
@@ -324,7 +328,8 @@ SpatialOperatorBase<dim, Number>::fill_matrix_free_data(
   if(param.right_hand_side)
     matrix_free_data.append_mapping_flags(Operators::RHSKernel<dim, Number>::get_mapping_flags());
 
-  if(param.use_divergence_penalty)
+  if(param.use_divergence_penalty or
+     param.preconditioner_coupled == PreconditionerCoupled::AugmentedLagrangian)
     matrix_free_data.append_mapping_flags(
       Operators::DivergencePenaltyKernel<dim, Number>::get_mapping_flags());
 
@@ -365,6 +370,15 @@ SpatialOperatorBase<dim, Number>::fill_matrix_free_data(
   matrix_free_data.insert_quadrature(dealii::QGaussLobatto<1>(param.get_degree_p(param.degree_u) +
                                                               1),
                                      field + quad_index_p_gauss_lobatto);
+
+  // quadrature rules for the evaluation of errors (same number of points as used by
+  // calculate_error() for dealii::VectorTools::integrate_difference())
+  std::shared_ptr<dealii::Quadrature<dim>> quadrature_u_error =
+    create_quadrature<dim>(param.grid.element_type, param.degree_u + 3);
+  matrix_free_data.insert_quadrature(*quadrature_u_error, field + quad_index_u_error);
+  std::shared_ptr<dealii::Quadrature<dim>> quadrature_p_error =
+    create_quadrature<dim>(param.grid.element_type, param.get_degree_p(param.degree_u) + 3);
+  matrix_free_data.insert_quadrature(*quadrature_p_error, field + quad_index_p_error);
 }
 
 template<int dim, typename Number>
@@ -389,6 +403,48 @@ SpatialOperatorBase<dim, Number>::initialize_dirichlet_cached_bc()
   }
 }
 
+template<int dim, typename Number>
+void
+SpatialOperatorBase<dim, Number>::initialize_precomputed_bc()
+{
+  // resolve the vectorized interface of the boundary functions
+  boundary_descriptor->velocity->set_vectorized_functions();
+  boundary_descriptor->pressure->set_vectorized_functions();
+
+  // tabulate time-independent or separable boundary conditions in the boundary quadrature points
+  if(not(boundary_descriptor->velocity->precomputed_bc.empty()))
+  {
+    std::vector<unsigned int> quad_indices;
+    quad_indices.emplace_back(get_quad_index_velocity_standard());
+    quad_indices.emplace_back(get_quad_index_velocity_overintegration());
+    quad_indices.emplace_back(get_quad_index_velocity_gauss_lobatto());
+    quad_indices.emplace_back(get_quad_index_velocity_linearized());
+
+    precomputed_data_velocity = std::make_shared<PrecomputedBoundaryData<dim>>();
+    precomputed_data_velocity->setup(*matrix_free,
+                                     get_dof_index_velocity(),
+                                     quad_indices,
+                                     boundary_descriptor->velocity->get_precomputed_functions());
+
+    boundary_descriptor->velocity->set_precomputed_data(precomputed_data_velocity);
+  }
+
+  if(not(boundary_descriptor->pressure->precomputed_bc.empty()))
+  {
+    std::vector<unsigned int> quad_indices;
+    quad_indices.emplace_back(get_quad_index_pressure());
+    quad_indices.emplace_back(get_quad_index_pressure_gauss_lobatto());
+
+    precomputed_data_pressure = std::make_shared<PrecomputedBoundaryData<dim>>();
+    precomputed_data_pressure->setup(*matrix_free,
+                                     get_dof_index_pressure(),
+                                     quad_indices,
+                                     boundary_descriptor->pressure->get_precomputed_functions());
+
+    boundary_descriptor->pressure->set_precomputed_data(precomputed_data_pressure);
+  }
+}
+
 template<int dim, typename Number>
 void
 SpatialOperatorBase<dim, Number>::initialize_operators(std::string const & dof_index_temperature)
@@ -399,13 +455,6 @@ SpatialOperatorBase<dim, Number>::initialize_operators(std::string const & dof_i
   mass_operator_data.quad_index = get_quad_index_velocity_standard();
   mass_operator.initialize(*matrix_free, constraint_u, mass_operator_data);
 
-  InverseMassOperatorDataHdiv inverse_mass_data_hdiv;
-  inverse_mass_data_hdiv.dof_index  = get_dof_index_velocity();
-  inverse_mass_data_hdiv.quad_index = get_quad_index_velocity_standard();
-  inverse_mass_data_hdiv.parameters = this->param.inverse_mass_operator_hdiv;
-
-  inverse_mass_hdiv.initialize(*matrix_free, constraint_u, inverse_mass_data_hdiv);
-
   // inverse mass operator
   if(param.spatial_discretization == SpatialDiscretization::L2)
   {
@@ -415,12 +464,19 @@ SpatialOperatorBase<dim, Number>::initialize_operators(std::string const & dof_i
     inverse_mass_operator_data_velocity.parameters = param.inverse_mass_operator;
     inverse_mass_velocity.initialize(*matrix_free, inverse_mass_operator_data_velocity);
   }
-  // inverse mass operator velocity scalar
-  InverseMassOperatorData inverse_mass_operator_data_velocity_scalar;
-  inverse_mass_operator_data_velocity_scalar.dof_index  = get_dof_index_velocity_scalar();
-  inverse_mass_operator_data_velocity_scalar.quad_index = get_quad_index_velocity_standard();
-  inverse_mass_operator_data_velocity_scalar.parameters = param.inverse_mass_operator;
-  inverse_mass_velocity_scalar.initialize(*matrix_free, inverse_mass_operator_data_velocity_scalar);
+  else if(param.spatial_discretization == SpatialDiscretization::HDIV)
+  {
+    InverseMassOperatorDataHdiv inverse_mass_data_hdiv;
+    inverse_mass_data_hdiv.dof_index  = get_dof_index_velocity();
+    inverse_mass_data_hdiv.quad_index = get_quad_index_velocity_standard();
+    inverse_mass_data_hdiv.parameters = this->param.inverse_mass_operator_hdiv;
+
+    inverse_mass_hdiv.initialize(*matrix_free, constraint_u, inverse_mass_data_hdiv);
+  }
+
+  // The inverse mass operator for scalar quantities is only needed for postprocessing and is
+  // initialized on first use.
+  inverse_mass_velocity_scalar.reset();
 
   // body force operator
   RHSOperatorData<dim> rhs_data;
@@ -674,7 +730,7 @@ SpatialOperatorBase<dim, Number>::initialize_calculators_for_derived_quantities(
 
 template<int dim, typename Number>
 void
-SpatialOperatorBase<dim, Number>::setup()
+SpatialOperatorBase<dim, Number>::setup(bool const initialize_solvers)
 {
   // initialize MatrixFree and MatrixFreeData
   std::shared_ptr<dealii::MatrixFree<dim, Number>> mf =
@@ -682,22 +738,24 @@ SpatialOperatorBase<dim, Number>::setup()
   std::shared_ptr<MatrixFreeData<dim, Number>> mf_data =
     std::make_shared<MatrixFreeData<dim, Number>>();
 
-  fill_matrix_free_data(*mf_data);
+  setup_profiler.measure({"MatrixFree"}, [&]() {
+    fill_matrix_free_data(*mf_data);
 
-  if(param.use_cell_based_face_loops)
-    Categorization::do_cell_based_loops(*grid->triangulation, mf_data->data);
-  mf->reinit(*get_mapping(),
-             mf_data->get_dof_handler_vector(),
-             mf_data->get_constraint_vector(),
-             mf_data->get_quadrature_vector(),
-             mf_data->data);
+    if(param.use_cell_based_face_loops)
+      Categorization::do_cell_based_loops(*grid->triangulation, mf_data->data);
+    mf->reinit(*get_mapping(),
+               mf_data->get_dof_handler_vector(),
+               mf_data->get_constraint_vector(),
+               mf_data->get_quadrature_vector(),
+               mf_data->data);
+  });
 
   if(param.ale_formulation)
     matrix_free_own_storage = mf;
 
   // Subsequently, call the other setup function with MatrixFree/MatrixFreeData objects as
   // arguments.
-  this->setup(mf, mf_data);
+  this->setup(mf, mf_data, "", initialize_solvers);
 }
 
 template<int dim, typename Number>
@@ -705,7 +763,8 @@ void
 SpatialOperatorBase<dim, Number>::setup(
   std::shared_ptr<dealii::MatrixFree<dim, Number> const> matrix_free_in,
   std::shared_ptr<MatrixFreeData<dim, Number> const>     matrix_free_data_in,
-  std::string const &                                    dof_index_temperature)
+  std::string const &                                    dof_index_temperature,
+  bool const                                             initialize_solvers)
 {
   pcout << std::endl
         << "Setup incompressible Navier-Stokes operator ..." << std::endl
@@ -717,16 +776,25 @@ SpatialOperatorBase<dim, Number>::setup(
 
   // Next, initialize data structures depending on MatrixFree:
 
-  initialize_dirichlet_cached_bc();
+  setup_profiler.measure({"Boundary data"}, [&]() {
+    initialize_dirichlet_cached_bc();
+
+    initialize_precomputed_bc();
+  });
 
-  initialize_operators(dof_index_temperature);
+  setup_profiler.measure({"Operators"}, [&]() { initialize_operators(dof_index_temperature); });
 
-  initialize_calculators_for_derived_quantities();
+  setup_profiler.measure({"Calculators derived quantities"},
+                         [&]() { initialize_calculators_for_derived_quantities(); });
 
   // Finally, do set up of derived classes
-  setup_derived();
+  setup_profiler.measure({"Operators derived class"}, [&]() { setup_derived(); });
 
-  setup_preconditioners_and_solvers();
+  if(initialize_solvers)
+  {
+    setup_profiler.measure({"Preconditioners and solvers"},
+                           [&]() { setup_preconditioners_and_solvers(); });
+  }
 
   pcout << std::endl << "... done!" << std::endl << std::flush;
 }
@@ -738,6 +806,13 @@ SpatialOperatorBase<dim, Number>::get_number_of_dofs() const
   return dof_handler_u.n_dofs() + dof_handler_p.n_dofs();
 }
 
+template<int dim, typename Number>
+SetupProfiler const &
+SpatialOperatorBase<dim, Number>::get_setup_profiler() const
+{
+  return setup_profiler;
+}
+
 template<int dim, typename Number>
 dealii::MatrixFree<dim, Number> const &
 SpatialOperatorBase<dim, Number>::get_matrix_free() const
@@ -787,6 +862,20 @@ SpatialOperatorBase<dim, Number>::get_quad_index_pressure() const
   return matrix_free_data->get_quad_index(field + quad_index_p);
 }
 
+template<int dim, typename Number>
+unsigned int
+SpatialOperatorBase<dim, Number>::get_quad_index_velocity_error() const
+{
+  return matrix_free_data->get_quad_index(field + quad_index_u_error);
+}
+
+template<int dim, typename Number>
+unsigned int
+SpatialOperatorBase<dim, Number>::get_quad_index_pressure_error() const
+{
+  return matrix_free_data->get_quad_index(field + quad_index_p_error);
+}
+
 template<int dim, typename Number>
 unsigned int
 SpatialOperatorBase<dim, Number>::get_quad_index_velocity_overintegration() const
@@ -1234,7 +1323,7 @@ SpatialOperatorBase<dim, Number>::compute_divergence(VectorType & dst, VectorTyp
 {
   divergence_calculator.compute_divergence(dst, src);
 
-  inverse_mass_velocity_scalar.apply(dst, dst);
+  apply_inverse_mass_operator_velocity_scalar(dst);
 }
 
 template<int dim, typename Number>
@@ -1243,7 +1332,7 @@ SpatialOperatorBase<dim, Number>::compute_shear_rate(VectorType & dst, VectorTyp
 {
   shear_rate_calculator.compute_shear_rate(dst, src);
 
-  inverse_mass_velocity_scalar.apply(dst, dst);
+  apply_inverse_mass_operator_velocity_scalar(dst);
 }
 
 template<int dim, typename Number>
@@ -1253,7 +1342,7 @@ SpatialOperatorBase<dim, Number>::compute_velocity_magnitude(VectorType &
 {
   magnitude_calculator.compute(dst, src);
 
-  inverse_mass_velocity_scalar.apply(dst, dst);
+  apply_inverse_mass_operator_velocity_scalar(dst);
 }
 
 template<int dim, typename Number>
@@ -1263,7 +1352,7 @@ SpatialOperatorBase<dim, Number>::compute_vorticity_magnitude(VectorType &
 {
   magnitude_calculator.compute(dst, src);
 
-  inverse_mass_velocity_scalar.apply(dst, dst);
+  apply_inverse_mass_operator_velocity_scalar(dst);
 }
 
 /*
@@ -1368,7 +1457,27 @@ SpatialOperatorBase<dim, Number>::compute_q_criterion(VectorType &       dst,
 {
   q_criterion_calculator.compute(dst, src);
 
-  inverse_mass_velocity_scalar.apply(dst, dst);
+  apply_inverse_mass_operator_velocity_scalar(dst);
+}
+
+template<int dim, typename Number>
+void
+SpatialOperatorBase<dim, Number>::apply_inverse_mass_operator_velocity_scalar(
+  VectorType & dst) const
+{
+  if(not inverse_mass_velocity_scalar.get())
+  {
+    InverseMassOperatorData inverse_mass_operator_data_velocity_scalar;
+    inverse_mass_operator_data_velocity_scalar.dof_index  = get_dof_index_velocity_scalar();
+    inverse_mass_operator_data_velocity_scalar.quad_index = get_quad_index_velocity_standard();
+    inverse_mass_operator_data_velocity_scalar.parameters = param.inverse_mass_operator;
+
+    inverse_mass_velocity_scalar = std::make_shared<InverseMassOperator<dim, 1, Number>>();
+    inverse_mass_velocity_scalar->initialize(*matrix_free,
+                                             inverse_mass_operator_data_velocity_scalar);
+  }
+
+  inverse_mass_velocity_scalar->apply(dst, dst);
 }
 
 template<int dim, typename Number>
@@ -1551,7 +1660,11 @@ SpatialOperatorBase<dim, Number>::update_after_grid_motion(bool const update_mat
   // The inverse mass operator might contain matrix-based components, in which cases it needs to be
   // updated after the grid has been deformed.
   inverse_mass_velocity.update();
-  inverse_mass_velocity_scalar.update();
+  if(inverse_mass_velocity_scalar.get())
+    inverse_mass_velocity_scalar->update();
+
+  // precomputed boundary data depends on the position of the quadrature points
+  initialize_precomputed_bc();
 
   // note that the update of div-div and continuity penalty terms is done separately
 }
@@ -55,6 +55,7 @@
 #include <exadg/poisson/spatial_discretization/laplace_operator.h>
 #include <exadg/solvers_and_preconditioners/preconditioners/preconditioner_base.h>
 #include <exadg/time_integration/interpolate.h>
+#include <exadg/utilities/setup_profiler.h>
 
 namespace ExaDG
 {
@@ -106,9 +107,14 @@ public:
 
   /**
    * Call this setup() function if the dealii::MatrixFree object can be set up by the present class.
+   *
+   * If initialize_solvers is false, preconditioners and solvers are not set up. This is used by
+   * processes that only evaluate postprocessing quantities (e.g. dedicated in-transit
+   * postprocessing processes), which need the dealii::MatrixFree object and the operators, but do
+   * not solve any systems of equations.
    */
   void
-  setup();
+  setup(bool const initialize_solvers = true);
 
   /**
    * Call this setup() function if the dealii::MatrixFree object needs to be created outside this
@@ -119,7 +125,8 @@ public:
   void
   setup(std::shared_ptr<dealii::MatrixFree<dim, Number> const> matrix_free,
         std::shared_ptr<MatrixFreeData<dim, Number> const>     matrix_free_data,
-        std::string const &                                    dof_index_temperature = "");
+        std::string const &                                    dof_index_temperature = "",
+        bool const                                             initialize_solvers    = true);
 
 protected:
   /*
@@ -161,6 +168,16 @@ public:
   unsigned int
   get_quad_index_pressure() const;
 
+  /*
+   * Quadrature rules with degree + 3 points used to evaluate errors w.r.t. an analytical solution,
+   * see ErrorCalculationData::use_matrix_free_evaluation.
+   */
+  unsigned int
+  get_quad_index_velocity_error() const;
+
+  unsigned int
+  get_quad_index_pressure_error() const;
+
 protected:
   unsigned int
   get_dof_index_velocity_scalar() const;
@@ -205,6 +222,12 @@ public:
   dealii::types::global_dof_index
   get_number_of_dofs() const;
 
+  /*
+   * Returns wall times and memory high-water marks of the setup phases of this operator.
+   */
+  SetupProfiler const &
+  get_setup_profiler() const;
+
   dealii::VectorizedArray<Number>
   get_viscosity_boundary_face(unsigned int const face, unsigned int const q) const;
 
@@ -516,6 +539,8 @@ private:
   std::string const quad_index_u_overintegration = "velocity_overintegration";
   std::string const quad_index_u_gauss_lobatto   = "velocity_gauss_lobatto";
   std::string const quad_index_p_gauss_lobatto   = "pressure_gauss_lobatto";
+  std::string const quad_index_u_error           = "velocity_error";
+  std::string const quad_index_p_error           = "pressure_error";
 
   std::shared_ptr<MatrixFreeData<dim, Number> const>     matrix_free_data;
   std::shared_ptr<dealii::MatrixFree<dim, Number> const> matrix_free;
@@ -532,6 +557,12 @@ private:
    */
   std::shared_ptr<ContainerInterfaceData<1, dim, double>> interface_data_dirichlet_cached;
 
+  /*
+   * Precomputed boundary data
+   */
+  std::shared_ptr<PrecomputedBoundaryData<dim>> precomputed_data_velocity;
+  std::shared_ptr<PrecomputedBoundaryData<dim>> precomputed_data_pressure;
+
 protected:
   /*
    * Operator kernels.
@@ -567,7 +598,6 @@ protected:
    * Inverse mass operator (for L2 spaces)
    */
   InverseMassOperator<dim, dim, Number> inverse_mass_velocity;
-  InverseMassOperator<dim, 1, Number>   inverse_mass_velocity_scalar;
 
   /*
    * Inverse mass operator used in case of H(div)-conforming space
@@ -610,6 +640,8 @@ protected:
 
   dealii::ConditionalOStream pcout;
 
+  SetupProfiler setup_profiler;
+
 private:
   // Minimum element length h_min required for global CFL condition.
   double
@@ -627,6 +659,9 @@ private:
   void
   initialize_dirichlet_cached_bc();
 
+  void
+  initialize_precomputed_bc();
+
   void
   initialize_operators(std::string const & dof_index_temperature);
 
@@ -636,6 +671,13 @@ private:
   void
   initialization_pure_dirichlet_bc();
 
+  /*
+   * Applies the inverse mass operator for scalar quantities derived from the velocity. The
+   * operator is only needed for postprocessing and is initialized on first use.
+   */
+  void
+  apply_inverse_mass_operator_velocity_scalar(VectorType & dst) const;
+
   void
   cell_loop_empty(dealii::MatrixFree<dim, Number> const &,
                   VectorType &,
@@ -664,6 +706,12 @@ private:
   mutable VectorType const * velocity_ptr;
   mutable VectorType const * pressure_ptr;
 
+  /*
+   * Inverse mass operator for scalar quantities derived from the velocity (initialized on first
+   * use).
+   */
+  mutable std::shared_ptr<InverseMassOperator<dim, 1, Number>> inverse_mass_velocity_scalar;
+
   /*
    * Variable viscosity models.
    */
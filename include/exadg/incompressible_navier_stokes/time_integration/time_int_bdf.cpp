@@ -51,7 +51,7 @@ TimeIntBDF<dim, Number>::TimeIntBDF(
     refine_steps_time(param_in.n_refine_time),
     cfl(param.cfl / std::pow(2.0, refine_steps_time)),
     operator_base(operator_in),
-    vec_convective_term(this->order),
+    vec_convective_term(this->order, param_in.store_convective_term_single_precision),
     use_extrapolation(true),
     store_solution(false),
     helpers_ale(helpers_ale_in),
@@ -71,12 +71,14 @@ TimeIntBDF<dim, Number>::allocate_vectors()
   // convective term
   if(needs_vector_convective_term)
   {
-    for(unsigned int i = 0; i < vec_convective_term.size(); ++i)
-      this->operator_base->initialize_vector_velocity(vec_convective_term[i]);
+    VectorType vector_velocity;
+    this->operator_base->initialize_vector_velocity(vector_velocity);
+
+    vec_convective_term.reinit(vector_velocity);
 
     if(param.ale_formulation == false)
     {
-      this->operator_base->initialize_vector_velocity(convective_term_np);
+      convective_term_np.reinit(vector_velocity);
     }
   }
 
@@ -138,8 +140,7 @@ TimeIntBDF<dim, Number>::prepare_vectors_for_next_timestep()
   {
     if(this->param.ale_formulation == false)
     {
-      push_back(this->vec_convective_term);
-      vec_convective_term[0].swap(convective_term_np);
+      vec_convective_term.push_back(convective_term_np);
     }
   }
 
@@ -236,17 +237,21 @@ template<int dim, typename Number>
 void
 TimeIntBDF<dim, Number>::initialize_vec_convective_term()
 {
-  this->operator_base->evaluate_convective_term(vec_convective_term[0],
+  // convective_term_np is used as temporary vector since the history might be stored in reduced
+  // precision
+  this->operator_base->evaluate_convective_term(convective_term_np,
                                                 get_velocity(),
                                                 this->get_time());
+  vec_convective_term.set(0, convective_term_np);
 
   if(this->param.start_with_low_order == false)
   {
     for(unsigned int i = 1; i < vec_convective_term.size(); ++i)
     {
-      this->operator_base->evaluate_convective_term(vec_convective_term[i],
+      this->operator_base->evaluate_convective_term(convective_term_np,
                                                     get_velocity(i),
                                                     this->get_previous_time(i));
+      vec_convective_term.set(i, convective_term_np);
     }
   }
 }
@@ -274,7 +279,9 @@ TimeIntBDF<dim, Number>::read_restart_vectors(boost::archive::binary_iarchive &
     {
       for(unsigned int i = 0; i < this->order; i++)
       {
-        ia >> vec_convective_term[i];
+        VectorType tmp = convective_term_np;
+        ia >> tmp;
+        vec_convective_term.set(i, tmp);
       }
     }
   }
@@ -307,7 +314,9 @@ TimeIntBDF<dim, Number>::write_restart_vectors(boost::archive::binary_oarchive &
     {
       for(unsigned int i = 0; i < this->order; i++)
       {
-        oa << vec_convective_term[i];
+        VectorType tmp;
+        vec_convective_term.get(i, tmp);
+        oa << tmp;
       }
     }
   }
@@ -28,6 +28,7 @@
 // ExaDG
 #include <exadg/time_integration/lambda_functions_ale.h>
 #include <exadg/time_integration/time_int_bdf_base.h>
+#include <exadg/time_integration/vector_history.h>
 
 namespace ExaDG
 {
@@ -129,9 +130,9 @@ protected:
   std::shared_ptr<SpatialOperatorBase<dim, Number>> operator_base;
 
   // convective term formulated explicitly
-  bool                    needs_vector_convective_term;
-  std::vector<VectorType> vec_convective_term;
-  VectorType              convective_term_np;
+  bool                  needs_vector_convective_term;
+  VectorHistory<Number> vec_convective_term;
+  VectorType            convective_term_np;
 
   // required for strongly-coupled partitioned iteration
   bool use_extrapolation;
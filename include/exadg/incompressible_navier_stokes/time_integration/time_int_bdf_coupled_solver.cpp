@@ -264,8 +264,7 @@ TimeIntBDFCoupled<dim, Number>::do_timestep_solve()
     if(this->param.convective_problem() and
        this->param.treatment_of_convective_term == TreatmentOfConvectiveTerm::Explicit)
     {
-      for(unsigned int i = 0; i < this->vec_convective_term.size(); ++i)
-        rhs.add(-this->extra.get_beta(i), this->vec_convective_term[i]);
+      this->vec_convective_term.add_extrapolation(rhs, -1.0, this->extra);
     }
 
     // Newton solver
@@ -305,8 +304,7 @@ TimeIntBDFCoupled<dim, Number>::do_timestep_solve()
     if(this->param.convective_problem() and
        this->param.treatment_of_convective_term == TreatmentOfConvectiveTerm::Explicit)
     {
-      for(unsigned int i = 0; i < this->vec_convective_term.size(); ++i)
-        rhs_vector.block(0).add(-this->extra.get_beta(i), this->vec_convective_term[i]);
+      this->vec_convective_term.add_extrapolation(rhs_vector.block(0), -1.0, this->extra);
     }
 
     // apply mass operator to sum_alphai_ui and add to rhs vector
@@ -669,6 +667,29 @@ TimeIntBDFCoupled<dim, Number>::print_iterations() const
   print_list_of_iterations(this->pcout, names, iterations_avg);
 }
 
+template<int dim, typename Number>
+std::vector<std::pair<std::string, unsigned long long>>
+TimeIntBDFCoupled<dim, Number>::get_accumulated_iterations() const
+{
+  std::vector<std::pair<std::string, unsigned long long>> accumulated_iterations;
+
+  if(this->param.nonlinear_problem_has_to_be_solved())
+  {
+    accumulated_iterations.emplace_back("Coupled system (nonlinear)",
+                                        std::get<0>(iterations.second));
+    accumulated_iterations.emplace_back("Coupled system (linear)", std::get<1>(iterations.second));
+  }
+  else
+  {
+    accumulated_iterations.emplace_back("Coupled system", std::get<1>(iterations.second));
+  }
+
+  if(this->param.apply_penalty_terms_in_postprocessing_step)
+    accumulated_iterations.emplace_back("Penalty terms", iterations_penalty.second);
+
+  return accumulated_iterations;
+}
+
 // instantiations
 
 template class TimeIntBDFCoupled<2, float>;
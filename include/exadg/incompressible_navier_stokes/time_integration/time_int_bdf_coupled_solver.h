@@ -90,6 +90,9 @@ private:
   void
   do_timestep_solve() final;
 
+  std::vector<std::pair<std::string, unsigned long long>>
+  get_accumulated_iterations() const final;
+
   void
   solve_steady_problem() final;
 
@@ -355,8 +355,7 @@ TimeIntBDFDualSplitting<dim, Number>::convective_step()
       }
     }
 
-    for(unsigned int i = 0; i < this->vec_convective_term.size(); ++i)
-      velocity_np.add(-this->extra.get_beta(i), this->vec_convective_term[i]);
+    this->vec_convective_term.add_extrapolation(velocity_np, -1.0, this->extra);
   }
 
   // compute body force vector
@@ -823,8 +822,7 @@ TimeIntBDFDualSplitting<dim, Number>::rhs_viscous(VectorType &       rhs,
     // compensate for explicit convective term
     if(this->param.convective_problem())
     {
-      for(unsigned int i = 0; i < this->vec_convective_term.size(); ++i)
-        rhs.add(this->extra.get_beta(i), this->vec_convective_term[i]);
+      this->vec_convective_term.add_extrapolation(rhs, 1.0, this->extra);
     }
   }
   else
@@ -1062,6 +1060,35 @@ TimeIntBDFDualSplitting<dim, Number>::print_iterations() const
   print_list_of_iterations(this->pcout, names, iterations_avg);
 }
 
+template<int dim, typename Number>
+std::vector<std::pair<std::string, unsigned long long>>
+TimeIntBDFDualSplitting<dim, Number>::get_accumulated_iterations() const
+{
+  std::vector<std::pair<std::string, unsigned long long>> accumulated_iterations = {
+    {"Pressure step", iterations_pressure.second},
+    {"Projection step", iterations_projection.second}};
+
+  if(this->param.nonlinear_problem_has_to_be_solved())
+  {
+    accumulated_iterations.emplace_back("Viscous step (nonlinear)",
+                                        std::get<0>(iterations_viscous.second));
+    accumulated_iterations.emplace_back("Viscous step (linear)",
+                                        std::get<1>(iterations_viscous.second));
+  }
+  else
+  {
+    accumulated_iterations.emplace_back("Viscous step", std::get<1>(iterations_viscous.second));
+  }
+
+  if(this->param.spatial_discretization == SpatialDiscretization::HDIV)
+    accumulated_iterations.emplace_back("Mass solver", iterations_mass.second);
+
+  if(this->param.apply_penalty_terms_in_postprocessing_step)
+    accumulated_iterations.emplace_back("Penalty step", iterations_penalty.second);
+
+  return accumulated_iterations;
+}
+
 // instantiations
 
 template class TimeIntBDFDualSplitting<2, float>;
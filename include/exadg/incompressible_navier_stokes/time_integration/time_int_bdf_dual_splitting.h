@@ -88,6 +88,9 @@ private:
   void
   do_timestep_solve() final;
 
+  std::vector<std::pair<std::string, unsigned long long>>
+  get_accumulated_iterations() const final;
+
   void
   prepare_vectors_for_next_timestep() final;
 
@@ -510,8 +510,7 @@ TimeIntBDFPressureCorrection<dim, Number>::rhs_momentum(VectorType & rhs)
       }
     }
 
-    for(unsigned int i = 0; i < this->vec_convective_term.size(); ++i)
-      rhs.add(-this->extra.get_beta(i), this->vec_convective_term[i]);
+    this->vec_convective_term.add_extrapolation(rhs, -1.0, this->extra);
   }
 
   /*
@@ -1050,6 +1049,30 @@ TimeIntBDFPressureCorrection<dim, Number>::print_iterations() const
   print_list_of_iterations(this->pcout, names, iterations_avg);
 }
 
+template<int dim, typename Number>
+std::vector<std::pair<std::string, unsigned long long>>
+TimeIntBDFPressureCorrection<dim, Number>::get_accumulated_iterations() const
+{
+  std::vector<std::pair<std::string, unsigned long long>> accumulated_iterations;
+
+  if(this->param.nonlinear_problem_has_to_be_solved())
+  {
+    accumulated_iterations.emplace_back("Momentum step (nonlinear)",
+                                        std::get<0>(iterations_momentum.second));
+    accumulated_iterations.emplace_back("Momentum step (linear)",
+                                        std::get<1>(iterations_momentum.second));
+  }
+  else
+  {
+    accumulated_iterations.emplace_back("Momentum step", std::get<1>(iterations_momentum.second));
+  }
+
+  accumulated_iterations.emplace_back("Pressure step", iterations_pressure.second);
+  accumulated_iterations.emplace_back("Projection step", iterations_projection.second);
+
+  return accumulated_iterations;
+}
+
 // instantiations
 
 template class TimeIntBDFPressureCorrection<2, float>;
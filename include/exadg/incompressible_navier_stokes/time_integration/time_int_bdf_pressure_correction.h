@@ -100,6 +100,9 @@ private:
   void
   do_timestep_solve() final;
 
+  std::vector<std::pair<std::string, unsigned long long>>
+  get_accumulated_iterations() const final;
+
   void
   solve_steady_problem() final;
 
@@ -31,6 +31,7 @@
 
 // ExaDG
 #include <exadg/functions_and_boundary_conditions/container_interface_data.h>
+#include <exadg/functions_and_boundary_conditions/precomputed_boundary_data.h>
 #include <exadg/functions_and_boundary_conditions/verify_boundary_conditions.h>
 
 namespace ExaDG
@@ -77,7 +78,7 @@ enum class BoundaryTypeP
 };
 
 template<int dim>
-struct BoundaryDescriptorU
+struct BoundaryDescriptorU : public PrecomputedBoundaryConditions<dim>
 {
   // Dirichlet: prescribe all components of the velocity
   std::map<dealii::types::boundary_id, std::shared_ptr<dealii::Function<dim>>> dirichlet_bc;
@@ -166,6 +167,23 @@ struct BoundaryDescriptorU
                 dealii::ExcMessage("Boundary face with non-unique boundary type found."));
   }
 
+  // returns the boundary functions of all boundary IDs in precomputed_bc, which need to be part
+  // of dirichlet_bc or neumann_bc
+  std::map<dealii::types::boundary_id, std::shared_ptr<dealii::Function<dim>>>
+  get_precomputed_functions() const
+  {
+    return this->collect_precomputed_functions({&dirichlet_bc, &neumann_bc},
+                                               "dirichlet_bc or neumann_bc");
+  }
+
+  // resolves the vectorized interface of the boundary functions evaluated by
+  // evaluate_boundary_function() once per boundary ID
+  void
+  set_vectorized_functions() const
+  {
+    this->resolve_vectorized_functions({&dirichlet_bc, &neumann_bc});
+  }
+
   void
   set_dirichlet_cached_data(
     std::shared_ptr<ContainerInterfaceData<1, dim, double> const> interface_data) const
@@ -187,7 +205,7 @@ private:
 };
 
 template<int dim>
-struct BoundaryDescriptorP
+struct BoundaryDescriptorP : public PrecomputedBoundaryConditions<dim>
 {
   // Dirichlet: prescribe pressure value
   std::map<dealii::types::boundary_id, std::shared_ptr<dealii::Function<dim>>> dirichlet_bc;
@@ -233,6 +251,22 @@ struct BoundaryDescriptorP
     AssertThrow(counter == 1,
                 dealii::ExcMessage("Boundary face with non-unique boundary type found."));
   }
+
+  // returns the boundary functions of all boundary IDs in precomputed_bc, which need to be part
+  // of dirichlet_bc
+  std::map<dealii::types::boundary_id, std::shared_ptr<dealii::Function<dim>>>
+  get_precomputed_functions() const
+  {
+    return this->collect_precomputed_functions({&dirichlet_bc}, "dirichlet_bc");
+  }
+
+  // resolves the vectorized interface of the boundary functions evaluated by
+  // evaluate_boundary_function() once per boundary ID
+  void
+  set_vectorized_functions() const
+  {
+    this->resolve_vectorized_functions({&dirichlet_bc});
+  }
 };
 
 template<int dim>
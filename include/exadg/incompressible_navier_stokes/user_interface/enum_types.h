@@ -455,13 +455,20 @@ enum class SolverCoupled
  *  - use BlockTriangular as default (typically best option in terms of time-to-solution, i.e.
  *    BlockDiagonal needs significantly more iterations and BlockTriangularFactorization reduces
  *    number of iterations only slightly but is significantly more expensive)
+ *
+ *  - AugmentedLagrangian: the momentum equation is augmented by the consistent grad-div term
+ *    gamma * D u (D: grad-div operator with constant penalty parameter gamma), and the augmented
+ *    system is solved with a block-triangular preconditioner with velocity block A + gamma * D and
+ *    Schur-complement approximation -S^{-1} = (nu + gamma) M_p^{-1} (InverseMassMatrix) or its
+ *    Cahouet-Chabard variant (CahouetChabard), see preconditioner_pressure_block.
  */
 enum class PreconditionerCoupled
 {
   None,
   BlockDiagonal,
   BlockTriangular,
-  BlockTriangularFactorization
+  BlockTriangularFactorization,
+  AugmentedLagrangian
 };
 
 /*
@@ -59,6 +59,7 @@ Parameters::Parameters()
     solver_type(SolverType::Undefined),
     temporal_discretization(TemporalDiscretization::Undefined),
     treatment_of_convective_term(TreatmentOfConvectiveTerm::Undefined),
+    store_convective_term_single_precision(false),
     calculation_of_time_step_size(TimeStepCalculation::Undefined),
     adaptive_time_stepping(false),
     adaptive_time_stepping_limiting_factor(1.2),
@@ -202,6 +203,7 @@ Parameters::Parameters()
 
     // preconditioning linear solver
     preconditioner_coupled(PreconditionerCoupled::BlockTriangular),
+    augmented_lagrangian_factor(1.0),
     update_preconditioner_coupled(false),
     update_preconditioner_coupled_every_newton_iter(1),
     update_preconditioner_coupled_every_time_steps(1),
@@ -310,6 +312,15 @@ Parameters::check(dealii::ConditionalOStream const & pcout) const
                 dealii::ExcMessage("parameter must be defined"));
   }
 
+  if(store_convective_term_single_precision)
+  {
+    // In case of ALE, the convective term is recomputed for all previous instants of time in
+    // each time step, i.e. there is no history to be stored.
+    AssertThrow(ale_formulation == false,
+                dealii::ExcMessage("Storing the convective term in single precision is not "
+                                   "possible for an ALE formulation."));
+  }
+
   AssertThrow(calculation_of_time_step_size != TimeStepCalculation::Undefined,
               dealii::ExcMessage("parameter must be defined"));
 
@@ -488,6 +499,26 @@ Parameters::check(dealii::ConditionalOStream const & pcout) const
     if(use_scaling_continuity == true)
       AssertThrow(scaling_factor_continuity > 0.0, dealii::ExcMessage("Invalid parameter"));
 
+    if(preconditioner_coupled == PreconditionerCoupled::AugmentedLagrangian)
+    {
+      AssertThrow(augmented_lagrangian_factor > 0.0,
+                  dealii::ExcMessage("Parameter augmented_lagrangian_factor must be positive."));
+
+      AssertThrow(preconditioner_velocity_block != MomentumPreconditioner::InverseMassMatrix,
+                  dealii::ExcMessage(
+                    "The augmented Lagrangian preconditioner requires a preconditioner for the "
+                    "velocity block that takes the grad-div term into account."));
+
+      bool const schur_complement_based_on_mass_matrix =
+        preconditioner_pressure_block == SchurComplementPreconditioner::InverseMassMatrix or
+        preconditioner_pressure_block == SchurComplementPreconditioner::CahouetChabard;
+      AssertThrow(schur_complement_based_on_mass_matrix,
+                  dealii::ExcMessage(
+                    "The augmented Lagrangian preconditioner requires a Schur-complement "
+                    "preconditioner based on the pressure mass matrix (InverseMassMatrix or "
+                    "CahouetChabard)."));
+    }
+
     if(preconditioner_velocity_block == MomentumPreconditioner::Multigrid)
     {
       AssertThrow(multigrid_operator_type_velocity_block != MultigridOperatorType::Undefined,
@@ -809,6 +840,9 @@ Parameters::print_parameters_temporal_discretization(dealii::ConditionalOStream
 
   print_parameter(pcout, "Temporal discretization method", temporal_discretization);
   print_parameter(pcout, "Treatment of convective term", treatment_of_convective_term);
+  print_parameter(pcout,
+                  "Store convective term in single precision",
+                  store_convective_term_single_precision);
 
   if(this->viscosity_is_variable())
     print_parameter(pcout, "Treatment of nonlinear viscosity", treatment_of_variable_viscosity);
@@ -1183,6 +1217,9 @@ Parameters::print_parameters_coupled_solver(dealii::ConditionalOStream const & p
 
   print_parameter(pcout, "Preconditioner", preconditioner_coupled);
 
+  if(preconditioner_coupled == PreconditionerCoupled::AugmentedLagrangian)
+    print_parameter(pcout, "Augmented Lagrangian factor", augmented_lagrangian_factor);
+
   print_parameter(pcout, "Update preconditioner", update_preconditioner_coupled);
 
   if(update_preconditioner_coupled == true)
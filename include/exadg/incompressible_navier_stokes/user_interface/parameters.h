@@ -218,6 +218,11 @@ public:
   // description: see enum declaration
   TreatmentOfConvectiveTerm treatment_of_convective_term;
 
+  // Store the history of the explicitly treated convective term in single precision. This
+  // reduces memory consumption and memory transfer of the extrapolation of the convective term,
+  // at the price of a rounding error of order 1e-7 relative to the convective term.
+  bool store_convective_term_single_precision;
+
   // description: see enum declaration
   TimeStepCalculation calculation_of_time_step_size;
 
@@ -436,7 +441,9 @@ public:
   // is necessary to perform the face-loop as a loop over all faces of a cell with an
   // outer loop over all cells, e.g., preconditioners operating on the level of
   // individual cells (for example block Jacobi). With this parameter, the loop structure
-  // can be changed to such an algorithm (cell_based_face_loops).
+  // can be changed to such an algorithm (cell_based_face_loops). On locally refined meshes,
+  // cell-based face loops are only supported for the multigrid levels, and mixed meshes are not
+  // supported, see Categorization::do_cell_based_loops().
   bool use_cell_based_face_loops;
 
   // Solver data for block Jacobi preconditioner. Accordingly, this parameter is only
@@ -652,6 +659,10 @@ public:
   // description: see enum declaration
   PreconditionerCoupled preconditioner_coupled;
 
+  // penalty parameter gamma of the grad-div term augmenting the momentum equation
+  // (only relevant if preconditioner_coupled == AugmentedLagrangian)
+  double augmented_lagrangian_factor;
+
   // Update preconditioner
   bool update_preconditioner_coupled;
 
@@ -22,6 +22,10 @@
 #ifndef OPERATOR_BASE_CATEGORIZATION_H
 #define OPERATOR_BASE_CATEGORIZATION_H
 
+// C/C++
+#include <algorithm>
+#include <vector>
+
 // deal.II
 #include <deal.II/grid/tria.h>
 
@@ -35,6 +39,15 @@ namespace Categorization
  *      same category
  *   2) cell based loops are enabled (incl. dealii::FEEvaluationBase::read_cell_data()
  *      for all neighboring cells)
+ *
+ * Cell based face loops access the neighbor via FEFaceEvaluation::reinit(cell, face) for the
+ * exterior side of a face. On locally refined meshes, this is wrong for the coarse side of a face
+ * with hanging nodes, where MatrixFree only knows the subfaces of the fine neighbors.
+ *
+ * Scope: On locally refined meshes, cell based loops are supported for multigrid levels only
+ * (local smoothing multigrid, i.e., @p level is specified), since level cells only have neighbors
+ * on the same level and the level matrix-free loops see no hanging nodes. For active cells, the
+ * mesh must not have hanging nodes. Mixed meshes (several reference cell types) are not supported.
  */
 template<int dim, typename AdditionalData>
 void
@@ -53,8 +66,9 @@ do_cell_based_loops(dealii::Triangulation<dim> const & tria,
   AssertThrow(tria.get_reference_cells().size() == 1,
               dealii::ExcMessage("No mixed meshes allowed."));
 
-  AssertThrow(not tria.has_hanging_nodes(),
-              dealii::ExcMessage("Cell based face loops do not support locally refined meshes."));
+  AssertThrow(is_mg or not tria.has_hanging_nodes(),
+              dealii::ExcMessage("Cell based face loops on locally refined meshes are only "
+                                 "supported for multigrid levels, not for active cells."));
 
   unsigned int const n_faces_per_cell = tria.get_reference_cells()[0].n_faces();
 
@@ -107,6 +121,38 @@ do_cell_based_loops(dealii::Triangulation<dim> const & tria,
     data.mapping_update_flags_inner_faces | data.mapping_update_flags_boundary_faces;
 }
 
+/*
+ * Adjust the categories set up by do_cell_based_loops() such that only cells with the same level
+ * (e.g. the time step level in case of local time stepping) are put into the same category. The
+ * vector cell_levels is indexed by the active cell index.
+ */
+template<int dim, typename AdditionalData>
+void
+split_categories_by_level(dealii::Triangulation<dim> const & tria,
+                          AdditionalData &                   data,
+                          std::vector<unsigned int> const &  cell_levels)
+{
+  AssertThrow(data.cell_vectorization_category.size() == tria.n_active_cells() and
+                cell_levels.size() == tria.n_active_cells(),
+              dealii::ExcMessage("Categories have to be set up for active cells first, see "
+                                 "do_cell_based_loops()."));
+
+  unsigned int n_categories = 1;
+  for(auto const & cell : tria.active_cell_iterators())
+  {
+    if(cell->is_locally_owned())
+      n_categories =
+        std::max(n_categories, data.cell_vectorization_category[cell->active_cell_index()] + 1);
+  }
+
+  for(auto const & cell : tria.active_cell_iterators())
+  {
+    if(cell->is_locally_owned())
+      data.cell_vectorization_category[cell->active_cell_index()] +=
+        cell_levels[cell->active_cell_index()] * n_categories;
+  }
+}
+
 } // namespace Categorization
 } // namespace ExaDG
 
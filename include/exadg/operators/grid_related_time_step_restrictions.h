@@ -134,6 +134,8 @@ calculate_time_step_cfl_local(dealii::MatrixFree<dim, value_type> const &  data,
 
   double const cfl_p = 1.0 / pow(degree, exponent_fe_degree);
 
+  VectorizedFunction<dim> const * velocity_vectorized = get_vectorized_function(velocity.get());
+
   // loop over cells of processor
   for(unsigned int cell = 0; cell < data.n_cell_batches(); ++cell)
   {
@@ -148,7 +150,7 @@ calculate_time_step_cfl_local(dealii::MatrixFree<dim, value_type> const &  data,
       dealii::Point<dim, dealii::VectorizedArray<value_type>> q_point = fe_eval.quadrature_point(q);
 
       dealii::Tensor<1, dim, dealii::VectorizedArray<value_type>> u_x =
-        FunctionEvaluator<1, dim, value_type>::value(*velocity, q_point, time);
+        FunctionEvaluator<1, dim, value_type>::value(*velocity, velocity_vectorized, q_point, time);
       dealii::Tensor<2, dim, dealii::VectorizedArray<value_type>> invJ =
         fe_eval.inverse_jacobian(q);
       invJ                                                              = transpose(invJ);
@@ -271,6 +273,59 @@ calculate_time_step_cfl_local(
   return new_time_step;
 }
 
+/*
+ * Assigns the cells to time step levels for local time stepping. Assuming that the admissible time
+ * step size of a cell scales with its minimum vertex distance h (CFL condition with constant speed
+ * of propagation), a cell is assigned to the level
+ *
+ *    l = min(floor(log2(h / h_min)), max_n_levels - 1) ,
+ *
+ * where h_min is the global minimum, i.e., the cell can be advanced with the time step size
+ * 2^l * dt with dt the time step size admissible for the smallest cell. The levels are computed
+ * for all locally owned and ghost cells (indexed by active_cell_index()). The number of levels
+ * (maximum over all processors) is returned.
+ */
+template<int dim>
+inline unsigned int
+calculate_time_step_levels(std::vector<unsigned int> &        levels,
+                           dealii::Triangulation<dim> const & triangulation,
+                           unsigned int const                 max_n_levels,
+                           MPI_Comm const &                   mpi_comm)
+{
+  AssertThrow(max_n_levels > 0, dealii::ExcMessage("At least one time step level is needed."));
+
+  double h_min = std::numeric_limits<double>::max();
+  for(auto const & cell : triangulation.active_cell_iterators())
+  {
+    if(cell->is_locally_owned())
+      h_min = std::min(h_min, cell->minimum_vertex_distance());
+  }
+  h_min = dealii::Utilities::MPI::min(h_min, mpi_comm);
+
+  levels.assign(triangulation.n_active_cells(), 0);
+
+  unsigned int max_level = 0;
+  for(auto const & cell : triangulation.active_cell_iterators())
+  {
+    if(not(cell->is_artificial()))
+    {
+      // add a small tolerance to make the levels robust w.r.t. round-off errors
+      double const log_ratio =
+        std::floor(std::log2(cell->minimum_vertex_distance() / h_min) + 1.e-12);
+
+      unsigned int const level =
+        log_ratio > 0.0 ? std::min((unsigned int)log_ratio, max_n_levels - 1) : 0;
+
+      levels[cell->active_cell_index()] = level;
+
+      if(cell->is_locally_owned())
+        max_level = std::max(max_level, level);
+    }
+  }
+
+  return dealii::Utilities::MPI::max(max_level, mpi_comm) + 1;
+}
+
 /*
  * this function computes the actual CFL number in each cell given a global time step size
  * (that holds for all cells)
@@ -218,6 +218,35 @@ public:
     }
   }
 
+  // dst = scaling_factor * (M^-1 * src) for the given cell batches only, i.e., the remaining
+  // entries of dst are not touched
+  void
+  apply_scale(VectorType &                      dst,
+              double const                      scaling_factor,
+              VectorType const &                src,
+              std::vector<unsigned int> const & cell_batches) const
+  {
+    AssertThrow(data.implementation_type == InverseMassType::MatrixfreeOperator,
+                dealii::ExcMessage("The inverse mass operator for a subset of cells is only "
+                                   "implemented for InverseMassType::MatrixfreeOperator."));
+
+    Integrator                      integrator(*matrix_free, dof_index, quad_index);
+    InverseMassAsMatrixFreeOperator inverse_mass(integrator);
+
+    for(unsigned int const cell : cell_batches)
+    {
+      integrator.reinit(cell);
+      integrator.read_dof_values(src, 0);
+
+      inverse_mass.apply(integrator.begin_dof_values(), integrator.begin_dof_values());
+
+      for(unsigned int i = 0; i < integrator.dofs_per_cell; ++i)
+        integrator.begin_dof_values()[i] *= static_cast<Number>(scaling_factor);
+
+      integrator.set_dof_values(dst, 0);
+    }
+  }
+
 
 private:
   void
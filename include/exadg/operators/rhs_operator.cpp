@@ -60,6 +60,20 @@ RHSOperator<dim, Number, n_components>::evaluate_add(VectorType & dst,
   matrix_free->cell_loop(&This::cell_loop, this, dst, src);
 }
 
+template<int dim, typename Number, int n_components>
+void
+RHSOperator<dim, Number, n_components>::evaluate_add(
+  VectorType &                      dst,
+  double const                      evaluation_time,
+  std::vector<unsigned int> const & cell_batches) const
+{
+  this->time = evaluation_time;
+
+  VectorType src;
+  for(unsigned int const cell : cell_batches)
+    cell_loop(*matrix_free, dst, src, Range(cell, cell + 1));
+}
+
 template<int dim, typename Number, int n_components>
 void
 RHSOperator<dim, Number, n_components>::do_cell_integral(IntegratorCell & integrator) const
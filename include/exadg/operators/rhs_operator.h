@@ -53,6 +53,8 @@ public:
   reinit(RHSKernelData<dim> const & data_in) const
   {
     data = data_in;
+
+    f_vectorized = get_vectorized_function(data.f.get());
   }
 
   static MappingFlags
@@ -79,11 +81,14 @@ public:
   {
     dealii::Point<dim, scalar> q_points = integrator.quadrature_point(q);
 
-    return FunctionEvaluator<rank, dim, Number>::value(*(data.f), q_points, time);
+    return FunctionEvaluator<rank, dim, Number>::value(*(data.f), f_vectorized, q_points, time);
   }
 
 private:
   mutable RHSKernelData<dim> data;
+
+  // vectorized interface of data.f (nullptr if not available)
+  mutable VectorizedFunction<dim> const * f_vectorized = nullptr;
 };
 
 } // namespace Operators
@@ -139,6 +144,14 @@ public:
   void
   evaluate_add(VectorType & dst, double const evaluation_time) const;
 
+  /*
+   * Evaluate operator and add to dst-vector for the given cell batches only.
+   */
+  void
+  evaluate_add(VectorType &                      dst,
+               double const                      evaluation_time,
+               std::vector<unsigned int> const & cell_batches) const;
+
 private:
   void
   do_cell_integral(IntegratorCell & integrator) const;
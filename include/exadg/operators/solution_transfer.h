@@ -22,22 +22,35 @@
 #ifndef INCLUDE_EXADG_OPERATORS_SOLUTION_TRANSFER_H
 #define INCLUDE_EXADG_OPERATORS_SOLUTION_TRANSFER_H
 
+// C/C++
+#include <map>
+
 // deal.II
+#include <deal.II/distributed/fully_distributed_tria.h>
 #include <deal.II/distributed/solution_transfer.h>
 #include <deal.II/distributed/tria.h>
 #include <deal.II/grid/tria.h>
+#include <deal.II/lac/vector.h>
 #include <deal.II/numerics/solution_transfer.h>
 
+// ExaDG
+#include <exadg/grid/fully_distributed_refinement.h>
+
 namespace ExaDG
 {
 template<int dim, typename VectorType>
 class SolutionTransfer
 {
 public:
+  typedef GridUtilities::FullyDistributedRefinement<dim> FullyDistributedRefinement;
+
   /*
-   * Constructor.
+   * Constructor. The argument refinement_in is only needed in case of a
+   * dealii::parallel::fullydistributed::Triangulation and may be empty otherwise.
    */
-  SolutionTransfer(dealii::DoFHandler<dim> const & dof_handler_in)
+  SolutionTransfer(dealii::DoFHandler<dim> const &                           dof_handler_in,
+                   std::shared_ptr<FullyDistributedRefinement const> const & refinement_in)
+    : fully_distributed_refinement(refinement_in)
   {
     dof_handler = &dof_handler_in;
   }
@@ -45,6 +58,12 @@ public:
   void
   prepare_coarsening_and_refinement(std::vector<VectorType *> & vectors)
   {
+    if(is_fully_distributed_triangulation())
+    {
+      send_cell_data(vectors);
+      return;
+    }
+
     // Container vectors_old_grid hold vectors for interpolation *REQUIRED* for
     // interpolate_after_coarsening_and_refinement(). Thus makes an actual copy.
     // In the case of parallel::distributed::Triangulation, pointers are sufficient.
@@ -90,6 +109,12 @@ public:
   void
   interpolate_after_coarsening_and_refinement(std::vector<VectorType *> & vectors)
   {
+    if(is_fully_distributed_triangulation())
+    {
+      interpolate_received_cell_data(vectors);
+      return;
+    }
+
     // Note that the sequence of vectors per DofHandler/SolutionTransfer
     // defined in Operator<dim, Number>::prepare_coarsening_and_refinement()
     // and solution transfer calls here *need to match*.
@@ -127,6 +152,21 @@ public:
   }
 
 private:
+  typedef typename FullyDistributedRefinement::CellIdBinary CellIdBinary;
+  typedef typename FullyDistributedRefinement::TransferType TransferType;
+
+  /*
+   * Data of an old cell received for a new cell in case of a fully-distributed triangulation.
+   */
+  struct ReceivedCellData
+  {
+    TransferType type;
+    unsigned int child_index;
+
+    // dof values of all vectors, stored consecutively
+    std::vector<double> values;
+  };
+
   bool
   is_parallel_distributed_triangulation() const
   {
@@ -134,6 +174,147 @@ private:
       &dof_handler->get_triangulation()));
   }
 
+  bool
+  is_fully_distributed_triangulation() const
+  {
+    return (dynamic_cast<dealii::parallel::fullydistributed::Triangulation<dim> const *>(
+      &dof_handler->get_triangulation()));
+  }
+
+  /*
+   * In case of a fully-distributed triangulation, the dof values of the locally owned cells are
+   * sent to the owners of the corresponding cells of the new triangulation as determined by
+   * FullyDistributedRefinement. This is done before the new triangulation is created. Only
+   * discontinuous finite elements are supported, i.e., all dofs are cell-local.
+   */
+  void
+  send_cell_data(std::vector<VectorType *> const & vectors)
+  {
+    AssertThrow(fully_distributed_refinement.get(),
+                dealii::ExcMessage("Adaptive mesh refinement with TriangulationType::"
+                                   "FullyDistributed requires keep_serial_triangulation."));
+
+    dealii::FiniteElement<dim> const & fe = dof_handler->get_fe();
+
+    AssertThrow(fe.n_dofs_per_face() == 0,
+                dealii::ExcMessage("Solution transfer for TriangulationType::FullyDistributed is "
+                                   "only implemented for discontinuous finite elements."));
+
+    std::map<CellIdBinary, typename dealii::DoFHandler<dim>::active_cell_iterator> cells;
+    for(auto const & cell : dof_handler->active_cell_iterators())
+    {
+      if(cell->is_locally_owned())
+        cells[cell->id().template to_binary<dim>()] = cell;
+    }
+
+    for(auto const & vector : vectors)
+      vector->update_ghost_values();
+
+    // message per cell: new cell id, transfer type, child index, dof values of all vectors
+    std::map<unsigned int, std::vector<double>> send_data;
+    dealii::Vector<double>                      cell_values(fe.n_dofs_per_cell());
+    for(auto const & transfer : fully_distributed_refinement->get_cell_transfers())
+    {
+      auto const & cell = cells.at(transfer.old_cell);
+
+      std::vector<double> & buffer = send_data[transfer.new_owner];
+      buffer.insert(buffer.end(), transfer.new_cell.begin(), transfer.new_cell.end());
+      buffer.push_back(static_cast<unsigned int>(transfer.type));
+      buffer.push_back(transfer.child_index);
+
+      for(auto const & vector : vectors)
+      {
+        cell->get_dof_values(*vector, cell_values);
+        buffer.insert(buffer.end(), cell_values.begin(), cell_values.end());
+      }
+    }
+
+    std::map<unsigned int, std::vector<double>> const received_data =
+      dealii::Utilities::MPI::some_to_some(dof_handler->get_communicator(), send_data);
+
+    unsigned int const n_values = vectors.size() * fe.n_dofs_per_cell();
+
+    received_cell_data.clear();
+    for(auto const & [process, buffer] : received_data)
+    {
+      (void)process;
+      for(unsigned int i = 0; i < buffer.size(); i += 6 + n_values)
+      {
+        CellIdBinary new_cell;
+        for(unsigned int j = 0; j < new_cell.size(); ++j)
+          new_cell[j] = static_cast<unsigned int>(buffer[i + j]);
+
+        ReceivedCellData data;
+        data.type        = static_cast<TransferType>(static_cast<unsigned int>(buffer[i + 4]));
+        data.child_index = static_cast<unsigned int>(buffer[i + 5]);
+        data.values.assign(buffer.begin() + i + 6, buffer.begin() + i + 6 + n_values);
+
+        received_cell_data[new_cell].push_back(data);
+      }
+    }
+  }
+
+  /*
+   * Fills the vectors on the new fully-distributed triangulation with the received data, where
+   * the dof values are prolongated to the children in case of refinement and restricted to the
+   * parent in case of coarsening.
+   */
+  void
+  interpolate_received_cell_data(std::vector<VectorType *> & vectors)
+  {
+    dealii::FiniteElement<dim> const & fe = dof_handler->get_fe();
+
+    unsigned int const dofs_per_cell = fe.n_dofs_per_cell();
+
+    dealii::Vector<double> cell_values(dofs_per_cell), old_values(dofs_per_cell),
+      restricted_values(dofs_per_cell);
+
+    for(auto const & cell : dof_handler->active_cell_iterators())
+    {
+      if(not cell->is_locally_owned())
+        continue;
+
+      std::vector<ReceivedCellData> const & cell_data =
+        received_cell_data.at(cell->id().template to_binary<dim>());
+
+      for(unsigned int v = 0; v < vectors.size(); ++v)
+      {
+        cell_values = 0.0;
+        for(auto const & data : cell_data)
+        {
+          std::copy(data.values.begin() + v * dofs_per_cell,
+                    data.values.begin() + (v + 1) * dofs_per_cell,
+                    old_values.begin());
+
+          if(data.type == TransferType::Keep)
+          {
+            cell_values = old_values;
+          }
+          else if(data.type == TransferType::Refine)
+          {
+            fe.get_prolongation_matrix(data.child_index).vmult(cell_values, old_values);
+          }
+          else if(data.type == TransferType::Coarsen)
+          {
+            // same as dealii::DoFCellAccessor::get_interpolated_dof_values()
+            fe.get_restriction_matrix(data.child_index).vmult(restricted_values, old_values);
+            for(unsigned int i = 0; i < dofs_per_cell; ++i)
+            {
+              if(fe.restriction_is_additive(i))
+                cell_values(i) += restricted_values(i);
+              else if(restricted_values(i) != 0.0)
+                cell_values(i) = restricted_values(i);
+            }
+          }
+        }
+
+        cell->set_dof_values(cell_values, *vectors[v]);
+      }
+    }
+
+    received_cell_data.clear();
+  }
+
   std::vector<VectorType> vectors_old_grid;
 
   std::shared_ptr<dealii::SolutionTransfer<dim, VectorType>> solution_transfer;
@@ -141,6 +322,10 @@ private:
     pd_solution_transfer;
 
   dealii::SmartPointer<dealii::DoFHandler<dim> const> dof_handler;
+
+  std::shared_ptr<FullyDistributedRefinement const> fully_distributed_refinement;
+
+  std::map<CellIdBinary, std::vector<ReceivedCellData>> received_cell_data;
 };
 } // namespace ExaDG
 
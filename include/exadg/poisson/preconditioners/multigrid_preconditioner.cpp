@@ -72,17 +72,16 @@ MultigridPreconditioner<dim, Number, n_components>::update()
   // if the mesh is moving
   if(mesh_is_moving)
   {
-    this->initialize_mapping();
-
-    this->update_matrix_free_objects();
-
-    this->for_all_levels(
+    bool const all_levels_updated = this->update_after_grid_motion(
       [&](unsigned int const level) { get_operator(level)->update_penalty_parameter(); });
 
     // Once the operators are updated, the update of smoothers and the coarse grid solver is generic
-    // functionality implemented in the base class.
-    this->update_smoothers();
-    this->update_coarse_solver();
+    // functionality implemented in the base class. The operators on coarser h-levels only depend on
+    // the grid, so that the smoothers and the coarse grid solver (e.g. an AMG preconditioner) on
+    // these levels are kept if these levels have not been updated.
+    this->update_smoothers(not(all_levels_updated) /* fine_h_level_only */);
+    if(all_levels_updated)
+      this->update_coarse_solver();
   }
 
   this->update_needed = false;
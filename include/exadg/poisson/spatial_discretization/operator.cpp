@@ -217,6 +217,29 @@ Operator<dim, n_components, Number>::setup_coupling_boundary_conditions()
   }
 }
 
+template<int dim, int n_components, typename Number>
+void
+Operator<dim, n_components, Number>::initialize_precomputed_bc()
+{
+  // resolve the vectorized interface of the boundary functions
+  boundary_descriptor->set_vectorized_functions();
+
+  // tabulate time-independent or separable boundary conditions in the boundary quadrature points
+  if(not(boundary_descriptor->precomputed_bc.empty()))
+  {
+    std::vector<unsigned int> quad_indices;
+    quad_indices.emplace_back(get_quad_index());
+
+    precomputed_data = std::make_shared<PrecomputedBoundaryData<dim>>();
+    precomputed_data->setup(*matrix_free,
+                            get_dof_index(),
+                            quad_indices,
+                            boundary_descriptor->get_precomputed_functions());
+
+    boundary_descriptor->set_precomputed_data(precomputed_data);
+  }
+}
+
 template<int dim, int n_components, typename Number>
 void
 Operator<dim, n_components, Number>::setup_operators()
@@ -292,6 +315,8 @@ Operator<dim, n_components, Number>::setup(
 
   setup_coupling_boundary_conditions();
 
+  initialize_precomputed_bc();
+
   setup_operators();
 
   setup_preconditioner_and_solver();
@@ -385,6 +410,7 @@ Operator<dim, n_components, Number>::setup_preconditioner_and_solver()
     solver_data.solver_tolerance_abs        = param.solver_data.abs_tol;
     solver_data.solver_tolerance_rel        = param.solver_data.rel_tol;
     solver_data.max_iter                    = param.solver_data.max_iter;
+    solver_data.n_recycle_vectors           = param.solver_data.n_recycle_vectors;
     solver_data.compute_performance_metrics = param.compute_performance_metrics;
 
     if(param.preconditioner != Poisson::Preconditioner::None)
@@ -402,6 +428,7 @@ Operator<dim, n_components, Number>::setup_preconditioner_and_solver()
     solver_data.solver_tolerance_abs        = param.solver_data.abs_tol;
     solver_data.solver_tolerance_rel        = param.solver_data.rel_tol;
     solver_data.max_iter                    = param.solver_data.max_iter;
+    solver_data.n_recycle_vectors           = param.solver_data.n_recycle_vectors;
     solver_data.max_n_tmp_vectors           = param.solver_data.max_krylov_size;
     solver_data.compute_performance_metrics = param.compute_performance_metrics;
 
@@ -159,6 +159,9 @@ private:
   void
   setup_coupling_boundary_conditions();
 
+  void
+  initialize_precomputed_bc();
+
   void
   setup_operators();
 
@@ -228,6 +231,11 @@ private:
   mutable std::shared_ptr<ContainerInterfaceData<rank, dim, double>>
     interface_data_dirichlet_cached;
 
+  /*
+   * Precomputed boundary data
+   */
+  std::shared_ptr<PrecomputedBoundaryData<dim>> precomputed_data;
+
   RHSOperator<dim, Number, n_components> rhs_operator;
 
   Laplace laplace_operator;
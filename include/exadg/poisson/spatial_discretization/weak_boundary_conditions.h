@@ -91,10 +91,10 @@ inline DEAL_II_ALWAYS_INLINE //
 
       if(boundary_type == BoundaryType::Dirichlet)
       {
-        auto bc       = boundary_descriptor->dirichlet_bc.find(boundary_id)->second;
-        auto q_points = integrator.quadrature_point(q);
+        auto bc = boundary_descriptor->dirichlet_bc.find(boundary_id)->second;
 
-        g = FunctionEvaluator<rank, dim, Number>::value(*bc, q_points, time);
+        g = evaluate_boundary_function<rank, dim, Number>(
+          *bc, *boundary_descriptor, boundary_id, integrator, q, time);
       }
       else if(boundary_type == BoundaryType::DirichletCached)
       {
@@ -207,10 +207,10 @@ inline DEAL_II_ALWAYS_INLINE //
   {
     if(operator_type == OperatorType::full or operator_type == OperatorType::inhomogeneous)
     {
-      auto bc       = boundary_descriptor->neumann_bc.find(boundary_id)->second;
-      auto q_points = integrator.quadrature_point(q);
+      auto bc = boundary_descriptor->neumann_bc.find(boundary_id)->second;
 
-      auto h = FunctionEvaluator<rank, dim, Number>::value(*bc, q_points, time);
+      auto h = evaluate_boundary_function<rank, dim, Number>(
+        *bc, *boundary_descriptor, boundary_id, integrator, q, time);
 
       normal_gradient_p =
         -normal_gradient_m + dealii::Tensor<rank, dim, dealii::VectorizedArray<Number>>(2.0 * h);
@@ -250,10 +250,10 @@ inline DEAL_II_ALWAYS_INLINE //
 
   if(boundary_type == BoundaryType::Neumann)
   {
-    auto bc       = boundary_descriptor->neumann_bc.find(boundary_id)->second;
-    auto q_points = integrator.quadrature_point(q);
+    auto bc = boundary_descriptor->neumann_bc.find(boundary_id)->second;
 
-    normal_gradient = FunctionEvaluator<rank, dim, Number>::value(*bc, q_points, time);
+    normal_gradient = evaluate_boundary_function<rank, dim, Number>(
+      *bc, *boundary_descriptor, boundary_id, integrator, q, time);
   }
   else
   {
@@ -20,13 +20,17 @@
  */
 
 // C/C++
-#include <fstream>
+#include <array>
+#include <iomanip>
+#include <sstream>
 
 // deal.II
 #include <deal.II/numerics/vector_tools.h>
 
 // ExaDG
+#include <exadg/functions_and_boundary_conditions/vectorized_function.h>
 #include <exadg/grid/grid_data.h>
+#include <exadg/matrix_free/integrators.h>
 #include <exadg/operators/quadrature.h>
 #include <exadg/postprocessor/error_calculation.h>
 #include <exadg/utilities/create_directories.h>
@@ -112,9 +116,322 @@ calculate_error(MPI_Comm const &                               mpi_comm,
   return error;
 }
 
+/*
+ * Evaluates the first values.size() components of a function in the points of all SIMD lanes of
+ * a cell batch. The vectorized interface of VectorizedFunction is used if available
+ * (vectorized_function != nullptr), otherwise the function is evaluated point by point for the
+ * filled lanes.
+ */
+template<int dim, typename Number>
+void
+evaluate_function_on_cell_batch(
+  dealii::Function<dim> const &                               function,
+  VectorizedFunction<dim> const *                             vectorized_function,
+  dealii::Point<dim, dealii::VectorizedArray<Number>> const & points,
+  unsigned int const                                          n_filled_lanes,
+  dealii::ArrayView<dealii::VectorizedArray<Number>> const &  values)
+{
+  if(vectorized_function != nullptr)
+  {
+    vectorized_function->vectorized_value(points, values);
+    return;
+  }
+
+  for(unsigned int v = 0; v < n_filled_lanes; ++v)
+  {
+    dealii::Point<dim> point;
+    for(unsigned int d = 0; d < dim; ++d)
+      point[d] = points[d][v];
+
+    for(unsigned int c = 0; c < values.size(); ++c)
+      values[c][v] = function.value(point, c);
+  }
+}
+
+/*
+ * Computes the squared (weighted) error of each component on the locally owned cells, using the
+ * quadrature rule and mapping data of the MatrixFree object. The last entry contains the squared
+ * norm of the analytical solution. The values of the analytical solution (and the weight) are
+ * computed via the vectorized interface of VectorizedFunction for all SIMD lanes at once, see
+ * evaluate_function_on_cell_batch(). Gradients are evaluated by one call to
+ * Function::vector_gradient_list() for all quadrature points of all filled SIMD lanes.
+ */
+template<int dim, int n_components, typename Number>
+std::vector<double>
+calculate_squared_errors_matrix_free(
+  dealii::MatrixFree<dim, Number> const &                    matrix_free,
+  unsigned int const                                         dof_index,
+  unsigned int const                                         quad_index,
+  dealii::LinearAlgebra::distributed::Vector<Number> const & numerical_solution,
+  dealii::Function<dim> const &                              analytical_solution,
+  dealii::VectorTools::NormType const &                      norm_type,
+  dealii::Function<dim> const *                              weight)
+{
+  AssertThrow(norm_type == dealii::VectorTools::L2_norm or
+                norm_type == dealii::VectorTools::H1_seminorm,
+              dealii::ExcMessage("Norm type is not implemented for matrix-free error evaluation."));
+
+  AssertThrow(analytical_solution.n_components == n_components,
+              dealii::ExcMessage("Number of components of analytical solution and finite element "
+                                 "do not match."));
+
+  if(weight != nullptr)
+  {
+    AssertThrow(weight->n_components == 1 or weight->n_components == n_components,
+                dealii::ExcMessage("Weight has to be scalar or has to have as many components as "
+                                   "the finite element."));
+  }
+
+  typedef dealii::VectorizedArray<Number> scalar;
+
+  bool const L2 = (norm_type == dealii::VectorTools::L2_norm);
+
+  // resolve the vectorized interface of the functions once
+  VectorizedFunction<dim> const * const vectorized_solution =
+    dynamic_cast<VectorizedFunction<dim> const *>(&analytical_solution);
+  VectorizedFunction<dim> const * const vectorized_weight =
+    dynamic_cast<VectorizedFunction<dim> const *>(weight);
+
+  CellIntegrator<dim, n_components, Number> integrator(matrix_free, dof_index, quad_index);
+
+  unsigned int const n_q_points = integrator.n_q_points;
+
+  std::vector<dealii::Point<dim>>                  points;
+  std::vector<std::vector<dealii::Tensor<1, dim>>> gradients;
+
+  std::array<scalar, n_components>                         u_h, values;
+  std::array<dealii::Tensor<1, dim, scalar>, n_components> grad_u_h;
+
+  std::vector<scalar> weights(weight != nullptr ? weight->n_components : 0);
+
+  std::vector<double> squared_errors(n_components + 1, 0.0);
+
+  for(unsigned int cell = 0; cell < matrix_free.n_cell_batches(); ++cell)
+  {
+    unsigned int const n_filled_lanes = matrix_free.n_active_entries_per_cell_batch(cell);
+    unsigned int const n_points       = n_q_points * n_filled_lanes;
+
+    integrator.reinit(cell);
+    integrator.read_dof_values_plain(numerical_solution);
+    integrator.evaluate(L2 ? dealii::EvaluationFlags::values : dealii::EvaluationFlags::gradients);
+
+    // evaluate the gradient of the analytical solution for all points of the cell batch at once
+    if(not L2)
+    {
+      points.resize(n_points);
+      for(unsigned int q = 0; q < n_q_points; ++q)
+      {
+        dealii::Point<dim, scalar> const point = integrator.quadrature_point(q);
+        for(unsigned int v = 0; v < n_filled_lanes; ++v)
+          for(unsigned int d = 0; d < dim; ++d)
+            points[q * n_filled_lanes + v][d] = point[d][v];
+      }
+
+      gradients.resize(n_points, std::vector<dealii::Tensor<1, dim>>(n_components));
+      analytical_solution.vector_gradient_list(points, gradients);
+    }
+
+    for(unsigned int q = 0; q < n_q_points; ++q)
+    {
+      if constexpr(n_components == 1)
+      {
+        if(L2)
+          u_h[0] = integrator.get_value(q);
+        else
+          grad_u_h[0] = integrator.get_gradient(q);
+      }
+      else
+      {
+        if(L2)
+        {
+          auto const value = integrator.get_value(q);
+          for(unsigned int c = 0; c < n_components; ++c)
+            u_h[c] = value[c];
+        }
+        else
+        {
+          auto const gradient = integrator.get_gradient(q);
+          for(unsigned int c = 0; c < n_components; ++c)
+            grad_u_h[c] = gradient[c];
+        }
+      }
+
+      dealii::Point<dim, scalar> const point = integrator.quadrature_point(q);
+
+      if(L2)
+        evaluate_function_on_cell_batch<dim, Number>(analytical_solution,
+                                                     vectorized_solution,
+                                                     point,
+                                                     n_filled_lanes,
+                                                     dealii::ArrayView<scalar>(values.data(),
+                                                                               values.size()));
+
+      if(weight != nullptr)
+        evaluate_function_on_cell_batch<dim, Number>(*weight,
+                                                     vectorized_weight,
+                                                     point,
+                                                     n_filled_lanes,
+                                                     dealii::ArrayView<scalar>(weights.data(),
+                                                                               weights.size()));
+
+      scalar const JxW = integrator.JxW(q);
+
+      for(unsigned int v = 0; v < n_filled_lanes; ++v)
+      {
+        for(unsigned int c = 0; c < n_components; ++c)
+        {
+          double w = JxW[v];
+          if(weight != nullptr)
+            w *= weights[weight->n_components == 1 ? 0 : c][v];
+
+          if(L2)
+          {
+            double const exact = values[c][v];
+            double const diff  = u_h[c][v] - exact;
+
+            squared_errors[c] += w * diff * diff;
+            squared_errors[n_components] += w * exact * exact;
+          }
+          else
+          {
+            unsigned int const p = q * n_filled_lanes + v;
+
+            for(unsigned int d = 0; d < dim; ++d)
+            {
+              double const exact = gradients[p][c][d];
+              double const diff  = grad_u_h[c][d][v] - exact;
+
+              squared_errors[c] += w * diff * diff;
+              squared_errors[n_components] += w * exact * exact;
+            }
+          }
+        }
+      }
+    }
+  }
+
+  return squared_errors;
+}
+
+/*
+ * Matrix-free counterpart of calculate_error(). Returns the error of the whole field followed by
+ * the errors of the individual components.
+ */
+template<int dim, typename Number>
+std::vector<double>
+calculate_error_matrix_free(
+  MPI_Comm const &                                           mpi_comm,
+  bool const                                                 relative_error,
+  dealii::MatrixFree<dim, Number> const &                    matrix_free,
+  unsigned int const                                         dof_index,
+  unsigned int const                                         quad_index,
+  dealii::LinearAlgebra::distributed::Vector<Number> const & numerical_solution,
+  std::shared_ptr<dealii::Function<dim>> const               analytical_solution,
+  double const                                               time,
+  dealii::VectorTools::NormType const &                      norm_type,
+  bool const                                                 spatially_weight_error,
+  std::shared_ptr<dealii::Function<dim>> const &             weight)
+{
+  if(spatially_weight_error == true)
+    AssertThrow(weight != nullptr,
+                dealii::ExcMessage("No spatial weight provided for error computation."));
+
+  analytical_solution->set_time(time);
+
+  // the solution vector might not have ghost values set
+  bool const has_ghost_elements = numerical_solution.has_ghost_elements();
+  if(not has_ghost_elements)
+    numerical_solution.update_ghost_values();
+
+  dealii::Function<dim> const * weight_ptr = spatially_weight_error ? weight.get() : nullptr;
+
+  unsigned int const n_components = matrix_free.get_dof_handler(dof_index).get_fe().n_components();
+
+  std::vector<double> squared_errors;
+  if(n_components == 1)
+    squared_errors = calculate_squared_errors_matrix_free<dim, 1, Number>(matrix_free,
+                                                                          dof_index,
+                                                                          quad_index,
+                                                                          numerical_solution,
+                                                                          *analytical_solution,
+                                                                          norm_type,
+                                                                          weight_ptr);
+  else if(n_components == 2)
+    squared_errors = calculate_squared_errors_matrix_free<dim, 2, Number>(matrix_free,
+                                                                          dof_index,
+                                                                          quad_index,
+                                                                          numerical_solution,
+                                                                          *analytical_solution,
+                                                                          norm_type,
+                                                                          weight_ptr);
+  else if(n_components == 3)
+    squared_errors = calculate_squared_errors_matrix_free<dim, 3, Number>(matrix_free,
+                                                                          dof_index,
+                                                                          quad_index,
+                                                                          numerical_solution,
+                                                                          *analytical_solution,
+                                                                          norm_type,
+                                                                          weight_ptr);
+  else if(n_components == 4)
+    squared_errors = calculate_squared_errors_matrix_free<dim, 4, Number>(matrix_free,
+                                                                          dof_index,
+                                                                          quad_index,
+                                                                          numerical_solution,
+                                                                          *analytical_solution,
+                                                                          norm_type,
+                                                                          weight_ptr);
+  else if(n_components == 5)
+    squared_errors = calculate_squared_errors_matrix_free<dim, 5, Number>(matrix_free,
+                                                                          dof_index,
+                                                                          quad_index,
+                                                                          numerical_solution,
+                                                                          *analytical_solution,
+                                                                          norm_type,
+                                                                          weight_ptr);
+  else
+    AssertThrow(false, dealii::ExcMessage("Number of components is not implemented."));
+
+  if(not has_ghost_elements)
+    numerical_solution.zero_out_ghost_values();
+
+  dealii::Utilities::MPI::sum(dealii::ArrayView<double const>(squared_errors.data(),
+                                                              squared_errors.size()),
+                              mpi_comm,
+                              dealii::ArrayView<double>(squared_errors.data(),
+                                                        squared_errors.size()));
+
+  double normalization = 1.0;
+  if(relative_error == true)
+  {
+    double const solution_norm = std::sqrt(squared_errors[n_components]);
+
+    AssertThrow(solution_norm > 1.e-15,
+                dealii::ExcMessage(
+                  "Cannot compute relative error since norm of solution tends to zero."));
+
+    normalization = 1.0 / solution_norm;
+  }
+
+  std::vector<double> errors(n_components + 1, 0.0);
+  for(unsigned int c = 0; c < n_components; ++c)
+  {
+    errors[0] += squared_errors[c];
+    errors[c + 1] = std::sqrt(squared_errors[c]) * normalization;
+  }
+  errors[0] = std::sqrt(errors[0]) * normalization;
+
+  return errors;
+}
+
 template<int dim, typename Number>
 ErrorCalculator<dim, Number>::ErrorCalculator(MPI_Comm const & comm)
-  : mpi_comm(comm), clear_files_L2(true), clear_files_H1_seminorm(true)
+  : mpi_comm(comm),
+    clear_files_L2(true),
+    clear_files_H1_seminorm(true),
+    writer_L2(comm),
+    writer_H1_seminorm(comm),
+    dof_index(0),
+    quad_index(0)
 {
 }
 
@@ -130,8 +447,46 @@ ErrorCalculator<dim, Number>::setup(dealii::DoFHandler<dim> const &   dof_handle
 
   time_control.setup(error_data_in.time_control_data);
 
+  AssertThrow(not error_data.use_matrix_free_evaluation or matrix_free,
+              dealii::ExcMessage("Matrix-free error evaluation requires the MatrixFree object to "
+                                 "be passed to ErrorCalculator::setup()."));
+
+  AssertThrow(not error_data.calculate_componentwise_errors or
+                error_data.use_matrix_free_evaluation,
+              dealii::ExcMessage("Componentwise errors require matrix-free error evaluation."));
+
   if(error_data.analytical_solution and error_data.write_errors_to_file)
+  {
     create_directories(error_data.directory, mpi_comm);
+
+    writer_L2.setup(error_data.directory + error_data.name + "_L2", error_data.time_series_data);
+
+    if(error_data.calculate_H1_seminorm_error)
+    {
+      writer_H1_seminorm.setup(error_data.directory + error_data.name + "_H1_seminorm",
+                               error_data.time_series_data);
+    }
+  }
+}
+
+template<int dim, typename Number>
+void
+ErrorCalculator<dim, Number>::setup(dealii::DoFHandler<dim> const &         dof_handler_in,
+                                    dealii::Mapping<dim> const &            mapping_in,
+                                    dealii::MatrixFree<dim, Number> const & matrix_free_in,
+                                    unsigned int const                      dof_index_in,
+                                    unsigned int const                      quad_index_in,
+                                    ErrorCalculationData<dim> const &       error_data_in)
+{
+  matrix_free = &matrix_free_in;
+  dof_index   = dof_index_in;
+  quad_index  = quad_index_in;
+
+  AssertThrow(&matrix_free->get_dof_handler(dof_index) == &dof_handler_in,
+              dealii::ExcMessage("DoFHandler of MatrixFree object and DoFHandler passed to "
+                                 "ErrorCalculator::setup() differ."));
+
+  setup(dof_handler_in, mapping_in, error_data_in);
 }
 
 template<int dim, typename Number>
@@ -166,97 +521,104 @@ template<int dim, typename Number>
 void
 ErrorCalculator<dim, Number>::do_evaluate(VectorType const & solution_vector, double const time)
 {
-  bool relative = error_data.calculate_relative_errors;
-
-  double const error = calculate_error<dim>(mpi_comm,
-                                            relative,
-                                            *dof_handler,
-                                            *mapping,
-                                            solution_vector,
-                                            error_data.analytical_solution,
-                                            time,
-                                            dealii::VectorTools::L2_norm,
-                                            error_data.spatially_weight_error,
-                                            error_data.weight);
+  std::vector<double> const errors_L2 =
+    calculate_errors(solution_vector, time, dealii::VectorTools::L2_norm);
 
-  dealii::ConditionalOStream pcout(std::cout,
-                                   dealii::Utilities::MPI::this_mpi_process(mpi_comm) == 0);
-  pcout << ((relative == true) ? "  Relative " : "  Absolute ")
-        << "error (L2-norm): " << std::scientific << std::setprecision(5) << error << std::endl;
+  write_errors(writer_L2, clear_files_L2, "L2-norm", errors_L2, time);
 
-  if(error_data.write_errors_to_file)
+  // H1-seminorm
+  if(error_data.calculate_H1_seminorm_error)
   {
-    // write output file
-    if(dealii::Utilities::MPI::this_mpi_process(mpi_comm) == 0)
-    {
-      std::string filename = error_data.directory + error_data.name + "_L2";
+    std::vector<double> const errors_H1_seminorm =
+      calculate_errors(solution_vector, time, dealii::VectorTools::H1_seminorm);
 
-      std::ofstream f;
-      if(clear_files_L2 == true)
-      {
-        f.open(filename.c_str(), std::ios::trunc);
+    write_errors(
+      writer_H1_seminorm, clear_files_H1_seminorm, "H1-seminorm", errors_H1_seminorm, time);
+  }
+}
 
-        f << "  Time                Error" << std::endl;
+template<int dim, typename Number>
+std::vector<double>
+ErrorCalculator<dim, Number>::calculate_errors(
+  VectorType const &                    solution_vector,
+  double const                          time,
+  dealii::VectorTools::NormType const & norm_type) const
+{
+  if(error_data.use_matrix_free_evaluation)
+  {
+    std::vector<double> errors =
+      calculate_error_matrix_free<dim, Number>(mpi_comm,
+                                               error_data.calculate_relative_errors,
+                                               *matrix_free,
+                                               dof_index,
+                                               quad_index,
+                                               solution_vector,
+                                               error_data.analytical_solution,
+                                               time,
+                                               norm_type,
+                                               error_data.spatially_weight_error,
+                                               error_data.weight);
+
+    if(not error_data.calculate_componentwise_errors)
+      errors.resize(1);
+
+    return errors;
+  }
+  else
+  {
+    return {calculate_error<dim>(mpi_comm,
+                                 error_data.calculate_relative_errors,
+                                 *dof_handler,
+                                 *mapping,
+                                 solution_vector,
+                                 error_data.analytical_solution,
+                                 time,
+                                 norm_type,
+                                 error_data.spatially_weight_error,
+                                 error_data.weight)};
+  }
+}
 
-        clear_files_L2 = false;
-      }
-      else
-      {
-        f.open(filename.c_str(), std::ios::app);
-      }
+template<int dim, typename Number>
+void
+ErrorCalculator<dim, Number>::write_errors(TimeSeriesWriter &          writer,
+                                           bool &                      clear_file,
+                                           std::string const &         norm_name,
+                                           std::vector<double> const & errors,
+                                           double const                time)
+{
+  bool const relative = error_data.calculate_relative_errors;
 
-      unsigned int precision = 12;
-      f << std::scientific << std::setprecision(precision) << std::setw(precision + 8) << time
-        << std::setw(precision + 8) << error << std::endl;
-    }
+  dealii::ConditionalOStream pcout(std::cout,
+                                   dealii::Utilities::MPI::this_mpi_process(mpi_comm) == 0);
+  pcout << ((relative == true) ? "  Relative " : "  Absolute ") << "error (" << norm_name
+        << "): " << std::scientific << std::setprecision(5) << errors[0] << std::endl;
+
+  for(unsigned int c = 1; c < errors.size(); ++c)
+  {
+    pcout << "    component " << c - 1 << ": " << std::scientific << std::setprecision(5)
+          << errors[c] << std::endl;
   }
 
-  // H1-seminorm
-  if(error_data.calculate_H1_seminorm_error)
+  if(error_data.write_errors_to_file)
   {
-    double const error = calculate_error<dim>(mpi_comm,
-                                              relative,
-                                              *dof_handler,
-                                              *mapping,
-                                              solution_vector,
-                                              error_data.analytical_solution,
-                                              time,
-                                              dealii::VectorTools::H1_seminorm,
-                                              error_data.spatially_weight_error,
-                                              error_data.weight);
-
-    dealii::ConditionalOStream pcout(std::cout,
-                                     dealii::Utilities::MPI::this_mpi_process(mpi_comm) == 0);
-    pcout << ((relative == true) ? "  Relative " : "  Absolute ")
-          << "error (H1-seminorm): " << std::scientific << std::setprecision(5) << error
-          << std::endl;
-
-    if(error_data.write_errors_to_file)
+    // write output file
+    if(clear_file == true)
     {
-      // write output file
-      if(dealii::Utilities::MPI::this_mpi_process(mpi_comm) == 0)
-      {
-        std::string filename = error_data.directory + error_data.name + "_H1_seminorm";
+      std::ostringstream header;
+      header << "  Time                Error";
+      for(unsigned int c = 1; c < errors.size(); ++c)
+        header << std::setw(20) << ("Error_" + std::to_string(c - 1));
+      header << std::endl;
 
-        std::ofstream f;
-        if(clear_files_H1_seminorm == true)
-        {
-          f.open(filename.c_str(), std::ios::trunc);
-
-          f << "  Time                Error" << std::endl;
+      writer.start_file(header.str());
 
-          clear_files_H1_seminorm = false;
-        }
-        else
-        {
-          f.open(filename.c_str(), std::ios::app);
-        }
-
-        unsigned int precision = 12;
-        f << std::scientific << std::setprecision(precision) << std::setw(precision + 8) << time
-          << std::setw(precision + 8) << error << std::endl;
-      }
+      clear_file = false;
     }
+
+    std::vector<double> row(1, time);
+    row.insert(row.end(), errors.begin(), errors.end());
+    writer.write_row(row);
   }
 }
 
@@ -27,9 +27,12 @@
 #include <deal.II/dofs/dof_handler.h>
 #include <deal.II/fe/mapping_q.h>
 #include <deal.II/lac/la_parallel_vector.h>
+#include <deal.II/matrix_free/matrix_free.h>
+#include <deal.II/numerics/vector_tools.h>
 
 // ExaDG
 #include <exadg/postprocessor/time_control.h>
+#include <exadg/postprocessor/time_series_writer.h>
 #include <exadg/utilities/print_functions.h>
 
 namespace ExaDG
@@ -40,6 +43,8 @@ struct ErrorCalculationData
   ErrorCalculationData()
     : calculate_relative_errors(true),
       calculate_H1_seminorm_error(false),
+      calculate_componentwise_errors(false),
+      use_matrix_free_evaluation(false),
       write_errors_to_file(false),
       spatially_weight_error(false),
       weight(nullptr),
@@ -57,6 +62,8 @@ struct ErrorCalculationData
       print(pcout, unsteady, time_control_data);
       print_parameter(pcout, "Calculate relative errors", calculate_relative_errors);
       print_parameter(pcout, "Calculate H1-seminorm error", calculate_H1_seminorm_error);
+      print_parameter(pcout, "Calculate componentwise errors", calculate_componentwise_errors);
+      print_parameter(pcout, "Use matrix-free evaluation", use_matrix_free_evaluation);
       print_parameter(pcout, "Write errors to file", write_errors_to_file);
       if(write_errors_to_file)
         print_parameter(pcout, "Directory", directory);
@@ -74,6 +81,21 @@ struct ErrorCalculationData
   // user.
   bool calculate_H1_seminorm_error;
 
+  // In addition to the error of the whole field, compute the error of each vector component.
+  // Relative errors of the components are normalized by the norm of the whole field, i.e., the
+  // squares of the component errors sum up to the square of the total error. Requires
+  // use_matrix_free_evaluation == true.
+  bool calculate_componentwise_errors;
+
+  // By default, errors are computed by dealii::VectorTools::integrate_difference() using a
+  // quadrature rule with degree + 3 points. If true, the errors are instead computed with the
+  // dealii::MatrixFree object (mapping data) of the solver, evaluating the analytical solution for
+  // all SIMD lanes at once if it is a VectorizedFunction. This requires the MatrixFree object to
+  // be passed to ErrorCalculator::setup() and to provide update_quadrature_points for cells. The
+  // quadrature rule passed to ErrorCalculator::setup() should be more accurate than the one of the
+  // discretization, e.g. a dedicated quadrature rule with degree + 3 points.
+  bool use_matrix_free_evaluation;
+
   // data used to control the output
   TimeControlData time_control_data;
 
@@ -88,6 +110,9 @@ struct ErrorCalculationData
   // directory and name (used as filename and as identifier for screen output)
   std::string directory;
   std::string name;
+
+  // buffering of the output written to file
+  TimeSeriesWriterData time_series_data;
 };
 
 template<int dim, typename Number>
@@ -103,6 +128,18 @@ public:
         dealii::Mapping<dim> const &      mapping,
         ErrorCalculationData<dim> const & error_data);
 
+  /*
+   * Same as above, but additionally provides the MatrixFree object of the solver, which is used to
+   * evaluate the errors if ErrorCalculationData::use_matrix_free_evaluation is true.
+   */
+  void
+  setup(dealii::DoFHandler<dim> const &         dof_handler,
+        dealii::Mapping<dim> const &            mapping,
+        dealii::MatrixFree<dim, Number> const & matrix_free,
+        unsigned int const                      dof_index,
+        unsigned int const                      quad_index,
+        ErrorCalculationData<dim> const &       error_data);
+
   void
   evaluate(VectorType const & solution, double const time, bool const unsteady);
 
@@ -112,13 +149,34 @@ private:
   void
   do_evaluate(VectorType const & solution_vector, double const time);
 
+  /*
+   * Returns the error of the whole field as first entry, followed by the errors of the individual
+   * components if calculate_componentwise_errors is true.
+   */
+  std::vector<double>
+  calculate_errors(VectorType const &                    solution_vector,
+                   double const                          time,
+                   dealii::VectorTools::NormType const & norm_type) const;
+
+  void
+  write_errors(TimeSeriesWriter &          writer,
+               bool &                      clear_file,
+               std::string const &         norm_name,
+               std::vector<double> const & errors,
+               double const                time);
+
   MPI_Comm const mpi_comm;
 
   bool clear_files_L2, clear_files_H1_seminorm;
 
+  TimeSeriesWriter writer_L2, writer_H1_seminorm;
+
   dealii::SmartPointer<dealii::DoFHandler<dim> const> dof_handler;
   dealii::SmartPointer<dealii::Mapping<dim> const>    mapping;
 
+  dealii::SmartPointer<dealii::MatrixFree<dim, Number> const> matrix_free;
+  unsigned int                                                dof_index, quad_index;
+
   ErrorCalculationData<dim> error_data;
 };
 
@@ -20,7 +20,7 @@
  */
 
 // C/C++
-#include <fstream>
+#include <sstream>
 
 // ExaDG
 #include <exadg/postprocessor/kinetic_energy_calculation.h>
@@ -30,7 +30,12 @@ namespace ExaDG
 {
 template<int dim, typename Number>
 KineticEnergyCalculator<dim, Number>::KineticEnergyCalculator(MPI_Comm const & comm)
-  : mpi_comm(comm), clear_files(true), matrix_free(nullptr), dof_index(0), quad_index(0)
+  : mpi_comm(comm),
+    clear_files(true),
+    writer(comm),
+    matrix_free(nullptr),
+    dof_index(0),
+    quad_index(0)
 {
 }
 
@@ -51,7 +56,11 @@ KineticEnergyCalculator<dim, Number>::setup(dealii::MatrixFree<dim, Number> cons
   clear_files = data.clear_file;
 
   if(data.time_control_data.is_active)
+  {
     create_directories(data.directory, mpi_comm);
+
+    writer.setup(data.directory + data.filename, data.time_series_data);
+  }
 }
 
 template<int dim, typename Number>
@@ -70,6 +79,25 @@ KineticEnergyCalculator<dim, Number>::evaluate(VectorType const & velocity,
   calculate_basic(velocity, time);
 }
 
+template<int dim, typename Number>
+void
+KineticEnergyCalculator<dim, Number>::evaluate(Number const energy,
+                                               Number const enstrophy,
+                                               Number const dissipation,
+                                               Number const max_vorticity,
+                                               double const time,
+                                               bool const   unsteady)
+{
+  AssertThrow(unsteady,
+              dealii::ExcMessage(
+                "This postprocessing tool can only be used for unsteady problems."));
+
+  AssertThrow(data.evaluate_individual_terms == false,
+              dealii::ExcMessage("Not implemented in this class."));
+
+  write_output_basic(energy, enstrophy, dissipation, max_vorticity, time);
+}
+
 template<int dim, typename Number>
 void
 KineticEnergyCalculator<dim, Number>::calculate_basic(VectorType const & velocity,
@@ -79,42 +107,38 @@ KineticEnergyCalculator<dim, Number>::calculate_basic(VectorType const & velocit
 
   integrate(*matrix_free, velocity, kinetic_energy, enstrophy, dissipation, max_vorticity);
 
+  write_output_basic(kinetic_energy, enstrophy, dissipation, max_vorticity, time);
+}
+
+template<int dim, typename Number>
+void
+KineticEnergyCalculator<dim, Number>::write_output_basic(Number const kinetic_energy,
+                                                         Number const enstrophy,
+                                                         Number const dissipation,
+                                                         Number const max_vorticity,
+                                                         double const time)
+{
   // write output file
-  if(dealii::Utilities::MPI::this_mpi_process(mpi_comm) == 0)
+  if(clear_files == true)
   {
+    std::ostringstream header;
+
     // clang-format off
-      std::ostringstream filename;
-      filename << data.directory + data.filename;
-
-      std::ofstream f;
-      if(clear_files == true)
-      {
-        f.open(filename.str().c_str(), std::ios::trunc);
-        f << "Kinetic energy: E_k = 1/V * 1/2 * (u,u)_Omega, where V=(1,1)_Omega" << std::endl
-          << "Dissipation rate: epsilon = nu/V * (grad(u),grad(u))_Omega, where V=(1,1)_Omega" << std::endl
-          << "Enstrophy: E = 1/V * 1/2 * (rot(u),rot(u))_Omega, where V=(1,1)_Omega" << std::endl;
-
-        f << std::endl
-          << "  Time                Kin. energy         dissipation         enstrophy           max_vorticity"
-          << std::endl;
-
-        clear_files = false;
-      }
-      else
-      {
-        f.open(filename.str().c_str(), std::ios::app);
-      }
-
-      unsigned int precision = 12;
-      f << std::scientific << std::setprecision(precision)
-        << std::setw(precision + 8) << time
-        << std::setw(precision + 8) << kinetic_energy
-        << std::setw(precision + 8) << dissipation
-        << std::setw(precision + 8) << enstrophy
-        << std::setw(precision + 8) << max_vorticity
-        << std::endl;
+    header << "Kinetic energy: E_k = 1/V * 1/2 * (u,u)_Omega, where V=(1,1)_Omega" << std::endl
+           << "Dissipation rate: epsilon = nu/V * (grad(u),grad(u))_Omega, where V=(1,1)_Omega" << std::endl
+           << "Enstrophy: E = 1/V * 1/2 * (rot(u),rot(u))_Omega, where V=(1,1)_Omega" << std::endl;
+
+    header << std::endl
+           << "  Time                Kin. energy         dissipation         enstrophy           max_vorticity"
+           << std::endl;
     // clang-format on
+
+    writer.start_file(header.str());
+
+    clear_files = false;
   }
+
+  writer.write_row({time, kinetic_energy, dissipation, enstrophy, max_vorticity});
 }
 
 template<int dim, typename Number>
@@ -29,6 +29,7 @@
 #include <exadg/incompressible_navier_stokes/spatial_discretization/curl_compute.h>
 #include <exadg/matrix_free/integrators.h>
 #include <exadg/postprocessor/time_control.h>
+#include <exadg/postprocessor/time_series_writer.h>
 #include <exadg/utilities/print_functions.h>
 
 namespace ExaDG
@@ -74,6 +75,8 @@ struct KineticEnergyData
   std::string directory;
   std::string filename;
   bool        clear_file;
+
+  TimeSeriesWriterData time_series_data;
 };
 
 template<int dim, typename Number>
@@ -99,12 +102,31 @@ public:
   void
   evaluate(VectorType const & velocity, double const time, bool const unsteady);
 
+  /*
+   * Same as above, but for integrals (normalized by the volume) that have already been computed
+   * and summed over all MPI processes, e.g., in a loop together with other integral quantities.
+   */
+  void
+  evaluate(Number const energy,
+           Number const enstrophy,
+           Number const dissipation,
+           Number const max_vorticity,
+           double const time,
+           bool const   unsteady);
+
   TimeControl time_control;
 
 protected:
   void
   calculate_basic(VectorType const & velocity, double const time);
 
+  void
+  write_output_basic(Number const energy,
+                     Number const enstrophy,
+                     Number const dissipation,
+                     Number const max_vorticity,
+                     double const time);
+
   /*
    *  This function calculates the kinetic energy
    *
@@ -138,6 +160,8 @@ protected:
 
   bool clear_files;
 
+  TimeSeriesWriter writer;
+
   dealii::MatrixFree<dim, Number> const * matrix_free;
   unsigned int                            dof_index, quad_index;
   KineticEnergyData                       data;
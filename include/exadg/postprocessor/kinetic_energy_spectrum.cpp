@@ -70,12 +70,18 @@ public:
   /**
    * Constructor
    *
-   * @param write     flush simulation data to hard drive for later post processing
-   * @param inplace   create energy spectrum at run time
+   * @param write         flush simulation data to hard drive for later post processing
+   * @param inplace       create energy spectrum at run time
+   * @param measure_plan  let FFTW measure the fastest plan during initialization
    *
    */
-  DealSpectrumWrapper(MPI_Comm const & comm, bool write, bool inplace)
-    : comm(comm), write(write), inplace(inplace), s(comm), ipol(comm, s), fftw(comm, s)
+  DealSpectrumWrapper(MPI_Comm const & comm, bool write, bool inplace, bool measure_plan)
+    : comm(comm),
+      write(write),
+      inplace(inplace),
+      s(comm),
+      ipol(comm, s),
+      fftw(comm, s, measure_plan ? FFTW_MEASURE : FFTW_ESTIMATE)
   {
   }
 
@@ -167,14 +173,12 @@ public:
     dealii::types::global_dof_index N  = s.cells * s.points_dst;
     dealii::types::global_dof_index Nx = (N / 2 + 1) * 2;
 
-    for(dealii::types::global_dof_index d = 0;
-        d < static_cast<dealii::types::global_dof_index>(s.dim);
-        d++)
-    {
-      dealii::types::global_dof_index c = 0;
-      for(dealii::types::global_dof_index k = 0; k < (end - start); k++)
-        for(dealii::types::global_dof_index j = 0; j < N; j++)
-          for(dealii::types::global_dof_index i = 0; i < Nx; i++, c++)
+    // the FFT transforms all components at once, i.e. the components are interleaved
+    dealii::types::global_dof_index c = 0;
+    for(dealii::types::global_dof_index k = 0; k < (end - start); k++)
+      for(dealii::types::global_dof_index j = 0; j < N; j++)
+        for(dealii::types::global_dof_index i = 0; i < Nx; i++, c++)
+          for(dealii::types::global_dof_index d = 0; d < dim; d++)
             if(i < N)
               indices_want.push_back(d * dealii::Utilities::pow(points_dst * n_cells_1D, dim) +
                                      (k + start) *
@@ -183,9 +187,9 @@ public:
             else
               indices_want.push_back(dealii::numbers::invalid_dof_index); // x-padding
 
-      for(; c < static_cast<dealii::types::global_dof_index>(fftw.bsize); c++)
+    for(; c < static_cast<dealii::types::global_dof_index>(fftw.bsize); c++)
+      for(dealii::types::global_dof_index d = 0; d < dim; d++)
         indices_want.push_back(dealii::numbers::invalid_dof_index); // z-padding
-    }
 
     nonconti = std::make_shared<dealii::Utilities::MPI::NoncontiguousPartitioner>(indices_has,
                                                                                   indices_want,
@@ -225,7 +229,7 @@ public:
         dealii::Utilities::pow(static_cast<dealii::types::global_dof_index>(s.cells * s.points_dst),
                                s.dim) *
         s.dim;
-      dealii::ArrayView<double>       dst(fftw.u_real, size * 2);
+      dealii::ArrayView<double>       dst(fftw.data_real, size * 2);
       dealii::ArrayView<double const> src_(ipol.dst, size);
       nonconti->export_to_ghosted_array(src_, dst);
 
@@ -312,7 +316,7 @@ namespace ExaDG
 class DealSpectrumWrapper
 {
 public:
-  DealSpectrumWrapper(MPI_Comm const &, bool, bool)
+  DealSpectrumWrapper(MPI_Comm const &, bool, bool, bool)
   {
   }
 
@@ -616,8 +620,10 @@ KineticEnergySpectrumCalculator<dim, Number>::setup(
 
     if(deal_spectrum_wrapper == nullptr)
     {
-      deal_spectrum_wrapper =
-        std::make_shared<DealSpectrumWrapper>(mpi_comm, data.write_raw_data_to_files, data.do_fftw);
+      deal_spectrum_wrapper = std::make_shared<DealSpectrumWrapper>(mpi_comm,
+                                                                    data.write_raw_data_to_files,
+                                                                    data.do_fftw,
+                                                                    data.measure_fftw_plan);
     }
 
     unsigned int evaluation_points = std::max(data.degree + 1, data.evaluation_points_per_cell);
@@ -41,6 +41,7 @@ struct KineticEnergySpectrumData
   KineticEnergySpectrumData()
     : write_raw_data_to_files(false),
       do_fftw(true),
+      measure_fftw_plan(true),
       directory("output/"),
       filename("energy_spectrum"),
       clear_file(true),
@@ -64,6 +65,7 @@ struct KineticEnergySpectrumData
       pcout << std::endl << "  Calculate kinetic energy spectrum:" << std::endl;
       print_parameter(pcout, "Write raw data to files", write_raw_data_to_files);
       print_parameter(pcout, "Do FFTW", do_fftw);
+      print_parameter(pcout, "Measure FFTW plan", measure_fftw_plan);
       print_parameter(pcout, "Directory of output files", directory);
       print_parameter(pcout, "Filename", filename);
       print_parameter(pcout, "Clear file", clear_file);
@@ -85,6 +87,10 @@ struct KineticEnergySpectrumData
   bool write_raw_data_to_files;
   bool do_fftw;
 
+  // The FFTW plan is created once during setup. If true, FFTW measures the fastest plan, which
+  // takes more time during setup but pays off if the spectrum is evaluated many times.
+  bool measure_fftw_plan;
+
   // these parameters are only relevant if do_fftw = true
   std::string directory;
   std::string filename;
@@ -20,7 +20,8 @@
  */
 
 // C/C++
-#include <fstream>
+#include <iomanip>
+#include <sstream>
 
 // ExaDG
 #include <exadg/matrix_free/integrators.h>
@@ -127,6 +128,8 @@ template<int dim, typename Number>
 LiftAndDragCalculator<dim, Number>::LiftAndDragCalculator(MPI_Comm const & comm)
   : mpi_comm(comm),
     clear_files(true),
+    writer_drag(comm),
+    writer_lift(comm),
     matrix_free(nullptr),
     dof_index_velocity(0),
     dof_index_pressure(1),
@@ -157,7 +160,12 @@ LiftAndDragCalculator<dim, Number>::setup(dealii::DoFHandler<dim> const & dof_ha
   time_control.setup(data_in.time_control_data);
 
   if(data_in.boundary_IDs.size() > 0)
+  {
     create_directories(data.directory, mpi_comm);
+
+    writer_drag.setup(data.directory + data.filename_drag, data.time_series_data, 12, 20, true);
+    writer_lift.setup(data.directory + data.filename_lift, data.time_series_data, 12, 20, true);
+  }
 }
 
 template<int dim, typename Number>
@@ -181,6 +189,19 @@ LiftAndDragCalculator<dim, Number>::evaluate(VectorType const & velocity,
                                                data.viscosity,
                                                mpi_comm);
 
+    evaluate(Force, time);
+  }
+}
+
+template<int dim, typename Number>
+void
+LiftAndDragCalculator<dim, Number>::evaluate(dealii::Tensor<1, dim, Number> const & force,
+                                             double const                           time) const
+{
+  if(data.boundary_IDs.size() > 0)
+  {
+    dealii::Tensor<1, dim, Number> Force = force;
+
     // compute lift and drag coefficients (c = (F/rho)/(1/2 U² A)
     double const reference_value = data.reference_value;
     Force /= reference_value;
@@ -191,62 +212,34 @@ LiftAndDragCalculator<dim, Number>::evaluate(VectorType const & velocity,
     c_L_min = std::min(c_L_min, lift);
     c_L_max = std::max(c_L_max, lift);
 
-    if(dealii::Utilities::MPI::this_mpi_process(mpi_comm) == 0)
+    if(clear_files)
     {
-      std::string filename_drag, filename_lift;
-      filename_drag = data.directory + data.filename_drag;
-      filename_lift = data.directory + data.filename_lift;
-
-      unsigned int precision = 12;
+      unsigned int const precision = 12;
 
-      std::ofstream f_drag, f_lift;
-      if(clear_files)
-      {
-        f_drag.open(filename_drag.c_str(), std::ios::trunc);
-        f_lift.open(filename_lift.c_str(), std::ios::trunc);
-
-        // clang-format off
-        f_drag << std::setw(precision+8) << std::left << "time_t"
-               << std::setw(precision+8) << std::left << "c_D(t)"
-               << std::setw(precision+8) << std::left << "c_D_min"
-               << std::setw(precision+8) << std::left << "c_D_max"
-               << std::endl;
-
-        f_lift << std::setw(precision+8) << std::left << "time_t"
-               << std::setw(precision+8) << std::left << "c_L(t)"
-               << std::setw(precision+8) << std::left << "c_L_min"
-               << std::setw(precision+8) << std::left << "c_L_max"
-               << std::endl;
-        // clang-format on
-
-        clear_files = false;
-      }
-      else
-      {
-        f_drag.open(filename_drag.c_str(), std::ios::app);
-        f_lift.open(filename_lift.c_str(), std::ios::app);
-      }
+      std::ostringstream header_drag, header_lift;
 
       // clang-format off
-      f_drag << std::scientific << std::setprecision(precision)
-             << std::setw(precision+8) << std::left << time
-             << std::setw(precision+8) << std::left << drag
-             << std::setw(precision+8) << std::left << c_D_min
-             << std::setw(precision+8) << std::left << c_D_max
-             << std::endl;
-
-      f_drag.close();
-
-      f_lift << std::scientific << std::setprecision(precision)
-             << std::setw(precision+8) << std::left << time
-             << std::setw(precision+8) << std::left << lift
-             << std::setw(precision+8) << std::left << c_L_min
-             << std::setw(precision+8) << std::left << c_L_max
-             << std::endl;
-
-      f_lift.close();
+      header_drag << std::setw(precision+8) << std::left << "time_t"
+                  << std::setw(precision+8) << std::left << "c_D(t)"
+                  << std::setw(precision+8) << std::left << "c_D_min"
+                  << std::setw(precision+8) << std::left << "c_D_max"
+                  << std::endl;
+
+      header_lift << std::setw(precision+8) << std::left << "time_t"
+                  << std::setw(precision+8) << std::left << "c_L(t)"
+                  << std::setw(precision+8) << std::left << "c_L_min"
+                  << std::setw(precision+8) << std::left << "c_L_max"
+                  << std::endl;
       // clang-format on
+
+      writer_drag.start_file(header_drag.str());
+      writer_lift.start_file(header_lift.str());
+
+      clear_files = false;
     }
+
+    writer_drag.write_row({time, drag, c_D_min, c_D_max});
+    writer_lift.write_row({time, lift, c_L_min, c_L_max});
   }
 }
 
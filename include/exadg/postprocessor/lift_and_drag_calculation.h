@@ -28,6 +28,7 @@
 
 // ExaDG
 #include <exadg/postprocessor/time_control.h>
+#include <exadg/postprocessor/time_series_writer.h>
 
 namespace ExaDG
 {
@@ -70,6 +71,8 @@ struct LiftAndDragData
   std::string filename_lift;
   std::string filename_drag;
 
+  TimeSeriesWriterData time_series_data;
+
   void
   print(dealii::ConditionalOStream & pcout, bool unsteady) const;
 };
@@ -93,6 +96,14 @@ public:
   void
   evaluate(VectorType const & velocity, VectorType const & pressure, double const time) const;
 
+  /*
+   * Writes lift and drag coefficients for a force that has already been integrated over the
+   * surface specified by LiftAndDragData::boundary_IDs and summed over all MPI processes. This
+   * allows to compute the force together with other integral quantities in a single loop.
+   */
+  void
+  evaluate(dealii::Tensor<1, dim, Number> const & force, double const time) const;
+
   TimeControl time_control;
 
 private:
@@ -100,6 +111,8 @@ private:
 
   mutable bool clear_files;
 
+  mutable TimeSeriesWriter writer_drag, writer_lift;
+
   dealii::SmartPointer<dealii::DoFHandler<dim> const> dof_handler_velocity;
   dealii::MatrixFree<dim, Number> const *             matrix_free;
   unsigned int dof_index_velocity, dof_index_pressure, quad_index;
@@ -20,7 +20,8 @@
  */
 
 // C/C++
-#include <fstream>
+#include <iomanip>
+#include <sstream>
 
 // ExaDG
 #include <exadg/postprocessor/normal_flux_calculation.h>
@@ -40,13 +41,18 @@ NormalFluxCalculator<dim, Number>::NormalFluxCalculator(
     quad_index(quad_index_in),
     data(data_in),
     clear_files(true),
+    writer(mpi_comm_in),
     mpi_comm(mpi_comm_in)
 {
   for(auto it : data.boundary_ids)
     flux.insert(typename std::pair<dealii::types::boundary_id, double>(it, 0.0));
 
   if(data.evaluate)
+  {
     create_directories(data.directory, mpi_comm);
+
+    writer.setup(data.directory + data.filename, data.time_series_data, 12, 20, true);
+  }
 }
 
 template<int dim, typename Number>
@@ -122,54 +128,33 @@ NormalFluxCalculator<dim, Number>::evaluate(VectorType const & solution,
   }
 
   // write results to file
-  if(dealii::Utilities::MPI::this_mpi_process(mpi_comm) == 0)
+  if(clear_files)
   {
-    std::string filename = data.directory + data.filename;
-
-    unsigned int precision = 12;
-
-    std::ofstream f;
-    if(clear_files)
-    {
-      f.open(filename.c_str(), std::ios::trunc);
-
-      f << std::setw(precision + 8) << std::left << "Time t";
-
-      for(auto it : flux)
-      {
-        // clang-format off
-        f << std::setw(precision + 8) << std::left
-          << "Flux (bid = " + std::to_string(it.first) + ")";
-        // clang-format on
-      }
+    unsigned int const precision = 12;
 
-      f << std::endl;
-
-      if(unsteady)
-        clear_files = false;
-    }
-    else
-    {
-      f.open(filename.c_str(), std::ios::app);
-    }
+    std::ostringstream header;
 
-    // clang-format off
-    f << std::scientific << std::setprecision(precision)
-      << std::setw(precision + 8) << std::left << time;
-    // clang-format on
+    header << std::setw(precision + 8) << std::left << "Time t";
 
     for(auto it : flux)
     {
       // clang-format off
-      f << std::scientific << std::setprecision(precision)
-        << std::setw(precision + 8) << std::left << it.second;
+      header << std::setw(precision + 8) << std::left
+             << "Flux (bid = " + std::to_string(it.first) + ")";
       // clang-format on
     }
 
-    f << std::endl;
+    header << std::endl;
 
-    f.close();
+    writer.start_file(header.str());
+
+    if(unsteady)
+      clear_files = false;
   }
+
+  std::vector<double> row = {time};
+  row.insert(row.end(), flux_vector.begin(), flux_vector.end());
+  writer.write_row(row);
 }
 
 template class NormalFluxCalculator<2, float>;
@@ -23,6 +23,7 @@
 
 // ExaDG
 #include <exadg/matrix_free/integrators.h>
+#include <exadg/postprocessor/time_series_writer.h>
 
 namespace ExaDG
 {
@@ -38,6 +39,8 @@ struct NormalFluxCalculatorData
   // specify where to write output files
   std::string directory;
   std::string filename;
+
+  TimeSeriesWriterData time_series_data;
 };
 
 template<int dim, typename Number>
@@ -67,6 +70,8 @@ private:
 
   bool clear_files;
 
+  TimeSeriesWriter writer;
+
   std::map<dealii::types::boundary_id, double> flux;
 
   MPI_Comm const mpi_comm;
@@ -20,7 +20,8 @@
  */
 
 // C/C++
-#include <fstream>
+#include <iomanip>
+#include <sstream>
 
 // ExaDG
 #include <exadg/postprocessor/pressure_difference_calculation.h>
@@ -49,7 +50,7 @@ PressureDifferenceData<dim>::print(dealii::ConditionalOStream & pcout, bool cons
 
 template<int dim, typename Number>
 PressureDifferenceCalculator<dim, Number>::PressureDifferenceCalculator(MPI_Comm const & comm)
-  : mpi_comm(comm), clear_files(true)
+  : mpi_comm(comm), clear_files(true), writer(comm)
 {
 }
 
@@ -67,7 +68,11 @@ PressureDifferenceCalculator<dim, Number>::setup(
   time_control.setup(data.time_control_data);
 
   if(data.time_control_data.is_active)
+  {
     create_directories(data.directory, mpi_comm);
+
+    writer.setup(data.directory + data.filename, data.time_series_data, 12, 20, true);
+  }
 }
 
 template<int dim, typename Number>
@@ -88,39 +93,24 @@ PressureDifferenceCalculator<dim, Number>::evaluate(VectorType const & pressure,
 
   Number const pressure_difference = pressure_1 - pressure_2;
 
-  if(dealii::Utilities::MPI::this_mpi_process(mpi_comm) == 0)
+  if(clear_files)
   {
-    std::string filename = data.directory + data.filename;
-
-    unsigned int precision = 12;
+    unsigned int const precision = 12;
 
-    std::ofstream f;
-    if(clear_files)
-    {
-      f.open(filename.c_str(), std::ios::trunc);
-
-      // clang-format off
-        f << std::setw(precision + 8) << std::left << "time t"
-          << std::setw(precision + 8) << std::left << "pressure difference"
-          << std::endl;
-      // clang-format on
-
-      clear_files = false;
-    }
-    else
-    {
-      f.open(filename.c_str(), std::ios::app);
-    }
+    std::ostringstream header;
 
     // clang-format off
-      f << std::scientific << std::setprecision(precision)
-        << std::setw(precision + 8) << std::left << time
-        << std::setw(precision + 8) << std::left << pressure_difference
-        << std::endl;
+    header << std::setw(precision + 8) << std::left << "time t"
+           << std::setw(precision + 8) << std::left << "pressure difference"
+           << std::endl;
     // clang-format on
 
-    f.close();
+    writer.start_file(header.str());
+
+    clear_files = false;
   }
+
+  writer.write_row({time, pressure_difference});
 }
 
 template class PressureDifferenceCalculator<2, float>;
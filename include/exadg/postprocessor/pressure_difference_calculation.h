@@ -32,6 +32,7 @@
 // ExaDG
 #include <exadg/postprocessor/solution_field.h>
 #include <exadg/postprocessor/time_control.h>
+#include <exadg/postprocessor/time_series_writer.h>
 
 namespace ExaDG
 {
@@ -60,6 +61,8 @@ struct PressureDifferenceData
   std::string directory;
   std::string filename;
 
+  TimeSeriesWriterData time_series_data;
+
   void
   print(dealii::ConditionalOStream & pcout, bool const unsteady) const;
 };
@@ -87,6 +90,8 @@ private:
 
   mutable bool clear_files;
 
+  mutable TimeSeriesWriter writer;
+
   dealii::SmartPointer<dealii::DoFHandler<dim> const> dof_handler_pressure;
   dealii::SmartPointer<dealii::Mapping<dim> const>    mapping;
 
@@ -0,0 +1,473 @@
+/*  ______________________________________________________________________
+ *
+ *  ExaDG - High-Order Discontinuous Galerkin for the Exa-Scale
+ *
+ *  Copyright (C) 2021 by the ExaDG authors
+ *
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation, either version 3 of the License, or
+ *  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ *  ______________________________________________________________________
+ */
+
+#ifndef INCLUDE_EXADG_POSTPROCESSOR_SNAPSHOT_TRANSFER_H_
+#define INCLUDE_EXADG_POSTPROCESSOR_SNAPSHOT_TRANSFER_H_
+
+// C/C++
+#include <array>
+#include <cmath>
+#include <limits>
+#include <memory>
+#include <vector>
+
+// deal.II
+#include <deal.II/base/array_view.h>
+#include <deal.II/base/geometry_info.h>
+#include <deal.II/base/mpi.h>
+#include <deal.II/base/mpi_noncontiguous_partitioner.h>
+#include <deal.II/dofs/dof_accessor.h>
+#include <deal.II/dofs/dof_handler.h>
+#include <deal.II/lac/la_parallel_vector.h>
+
+// ExaDG
+#include <exadg/utilities/in_transit_communicator.h>
+#include <exadg/utilities/numbers.h>
+
+namespace ExaDG
+{
+/*
+ * Ships snapshots of solution vectors from the solver processes to the dedicated postprocessing
+ * processes of an InTransitCommunicator, where the same mesh and finite element spaces exist with
+ * a different parallel partitioning.
+ *
+ * Degrees of freedom are identified across the two partitionings by a canonical index that is
+ * computed from the CellId of an active cell (coarse cell id and child indices) and the local
+ * degree of freedom index within the cell. One dealii::Utilities::MPI::NoncontiguousPartitioner
+ * per field performs the point-to-point exchange on the global communicator.
+ *
+ * On the solver side, send() only starts the non-blocking communication and returns. The
+ * communication of a snapshot is completed at the beginning of the next call to send() (or in
+ * finalize()), so that at most one snapshot is in flight. If the postprocessing processes are
+ * slower than the solver, the solver therefore waits in send(), which limits the memory used for
+ * buffering to a single snapshot.
+ */
+template<int dim, typename Number>
+class SnapshotTransfer
+{
+public:
+  typedef dealii::LinearAlgebra::distributed::Vector<Number> VectorType;
+
+  SnapshotTransfer(InTransitCommunicator const &                       in_transit_in,
+                   std::vector<dealii::DoFHandler<dim> const *> const & dof_handlers_in)
+    : in_transit(in_transit_in),
+      dof_handlers(dof_handlers_in),
+      snapshot_in_flight(false),
+      n_snapshots(0),
+      postprocessing_wall_time(0.0)
+  {
+    AssertThrow(in_transit.is_active(),
+                dealii::ExcMessage("No dedicated postprocessing processes available."));
+
+    // metadata is exchanged on a separate communicator to avoid conflicts with the tags used by
+    // the noncontiguous partitioners
+    MPI_Comm_dup(in_transit.get_global_communicator(), &metadata_comm);
+
+    partitioners.resize(dof_handlers.size());
+    buffers.resize(dof_handlers.size());
+    temporary_storage.resize(dof_handlers.size());
+    requests.resize(dof_handlers.size());
+
+    for(unsigned int field = 0; field < dof_handlers.size(); ++field)
+    {
+      std::vector<dealii::types::global_dof_index> const indices = get_canonical_indices(field);
+
+      std::vector<dealii::types::global_dof_index> const empty;
+
+      // solver processes own the data, postprocessing processes want to receive it
+      if(in_transit.is_postprocessing_process())
+        partitioners[field] =
+          std::make_shared<dealii::Utilities::MPI::NoncontiguousPartitioner>(
+            empty, indices, in_transit.get_global_communicator());
+      else
+        partitioners[field] =
+          std::make_shared<dealii::Utilities::MPI::NoncontiguousPartitioner>(
+            indices, empty, in_transit.get_global_communicator());
+
+      buffers[field].resize(indices.size());
+      temporary_storage[field].resize(partitioners[field]->temporary_storage_size());
+    }
+  }
+
+  ~SnapshotTransfer()
+  {
+    MPI_Comm_free(&metadata_comm);
+  }
+
+  /*
+   * Solver side: start the transfer of a snapshot. The vectors are copied into internal buffers,
+   * i.e., they may be modified after this function returns.
+   */
+  void
+  send(std::vector<VectorType const *> const & vectors,
+       double const                            time,
+       types::time_step const                  time_step_number)
+  {
+    AssertThrow(not in_transit.is_postprocessing_process(),
+                dealii::ExcMessage("send() may only be called on solver processes."));
+    AssertThrow(vectors.size() == dof_handlers.size(),
+                dealii::ExcMessage("Number of vectors does not match number of DoFHandlers."));
+
+    // backpressure: complete the previous snapshot before buffering a new one
+    finish_snapshot();
+
+    send_metadata(1.0, time, static_cast<double>(time_step_number));
+
+    for(unsigned int field = 0; field < dof_handlers.size(); ++field)
+    {
+      copy_to_buffer(field, *vectors[field]);
+
+      partitioners[field]->export_to_ghosted_array_start(
+        field,
+        dealii::ArrayView<Number const>(buffers[field].data(), buffers[field].size()),
+        dealii::ArrayView<Number>(temporary_storage[field].data(),
+                                  temporary_storage[field].size()),
+        requests[field]);
+    }
+
+    snapshot_in_flight = true;
+    ++n_snapshots;
+  }
+
+  /*
+   * Postprocessing side: receive the next snapshot. Returns false if the solver has finished and
+   * no further snapshots will arrive.
+   */
+  bool
+  receive(std::vector<VectorType *> const & vectors,
+          double &                          time,
+          types::time_step &                time_step_number)
+  {
+    AssertThrow(in_transit.is_postprocessing_process(),
+                dealii::ExcMessage("receive() may only be called on postprocessing processes."));
+    AssertThrow(vectors.size() == dof_handlers.size(),
+                dealii::ExcMessage("Number of vectors does not match number of DoFHandlers."));
+
+    std::array<double, 3> data;
+    MPI_Recv(data.data(),
+             data.size(),
+             MPI_DOUBLE,
+             in_transit.get_solver_root(),
+             metadata_tag,
+             metadata_comm,
+             MPI_STATUS_IGNORE);
+
+    if(data[0] == 0.0)
+      return false;
+
+    time             = data[1];
+    time_step_number = static_cast<types::time_step>(data[2]);
+
+    // post the receives of all fields before waiting for any of them
+    for(unsigned int field = 0; field < dof_handlers.size(); ++field)
+    {
+      partitioners[field]->export_to_ghosted_array_start(
+        field,
+        dealii::ArrayView<Number const>(),
+        dealii::ArrayView<Number>(temporary_storage[field].data(),
+                                  temporary_storage[field].size()),
+        requests[field]);
+    }
+
+    for(unsigned int field = 0; field < dof_handlers.size(); ++field)
+    {
+      partitioners[field]->export_to_ghosted_array_finish(
+        dealii::ArrayView<Number const>(temporary_storage[field].data(),
+                                        temporary_storage[field].size()),
+        dealii::ArrayView<Number>(buffers[field].data(), buffers[field].size()),
+        requests[field]);
+
+      copy_from_buffer(field, *vectors[field]);
+    }
+
+    ++n_snapshots;
+
+    return true;
+  }
+
+  /*
+   * Solver side: complete the last snapshot, notify the postprocessing processes that no further
+   * snapshots will arrive, and receive the statistics sent by send_statistics().
+   */
+  void
+  finalize()
+  {
+    AssertThrow(not in_transit.is_postprocessing_process(),
+                dealii::ExcMessage("finalize() may only be called on solver processes."));
+
+    finish_snapshot();
+
+    send_metadata(0.0, 0.0, 0.0);
+    finish_metadata();
+
+    std::array<double, 2> statistics = {{0.0, 0.0}};
+    if(dealii::Utilities::MPI::this_mpi_process(in_transit.get_global_communicator()) ==
+       in_transit.get_solver_root())
+    {
+      MPI_Recv(statistics.data(),
+               statistics.size(),
+               MPI_DOUBLE,
+               in_transit.get_postprocessing_root(),
+               statistics_tag,
+               metadata_comm,
+               MPI_STATUS_IGNORE);
+    }
+    MPI_Bcast(
+      statistics.data(), statistics.size(), MPI_DOUBLE, 0, in_transit.get_local_communicator());
+
+    postprocessing_wall_time = statistics[1];
+  }
+
+  /*
+   * Postprocessing side: send the accumulated wall time of the postprocessing to the solver
+   * processes, see finalize().
+   */
+  void
+  send_statistics(double const wall_time)
+  {
+    AssertThrow(in_transit.is_postprocessing_process(),
+                dealii::ExcMessage("send_statistics() may only be called on postprocessing "
+                                   "processes."));
+
+    postprocessing_wall_time =
+      dealii::Utilities::MPI::max(wall_time, in_transit.get_local_communicator());
+
+    if(dealii::Utilities::MPI::this_mpi_process(in_transit.get_global_communicator()) ==
+       in_transit.get_postprocessing_root())
+    {
+      std::array<double, 2> statistics = {{static_cast<double>(n_snapshots),
+                                           postprocessing_wall_time}};
+      MPI_Send(statistics.data(),
+               statistics.size(),
+               MPI_DOUBLE,
+               in_transit.get_solver_root(),
+               statistics_tag,
+               metadata_comm);
+    }
+  }
+
+  unsigned int
+  get_n_snapshots() const
+  {
+    return n_snapshots;
+  }
+
+  /*
+   * Wall time spent in postprocessing on the dedicated processes (maximum over processes), i.e.,
+   * the wall time removed from the critical path of the solver.
+   */
+  double
+  get_postprocessing_wall_time() const
+  {
+    return postprocessing_wall_time;
+  }
+
+private:
+  /*
+   * Canonical indices of the degrees of freedom of all locally owned cells, in the order of
+   * iteration over the active cells. The cell index is the coarse cell id followed by the child
+   * indices down to the finest level of the triangulation (padded with zeros for coarser cells),
+   * which is unique for the active cells and independent of the parallel partitioning.
+   */
+  std::vector<dealii::types::global_dof_index>
+  get_canonical_indices(unsigned int const field) const
+  {
+    dealii::DoFHandler<dim> const & dof_handler = *dof_handlers[field];
+
+    unsigned int const n_levels      = dof_handler.get_triangulation().n_global_levels();
+    unsigned int const n_children    = dealii::GeometryInfo<dim>::max_children_per_cell;
+    unsigned int const dofs_per_cell = dof_handler.get_fe().n_dofs_per_cell();
+
+    // make sure that the canonical indices can be represented
+    {
+      double const n_coarse_cells =
+        static_cast<double>(dof_handler.get_triangulation().n_global_coarse_cells());
+      double const max_index = n_coarse_cells * std::pow(static_cast<double>(n_children),
+                                                         static_cast<double>(n_levels - 1)) *
+                               static_cast<double>(dofs_per_cell);
+      double const max_representable =
+        static_cast<double>(std::numeric_limits<dealii::types::global_dof_index>::max());
+      AssertThrow(max_index < max_representable,
+                  dealii::ExcMessage("Canonical DoF indices exceed the range of "
+                                     "dealii::types::global_dof_index."));
+    }
+
+    std::vector<dealii::types::global_dof_index> indices;
+    indices.reserve(dof_handler.get_triangulation().n_locally_owned_active_cells() *
+                    dofs_per_cell);
+
+    for(auto const & cell : dof_handler.active_cell_iterators())
+    {
+      if(cell->is_locally_owned())
+      {
+        dealii::CellId const cell_id = cell->id();
+
+        dealii::types::global_dof_index cell_index = cell_id.get_coarse_cell_id();
+
+        auto const child_indices = cell_id.get_child_indices();
+        for(unsigned int level = 0; level + 1 < n_levels; ++level)
+          cell_index = cell_index * n_children +
+                       (level < child_indices.size() ? child_indices[level] : 0);
+
+        for(unsigned int i = 0; i < dofs_per_cell; ++i)
+          indices.push_back(cell_index * dofs_per_cell + i);
+      }
+    }
+
+    return indices;
+  }
+
+  void
+  copy_to_buffer(unsigned int const field, VectorType const & vector)
+  {
+    dealii::DoFHandler<dim> const & dof_handler = *dof_handlers[field];
+
+    // degrees of freedom shared between cells (e.g. H(div) elements) may be ghosts
+    bool const update_ghosts = not vector.has_ghost_elements();
+    if(update_ghosts)
+      vector.update_ghost_values();
+
+    std::vector<dealii::types::global_dof_index> dof_indices(
+      dof_handler.get_fe().n_dofs_per_cell());
+
+    unsigned int counter = 0;
+    for(auto const & cell : dof_handler.active_cell_iterators())
+    {
+      if(cell->is_locally_owned())
+      {
+        cell->get_dof_indices(dof_indices);
+        for(auto const & index : dof_indices)
+          buffers[field][counter++] = vector(index);
+      }
+    }
+
+    if(update_ghosts)
+      vector.zero_out_ghost_values();
+  }
+
+  void
+  copy_from_buffer(unsigned int const field, VectorType & vector) const
+  {
+    dealii::DoFHandler<dim> const & dof_handler = *dof_handlers[field];
+
+    std::vector<dealii::types::global_dof_index> dof_indices(
+      dof_handler.get_fe().n_dofs_per_cell());
+
+    unsigned int counter = 0;
+    for(auto const & cell : dof_handler.active_cell_iterators())
+    {
+      if(cell->is_locally_owned())
+      {
+        cell->get_dof_indices(dof_indices);
+        for(auto const & index : dof_indices)
+        {
+          if(vector.in_local_range(index))
+            vector(index) = buffers[field][counter];
+          ++counter;
+        }
+      }
+    }
+  }
+
+  void
+  send_metadata(double const flag, double const time, double const time_step_number)
+  {
+    if(dealii::Utilities::MPI::this_mpi_process(in_transit.get_global_communicator()) !=
+       in_transit.get_solver_root())
+      return;
+
+    metadata = {{flag, time, time_step_number}};
+
+    metadata_requests.resize(in_transit.get_n_postprocessing_processes());
+    for(unsigned int p = 0; p < in_transit.get_n_postprocessing_processes(); ++p)
+      MPI_Isend(metadata.data(),
+                metadata.size(),
+                MPI_DOUBLE,
+                in_transit.get_postprocessing_root() + p,
+                metadata_tag,
+                metadata_comm,
+                &metadata_requests[p]);
+  }
+
+  void
+  finish_metadata()
+  {
+    if(not metadata_requests.empty())
+    {
+      MPI_Waitall(metadata_requests.size(), metadata_requests.data(), MPI_STATUSES_IGNORE);
+      metadata_requests.clear();
+    }
+  }
+
+  void
+  finish_snapshot()
+  {
+    if(not snapshot_in_flight)
+      return;
+
+    finish_metadata();
+
+    // the solver processes do not receive data, i.e., this only waits for the sends to complete
+    for(unsigned int field = 0; field < dof_handlers.size(); ++field)
+    {
+      partitioners[field]->export_to_ghosted_array_finish(
+        dealii::ArrayView<Number const>(temporary_storage[field].data(),
+                                        temporary_storage[field].size()),
+        dealii::ArrayView<Number>(),
+        requests[field]);
+    }
+
+    snapshot_in_flight = false;
+  }
+
+  static int const metadata_tag   = 1;
+  static int const statistics_tag = 2;
+
+  InTransitCommunicator const & in_transit;
+
+  std::vector<dealii::DoFHandler<dim> const *> dof_handlers;
+
+  MPI_Comm metadata_comm;
+
+  std::vector<std::shared_ptr<dealii::Utilities::MPI::NoncontiguousPartitioner>> partitioners;
+
+  // values of the locally owned cells in the order of get_canonical_indices()
+  std::vector<std::vector<Number>> buffers;
+
+  std::vector<std::vector<Number>> temporary_storage;
+
+  // requests of the point-to-point communication of each field, which are in flight at the same
+  // time on the solver side
+  std::vector<std::vector<MPI_Request>> requests;
+
+  std::array<double, 3>    metadata;
+  std::vector<MPI_Request> metadata_requests;
+
+  bool snapshot_in_flight;
+
+  unsigned int n_snapshots;
+
+  double postprocessing_wall_time;
+};
+
+} // namespace ExaDG
+
+#endif /* INCLUDE_EXADG_POSTPROCESSOR_SNAPSHOT_TRANSFER_H_ */
@@ -120,7 +120,6 @@ public:
     MAP.getLocalRange(start, end);
     // ... my rows for FFT
     FFT.getLocalRange(start_, end_);
-    bsize = FFT.bsize;
 
     // data structures for determining the communication partners...
     int                 has_length = (end - start) * dealii::Utilities::pow(points, dim);
@@ -435,7 +434,7 @@ public:
     // perform copy operation on local process, if necessary
     for(int s = send_offset[0], t = recv_offset[0]; s < send_offset[1]; s++, t++)
       for(int d = 0; d < dim; d++)
-        target[recv_index[t] + d * bsize] = source[dim * send_index[s] + d];
+        target[recv_index[t] * dim + d] = source[dim * send_index[s] + d];
   }
 
   /**
@@ -454,7 +453,7 @@ public:
       // ... copy data from buffers
       for(int j = recv_offset[i + 1]; j < recv_offset[i + 2]; j++)
         for(int d = 0; d < dim; d++)
-          target[recv_index[j] + d * bsize] = recv_buffer[j * dim + d];
+          target[recv_index[j] * dim + d] = recv_buffer[j * dim + d];
     }
 
     // wait that e.th has been send away
@@ -489,10 +488,8 @@ private:
   // ... range of buffer to be received from a process
   std::vector<int> recv_offset;
 
-  // dimensions
+  // dimensions (the components are stored interleaved in target)
   int dim;
-  // portion of target dedicated for each direction
-  int bsize;
 };
 
 } // namespace dealspectrum
@@ -29,17 +29,17 @@
 // ExaDG
 #include <exadg/postprocessor/spectral_analysis/setup.h>
 
-// shortcuts for accessing linearized arrays
-#define u_comp2(i, j) u_comp[(j - local_start) * (N / 2 + 1) + i]
-#define v_comp2(i, j) v_comp[(j - local_start) * (N / 2 + 1) + i]
-#define u_comp3(i, j, k) u_comp[((k - local_start) * N + j) * (N / 2 + 1) + i]
-#define v_comp3(i, j, k) v_comp[((k - local_start) * N + j) * (N / 2 + 1) + i]
-#define w_comp3(i, j, k) w_comp[((k - local_start) * N + j) * (N / 2 + 1) + i]
+// shortcuts for accessing linearized arrays (the velocity components d are stored interleaved)
+#define comp2(d, i, j) data_comp[((j - local_start) * (N / 2 + 1) + i) * dim + d]
+#define comp3(d, i, j, k) data_comp[(((k - local_start) * N + j) * (N / 2 + 1) + i) * dim + d]
 
 namespace dealspectrum
 {
 /**
  * Class wrapping FFTW and performing energy spectral analysis.
+ *
+ * All velocity components are transformed by a single batched transform (the components are
+ * stored interleaved). The FFTW plan is created once in init() and reused for all evaluations.
  */
 class SpectralAnalysis
 {
@@ -51,13 +51,17 @@ class SpectralAnalysis
   bool initialized;
   // rank of process which owns row
   int * _indices_proc_rows;
+  // planner flags of FFTW (e.g. FFTW_ESTIMATE or FFTW_MEASURE)
+  unsigned int const planner_flags;
 
 public:
   /**
    * Constructor
-   * @param s DEAL.SPECTRUM setup
+   * @param s               DEAL.SPECTRUM setup
+   * @param planner_flags   FFTW planner flags used to create the plan in init()
    */
-  SpectralAnalysis(MPI_Comm const & comm, Setup & s) : comm(comm), s(s), initialized(false)
+  SpectralAnalysis(MPI_Comm const & comm, Setup & s, unsigned int const planner_flags)
+    : comm(comm), s(s), initialized(false), planner_flags(planner_flags)
   {
   }
 
@@ -110,10 +114,11 @@ public:
       n[i] = N;
     n[dim - 1] = N / 2 + 1;
 
-    // ...get local size of local output arrays
+    // ...get local size of local output arrays (for all dim components)
     ptrdiff_t local_elements = 0;
-    alloc_local              = fftw_mpi_local_size(dim, n, comm, &local_elements, &local_start);
-    local_end                = local_start + local_elements;
+    alloc_local              = fftw_mpi_local_size_many(
+      dim, n, dim /*howmany*/, FFTW_MPI_DEFAULT_BLOCK, comm, &local_elements, &local_start);
+    local_end = local_start + local_elements;
 
     // determine how many rows each process has
     int * global_elements = new int[size];
@@ -134,27 +139,28 @@ public:
 
     // allocate memory
     // ... for input array (real) - allocated together for all directions
-    u_real = fftw_alloc_real(2 * alloc_local * dim);
-    // ... and save required size
-    this->bsize = 2 * alloc_local;
-
-    // initialize input array with zero (not needed: only useful for IO -> hard zero)
-    for(int i = 0; i < 2 * alloc_local * dim; i++)
-      u_real[i] = 0;
-
-    // set pointer for v input field
-    v_real = u_real + 2 * alloc_local;
+    data_real = fftw_alloc_real(2 * alloc_local);
+    // ... and save required size per direction
+    this->bsize = 2 * alloc_local / dim;
 
     // allocate memory for output array (complex)
-    u_comp = fftw_alloc_complex(alloc_local);
-    v_comp = fftw_alloc_complex(alloc_local);
+    data_comp = fftw_alloc_complex(alloc_local);
+
+    // create the plan once: planning with FFTW_MEASURE overwrites the arrays, i.e. this has to be
+    // done before the arrays are filled
+    plan = fftw_mpi_plan_many_dft_r2c(dim,
+                                      n,
+                                      dim /*howmany*/,
+                                      FFTW_MPI_DEFAULT_BLOCK,
+                                      FFTW_MPI_DEFAULT_BLOCK,
+                                      data_real,
+                                      data_comp,
+                                      comm,
+                                      planner_flags);
 
-    // do the same for 3D
-    if(dim == 3)
-    {
-      w_real = v_real + 2 * alloc_local;
-      w_comp = fftw_alloc_complex(alloc_local);
-    }
+    // initialize input array with zero (not needed: only useful for IO -> hard zero)
+    for(int i = 0; i < 2 * alloc_local; i++)
+      data_real[i] = 0;
 
     // allocate memory and ...
     this->e = new double[N];
@@ -177,47 +183,27 @@ public:
     // free data structures
     delete[] _indices_proc_rows;
 
-    free(n);
-    fftw_free(u_comp);
-    fftw_free(v_comp);
-    free(u_real);
+    fftw_destroy_plan(plan);
 
-    if(dim == 3)
-    {
-      fftw_free(w_comp);
-    }
+    delete[] n;
+    fftw_free(data_comp);
+    fftw_free(data_real);
 
-    delete e;
-    delete E;
-    delete k;
-    delete K;
-    delete c;
-    delete C;
+    delete[] e;
+    delete[] E;
+    delete[] k;
+    delete[] K;
+    delete[] c;
+    delete[] C;
   }
 
   /**
-   * Perform FFT with FFTW
+   * Perform FFT with FFTW (all components at once)
    */
   void
   execute()
   {
-    // perform FFT for u
-    fftw_plan pu = fftw_mpi_plan_dft_r2c(dim, n, u_real, u_comp, comm, FFTW_ESTIMATE);
-    fftw_execute(pu);
-    fftw_destroy_plan(pu);
-
-    // ... for v
-    fftw_plan pv = fftw_mpi_plan_dft_r2c(dim, n, v_real, v_comp, comm, FFTW_ESTIMATE);
-    fftw_execute(pv);
-    fftw_destroy_plan(pv);
-
-    // ... for w
-    if(dim == 3)
-    {
-      fftw_plan pw = fftw_mpi_plan_dft_r2c(dim, n, w_real, w_comp, comm, FFTW_ESTIMATE);
-      fftw_execute(pw);
-      fftw_destroy_plan(pw);
-    }
+    fftw_execute(plan);
   }
 
   void
@@ -226,9 +212,9 @@ public:
     double scaling    = pow(N, dim);
     double e_physical = 0.0, e_spectral = 0.0;
 
-    for(int i = 0; i < 2 * alloc_local * dim; i++)
+    for(int i = 0; i < 2 * alloc_local; i++)
     {
-      e_physical += u_real[i] * u_real[i];
+      e_physical += data_real[i] * data_real[i];
     }
 
     // scale: integrate cell wise...
@@ -242,10 +228,9 @@ public:
       {
         for(int i = 0; i < N; i++)
         {
-          e_spectral += u_comp2(MIN(i, N - i), j)[0] * u_comp2(MIN(i, N - i), j)[0] +
-                        u_comp2(MIN(i, N - i), j)[1] * u_comp2(MIN(i, N - i), j)[1] +
-                        v_comp2(MIN(i, N - i), j)[0] * v_comp2(MIN(i, N - i), j)[0] +
-                        v_comp2(MIN(i, N - i), j)[1] * v_comp2(MIN(i, N - i), j)[1];
+          for(int d = 0; d < dim; d++)
+            e_spectral += comp2(d, MIN(i, N - i), j)[0] * comp2(d, MIN(i, N - i), j)[0] +
+                          comp2(d, MIN(i, N - i), j)[1] * comp2(d, MIN(i, N - i), j)[1];
         }
       }
     }
@@ -257,12 +242,9 @@ public:
         {
           for(int i = 0; i < N; i++)
           {
-            e_spectral += u_comp3(MIN(i, N - i), j, k_)[0] * u_comp3(MIN(i, N - i), j, k_)[0] +
-                          u_comp3(MIN(i, N - i), j, k_)[1] * u_comp3(MIN(i, N - i), j, k_)[1] +
-                          v_comp3(MIN(i, N - i), j, k_)[0] * v_comp3(MIN(i, N - i), j, k_)[0] +
-                          v_comp3(MIN(i, N - i), j, k_)[1] * v_comp3(MIN(i, N - i), j, k_)[1] +
-                          w_comp3(MIN(i, N - i), j, k_)[0] * w_comp3(MIN(i, N - i), j, k_)[0] +
-                          w_comp3(MIN(i, N - i), j, k_)[1] * w_comp3(MIN(i, N - i), j, k_)[1];
+            for(int d = 0; d < dim; d++)
+              e_spectral += comp3(d, MIN(i, N - i), j, k_)[0] * comp3(d, MIN(i, N - i), j, k_)[0] +
+                            comp3(d, MIN(i, N - i), j, k_)[1] * comp3(d, MIN(i, N - i), j, k_)[1];
           }
         }
       }
@@ -309,10 +291,9 @@ public:
           // ... use for binning
           int p = static_cast<int>(std::round(r));
           // ... update energy
-          e[p] += u_comp2(MIN(i, N - i), j)[0] * u_comp2(MIN(i, N - i), j)[0] +
-                  u_comp2(MIN(i, N - i), j)[1] * u_comp2(MIN(i, N - i), j)[1] +
-                  v_comp2(MIN(i, N - i), j)[0] * v_comp2(MIN(i, N - i), j)[0] +
-                  v_comp2(MIN(i, N - i), j)[1] * v_comp2(MIN(i, N - i), j)[1];
+          for(int d = 0; d < dim; d++)
+            e[p] += comp2(d, MIN(i, N - i), j)[0] * comp2(d, MIN(i, N - i), j)[0] +
+                    comp2(d, MIN(i, N - i), j)[1] * comp2(d, MIN(i, N - i), j)[1];
 
           // ... update kappa results
           k[p] += r;
@@ -334,12 +315,9 @@ public:
             // ... use for binning
             int p = static_cast<int>(std::round(r));
             // ... update energy
-            e[p] += u_comp3(MIN(i, N - i), j, k_)[0] * u_comp3(MIN(i, N - i), j, k_)[0] +
-                    u_comp3(MIN(i, N - i), j, k_)[1] * u_comp3(MIN(i, N - i), j, k_)[1] +
-                    v_comp3(MIN(i, N - i), j, k_)[0] * v_comp3(MIN(i, N - i), j, k_)[0] +
-                    v_comp3(MIN(i, N - i), j, k_)[1] * v_comp3(MIN(i, N - i), j, k_)[1] +
-                    w_comp3(MIN(i, N - i), j, k_)[0] * w_comp3(MIN(i, N - i), j, k_)[0] +
-                    w_comp3(MIN(i, N - i), j, k_)[1] * w_comp3(MIN(i, N - i), j, k_)[1];
+            for(int d = 0; d < dim; d++)
+              e[p] += comp3(d, MIN(i, N - i), j, k_)[0] * comp3(d, MIN(i, N - i), j, k_)[0] +
+                      comp3(d, MIN(i, N - i), j, k_)[1] * comp3(d, MIN(i, N - i), j, k_)[1];
 
             // ... update kappa results
             k[p] += r;
@@ -401,25 +379,20 @@ public:
     int        dofs = (end - start) * delta;
     MPI_Offset disp = 8 * sizeof(int) + start * delta * sizeof(double); // bytes
 
-    // create view
+    // create view: the components are stored interleaved in memory, but one after another in
+    // the file
     MPI_Datatype stype;
-    MPI_Type_contiguous(dofs, MPI_DOUBLE, &stype);
+    MPI_Type_vector(dofs, 1, dim, MPI_DOUBLE, &stype);
     MPI_Type_commit(&stype);
 
-    // read file
+    // write file
     MPI_File fh;
     MPI_File_open(comm, filename, MPI_MODE_WRONLY, MPI_INFO_NULL, &fh);
 
-    MPI_File_set_view(fh, disp + delta_all * 0, MPI_DOUBLE, MPI_DOUBLE, "native", MPI_INFO_NULL);
-    MPI_File_write_all(fh, u_real, dofs, MPI_DOUBLE, MPI_STATUSES_IGNORE);
-
-    MPI_File_set_view(fh, disp + delta_all * 1, MPI_DOUBLE, MPI_DOUBLE, "native", MPI_INFO_NULL);
-    MPI_File_write_all(fh, v_real, dofs, MPI_DOUBLE, MPI_STATUSES_IGNORE);
-
-    if(dim == 3)
+    for(int d = 0; d < dim; d++)
     {
-      MPI_File_set_view(fh, disp + delta_all * 2, MPI_DOUBLE, MPI_DOUBLE, "native", MPI_INFO_NULL);
-      MPI_File_write_all(fh, w_real, dofs, MPI_DOUBLE, MPI_STATUSES_IGNORE);
+      MPI_File_set_view(fh, disp + delta_all * d, MPI_DOUBLE, MPI_DOUBLE, "native", MPI_INFO_NULL);
+      MPI_File_write_all(fh, data_real + d, 1, stype, MPI_STATUSES_IGNORE);
     }
 
     MPI_File_close(&fh);
@@ -443,25 +416,20 @@ public:
     int        dofs = (end - start) * delta;
     MPI_Offset disp = 8 * sizeof(int) + start * delta * sizeof(double); // bytes
 
-    // create view
+    // create view: the components are stored interleaved in memory, but one after another in
+    // the file
     MPI_Datatype stype;
-    MPI_Type_contiguous(dofs, MPI_DOUBLE, &stype);
+    MPI_Type_vector(dofs, 1, dim, MPI_DOUBLE, &stype);
     MPI_Type_commit(&stype);
 
     // read file
     MPI_File fh;
     MPI_File_open(comm, filename, MPI_MODE_RDONLY, MPI_INFO_NULL, &fh);
 
-    MPI_File_set_view(fh, disp + delta_all * 0, MPI_DOUBLE, MPI_DOUBLE, "native", MPI_INFO_NULL);
-    MPI_File_read_all(fh, u_real, dofs, MPI_DOUBLE, MPI_STATUSES_IGNORE);
-
-    MPI_File_set_view(fh, disp + delta_all * 1, MPI_DOUBLE, MPI_DOUBLE, "native", MPI_INFO_NULL);
-    MPI_File_read_all(fh, v_real, dofs, MPI_DOUBLE, MPI_STATUSES_IGNORE);
-
-    if(dim == 3)
+    for(int d = 0; d < dim; d++)
     {
-      MPI_File_set_view(fh, disp + delta_all * 2, MPI_DOUBLE, MPI_DOUBLE, "native", MPI_INFO_NULL);
-      MPI_File_read_all(fh, w_real, dofs, MPI_DOUBLE, MPI_STATUSES_IGNORE);
+      MPI_File_set_view(fh, disp + delta_all * d, MPI_DOUBLE, MPI_DOUBLE, "native", MPI_INFO_NULL);
+      MPI_File_read_all(fh, data_real + d, 1, stype, MPI_STATUSES_IGNORE);
     }
 
     MPI_File_close(&fh);
@@ -488,22 +456,16 @@ private:
   ptrdiff_t alloc_local;
 
 public:
-  // size of each real field
+  // size of each real field (per direction)
   int bsize;
-  // real field for u
-  double * u_real;
+  // real field for all directions (interleaved, i.e. entry c of direction d is data_real[c*dim+d])
+  double * data_real;
 
 private:
-  // ... for v
-  double * v_real;
-  // ... for w
-  double * w_real;
-  // complex field for u
-  fftw_complex * u_comp;
-  // ... for v
-  fftw_complex * v_comp;
-  // ... for w
-  fftw_complex * w_comp;
+  // complex field for all directions (interleaved)
+  fftw_complex * data_comp;
+  // persistent FFTW plan
+  fftw_plan plan;
 
 private:
   // array for locally collecting energy
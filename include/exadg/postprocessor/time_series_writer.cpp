@@ -0,0 +1,242 @@
+/*  ______________________________________________________________________
+ *
+ *  ExaDG - High-Order Discontinuous Galerkin for the Exa-Scale
+ *
+ *  Copyright (C) 2021 by the ExaDG authors
+ *
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation, either version 3 of the License, or
+ *  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ *  ______________________________________________________________________
+ */
+
+// C/C++
+#include <filesystem>
+#include <fstream>
+#include <iomanip>
+#include <limits>
+#include <sstream>
+
+// deal.II
+#include <deal.II/base/exceptions.h>
+
+// ExaDG
+#include <exadg/postprocessor/time_series_writer.h>
+
+namespace ExaDG
+{
+namespace
+{
+char const          binary_magic[8]   = {'E', 'X', 'A', 'D', 'G', 'T', 'S', '1'};
+std::uint32_t const invalid_n_columns = std::numeric_limits<std::uint32_t>::max();
+} // namespace
+
+TimeSeriesWriter::TimeSeriesWriter(MPI_Comm const & comm)
+  : is_active(dealii::Utilities::MPI::this_mpi_process(comm) == 0),
+    precision(12),
+    width(20),
+    left_aligned(false),
+    truncate_file(false),
+    n_buffered_rows(0),
+    n_columns(invalid_n_columns),
+    last_flush(std::chrono::steady_clock::now()),
+    flush_requested(false),
+    shutdown(false)
+{
+}
+
+TimeSeriesWriter::~TimeSeriesWriter()
+{
+  if(thread.joinable())
+  {
+    {
+      std::lock_guard<std::mutex> lock(buffer_mutex);
+      shutdown = true;
+    }
+    condition.notify_one();
+    thread.join();
+  }
+
+  if(is_active and not filename.empty())
+    write_buffer();
+}
+
+void
+TimeSeriesWriter::setup(std::string const &          filename_in,
+                        TimeSeriesWriterData const & data_in,
+                        unsigned int const           precision_in,
+                        unsigned int const           width_in,
+                        bool const                   left_aligned_in)
+{
+  AssertThrow(not thread.joinable(),
+              dealii::ExcMessage("TimeSeriesWriter::setup() must only be called once."));
+
+  filename     = filename_in;
+  data         = data_in;
+  precision    = precision_in;
+  width        = width_in;
+  left_aligned = left_aligned_in;
+
+  AssertThrow(data.buffer_size > 0, dealii::ExcMessage("buffer_size has to be larger than 0."));
+
+  if(is_active and data.asynchronous)
+    thread = std::thread(&TimeSeriesWriter::background_loop, this);
+}
+
+void
+TimeSeriesWriter::start_file(std::string const & header)
+{
+  if(not is_active)
+    return;
+
+  std::lock_guard<std::mutex> lock(buffer_mutex);
+
+  truncate_file = true;
+  buffer_text   = header;
+  buffer_binary.clear();
+  n_buffered_rows = 0;
+  n_columns       = invalid_n_columns;
+}
+
+void
+TimeSeriesWriter::write_row(std::vector<double> const & values)
+{
+  if(not is_active)
+    return;
+
+  std::ostringstream row;
+  row << std::scientific << std::setprecision(precision);
+  if(left_aligned)
+    row << std::left;
+  for(double const value : values)
+    row << std::setw(width) << value;
+  row << std::endl;
+
+  bool needs_flush = false;
+  {
+    std::lock_guard<std::mutex> lock(buffer_mutex);
+
+    buffer_text += row.str();
+
+    if(data.write_binary)
+    {
+      if(n_columns == invalid_n_columns)
+        n_columns = values.size();
+
+      AssertThrow(values.size() == n_columns,
+                  dealii::ExcMessage("All rows of a binary time series need the same length."));
+
+      buffer_binary.insert(buffer_binary.end(), values.begin(), values.end());
+    }
+
+    ++n_buffered_rows;
+
+    std::chrono::duration<double> const time_since_flush =
+      std::chrono::steady_clock::now() - last_flush;
+
+    needs_flush =
+      n_buffered_rows >= data.buffer_size or time_since_flush.count() >= data.flush_interval;
+
+    if(needs_flush and data.asynchronous)
+      flush_requested = true;
+  }
+
+  if(needs_flush)
+  {
+    if(data.asynchronous)
+      condition.notify_one();
+    else
+      write_buffer();
+  }
+}
+
+void
+TimeSeriesWriter::flush()
+{
+  if(is_active)
+    write_buffer();
+}
+
+void
+TimeSeriesWriter::write_buffer()
+{
+  std::lock_guard<std::mutex> file_lock(file_mutex);
+
+  bool                truncate = false;
+  std::string         text;
+  std::vector<double> binary;
+  std::uint32_t       columns = invalid_n_columns;
+  {
+    std::lock_guard<std::mutex> lock(buffer_mutex);
+
+    truncate      = truncate_file;
+    truncate_file = false;
+    text.swap(buffer_text);
+    binary.swap(buffer_binary);
+    columns         = n_columns;
+    n_buffered_rows = 0;
+    last_flush      = std::chrono::steady_clock::now();
+  }
+
+  if(text.empty() and not truncate)
+    return;
+
+  {
+    std::ofstream f(filename, truncate ? std::ios::trunc : std::ios::app);
+    f << text;
+  }
+
+  if(data.write_binary)
+  {
+    std::string const filename_binary = filename + ".bin";
+
+    bool const write_header = truncate or not std::filesystem::exists(filename_binary) or
+                              std::filesystem::file_size(filename_binary) == 0;
+
+    std::ofstream f(filename_binary,
+                    std::ios::binary | (truncate ? std::ios::trunc : std::ios::app));
+
+    if(binary.size() > 0)
+    {
+      if(write_header)
+      {
+        f.write(binary_magic, sizeof(binary_magic));
+        f.write(reinterpret_cast<char const *>(&columns), sizeof(columns));
+      }
+
+      f.write(reinterpret_cast<char const *>(binary.data()),
+              static_cast<std::streamsize>(binary.size() * sizeof(double)));
+    }
+  }
+}
+
+void
+TimeSeriesWriter::background_loop()
+{
+  bool stop = false;
+  while(not stop)
+  {
+    {
+      std::unique_lock<std::mutex> lock(buffer_mutex);
+      condition.wait_for(lock, std::chrono::duration<double>(data.flush_interval), [&]() {
+        return flush_requested or shutdown;
+      });
+
+      flush_requested = false;
+      stop            = shutdown;
+    }
+
+    write_buffer();
+  }
+}
+
+} // namespace ExaDG
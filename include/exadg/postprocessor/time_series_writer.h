@@ -0,0 +1,152 @@
+/*  ______________________________________________________________________
+ *
+ *  ExaDG - High-Order Discontinuous Galerkin for the Exa-Scale
+ *
+ *  Copyright (C) 2021 by the ExaDG authors
+ *
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation, either version 3 of the License, or
+ *  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ *  ______________________________________________________________________
+ */
+
+#ifndef INCLUDE_EXADG_POSTPROCESSOR_TIME_SERIES_WRITER_H_
+#define INCLUDE_EXADG_POSTPROCESSOR_TIME_SERIES_WRITER_H_
+
+// C/C++
+#include <chrono>
+#include <condition_variable>
+#include <cstdint>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+
+// deal.II
+#include <deal.II/base/mpi.h>
+
+namespace ExaDG
+{
+struct TimeSeriesWriterData
+{
+  TimeSeriesWriterData()
+    : asynchronous(false), buffer_size(100), flush_interval(10.0), write_binary(false)
+  {
+  }
+
+  // Write buffered rows from a background thread instead of the thread calling write_row(). Each
+  // writer owns its own thread, so this option should only be enabled for few writers with
+  // expensive file accesses (e.g., on slow parallel file systems).
+  bool asynchronous;
+
+  // number of rows kept in memory before they are written to file
+  unsigned int buffer_size;
+
+  // maximum time (in seconds of wall time) rows are kept in memory before they are written to file
+  double flush_interval;
+
+  // In addition to the text file, write all rows to a binary file "<filename>.bin". The binary
+  // file consists of the 8 characters "EXADGTS1", the number of columns as 32-bit unsigned integer,
+  // and the rows as consecutive doubles in native byte order.
+  bool write_binary;
+};
+
+/**
+ * Sink for scalar time series written by postprocessing tools (e.g., lift and drag coefficients,
+ * kinetic energy, errors). Rows are formatted and buffered in memory on the first MPI process only,
+ * and written to file in blocks, synchronously by default or optionally from a background thread.
+ * This avoids opening and closing files on every evaluation.
+ *
+ * Buffered rows are written to file when the object is destroyed and when flush() is called, which
+ * should be done at points where the file is expected to be complete (e.g., at the end of a
+ * simulation). Rows buffered at the time the program aborts are lost, which is limited by
+ * buffer_size and flush_interval.
+ */
+class TimeSeriesWriter
+{
+public:
+  TimeSeriesWriter(MPI_Comm const & comm);
+
+  ~TimeSeriesWriter();
+
+  TimeSeriesWriter(TimeSeriesWriter const &) = delete;
+
+  TimeSeriesWriter &
+  operator=(TimeSeriesWriter const &) = delete;
+
+  /*
+   * Each value of a row is written with std::scientific format, the given precision and the given
+   * field width.
+   */
+  void
+  setup(std::string const &          filename,
+        TimeSeriesWriterData const & data,
+        unsigned int const           precision    = 12,
+        unsigned int const           width        = 20,
+        bool const                   left_aligned = false);
+
+  /*
+   * Starts a new file containing the given header (written as is). Existing files are truncated
+   * and rows that have not been written yet are discarded.
+   */
+  void
+  start_file(std::string const & header);
+
+  /*
+   * Appends a row of values. The number of values has to be the same for all rows of a file if
+   * the binary output is used.
+   */
+  void
+  write_row(std::vector<double> const & values);
+
+  /*
+   * Writes all buffered rows to file. This function returns once the data has been written.
+   */
+  void
+  flush();
+
+private:
+  void
+  write_buffer();
+
+  void
+  background_loop();
+
+  bool                 is_active;
+  std::string          filename;
+  TimeSeriesWriterData data;
+  unsigned int         precision;
+  unsigned int         width;
+  bool                 left_aligned;
+
+  // buffer, protected by buffer_mutex
+  std::mutex                            buffer_mutex;
+  bool                                  truncate_file;
+  std::string                           buffer_text;
+  std::vector<double>                   buffer_binary;
+  unsigned int                          n_buffered_rows;
+  std::uint32_t                         n_columns;
+  std::chrono::steady_clock::time_point last_flush;
+
+  // serializes write accesses to the files
+  std::mutex file_mutex;
+
+  // background thread
+  std::thread             thread;
+  std::condition_variable condition;
+  bool                    flush_requested;
+  bool                    shutdown;
+};
+
+} // namespace ExaDG
+
+#endif /* INCLUDE_EXADG_POSTPROCESSOR_TIME_SERIES_WRITER_H_ */
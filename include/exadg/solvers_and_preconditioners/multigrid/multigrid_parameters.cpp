@@ -69,4 +69,16 @@ MultigridData::involves_p_transfer() const
   }
 }
 
+bool
+MultigridData::mesh_motion_coarse_levels_need_update(
+  unsigned int const              n_updates_since_coarse_update,
+  std::function<double()> const & compute_relative_change_of_jxw) const
+{
+  if(mesh_motion_coarse_update_interval <= 1)
+    return true;
+
+  return (n_updates_since_coarse_update >= mesh_motion_coarse_update_interval) or
+         (compute_relative_change_of_jxw() > mesh_motion_coarse_update_tolerance);
+}
+
 } // namespace ExaDG
@@ -23,6 +23,7 @@
 #define INCLUDE_SOLVERS_AND_PRECONDITIONERS_MULTIGRIDINPUTPARAMETERS_H_
 
 // C/C++
+#include <functional>
 #include <string>
 #include <vector>
 
@@ -174,7 +175,10 @@ struct SmootherData
       iterations(5),
       relaxation_factor(0.8),
       smoothing_range(20),
-      iterations_eigenvalue_estimation(20)
+      iterations_eigenvalue_estimation(20),
+      reuse_eigenvalue_estimates(false),
+      iterations_power_iteration(5),
+      eigenvalue_drift_tolerance(0.1)
   {
   }
 
@@ -194,6 +198,13 @@ struct SmootherData
     {
       print_parameter(pcout, "Smoothing range", smoothing_range);
       print_parameter(pcout, "Iterations eigenvalue estimation", iterations_eigenvalue_estimation);
+      print_parameter(pcout, "Reuse eigenvalue estimates", reuse_eigenvalue_estimates);
+
+      if(reuse_eigenvalue_estimates)
+      {
+        print_parameter(pcout, "Iterations power iteration", iterations_power_iteration);
+        print_parameter(pcout, "Eigenvalue drift tolerance", eigenvalue_drift_tolerance);
+      }
     }
   }
 
@@ -214,6 +225,21 @@ struct SmootherData
 
   // Chebyshev smmother: number of CG iterations for estimation of eigenvalues
   unsigned int iterations_eigenvalue_estimation;
+
+  // Chebyshev smoother: reuse the eigenvalue estimate across updates of the smoother instead of
+  // re-running the CG eigenvalue estimation on every update. A drift of the largest eigenvalue is
+  // detected by the Rayleigh quotient of an eigenvector approximation computed by a power iteration
+  // after the last CG eigenvalue estimation. The cached estimate is rescaled if the drift is below
+  // the tolerance, and a new CG eigenvalue estimation is performed otherwise.
+  bool reuse_eigenvalue_estimates;
+
+  // Chebyshev smoother: number of power iterations used to approximate the eigenvector of the
+  // largest eigenvalue after a CG eigenvalue estimation
+  unsigned int iterations_power_iteration;
+
+  // Chebyshev smoother: relative change of the largest eigenvalue (as measured by the Rayleigh
+  // quotient) up to which the cached eigenvalue estimate is reused
+  double eigenvalue_drift_tolerance;
 };
 
 struct CoarseGridData
@@ -261,7 +287,9 @@ struct MultigridData
     : type(MultigridType::hMG),
       p_sequence(PSequenceType::Bisect),
       smoother_data(SmootherData()),
-      coarse_problem(CoarseGridData())
+      coarse_problem(CoarseGridData()),
+      mesh_motion_coarse_update_interval(1),
+      mesh_motion_coarse_update_tolerance(0.05)
   {
   }
 
@@ -278,6 +306,14 @@ struct MultigridData
     smoother_data.print(pcout);
 
     coarse_problem.print(pcout);
+
+    print_parameter(pcout, "Mesh motion: coarse update interval", mesh_motion_coarse_update_interval);
+    if(mesh_motion_coarse_update_interval > 1)
+    {
+      print_parameter(pcout,
+                      "Mesh motion: coarse update tolerance",
+                      mesh_motion_coarse_update_tolerance);
+    }
   }
 
   bool
@@ -289,6 +325,16 @@ struct MultigridData
   bool
   involves_p_transfer() const;
 
+  /*
+   * Moving meshes: Returns whether the coarser h-levels need to be updated, given the number of
+   * grid updates since the last update of the coarser h-levels (including the current one). The
+   * relative change of the integration weights is only computed if needed.
+   */
+  bool
+  mesh_motion_coarse_levels_need_update(
+    unsigned int const              n_updates_since_coarse_update,
+    std::function<double()> const & compute_relative_change_of_jxw) const;
+
   // Multigrid type: p-MG vs. h-MG
   MultigridType type;
 
@@ -300,6 +346,19 @@ struct MultigridData
 
   // Coarse grid problem
   CoarseGridData coarse_problem;
+
+  // Moving meshes: The multigrid levels on the finest h-level are updated whenever the grid has
+  // been deformed. The mappings and matrix-free objects on coarser h-levels (and the operators on
+  // these levels) are only updated every mesh_motion_coarse_update_interval updates, or if the
+  // deformation of the grid exceeds mesh_motion_coarse_update_tolerance, see below. A value of 1
+  // updates all levels every time. The DoF handlers, constraints and transfer operators are not
+  // affected by mesh motion.
+  unsigned int mesh_motion_coarse_update_interval;
+
+  // Moving meshes: maximum relative change of the integration weights JxW on the finest level since
+  // the last update of the coarser h-levels, above which the coarser h-levels are updated
+  // irrespective of mesh_motion_coarse_update_interval.
+  double mesh_motion_coarse_update_tolerance;
 };
 
 } // namespace ExaDG
@@ -20,11 +20,13 @@
  */
 
 // deal.II
+#include <deal.II/base/mpi.h>
 #include <deal.II/fe/fe_dgq.h>
 #include <deal.II/fe/fe_q.h>
 #include <deal.II/fe/fe_simplex_p.h>
 #include <deal.II/fe/fe_system.h>
 #include <deal.II/grid/grid_tools.h>
+#include <deal.II/matrix_free/fe_evaluation.h>
 #include <deal.II/numerics/vector_tools.h>
 
 // ExaDG
@@ -48,7 +50,7 @@ namespace ExaDG
 template<int dim, typename Number, typename MultigridNumber>
 MultigridPreconditionerBase<dim, Number, MultigridNumber>::MultigridPreconditionerBase(
   MPI_Comm const & comm)
-  : mpi_comm(comm)
+  : mpi_comm(comm), n_updates_since_coarse_update(0), setup_profiler("Multigrid")
 {
 }
 
@@ -72,26 +74,33 @@ MultigridPreconditionerBase<dim, Number, MultigridNumber>::initialize(
 
   bool const is_dg = (fe.dofs_per_vertex == 0);
 
-  this->initialize_levels(fe.degree, is_dg);
+  setup_profiler.measure({"Levels"}, [&]() { this->initialize_levels(fe.degree, is_dg); });
 
-  this->initialize_mapping();
+  setup_profiler.measure({"Mapping"}, [&]() { this->initialize_mapping(); });
 
-  this->initialize_dof_handler_and_constraints(operator_is_singular,
-                                               fe.n_components(),
-                                               dirichlet_bc,
-                                               dirichlet_bc_component_mask);
+  setup_profiler.measure({"DoF handlers and constraints"}, [&]() {
+    this->initialize_dof_handler_and_constraints(operator_is_singular,
+                                                 fe.n_components(),
+                                                 dirichlet_bc,
+                                                 dirichlet_bc_component_mask);
+  });
 
-  this->initialize_matrix_free_objects();
+  setup_profiler.measure({"MatrixFree"}, [&]() { this->initialize_matrix_free_objects(); });
 
-  this->initialize_transfer_operators();
+  setup_profiler.measure({"Transfer operators"}, [&]() { this->initialize_transfer_operators(); });
 
-  this->initialize_operators();
+  setup_profiler.measure({"Level operators"}, [&]() { this->initialize_operators(); });
 
-  this->initialize_smoothers(initialize_preconditioners);
+  setup_profiler.measure({"Smoothers"},
+                         [&]() { this->initialize_smoothers(initialize_preconditioners); });
 
-  this->initialize_coarse_solver(operator_is_singular, initialize_preconditioners);
+  // includes e.g. the setup of algebraic multigrid on the coarse level
+  setup_profiler.measure({"Coarse grid solver"}, [&]() {
+    this->initialize_coarse_solver(operator_is_singular, initialize_preconditioners);
+  });
 
-  this->initialize_multigrid_algorithm();
+  setup_profiler.measure({"Multigrid algorithm"},
+                         [&]() { this->initialize_multigrid_algorithm(); });
 }
 
 template<int dim, typename Number, typename MultigridNumber>
@@ -601,6 +610,104 @@ MultigridPreconditionerBase<dim, Number, MultigridNumber>::update_matrix_free_ob
   });
 }
 
+template<int dim, typename Number, typename MultigridNumber>
+bool
+MultigridPreconditionerBase<dim, Number, MultigridNumber>::update_after_grid_motion(
+  std::function<void(unsigned int const)> const & function_on_level)
+{
+  // Levels on the finest h-level (e.g. levels of p- or c-transfer) use the fine-level mapping,
+  // which has already been updated, and are therefore updated in any case.
+  unsigned int const fine_h_level = level_info.back().h_level();
+
+  for_all_levels([&](unsigned int const level) {
+    if(level_info[level].h_level() == fine_h_level)
+    {
+      matrix_free_objects[level]->update_mapping(get_mapping(fine_h_level));
+      function_on_level(level);
+    }
+  });
+
+  if(level_info.front().h_level() == fine_h_level)
+    return true;
+
+  // coarser h-levels
+  ++n_updates_since_coarse_update;
+
+  bool const update_coarse_levels =
+    data.mesh_motion_coarse_levels_need_update(n_updates_since_coarse_update, [&]() {
+      return compute_relative_change_of_jxw(false /* reinit_reference */);
+    });
+
+  if(update_coarse_levels)
+  {
+    this->initialize_mapping();
+
+    for_all_levels([&](unsigned int const level) {
+      if(level_info[level].h_level() != fine_h_level)
+      {
+        matrix_free_objects[level]->update_mapping(get_mapping(level_info[level].h_level()));
+        function_on_level(level);
+      }
+    });
+
+    n_updates_since_coarse_update = 0;
+
+    if(data.mesh_motion_coarse_update_interval > 1)
+      compute_relative_change_of_jxw(true /* reinit_reference */);
+  }
+
+  return update_coarse_levels;
+}
+
+template<int dim, typename Number, typename MultigridNumber>
+double
+MultigridPreconditionerBase<dim, Number, MultigridNumber>::compute_relative_change_of_jxw(
+  bool const reinit_reference)
+{
+  dealii::MatrixFree<dim, MultigridNumber> const & matrix_free =
+    *matrix_free_objects[get_number_of_levels() - 1];
+
+  dealii::FEEvaluation<dim, -1, 0, 1, MultigridNumber> integrator(matrix_free, 0, 0);
+
+  unsigned int const n_q_points = integrator.n_q_points;
+
+  bool const reference_is_valid =
+    (jxw_reference.size() == matrix_free.n_cell_batches() * n_q_points);
+
+  if(reinit_reference or not(reference_is_valid))
+    jxw_reference.resize(matrix_free.n_cell_batches() * n_q_points);
+
+  double max_relative_change = 0.0;
+
+  for(unsigned int cell = 0; cell < matrix_free.n_cell_batches(); ++cell)
+  {
+    integrator.reinit(cell);
+
+    for(unsigned int q = 0; q < n_q_points; ++q)
+    {
+      dealii::VectorizedArray<MultigridNumber> & reference = jxw_reference[cell * n_q_points + q];
+
+      if(reinit_reference or not(reference_is_valid))
+      {
+        reference = integrator.JxW(q);
+      }
+      else
+      {
+        dealii::VectorizedArray<MultigridNumber> const jxw = integrator.JxW(q);
+        for(unsigned int v = 0; v < matrix_free.n_active_entries_per_cell_batch(cell); ++v)
+          max_relative_change =
+            std::max(max_relative_change, std::abs((double)jxw[v] / (double)reference[v] - 1.0));
+      }
+    }
+  }
+
+  // If there was no valid reference, all coarser levels should be updated.
+  if(not(reference_is_valid))
+    max_relative_change = std::numeric_limits<double>::max();
+
+  return dealii::Utilities::MPI::max(max_relative_change, mpi_comm);
+}
+
 template<int dim, typename Number, typename MultigridNumber>
 void
 MultigridPreconditionerBase<dim, Number, MultigridNumber>::initialize_operators()
@@ -655,6 +762,13 @@ MultigridPreconditionerBase<dim, Number, MultigridNumber>::get_timings() const
   return multigrid_algorithm->get_timings();
 }
 
+template<int dim, typename Number, typename MultigridNumber>
+SetupProfiler const &
+MultigridPreconditionerBase<dim, Number, MultigridNumber>::get_setup_profiler() const
+{
+  return setup_profiler;
+}
+
 template<int dim, typename Number, typename MultigridNumber>
 void
 MultigridPreconditionerBase<dim, Number, MultigridNumber>::vmult(VectorType &       dst,
@@ -712,6 +826,9 @@ MultigridPreconditionerBase<dim, Number, MultigridNumber>::initialize_smoother(
       smoother_data.degree          = data.smoother_data.iterations;
       smoother_data.iterations_eigenvalue_estimation =
         data.smoother_data.iterations_eigenvalue_estimation;
+      smoother_data.reuse_eigenvalue_estimates = data.smoother_data.reuse_eigenvalue_estimates;
+      smoother_data.iterations_power_iteration = data.smoother_data.iterations_power_iteration;
+      smoother_data.eigenvalue_drift_tolerance = data.smoother_data.eigenvalue_drift_tolerance;
 
       std::shared_ptr<Chebyshev> smoother = std::dynamic_pointer_cast<Chebyshev>(smoothers[level]);
       smoother->setup(mg_operator, initialize_preconditioner, smoother_data);
@@ -766,9 +883,44 @@ MultigridPreconditionerBase<dim, Number, MultigridNumber>::initialize_smoother(
 
 template<int dim, typename Number, typename MultigridNumber>
 void
-MultigridPreconditionerBase<dim, Number, MultigridNumber>::update_smoothers()
+MultigridPreconditionerBase<dim, Number, MultigridNumber>::update_smoothers(
+  bool const fine_h_level_only)
 {
-  for_all_smoothing_levels([&](unsigned int const level) { smoothers[level]->update(); });
+  dealii::Timer timer;
+
+  unsigned int const fine_h_level = level_info.back().h_level();
+
+  auto const level_needs_update = [&](unsigned int const level) {
+    return not(fine_h_level_only) or level_info[level].h_level() == fine_h_level;
+  };
+
+  for_all_smoothing_levels([&](unsigned int const level) {
+    if(level_needs_update(level))
+      smoothers[level]->update();
+  });
+
+  std::shared_ptr<TimerTree> timer_tree = multigrid_algorithm->get_timings();
+  timer_tree->insert({"Multigrid", "Update smoothers"}, timer.wall_time());
+
+  if(data.smoother_data.smoother == MultigridSmoother::Chebyshev and
+     data.smoother_data.reuse_eigenvalue_estimates)
+  {
+    typedef ChebyshevSmoother<Operator, VectorTypeMG> Chebyshev;
+
+    for_all_smoothing_levels([&](unsigned int const level) {
+      if(not(level_needs_update(level)))
+        return;
+
+      std::shared_ptr<Chebyshev> smoother = std::dynamic_pointer_cast<Chebyshev>(smoothers[level]);
+
+      auto const & timings = smoother->get_update_timings();
+
+      timer_tree->insert({"Multigrid", "Update smoothers", "Eigenvalue estimation"},
+                         timings.eigenvalue_estimation);
+      timer_tree->insert({"Multigrid", "Update smoothers", "Eigenvalue drift check"},
+                         timings.drift_check);
+    });
+  }
 }
 
 template<int dim, typename Number, typename MultigridNumber>
@@ -38,6 +38,7 @@
 #include <exadg/solvers_and_preconditioners/multigrid/smoothers/smoother_base.h>
 #include <exadg/solvers_and_preconditioners/multigrid/transfer.h>
 #include <exadg/solvers_and_preconditioners/preconditioners/preconditioner_base.h>
+#include <exadg/utilities/setup_profiler.h>
 
 // forward declarations
 namespace ExaDG
@@ -136,6 +137,12 @@ public:
   std::shared_ptr<TimerTree>
   get_timings() const override;
 
+  /*
+   * Returns wall times and memory high-water marks of the phases of initialize().
+   */
+  SetupProfiler const &
+  get_setup_profiler() const;
+
 protected:
   /*
    * Initialization of mapping depending on multigrid transfer type. Note that the mapping needs to
@@ -157,12 +164,26 @@ protected:
   void
   update_matrix_free_objects();
 
+  /*
+   * This function updates the mappings and the matrix-free objects after the grid has been
+   * deformed and calls function_on_level for all levels that have been updated, e.g. in order to
+   * update the operators on these levels. The levels on the finest h-level are updated in every
+   * call, while coarser h-levels are updated lazily according to
+   * MultigridData::mesh_motion_coarse_update_interval and
+   * MultigridData::mesh_motion_coarse_update_tolerance. Returns whether all levels have been
+   * updated. If not, the smoothers and the coarse-grid solver on the coarser h-levels may be kept
+   * as long as the operators on these levels do not change otherwise, see update_smoothers().
+   */
+  bool
+  update_after_grid_motion(std::function<void(unsigned int const)> const & function_on_level);
+
   /**
-   * This function updates the smoother for all smoothing levels.
+   * This function updates the smoother for all smoothing levels, or only for the smoothing levels
+   * on the finest h-level if fine_h_level_only is true.
    * The prerequisite to call this function is that the multigrid operators have been updated.
    */
   void
-  update_smoothers();
+  update_smoothers(bool const fine_h_level_only = false);
 
   /**
    * This function updates the coarse-grid solver.
@@ -280,6 +301,14 @@ private:
   dealii::Mapping<dim> const &
   get_mapping(unsigned int const h_level) const;
 
+  /*
+   * Returns the maximum relative change of the integration weights JxW on the finest level compared
+   * to the reference values jxw_reference. If reinit_reference is true, the reference values are
+   * set to the current values.
+   */
+  double
+  compute_relative_change_of_jxw(bool const reinit_reference);
+
   /*
    * Data structures needed for matrix-free operator evaluation.
    */
@@ -335,6 +364,14 @@ private:
   std::shared_ptr<CoarseGridSolverBase<Operator>> coarse_grid_solver;
 
   std::shared_ptr<MultigridAlgorithm<VectorTypeMG, Operator, Smoother>> multigrid_algorithm;
+
+  // moving meshes: number of updates since the last update of coarser h-levels
+  unsigned int n_updates_since_coarse_update;
+
+  SetupProfiler setup_profiler;
+
+  // moving meshes: integration weights on the finest level at the last update of coarser h-levels
+  dealii::AlignedVector<dealii::VectorizedArray<MultigridNumber>> jxw_reference;
 };
 } // namespace ExaDG
 
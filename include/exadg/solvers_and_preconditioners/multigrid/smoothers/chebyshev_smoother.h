@@ -22,7 +22,11 @@
 #ifndef INCLUDE_SOLVERS_AND_PRECONDITIONERS_CHEBYSHEVSMOOTHER_H_
 #define INCLUDE_SOLVERS_AND_PRECONDITIONERS_CHEBYSHEVSMOOTHER_H_
 
+// C/C++
+#include <cmath>
+
 // deal.II
+#include <deal.II/base/timer.h>
 #include <deal.II/lac/precondition.h>
 
 // ExaDG
@@ -46,7 +50,13 @@ public:
     PreconditionChebyshev<Operator, VectorType, AdditiveSchwarzPreconditioner<Operator>>
       ChebyshevAdditiveSchwarz;
 
-  ChebyshevSmoother() : underlying_operator(nullptr)
+  ChebyshevSmoother()
+    : underlying_operator(nullptr),
+      eigenvalues_are_cached(false),
+      max_eigenvalue_cached(1.0),
+      rayleigh_quotient_reference(1.0),
+      n_eigenvalue_estimations(0),
+      n_reused_eigenvalue_estimates(0)
   {
   }
 
@@ -59,7 +69,10 @@ public:
       : preconditioner(PreconditionerSmoother::PointJacobi),
         smoothing_range(20),
         degree(5),
-        iterations_eigenvalue_estimation(20)
+        iterations_eigenvalue_estimation(20),
+        reuse_eigenvalue_estimates(false),
+        iterations_power_iteration(5),
+        eigenvalue_drift_tolerance(0.1)
     {
     }
 
@@ -74,6 +87,29 @@ public:
 
     // number of CG iterations for estimation of eigenvalues
     unsigned int iterations_eigenvalue_estimation;
+
+    // reuse eigenvalue estimates across calls to update()
+    bool reuse_eigenvalue_estimates;
+
+    // number of power iterations used to approximate the eigenvector of the largest eigenvalue
+    // after a CG eigenvalue estimation
+    unsigned int iterations_power_iteration;
+
+    // relative drift of the largest eigenvalue up to which the cached estimate is reused
+    double eigenvalue_drift_tolerance;
+  };
+
+  /*
+   * Wall times spent for the eigenvalue estimation during the last call to update().
+   */
+  struct UpdateTimings
+  {
+    UpdateTimings() : eigenvalue_estimation(0.0), drift_check(0.0)
+    {
+    }
+
+    double eigenvalue_estimation;
+    double drift_check;
   };
 
   void
@@ -124,21 +160,22 @@ public:
     AssertThrow(underlying_operator != nullptr,
                 dealii::ExcMessage("Pointer underlying_operator is uninitialized."));
 
+    update_timings = UpdateTimings();
+
     if(data.preconditioner == PreconditionerSmoother::PointJacobi)
     {
       preconditioner_point_jacobi->update();
-      chebyshev_point_jacobi->initialize(*underlying_operator, additional_data_point);
+      update_chebyshev(*chebyshev_point_jacobi, additional_data_point);
     }
     else if(data.preconditioner == PreconditionerSmoother::BlockJacobi)
     {
       preconditioner_block_jacobi->update();
-      chebyshev_block_jacobi->initialize(*underlying_operator, additional_data_block);
+      update_chebyshev(*chebyshev_block_jacobi, additional_data_block);
     }
     else if(data.preconditioner == PreconditionerSmoother::AdditiveSchwarz)
     {
       preconditioner_additive_schwarz->update();
-      chebyshev_additive_schwarz->initialize(*underlying_operator,
-                                             additional_data_additive_schwarz);
+      update_chebyshev(*chebyshev_additive_schwarz, additional_data_additive_schwarz);
     }
     else
     {
@@ -168,7 +205,7 @@ public:
       chebyshev_point_jacobi = std::make_shared<ChebyshevPointJacobi>();
 
       if(initialize_preconditioner)
-        chebyshev_point_jacobi->initialize(*underlying_operator, additional_data_point);
+        update_chebyshev(*chebyshev_point_jacobi, additional_data_point);
     }
     else if(data.preconditioner == PreconditionerSmoother::BlockJacobi)
     {
@@ -184,7 +221,7 @@ public:
       chebyshev_block_jacobi = std::make_shared<ChebyshevBlockJacobi>();
 
       if(initialize_preconditioner)
-        chebyshev_block_jacobi->initialize(*underlying_operator, additional_data_block);
+        update_chebyshev(*chebyshev_block_jacobi, additional_data_block);
     }
     else if(data.preconditioner == PreconditionerSmoother::AdditiveSchwarz)
     {
@@ -200,8 +237,7 @@ public:
       chebyshev_additive_schwarz = std::make_shared<ChebyshevAdditiveSchwarz>();
 
       if(initialize_preconditioner)
-        chebyshev_additive_schwarz->initialize(*underlying_operator,
-                                               additional_data_additive_schwarz);
+        update_chebyshev(*chebyshev_additive_schwarz, additional_data_additive_schwarz);
     }
     else
     {
@@ -209,10 +245,171 @@ public:
     }
   }
 
+  UpdateTimings const &
+  get_update_timings() const
+  {
+    return update_timings;
+  }
+
+  // number of CG eigenvalue estimations performed so far
+  unsigned int
+  get_n_eigenvalue_estimations() const
+  {
+    return n_eigenvalue_estimations;
+  }
+
+  // number of updates so far that reused the cached eigenvalue estimate
+  unsigned int
+  get_n_reused_eigenvalue_estimates() const
+  {
+    return n_reused_eigenvalue_estimates;
+  }
+
 private:
+  /*
+   * Re-initializes the Chebyshev iteration after the underlying operator has changed. Without
+   * reuse of eigenvalue estimates, the eigenvalues are estimated by deal.II with CG iterations.
+   *
+   * With reuse of eigenvalue estimates, a power iteration computes an approximation of the
+   * eigenvector of the largest eigenvalue of the preconditioned operator P^{-1}A after each CG
+   * eigenvalue estimation. In subsequent calls, the drift of the largest eigenvalue is detected by
+   * the Rayleigh quotient of this cached eigenvector, which requires only one application of the
+   * operator and the preconditioner. Note that the preconditioned operator P^{-1}A is invariant
+   * w.r.t. a uniform scaling of A (e.g. a change of the time step size for a mass-dominated
+   * operator or of a constant viscosity for a Laplace-dominated operator), so that the cached
+   * estimate remains valid in this case. A change in the relative weight of mass and Laplace terms
+   * changes the spectrum. For small drifts, the cached estimate is rescaled by the ratio of the
+   * Rayleigh quotients, for large drifts a new CG eigenvalue estimation is performed.
+   */
+  template<typename Chebyshev>
+  void
+  update_chebyshev(Chebyshev & chebyshev, typename Chebyshev::AdditionalData & additional_data)
+  {
+    if(not(data.reuse_eigenvalue_estimates))
+    {
+      chebyshev.initialize(*underlying_operator, additional_data);
+      return;
+    }
+
+    if(eigenvalues_are_cached)
+    {
+      dealii::Timer timer;
+
+      double const lambda = rayleigh_quotient(*additional_data.preconditioner);
+      double const drift  = std::abs(lambda / rayleigh_quotient_reference - 1.0);
+
+      update_timings.drift_check += timer.wall_time();
+
+      if(drift <= data.eigenvalue_drift_tolerance)
+      {
+        // without CG iterations, deal.II uses max_eigenvalue as is, i.e. the cached value
+        // already contains the safety factor applied by deal.II to the CG estimate
+        additional_data.eig_cg_n_iterations = 0;
+        additional_data.max_eigenvalue =
+          max_eigenvalue_cached * lambda / rayleigh_quotient_reference;
+
+        chebyshev.initialize(*underlying_operator, additional_data);
+
+        ++n_reused_eigenvalue_estimates;
+
+        return;
+      }
+    }
+
+    dealii::Timer timer;
+
+    additional_data.eig_cg_n_iterations = data.iterations_eigenvalue_estimation;
+    chebyshev.initialize(*underlying_operator, additional_data);
+
+    VectorType vector;
+    underlying_operator->initialize_dof_vector(vector);
+    auto const info = chebyshev.estimate_eigenvalues(vector);
+
+    // the estimate returned by deal.II already includes the safety factor applied to the largest
+    // eigenvalue of the CG iteration, i.e. it is cached as is
+    max_eigenvalue_cached       = info.max_eigenvalue_estimate;
+    rayleigh_quotient_reference = power_iteration(*additional_data.preconditioner);
+    eigenvalues_are_cached      = true;
+
+    ++n_eigenvalue_estimations;
+    update_timings.eigenvalue_estimation += timer.wall_time();
+  }
+
+  /*
+   * Approximates the eigenvector of the largest eigenvalue of the preconditioned operator P^{-1}A
+   * by a power iteration with a deterministic start vector. The normalized eigenvector is stored
+   * and the corresponding Rayleigh quotient is returned.
+   */
+  template<typename Preconditioner>
+  double
+  power_iteration(Preconditioner const & preconditioner)
+  {
+    VectorType y;
+    underlying_operator->initialize_dof_vector(eigenvector_cached);
+    underlying_operator->initialize_dof_vector(y);
+
+    dealii::IndexSet const locally_owned = eigenvector_cached.locally_owned_elements();
+    for(unsigned int i = 0; i < eigenvector_cached.locally_owned_size(); ++i)
+      eigenvector_cached.local_element(i) =
+        1.0 + 0.5 * std::sin(static_cast<double>(locally_owned.nth_index_in_set(i)));
+    eigenvector_cached /= eigenvector_cached.l2_norm();
+
+    for(unsigned int i = 0; i < data.iterations_power_iteration; ++i)
+    {
+      apply_preconditioned_operator(y, eigenvector_cached, preconditioner);
+
+      double const norm = y.l2_norm();
+      if(norm == 0.0)
+        break;
+
+      eigenvector_cached.equ(1.0 / norm, y);
+    }
+
+    return rayleigh_quotient(preconditioner);
+  }
+
+  /*
+   * Rayleigh quotient x^T P^{-1}A x of the cached eigenvector x.
+   */
+  template<typename Preconditioner>
+  double
+  rayleigh_quotient(Preconditioner const & preconditioner) const
+  {
+    VectorType y;
+    underlying_operator->initialize_dof_vector(y);
+
+    apply_preconditioned_operator(y, eigenvector_cached, preconditioner);
+
+    return eigenvector_cached * y;
+  }
+
+  template<typename Preconditioner>
+  void
+  apply_preconditioned_operator(VectorType &           dst,
+                                VectorType const &     src,
+                                Preconditioner const & preconditioner) const
+  {
+    VectorType tmp;
+    underlying_operator->initialize_dof_vector(tmp);
+
+    underlying_operator->vmult(tmp, src);
+    preconditioner.vmult(dst, tmp);
+  }
+
   Operator const * underlying_operator;
   AdditionalData   data;
 
+  // cached eigenvalue estimates
+  bool       eigenvalues_are_cached;
+  double     max_eigenvalue_cached;
+  double     rayleigh_quotient_reference;
+  VectorType eigenvector_cached;
+
+  unsigned int n_eigenvalue_estimations;
+  unsigned int n_reused_eigenvalue_estimates;
+
+  UpdateTimings update_timings;
+
   std::shared_ptr<ChebyshevPointJacobi>     chebyshev_point_jacobi;
   std::shared_ptr<ChebyshevBlockJacobi>     chebyshev_block_jacobi;
   std::shared_ptr<ChebyshevAdditiveSchwarz> chebyshev_additive_schwarz;
@@ -22,6 +22,10 @@
 #ifndef INCLUDE_SOLVERS_AND_PRECONDITIONERS_ITERATIVESOLVERS_H_
 #define INCLUDE_SOLVERS_AND_PRECONDITIONERS_ITERATIVESOLVERS_H_
 
+// C/C++
+#include <algorithm>
+#include <vector>
+
 // deal.II
 #include <deal.II/base/timer.h>
 #include <deal.II/lac/precondition.h>
@@ -44,8 +48,12 @@ public:
     timer_tree = std::make_shared<TimerTree>();
   }
 
+  /*
+   * The solve function is non-const since solvers may carry state from one solve to the next, see
+   * RecycleSpace.
+   */
   virtual unsigned int
-  solve(VectorType & dst, VectorType const & rhs) const = 0;
+  solve(VectorType & dst, VectorType const & rhs) = 0;
 
   virtual ~SolverBase()
   {
@@ -88,6 +96,197 @@ protected:
   std::shared_ptr<TimerTree> timer_tree;
 };
 
+/**
+ * Recycling of Krylov information across a sequence of linear systems with the same or a slowly
+ * varying operator A, e.g. the linearized systems of a Newton solver, the structural problem
+ * solved in every sub-iteration of a partitioned FSI scheme, or the mesh motion problem solved in
+ * every time step of an ALE simulation.
+ *
+ * The recycle space stores the solution increments U of previous solves together with C = A U,
+ * where the columns of C are orthonormal. Prior to a solve, the initial guess is corrected by the
+ * minimum-residual update within span(U), i.e.
+ *
+ *   x_0 <- x_0 + U C^T r_0 ,   r_0 <- (I - C C^T) r_0 ,
+ *
+ * which corresponds to the outer projection of GCRO-type methods. The increment computed by the
+ * Krylov solver is appended to the recycle space after the solve (the oldest vector is dropped
+ * once the space is full). Since C has to be consistent with the current operator, the relation
+ * A u = c is checked for the oldest vector before each solve and C is recomputed for all vectors
+ * if the relative deviation exceeds a given tolerance.
+ *
+ * Note that this is a recycling of the initial guess only: The subsequent Krylov iteration is not
+ * deflated, i.e., it is not kept orthogonal to span(C) as in GCRO-DR, since the wrapped deal.II
+ * solvers do not allow to modify the Krylov iteration. Hence, recycling reduces the initial
+ * residual (and thereby the number of iterations if the solutions of subsequent systems are
+ * close to span(U)), but not the convergence rate of the Krylov solver.
+ *
+ * The recycle space belongs to one sequence of linear systems and is owned by the Krylov solver
+ * solving these systems.
+ */
+template<typename VectorType>
+class RecycleSpace
+{
+public:
+  RecycleSpace() : max_size(0), refresh_tolerance(1.e-2), n_refresh(0)
+  {
+  }
+
+  void
+  reinit(unsigned int const max_size_in, double const refresh_tolerance_in)
+  {
+    max_size          = max_size_in;
+    refresh_tolerance = refresh_tolerance_in;
+
+    U.clear();
+    C.clear();
+  }
+
+  bool
+  is_active() const
+  {
+    return max_size > 0;
+  }
+
+  unsigned int
+  size() const
+  {
+    return U.size();
+  }
+
+  unsigned int
+  get_n_refresh() const
+  {
+    return n_refresh;
+  }
+
+  /**
+   * Corrects the initial guess @p dst by the minimum-residual update within the recycle space.
+   * Returns the l2 norm of the residual of the initial guess before the correction.
+   */
+  template<typename Operator>
+  double
+  project_initial_guess(Operator const & op, VectorType & dst, VectorType const & rhs)
+  {
+    VectorType residual;
+    residual.reinit(rhs, true);
+    op.vmult(residual, dst);
+    residual.sadd(-1.0, 1.0, rhs);
+
+    double const norm_initial_residual = residual.l2_norm();
+
+    if(U.empty())
+      return norm_initial_residual;
+
+    refresh_if_operator_changed(op);
+
+    // modified Gram-Schmidt variant of x_0 += U C^T r_0
+    for(unsigned int i = 0; i < U.size(); ++i)
+    {
+      double const alpha = C[i] * residual;
+      dst.add(alpha, U[i]);
+      residual.add(-alpha, C[i]);
+    }
+
+    return norm_initial_residual;
+  }
+
+  /**
+   * Appends the solution increment of the last solve to the recycle space.
+   */
+  template<typename Operator>
+  void
+  add(Operator const & op, VectorType const & increment)
+  {
+    VectorType u(increment), c;
+    c.reinit(increment, true);
+    op.vmult(c, u);
+
+    if(orthonormalize(u, c))
+    {
+      if(U.size() == max_size)
+      {
+        U.erase(U.begin());
+        C.erase(C.begin());
+      }
+
+      U.push_back(u);
+      C.push_back(c);
+    }
+  }
+
+private:
+  /**
+   * Orthonormalizes c against all vectors in C and applies the same transformation to u such that
+   * A u = c is preserved. Returns false if c is (numerically) linearly dependent on C.
+   */
+  bool
+  orthonormalize(VectorType & u, VectorType & c) const
+  {
+    double const norm_initial = c.l2_norm();
+
+    if(not(norm_initial > 0.0))
+      return false;
+
+    for(unsigned int i = 0; i < C.size(); ++i)
+    {
+      double const beta = C[i] * c;
+      c.add(-beta, C[i]);
+      u.add(-beta, U[i]);
+    }
+
+    double const norm = c.l2_norm();
+
+    if(norm < 1.e-8 * norm_initial)
+      return false;
+
+    c *= 1.0 / norm;
+    u *= 1.0 / norm;
+
+    return true;
+  }
+
+  template<typename Operator>
+  void
+  refresh_if_operator_changed(Operator const & op)
+  {
+    // the oldest vector is the one most likely to be outdated, ||C[0]|| = 1
+    VectorType tmp;
+    tmp.reinit(C[0], true);
+    op.vmult(tmp, U[0]);
+    tmp.add(-1.0, C[0]);
+
+    if(tmp.l2_norm() > refresh_tolerance)
+    {
+      std::vector<VectorType> U_old;
+      U_old.swap(U);
+      C.clear();
+
+      for(VectorType & u : U_old)
+      {
+        VectorType c;
+        c.reinit(u, true);
+        op.vmult(c, u);
+
+        if(orthonormalize(u, c))
+        {
+          U.push_back(u);
+          C.push_back(c);
+        }
+      }
+
+      ++n_refresh;
+    }
+  }
+
+  unsigned int max_size;
+  double       refresh_tolerance;
+
+  std::vector<VectorType> U;
+  std::vector<VectorType> C;
+
+  unsigned int n_refresh;
+};
+
 struct SolverDataCG
 {
   SolverDataCG()
@@ -95,7 +294,9 @@ struct SolverDataCG
       solver_tolerance_abs(1.e-20),
       solver_tolerance_rel(1.e-6),
       use_preconditioner(false),
-      compute_performance_metrics(false)
+      compute_performance_metrics(false),
+      n_recycle_vectors(0),
+      recycle_refresh_tolerance(1.e-2)
   {
   }
 
@@ -104,6 +305,10 @@ struct SolverDataCG
   double       solver_tolerance_rel;
   bool         use_preconditioner;
   bool         compute_performance_metrics;
+  // size of the recycle space (0 = no recycling), see RecycleSpace
+  unsigned int n_recycle_vectors;
+  // relative deviation |A u - c| / |c| above which the recycle space is recomputed
+  double       recycle_refresh_tolerance;
 };
 
 template<typename Operator, typename Preconditioner, typename VectorType>
@@ -117,6 +322,7 @@ public:
       preconditioner(preconditioner_in),
       solver_data(solver_data_in)
   {
+    recycle_space.reinit(solver_data.n_recycle_vectors, solver_data.recycle_refresh_tolerance);
   }
 
   void
@@ -132,12 +338,30 @@ public:
   }
 
   unsigned int
-  solve(VectorType & dst, VectorType const & rhs) const override
+  solve(VectorType & dst, VectorType const & rhs) override
   {
     dealii::Timer timer;
 
+    double tolerance_abs = solver_data.solver_tolerance_abs;
+
+    VectorType initial_guess;
+    if(recycle_space.is_active())
+    {
+      dealii::Timer timer_recycle;
+
+      double const norm_initial_residual =
+        recycle_space.project_initial_guess(underlying_operator, dst, rhs);
+      initial_guess = dst;
+
+      // the relative tolerance refers to the residual before the projection
+      tolerance_abs = std::max(tolerance_abs,
+                               solver_data.solver_tolerance_rel * norm_initial_residual);
+
+      this->timer_tree->insert({"SolverCG", "Recycling"}, timer_recycle.wall_time());
+    }
+
     dealii::ReductionControl solver_control(solver_data.max_iter,
-                                            solver_data.solver_tolerance_abs,
+                                            tolerance_abs,
                                             solver_data.solver_tolerance_rel);
 
     dealii::SolverCG<VectorType> solver(solver_control);
@@ -157,6 +381,16 @@ public:
     if(solver_data.compute_performance_metrics)
       this->compute_performance_metrics(solver_control);
 
+    if(recycle_space.is_active())
+    {
+      dealii::Timer timer_recycle;
+
+      initial_guess.sadd(-1.0, 1.0, dst);
+      recycle_space.add(underlying_operator, initial_guess);
+
+      this->timer_tree->insert({"SolverCG", "Recycling"}, timer_recycle.wall_time());
+    }
+
     this->timer_tree->insert({"SolverCG"}, timer.wall_time());
 
     return solver_control.last_step();
@@ -177,6 +411,8 @@ private:
   Operator const &   underlying_operator;
   Preconditioner &   preconditioner;
   SolverDataCG const solver_data;
+
+  RecycleSpace<VectorType> recycle_space;
 };
 
 template<class Number>
@@ -205,7 +441,9 @@ struct SolverDataGMRES
       use_preconditioner(false),
       max_n_tmp_vectors(30),
       compute_eigenvalues(false),
-      compute_performance_metrics(false)
+      compute_performance_metrics(false),
+      n_recycle_vectors(0),
+      recycle_refresh_tolerance(1.e-2)
   {
   }
 
@@ -216,6 +454,10 @@ struct SolverDataGMRES
   unsigned int max_n_tmp_vectors;
   bool         compute_eigenvalues;
   bool         compute_performance_metrics;
+  // size of the recycle space (0 = no recycling), see RecycleSpace
+  unsigned int n_recycle_vectors;
+  // relative deviation |A u - c| / |c| above which the recycle space is recomputed
+  double       recycle_refresh_tolerance;
 };
 
 template<typename Operator, typename Preconditioner, typename VectorType>
@@ -231,6 +473,7 @@ public:
       solver_data(solver_data_in),
       mpi_comm(mpi_comm_in)
   {
+    recycle_space.reinit(solver_data.n_recycle_vectors, solver_data.recycle_refresh_tolerance);
   }
 
   virtual ~SolverGMRES()
@@ -250,12 +493,30 @@ public:
   }
 
   unsigned int
-  solve(VectorType & dst, VectorType const & rhs) const override
+  solve(VectorType & dst, VectorType const & rhs) override
   {
     dealii::Timer timer;
 
+    double tolerance_abs = solver_data.solver_tolerance_abs;
+
+    VectorType initial_guess;
+    if(recycle_space.is_active())
+    {
+      dealii::Timer timer_recycle;
+
+      double const norm_initial_residual =
+        recycle_space.project_initial_guess(underlying_operator, dst, rhs);
+      initial_guess = dst;
+
+      // the relative tolerance refers to the residual before the projection
+      tolerance_abs = std::max(tolerance_abs,
+                               solver_data.solver_tolerance_rel * norm_initial_residual);
+
+      this->timer_tree->insert({"SolverGMRES", "Recycling"}, timer_recycle.wall_time());
+    }
+
     dealii::ReductionControl solver_control(solver_data.max_iter,
-                                            solver_data.solver_tolerance_abs,
+                                            tolerance_abs,
                                             solver_data.solver_tolerance_rel);
 
     typename dealii::SolverGMRES<VectorType>::AdditionalData additional_data;
@@ -287,6 +548,16 @@ public:
     if(solver_data.compute_performance_metrics)
       this->compute_performance_metrics(solver_control);
 
+    if(recycle_space.is_active())
+    {
+      dealii::Timer timer_recycle;
+
+      initial_guess.sadd(-1.0, 1.0, dst);
+      recycle_space.add(underlying_operator, initial_guess);
+
+      this->timer_tree->insert({"SolverGMRES", "Recycling"}, timer_recycle.wall_time());
+    }
+
     this->timer_tree->insert({"SolverGMRES"}, timer.wall_time());
 
     return solver_control.last_step();
@@ -309,6 +580,8 @@ private:
   SolverDataGMRES const solver_data;
 
   MPI_Comm const mpi_comm;
+
+  RecycleSpace<VectorType> recycle_space;
 };
 
 struct SolverDataFGMRES
@@ -319,7 +592,9 @@ struct SolverDataFGMRES
       solver_tolerance_rel(1.e-6),
       use_preconditioner(false),
       max_n_tmp_vectors(30),
-      compute_performance_metrics(false)
+      compute_performance_metrics(false),
+      n_recycle_vectors(0),
+      recycle_refresh_tolerance(1.e-2)
   {
   }
 
@@ -329,6 +604,10 @@ struct SolverDataFGMRES
   bool         use_preconditioner;
   unsigned int max_n_tmp_vectors;
   bool         compute_performance_metrics;
+  // size of the recycle space (0 = no recycling), see RecycleSpace
+  unsigned int n_recycle_vectors;
+  // relative deviation |A u - c| / |c| above which the recycle space is recomputed
+  double       recycle_refresh_tolerance;
 };
 
 template<typename Operator, typename Preconditioner, typename VectorType>
@@ -342,6 +621,7 @@ public:
       preconditioner(preconditioner_in),
       solver_data(solver_data_in)
   {
+    recycle_space.reinit(solver_data.n_recycle_vectors, solver_data.recycle_refresh_tolerance);
   }
 
   virtual ~SolverFGMRES()
@@ -361,12 +641,30 @@ public:
   }
 
   unsigned int
-  solve(VectorType & dst, VectorType const & rhs) const override
+  solve(VectorType & dst, VectorType const & rhs) override
   {
     dealii::Timer timer;
 
+    double tolerance_abs = solver_data.solver_tolerance_abs;
+
+    VectorType initial_guess;
+    if(recycle_space.is_active())
+    {
+      dealii::Timer timer_recycle;
+
+      double const norm_initial_residual =
+        recycle_space.project_initial_guess(underlying_operator, dst, rhs);
+      initial_guess = dst;
+
+      // the relative tolerance refers to the residual before the projection
+      tolerance_abs = std::max(tolerance_abs,
+                               solver_data.solver_tolerance_rel * norm_initial_residual);
+
+      this->timer_tree->insert({"SolverFGMRES", "Recycling"}, timer_recycle.wall_time());
+    }
+
     dealii::ReductionControl solver_control(solver_data.max_iter,
-                                            solver_data.solver_tolerance_abs,
+                                            tolerance_abs,
                                             solver_data.solver_tolerance_rel);
 
     typename dealii::SolverFGMRES<VectorType>::AdditionalData additional_data;
@@ -390,6 +688,16 @@ public:
     if(solver_data.compute_performance_metrics)
       this->compute_performance_metrics(solver_control);
 
+    if(recycle_space.is_active())
+    {
+      dealii::Timer timer_recycle;
+
+      initial_guess.sadd(-1.0, 1.0, dst);
+      recycle_space.add(underlying_operator, initial_guess);
+
+      this->timer_tree->insert({"SolverFGMRES", "Recycling"}, timer_recycle.wall_time());
+    }
+
     this->timer_tree->insert({"SolverFGMRES"}, timer.wall_time());
 
     return solver_control.last_step();
@@ -410,6 +718,8 @@ private:
   Operator const &       underlying_operator;
   Preconditioner &       preconditioner;
   SolverDataFGMRES const solver_data;
+
+  RecycleSpace<VectorType> recycle_space;
 };
 } // namespace Krylov
 
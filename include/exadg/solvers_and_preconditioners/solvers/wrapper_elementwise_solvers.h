@@ -88,7 +88,7 @@ public:
    * Solve function. This function may be called with identical dst, src vectors.
    */
   unsigned int
-  solve(VectorType & dst, VectorType const & src) const override
+  solve(VectorType & dst, VectorType const & src) override
   {
     dst = 0;
 
@@ -84,6 +84,17 @@ Driver<dim, Number>::setup()
       time_integrator = std::make_shared<TimeIntGenAlpha<dim, Number>>(
         pde_operator, postprocessor, application->get_parameters(), mpi_comm, is_test);
       time_integrator->setup(application->get_parameters().restarted_simulation);
+
+      // machine-readable log of solver statistics
+      std::string const & statistics_filename =
+        application->get_parameters().solver_info_data.statistics_filename;
+      if(not statistics_filename.empty())
+      {
+        solver_statistics = std::make_shared<SolverStatistics>(statistics_filename, mpi_comm);
+        solver_statistics->write_run(application->get_parameters(),
+                                     pde_operator->get_number_of_dofs());
+        time_integrator->set_solver_statistics(solver_statistics);
+      }
     }
     else if(application->get_parameters().problem_type == ProblemType::Steady)
     {
@@ -178,6 +189,9 @@ Driver<dim, Number>::print_performance_results(double const total_time) const
   pcout << std::endl << "Timings for level 2:" << std::endl;
   timer_tree.print_level(pcout, 2);
 
+  if(solver_statistics.get())
+    solver_statistics->write_summary(time_integrator->get_number_of_time_steps(), timer_tree);
+
   // Throughput in DoFs/s per time step per core
   dealii::types::global_dof_index const DoFs = pde_operator->get_number_of_dofs();
   unsigned int const N_mpi_processes         = dealii::Utilities::MPI::n_mpi_processes(mpi_comm);
@@ -35,6 +35,7 @@
 #include <exadg/structure/time_integration/time_int_gen_alpha.h>
 #include <exadg/structure/user_interface/application_base.h>
 #include <exadg/utilities/print_general_infos.h>
+#include <exadg/utilities/solver_statistics.h>
 #include <exadg/utilities/timer_tree.h>
 
 namespace ExaDG
@@ -115,6 +116,9 @@ private:
   // time integration scheme
   std::shared_ptr<TimeIntGenAlpha<dim, Number>> time_integrator;
 
+  // machine-readable log of solver statistics (optional)
+  std::shared_ptr<SolverStatistics> solver_statistics;
+
   // computation time
   mutable TimerTree timer_tree;
 };
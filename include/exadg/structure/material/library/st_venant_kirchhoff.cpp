@@ -118,6 +118,9 @@ StVenantKirchhoff<dim, Number>::cell_loop_set_coefficients(
   auto const f1_factor = get_f1_factor();
   auto const f2_factor = get_f2_factor();
 
+  VectorizedFunction<dim> const * E_function_vectorized =
+    get_vectorized_function(data.E_function.get());
+
   // loop over all cells
   for(unsigned int cell = cell_range.first; cell < cell_range.second; ++cell)
   {
@@ -128,6 +131,7 @@ StVenantKirchhoff<dim, Number>::cell_loop_set_coefficients(
     {
       dealii::VectorizedArray<Number> E_vec =
         FunctionEvaluator<0, dim, Number>::value(*(data.E_function),
+                                                 E_function_vectorized,
                                                  integrator.quadrature_point(q),
                                                  0.0 /*time*/);
 
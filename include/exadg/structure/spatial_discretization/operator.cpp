@@ -207,6 +207,28 @@ Operator<dim, Number>::setup_coupling_boundary_conditions()
   }
 }
 
+template<int dim, typename Number>
+void
+Operator<dim, Number>::initialize_precomputed_bc()
+{
+  // resolve the vectorized interface of the boundary functions
+  boundary_descriptor->set_vectorized_functions();
+
+  if(not(boundary_descriptor->precomputed_bc.empty()))
+  {
+    std::vector<unsigned int> quad_indices;
+    quad_indices.emplace_back(get_quad_index());
+
+    precomputed_data = std::make_shared<PrecomputedBoundaryData<dim>>();
+    precomputed_data->setup(*matrix_free,
+                            get_dof_index(),
+                            quad_indices,
+                            boundary_descriptor->get_precomputed_functions());
+
+    boundary_descriptor->set_precomputed_data(precomputed_data);
+  }
+}
+
 template<int dim, typename Number>
 void
 Operator<dim, Number>::setup_operators()
@@ -306,6 +328,8 @@ Operator<dim, Number>::setup(std::shared_ptr<dealii::MatrixFree<dim, Number> con
 
   setup_coupling_boundary_conditions();
 
+  initialize_precomputed_bc();
+
   setup_operators();
 
   setup_preconditioner();
@@ -508,6 +532,7 @@ Operator<dim, Number>::setup_solver()
     solver_data.solver_tolerance_abs = param.solver_data.abs_tol;
     solver_data.solver_tolerance_rel = param.solver_data.rel_tol;
     solver_data.max_iter             = param.solver_data.max_iter;
+    solver_data.n_recycle_vectors    = param.solver_data.n_recycle_vectors;
 
     if(param.preconditioner != Preconditioner::None)
       solver_data.use_preconditioner = true;
@@ -536,6 +561,7 @@ Operator<dim, Number>::setup_solver()
     solver_data.solver_tolerance_abs = param.solver_data.abs_tol;
     solver_data.solver_tolerance_rel = param.solver_data.rel_tol;
     solver_data.max_iter             = param.solver_data.max_iter;
+    solver_data.n_recycle_vectors    = param.solver_data.n_recycle_vectors;
     solver_data.max_n_tmp_vectors    = param.solver_data.max_krylov_size;
 
     if(param.preconditioner != Preconditioner::None)
@@ -366,6 +366,13 @@ private:
   void
   setup_coupling_boundary_conditions();
 
+  /**
+   * Tabulates time-independent or separable Neumann boundary conditions in the boundary quadrature
+   * points.
+   */
+  void
+  initialize_precomputed_bc();
+
   /**
    * Initializes operators.
    */
@@ -457,6 +464,11 @@ private:
   mutable std::shared_ptr<ContainerInterfaceData<1, dim, double>> interface_data_dirichlet_cached;
   mutable std::shared_ptr<ContainerInterfaceData<1, dim, double>> interface_data_neumann_cached;
 
+  /*
+   * Precomputed boundary data
+   */
+  std::shared_ptr<PrecomputedBoundaryData<dim>> precomputed_data;
+
   /*
    * Basic operators.
    */
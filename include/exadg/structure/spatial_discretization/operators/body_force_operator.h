@@ -23,6 +23,7 @@
 #define INCLUDE_STRUCTURE_SPATIAL_DISCRETIZATION_RHS_OPERATOR_H_
 
 // ExaDG
+#include <exadg/functions_and_boundary_conditions/vectorized_function.h>
 #include <exadg/matrix_free/integrators.h>
 #include <exadg/operators/mapping_flags.h>
 
@@ -89,6 +90,9 @@ private:
 
   BodyForceData<dim> data;
 
+  // vectorized interface of data.function (nullptr if not available)
+  VectorizedFunction<dim> const * function_vectorized = nullptr;
+
   double mutable time;
 };
 
@@ -46,10 +46,10 @@ inline DEAL_II_ALWAYS_INLINE //
 
   if(boundary_type == BoundaryType::Neumann)
   {
-    auto bc       = boundary_descriptor->neumann_bc.find(boundary_id)->second;
-    auto q_points = integrator.quadrature_point(q);
+    auto bc = boundary_descriptor->neumann_bc.find(boundary_id)->second;
 
-    traction = FunctionEvaluator<1, dim, Number>::value(*bc, q_points, time);
+    traction = evaluate_boundary_function<1, dim, Number>(
+      *bc, *boundary_descriptor, boundary_id, integrator, q, time);
   }
   else if(boundary_type == BoundaryType::NeumannCached)
   {
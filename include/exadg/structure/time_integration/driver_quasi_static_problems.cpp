@@ -19,10 +19,16 @@
  *  ______________________________________________________________________
  */
 
+// C/C++
+#include <boost/archive/binary_iarchive.hpp>
+#include <boost/archive/binary_oarchive.hpp>
+
+// ExaDG
 #include <exadg/structure/postprocessor/postprocessor_base.h>
 #include <exadg/structure/spatial_discretization/interface.h>
 #include <exadg/structure/time_integration/driver_quasi_static_problems.h>
 #include <exadg/structure/user_interface/parameters.h>
+#include <exadg/time_integration/restart.h>
 #include <exadg/utilities/print_solver_results.h>
 
 namespace ExaDG
@@ -42,7 +48,11 @@ DriverQuasiStatic<dim, Number>::DriverQuasiStatic(
     mpi_comm(mpi_comm_),
     is_test(is_test_),
     pcout(std::cout, dealii::Utilities::MPI::this_mpi_process(mpi_comm_) == 0),
+    load_factor(0.0),
+    load_increment(param.load_increment),
     last_load_increment(param.load_increment),
+    previous_load_increment(param.load_increment),
+    n_accepted_steps(0),
     step_number(1),
     timer_tree(new TimerTree()),
     iterations({0, {0, 0}})
@@ -61,8 +71,16 @@ DriverQuasiStatic<dim, Number>::setup()
   // initialize global solution vectors (allocation)
   initialize_vectors();
 
-  // initialize solution by interpolation of initial data
-  initialize_solution();
+  if(param.restarted_simulation)
+  {
+    // read solution and state of load stepping from restart files
+    read_restart();
+  }
+  else
+  {
+    // initialize solution by interpolation of initial data
+    initialize_solution();
+  }
 }
 
 template<int dim, typename Number>
@@ -128,17 +146,23 @@ DriverQuasiStatic<dim, Number>::do_solve()
 
   pcout << std::endl << "Solving quasi-static problem ..." << std::endl << std::flush;
 
-  // perform time loop
-  double load_factor    = 0.0;
-  double load_increment = param.load_increment;
-  // Step 0 is a pre step with a smaller load factor in order to make solving step 1 easier.
-  step_number = 0;
-  // In the first load step, we can not extrapolate the solution, so we solve the problem for a much
-  // smaller load factor and afterwards extrapolate the solution to the actual load factor in order
-  // to solve the first load step.
-  double const reduction_load_factor_step_0 = 0.01;
-  if(step_number == 0)
-    load_increment *= reduction_load_factor_step_0;
+  // perform time loop (load_factor, load_increment, and step_number have been read from restart
+  // files in case of a restarted simulation)
+  if(not(param.restarted_simulation))
+  {
+    load_factor    = 0.0;
+    load_increment = param.load_increment;
+    // Step 0 is a pre step with a smaller load factor in order to make solving step 1 easier.
+    step_number = 0;
+    // In the first load step, we can not extrapolate the solution, so we solve the problem for a
+    // much smaller load factor and afterwards extrapolate the solution to the actual load factor in
+    // order to solve the first load step.
+    double const reduction_load_factor_step_0 = 0.01;
+    if(step_number == 0)
+      load_increment *= reduction_load_factor_step_0;
+  }
+
+  bool first_restart_check = true;
 
   double const eps = 1.e-10;
   while(load_factor < 1.0 - eps)
@@ -154,28 +178,38 @@ DriverQuasiStatic<dim, Number>::do_solve()
 
     // compute displacement for new load factor
 
-    // reduce load increment in factors of 2 until the current
-    // step can be solved successfully
+    // Load increments below the minimum load increment result from clipping the increment in order
+    // to hit the maximum load exactly (or from the reduced increment of step 0). Since they have
+    // not been chosen by the adaptive strategy, they are reduced further if needed, and only the
+    // maximum number of attempts applies.
+    bool const increment_below_min = (load_increment < param.load_increment_min);
+
+    // reduce load increment until the current step can be solved successfully
     bool         success        = false;
     unsigned int re_try_counter = 0;
-    while(not(success) and re_try_counter < 10)
+    while(not(success) and re_try_counter < param.max_load_step_attempts and
+          (re_try_counter == 0 or increment_below_min or
+           load_increment >= param.load_increment_min))
     {
       try
       {
         // extrapolate solution
-        solution.add(load_increment / last_load_increment, displacement_increment);
+        extrapolate_solution(load_increment);
 
         iter    = solve_step(load_factor + load_increment, update_preconditioner);
         success = true;
       }
       catch(...)
       {
+        load_step_log.push_back(
+          {step_number, load_factor + load_increment, load_increment, 0, 0, false});
+
         // undo changes in solution vector
         solution = old_solution;
         ++re_try_counter;
 
-        // reduce load increment by factor of 2
-        load_increment *= 0.5;
+        // reduce load increment
+        load_increment *= param.load_increment_reduction;
         pcout << std::endl
               << "  Could not solve non-linear problem. Reduce load increment to " << load_increment
               << "." << std::endl
@@ -187,9 +221,22 @@ DriverQuasiStatic<dim, Number>::do_solve()
                 dealii::ExcMessage(
                   "Could not solve quasi static problem even after reducing the load increment."));
 
+    load_step_log.push_back({step_number,
+                             load_factor + load_increment,
+                             load_increment,
+                             std::get<0>(iter),
+                             std::get<1>(iter),
+                             true});
+
     // calculate increment as new_solution - old_solution
+    if(param.load_step_predictor == LoadStepPredictor::Quadratic)
+    {
+      previous_displacement_increment.swap(displacement_increment);
+      previous_load_increment = last_load_increment;
+    }
     displacement_increment = solution;
     displacement_increment.add(-1.0, old_solution);
+    ++n_accepted_steps;
 
     iterations.first += 1;
     std::get<0>(iterations.second) += std::get<0>(iter);
@@ -203,7 +250,7 @@ DriverQuasiStatic<dim, Number>::do_solve()
     if(step_number == 0)
       load_increment = param.load_increment - last_load_increment;
     else
-      load_increment = param.load_increment;
+      load_increment = calculate_next_load_increment(last_load_increment, std::get<0>(iter));
 
     // make sure to hit maximum load exactly
     if(load_factor + load_increment >= 1.0)
@@ -211,8 +258,25 @@ DriverQuasiStatic<dim, Number>::do_solve()
 
     // finally, increment step number
     ++step_number;
+
+    // restart
+    if(param.restart_data.write_restart)
+    {
+      if(param.restart_data.do_restart(timer.wall_time(),
+                                       load_factor,
+                                       step_number,
+                                       first_restart_check))
+      {
+        write_restart();
+      }
+
+      first_restart_check = false;
+    }
   }
 
+  if(not(is_test))
+    print_load_step_log();
+
   pcout << std::endl << "... done!" << std::endl;
 
   timer_tree->insert({"DriverQuasiStatic", "Solve"}, timer.wall_time());
@@ -227,6 +291,9 @@ DriverQuasiStatic<dim, Number>::initialize_vectors()
   pde_operator->initialize_dof_vector(rhs_vector);
 
   pde_operator->initialize_dof_vector(displacement_increment);
+
+  if(param.load_step_predictor == LoadStepPredictor::Quadratic)
+    pde_operator->initialize_dof_vector(previous_displacement_increment);
 }
 
 template<int dim, typename Number>
@@ -236,6 +303,111 @@ DriverQuasiStatic<dim, Number>::initialize_solution()
   pde_operator->prescribe_initial_displacement(solution, 0.0 /* time */);
 }
 
+template<int dim, typename Number>
+void
+DriverQuasiStatic<dim, Number>::write_restart() const
+{
+  pcout << std::endl
+        << print_horizontal_line() << std::endl
+        << std::endl
+        << " Writing restart file at load factor = " << std::scientific << std::setprecision(4)
+        << load_factor << ":" << std::endl;
+
+  std::string const filename = restart_filename(param.restart_data.filename, mpi_comm);
+
+  rename_restart_files(filename);
+
+  std::ostringstream oss;
+
+  boost::archive::binary_oarchive oa(oss);
+
+  unsigned int n_ranks = dealii::Utilities::MPI::n_mpi_processes(mpi_comm);
+
+  // 1. ranks
+  oa & n_ranks;
+
+  // 2. state of load stepping
+  oa & load_factor;
+  oa & load_increment;
+  oa & last_load_increment;
+  oa & previous_load_increment;
+  oa & step_number;
+  oa & n_accepted_steps;
+
+  // 3. solution vectors
+  oa << solution;
+  oa << displacement_increment;
+
+  bool const write_previous_increment = (param.load_step_predictor == LoadStepPredictor::Quadratic);
+  oa &       write_previous_increment;
+  if(write_previous_increment)
+    oa << previous_displacement_increment;
+
+  write_restart_file(oss, filename);
+
+  pcout << std::endl << " ... done!" << std::endl << print_horizontal_line() << std::endl;
+}
+
+template<int dim, typename Number>
+void
+DriverQuasiStatic<dim, Number>::read_restart()
+{
+  pcout << std::endl
+        << print_horizontal_line() << std::endl
+        << std::endl
+        << " Reading restart file:" << std::endl;
+
+  std::string const filename = restart_filename(param.restart_data.filename, mpi_comm);
+  std::ifstream     in(filename, std::ios::binary);
+  AssertThrow(in, dealii::ExcMessage("File " + filename + " does not exist."));
+
+  boost::archive::binary_iarchive ia(in);
+
+  // Note that the operations done here must be in sync with the output.
+
+  // 1. ranks
+  unsigned int n_old_ranks = 1;
+  ia &         n_old_ranks;
+
+  unsigned int n_ranks = dealii::Utilities::MPI::n_mpi_processes(mpi_comm);
+  AssertThrow(n_old_ranks == n_ranks,
+              dealii::ExcMessage("Tried to restart with " + dealii::Utilities::to_string(n_ranks) +
+                                 " processes, "
+                                 "but restart was written on " +
+                                 dealii::Utilities::to_string(n_old_ranks) + " processes."));
+
+  // 2. state of load stepping
+  ia & load_factor;
+  ia & load_increment;
+  ia & last_load_increment;
+  ia & previous_load_increment;
+  ia & step_number;
+  ia & n_accepted_steps;
+
+  // 3. solution vectors
+  ia >> solution;
+  ia >> displacement_increment;
+
+  bool read_previous_increment = false;
+  ia & read_previous_increment;
+  if(read_previous_increment)
+  {
+    VectorType tmp(displacement_increment);
+    ia >> tmp;
+    if(param.load_step_predictor == LoadStepPredictor::Quadratic)
+      previous_displacement_increment = tmp;
+  }
+
+  // the quadratic predictor needs the increments of two load steps
+  if(param.load_step_predictor == LoadStepPredictor::Quadratic and not(read_previous_increment))
+    n_accepted_steps = std::min(n_accepted_steps, 1u);
+
+  pcout << std::endl
+        << " ... done!" << std::endl
+        << print_horizontal_line() << std::endl
+        << std::endl;
+}
+
 template<int dim, typename Number>
 void
 DriverQuasiStatic<dim, Number>::output_solver_info_header(double const load_factor)
@@ -248,6 +420,93 @@ DriverQuasiStatic<dim, Number>::output_solver_info_header(double const load_fact
         << print_horizontal_line() << std::endl;
 }
 
+template<int dim, typename Number>
+void
+DriverQuasiStatic<dim, Number>::extrapolate_solution(double const load_increment)
+{
+  if(param.load_step_predictor == LoadStepPredictor::None)
+    return;
+
+  if(param.load_step_predictor == LoadStepPredictor::Quadratic and n_accepted_steps >= 2)
+  {
+    // Extrapolation of the quadratic polynomial through the solutions of the last three load
+    // steps (Newton form), with h = load_increment, h1 = last_load_increment, and
+    // h2 = previous_load_increment:
+    // u = u_n + h/h1 * du_n + h (h + h1) / (h1 + h2) * (du_n/h1 - du_{n-1}/h2)
+    double const h  = load_increment;
+    double const h1 = last_load_increment;
+    double const h2 = previous_load_increment;
+
+    double const factor = h * (h + h1) / (h1 + h2);
+
+    solution.add(h / h1 + factor / h1,
+                 displacement_increment,
+                 -factor / h2,
+                 previous_displacement_increment);
+  }
+  else // linear extrapolation
+  {
+    solution.add(load_increment / last_load_increment, displacement_increment);
+  }
+}
+
+template<int dim, typename Number>
+double
+DriverQuasiStatic<dim, Number>::calculate_next_load_increment(
+  double const       load_increment,
+  unsigned int const n_iter_nonlinear) const
+{
+  if(not(param.adaptive_load_increment))
+    return param.load_increment;
+
+  // The load increment is scaled by sqrt(desired_newton_iterations / n_iter_nonlinear), i.e., it
+  // grows if Newton converges fast and shrinks if Newton needs many iterations. The change per
+  // step is limited to the interval [load_increment_reduction, load_increment_max_growth].
+  double factor = param.load_increment_max_growth;
+  if(n_iter_nonlinear > 0)
+    factor = std::sqrt((double)param.desired_newton_iterations / (double)n_iter_nonlinear);
+
+  factor = std::min(std::max(factor, param.load_increment_reduction),
+                    param.load_increment_max_growth);
+
+  return std::min(std::max(load_increment * factor, param.load_increment_min),
+                  param.load_increment_max);
+}
+
+template<int dim, typename Number>
+void
+DriverQuasiStatic<dim, Number>::print_load_step_log() const
+{
+  pcout << std::endl << "Load steps:" << std::endl << std::endl;
+
+  pcout << "  " << std::setw(6) << std::left << "Step" << std::setw(14) << std::right
+        << "Load factor" << std::setw(16) << "Load increment" << std::setw(10) << "Newton"
+        << std::setw(10) << "Linear" << "   Status" << std::endl;
+
+  unsigned int n_rejected = 0;
+  for(auto const & entry : load_step_log)
+  {
+    pcout << "  " << std::setw(6) << std::left << entry.step_number << std::right
+          << std::scientific << std::setprecision(4) << std::setw(14) << entry.load_factor
+          << std::setw(16) << entry.load_increment;
+
+    if(entry.accepted)
+    {
+      pcout << std::setw(10) << entry.n_iter_nonlinear << std::setw(10) << entry.n_iter_linear
+            << "   accepted" << std::endl;
+    }
+    else
+    {
+      pcout << std::setw(10) << "-" << std::setw(10) << "-" << "   rejected" << std::endl;
+      ++n_rejected;
+    }
+  }
+
+  pcout << std::endl
+        << "  Accepted load steps: " << load_step_log.size() - n_rejected << std::endl
+        << "  Rejected load steps: " << n_rejected << std::endl;
+}
+
 template<int dim, typename Number>
 std::tuple<unsigned int, unsigned int>
 DriverQuasiStatic<dim, Number>::solve_step(double const load_factor,
@@ -83,6 +83,25 @@ private:
   void
   output_solver_info_header(double const load_factor);
 
+  // compute initial guess for the Newton solver by extrapolation from the last load steps
+  void
+  extrapolate_solution(double const load_increment);
+
+  // load increment for the next load step after a load step has been solved successfully
+  double
+  calculate_next_load_increment(double const       load_increment,
+                                unsigned int const n_iter_nonlinear) const;
+
+  void
+  print_load_step_log() const;
+
+  // write/read solution and state of load stepping to/from restart files
+  void
+  write_restart() const;
+
+  void
+  read_restart();
+
   std::tuple<unsigned int, unsigned int>
   solve_step(double const load_factor, bool const update_preconditioner);
 
@@ -109,10 +128,36 @@ private:
   // load step and obtain an accurate initial guess for the Newton solver.
   VectorType displacement_increment;
 
+  // current load factor and load increment of the next load step
+  double load_factor;
+  double load_increment;
+
   // For the purpose of extrapolating the displacements, we also need to store the
   // load_increment of the last load step.
   double last_load_increment;
 
+  // displacement increment and load increment of the second to last load step (only needed for
+  // quadratic extrapolation)
+  VectorType previous_displacement_increment;
+  double     previous_load_increment;
+
+  // number of load steps solved successfully, i.e., number of increments available for
+  // extrapolation
+  unsigned int n_accepted_steps;
+
+  // log of accepted and rejected load steps
+  struct LoadStepLogEntry
+  {
+    unsigned int step_number;
+    double       load_factor;
+    double       load_increment;
+    unsigned int n_iter_nonlinear;
+    unsigned int n_iter_linear;
+    bool         accepted;
+  };
+
+  std::vector<LoadStepLogEntry> load_step_log;
+
   unsigned int step_number;
 
   std::shared_ptr<TimerTree> timer_tree;
@@ -276,16 +276,65 @@ template<int dim, typename Number>
 void
 TimeIntGenAlpha<dim, Number>::do_write_restart(std::string const & filename) const
 {
-  (void)filename;
-  AssertThrow(false, dealii::ExcMessage("Restart has not been implemented for Structure."));
+  std::ostringstream oss;
+
+  boost::archive::binary_oarchive oa(oss);
+
+  unsigned int n_ranks = dealii::Utilities::MPI::n_mpi_processes(this->mpi_comm);
+
+  // 1. ranks
+  oa & n_ranks;
+
+  // 2. time
+  oa & this->time;
+
+  // 3. time step size
+  double const time_step_size = this->get_time_step_size();
+  oa &         time_step_size;
+
+  // 4. solution vectors
+  oa << displacement_n;
+  oa << velocity_n;
+  oa << acceleration_n;
+
+  write_restart_file(oss, filename);
 }
 
 template<int dim, typename Number>
 void
 TimeIntGenAlpha<dim, Number>::do_read_restart(std::ifstream & in)
 {
-  (void)in;
-  AssertThrow(false, dealii::ExcMessage("Restart has not been implemented for Structure."));
+  boost::archive::binary_iarchive ia(in);
+
+  // Note that the operations done here must be in sync with the output.
+
+  // 1. ranks
+  unsigned int n_old_ranks = 1;
+  ia &         n_old_ranks;
+
+  unsigned int n_ranks = dealii::Utilities::MPI::n_mpi_processes(this->mpi_comm);
+  AssertThrow(n_old_ranks == n_ranks,
+              dealii::ExcMessage("Tried to restart with " + dealii::Utilities::to_string(n_ranks) +
+                                 " processes, "
+                                 "but restart was written on " +
+                                 dealii::Utilities::to_string(n_old_ranks) + " processes."));
+
+  // 2. time
+  ia & this->time;
+
+  // Note that start_time has to be set to the new start_time (since param.start_time might still be
+  // the original start time).
+  this->start_time = this->time;
+
+  // 3. time step size
+  double time_step_size = 1.0;
+  ia &   time_step_size;
+  this->set_current_time_step_size(time_step_size);
+
+  // 4. solution vectors
+  ia >> displacement_n;
+  ia >> velocity_n;
+  ia >> acceleration_n;
 }
 
 template<int dim, typename Number>
@@ -343,6 +392,21 @@ TimeIntGenAlpha<dim, Number>::print_iterations() const
   print_list_of_iterations(pcout, names, iterations_avg);
 }
 
+template<int dim, typename Number>
+std::vector<std::pair<std::string, unsigned long long>>
+TimeIntGenAlpha<dim, Number>::get_accumulated_iterations() const
+{
+  if(param.large_deformation)
+  {
+    return {{"Nonlinear iterations", std::get<0>(iterations.second)},
+            {"Linear iterations", std::get<1>(iterations.second)}};
+  }
+  else
+  {
+    return {{"Linear iterations", std::get<1>(iterations.second)}};
+  }
+}
+
 template class TimeIntGenAlpha<2, float>;
 template class TimeIntGenAlpha<3, float>;
 
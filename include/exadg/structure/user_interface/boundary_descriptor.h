@@ -29,6 +29,7 @@
 
 // ExaDG
 #include <exadg/functions_and_boundary_conditions/container_interface_data.h>
+#include <exadg/functions_and_boundary_conditions/precomputed_boundary_data.h>
 
 namespace ExaDG
 {
@@ -44,7 +45,7 @@ enum class BoundaryType
 };
 
 template<int dim>
-struct BoundaryDescriptor
+struct BoundaryDescriptor : public PrecomputedBoundaryConditions<dim>
 {
   // Dirichlet
   std::map<dealii::types::boundary_id, std::shared_ptr<dealii::Function<dim>>> dirichlet_bc;
@@ -140,6 +141,22 @@ struct BoundaryDescriptor
                 dealii::ExcMessage("Boundary face with non-unique boundary type found."));
   }
 
+  // returns the boundary functions of all boundary IDs in precomputed_bc, which need to be part
+  // of neumann_bc
+  std::map<dealii::types::boundary_id, std::shared_ptr<dealii::Function<dim>>>
+  get_precomputed_functions() const
+  {
+    return this->collect_precomputed_functions({&neumann_bc}, "neumann_bc");
+  }
+
+  // resolves the vectorized interface of the boundary functions evaluated by
+  // evaluate_boundary_function() once per boundary ID
+  void
+  set_vectorized_functions() const
+  {
+    this->resolve_vectorized_functions({&neumann_bc});
+  }
+
   void
   set_dirichlet_cached_data(
     std::shared_ptr<ContainerInterfaceData<1, dim, double> const> interface_data) const
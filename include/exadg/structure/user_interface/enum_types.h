@@ -75,7 +75,20 @@ enum class MaterialType
 /*                                                                                    */
 /**************************************************************************************/
 
-// there are currently no enums for this section
+/*
+ *  Predictor used to compute the initial guess of the Newton solver for the next load step of
+ *  a quasi-static problem:
+ *
+ *  None:      solution of the last load step
+ *  Linear:    secant extrapolation from the last two load steps
+ *  Quadratic: quadratic extrapolation from the last three load steps
+ */
+enum class LoadStepPredictor
+{
+  None,
+  Linear,
+  Quadratic
+};
 
 
 
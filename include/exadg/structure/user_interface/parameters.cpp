@@ -59,6 +59,14 @@ Parameters::Parameters()
 
     // quasi-static solver
     load_increment(1.0),
+    adaptive_load_increment(false),
+    load_increment_min(0.0),
+    load_increment_max(1.0),
+    desired_newton_iterations(5),
+    load_increment_max_growth(2.0),
+    load_increment_reduction(0.5),
+    max_load_step_attempts(10),
+    load_step_predictor(LoadStepPredictor::Linear),
 
     // SPATIAL DISCRETIZATION
     grid(GridData()),
@@ -91,12 +99,29 @@ Parameters::check() const
     AssertThrow(large_deformation == true,
                 dealii::ExcMessage(
                   "QuasiStatic solver only implemented for nonlinear formulation."));
+
+    AssertThrow(load_increment > 0.0 and load_increment <= 1.0,
+                dealii::ExcMessage("Load increment has to be in (0,1]."));
+    AssertThrow(load_increment_min >= 0.0 and load_increment_min <= load_increment_max,
+                dealii::ExcMessage("Invalid bounds for load increment."));
+    AssertThrow(load_increment_reduction > 0.0 and load_increment_reduction < 1.0,
+                dealii::ExcMessage("Parameter load_increment_reduction has to be in (0,1)."));
+    AssertThrow(max_load_step_attempts > 0,
+                dealii::ExcMessage("Parameter max_load_step_attempts has to be positive."));
+
+    if(adaptive_load_increment)
+    {
+      AssertThrow(desired_newton_iterations > 0,
+                  dealii::ExcMessage("Parameter desired_newton_iterations has to be positive."));
+      AssertThrow(load_increment_max_growth >= 1.0,
+                  dealii::ExcMessage("Parameter load_increment_max_growth has to be >= 1."));
+    }
   }
 
-  if(problem_type == ProblemType::Unsteady)
+  if(problem_type == ProblemType::Steady)
   {
-    AssertThrow(restarted_simulation == false,
-                dealii::ExcMessage("Restart has not been implemented."));
+    AssertThrow(restarted_simulation == false and restart_data.write_restart == false,
+                dealii::ExcMessage("Restart is not available for ProblemType::Steady."));
   }
 
   if(weak_damping_active)
@@ -188,6 +213,19 @@ Parameters::print_parameters_temporal_discretization(dealii::ConditionalOStream
   if(problem_type == ProblemType::QuasiStatic)
   {
     print_parameter(pcout, "load_increment", load_increment);
+    print_parameter(pcout, "Adaptive load increment", adaptive_load_increment);
+    if(adaptive_load_increment)
+    {
+      print_parameter(pcout, "Min. load increment", load_increment_min);
+      print_parameter(pcout, "Max. load increment", load_increment_max);
+      print_parameter(pcout, "Desired Newton iterations", desired_newton_iterations);
+      print_parameter(pcout, "Max. growth of load increment", load_increment_max_growth);
+    }
+    print_parameter(pcout, "Reduction of load increment", load_increment_reduction);
+    print_parameter(pcout, "Max. attempts per load step", max_load_step_attempts);
+    print_parameter(pcout, "Load step predictor", load_step_predictor);
+    if(restarted_simulation or restart_data.write_restart)
+      restart_data.print(pcout);
   }
 
   if(problem_type == ProblemType::Unsteady)
@@ -166,6 +166,32 @@ public:
   // choose a value in [0,1] where 1 = maximum load (Neumann or Dirichlet)
   double load_increment;
 
+  // If true, the load increment is adapted after each load step depending on the number of Newton
+  // iterations needed: it grows if Newton converged in less than desired_newton_iterations and
+  // shrinks otherwise. If false, the load increment is only reduced temporarily in case the
+  // nonlinear solver fails.
+  bool adaptive_load_increment;
+
+  // bounds for the load increment (relevant in case of adaptive_load_increment == true or if the
+  // load increment is reduced since the nonlinear solver fails)
+  double load_increment_min;
+  double load_increment_max;
+
+  // desired number of Newton iterations per load step
+  unsigned int desired_newton_iterations;
+
+  // maximum factor by which the load increment may grow from one load step to the next
+  double load_increment_max_growth;
+
+  // factor by which the load increment is reduced if the nonlinear solver fails
+  double load_increment_reduction;
+
+  // maximum number of attempts to solve a load step before aborting the simulation
+  unsigned int max_load_step_attempts;
+
+  // predictor for the initial guess of the Newton solver in the next load step
+  LoadStepPredictor load_step_predictor;
+
   /**************************************************************************************/
   /*                                                                                    */
   /*                              SPATIAL DISCRETIZATION                                */
@@ -0,0 +1,275 @@
+/*  ______________________________________________________________________
+ *
+ *  ExaDG - High-Order Discontinuous Galerkin for the Exa-Scale
+ *
+ *  Copyright (C) 2021 by the ExaDG authors
+ *
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation, either version 3 of the License, or
+ *  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ *  ______________________________________________________________________
+ */
+
+#ifndef INCLUDE_EXADG_TIME_INTEGRATION_IMEX_RUNGE_KUTTA_H_
+#define INCLUDE_EXADG_TIME_INTEGRATION_IMEX_RUNGE_KUTTA_H_
+
+// C/C++
+#include <cmath>
+#include <memory>
+#include <string>
+#include <tuple>
+#include <vector>
+
+// deal.II
+#include <deal.II/base/exceptions.h>
+
+namespace ExaDG
+{
+/*
+ * Additive (IMEX) Runge-Kutta methods for problems of the type
+ *
+ *   du/dt = f_ex(u,t) + f_im(u,t) ,
+ *
+ * where f_ex is treated explicitly and f_im implicitly by a diagonally implicit Runge-Kutta
+ * method. The stages are given by
+ *
+ *   U_i = u_n + dt * sum_{j<i} a_ex_ij f_ex(U_j) + dt * sum_{j<=i} a_im_ij f_im(U_j) ,
+ *
+ * and the solution by u_{n+1} = u_n + dt * sum_i (b_ex_i f_ex(U_i) + b_im_i f_im(U_i)).
+ *
+ * The underlying operator has to provide the functions evaluate_explicit_part(),
+ * evaluate_implicit_part(), and solve_implicit_part(), where the latter solves the (nonlinear)
+ * problem U - factor * f_im(U) = rhs and returns the number of nonlinear and linear iterations.
+ *
+ * The following schemes of Ascher, Ruuth, Spiteri (1997), "Implicit-explicit Runge-Kutta methods
+ * for time-dependent partial differential equations", are implemented:
+ *
+ *   order 1: ARS(1,1,1), i.e. forward-backward Euler
+ *   order 2: ARS(2,2,2)
+ *   order 3: ARS(3,4,3)
+ *
+ * For all schemes, the first stage is explicit and the implicit part is L-stable.
+ */
+template<typename Operator, typename VectorType>
+class IMEXRungeKuttaTimeIntegrator
+{
+public:
+  IMEXRungeKuttaTimeIntegrator(unsigned int const              order_time_integrator,
+                               std::shared_ptr<Operator> const operator_in)
+    : underlying_operator(operator_in),
+      order(order_time_integrator),
+      n_iterations_nonlinear(0),
+      n_iterations_linear(0)
+  {
+    initialize_butcher_tableaus();
+
+    unsigned int const stages = c.size();
+
+    f_ex.resize(stages);
+    f_im.resize(stages);
+    for(unsigned int i = 0; i < stages; ++i)
+    {
+      if(stage_is_needed(A_ex, b_ex, i))
+        underlying_operator->initialize_dof_vector(f_ex[i]);
+      if(stage_is_needed(A_im, b_im, i))
+        underlying_operator->initialize_dof_vector(f_im[i]);
+    }
+
+    underlying_operator->initialize_dof_vector(vec_rhs);
+    underlying_operator->initialize_dof_vector(vec_stage);
+  }
+
+  void
+  solve_timestep(VectorType & dst, VectorType & src, double const time, double const time_step)
+  {
+    n_iterations_nonlinear = 0;
+    n_iterations_linear    = 0;
+
+    unsigned int const stages = c.size();
+
+    for(unsigned int i = 0; i < stages; ++i)
+    {
+      double const time_stage = time + c[i] * time_step;
+
+      // explicit contributions of the previous stages
+      vec_rhs = src;
+      for(unsigned int j = 0; j < i; ++j)
+      {
+        if(A_ex[i][j] != 0.0)
+          vec_rhs.add(time_step * A_ex[i][j], f_ex[j]);
+        if(A_im[i][j] != 0.0)
+          vec_rhs.add(time_step * A_im[i][j], f_im[j]);
+      }
+
+      // solve for the stage value, using the right-hand side as initial guess
+      vec_stage = vec_rhs;
+
+      double const factor = time_step * A_im[i][i];
+      if(factor != 0.0)
+      {
+        auto const iterations =
+          underlying_operator->solve_implicit_part(vec_stage, vec_rhs, time_stage, factor);
+
+        n_iterations_nonlinear += std::get<0>(iterations);
+        n_iterations_linear += std::get<1>(iterations);
+      }
+
+      // evaluate the operators for the current stage if needed by subsequent stages or the
+      // final update
+      if(stage_is_needed(A_ex, b_ex, i))
+        underlying_operator->evaluate_explicit_part(f_ex[i], vec_stage, time_stage);
+
+      if(stage_is_needed(A_im, b_im, i))
+      {
+        if(factor != 0.0)
+        {
+          // f_im(U_i) = (U_i - rhs_i) / (dt * a_im_ii) avoids an additional operator evaluation
+          f_im[i].equ(1.0 / factor, vec_stage);
+          f_im[i].add(-1.0 / factor, vec_rhs);
+        }
+        else
+        {
+          underlying_operator->evaluate_implicit_part(f_im[i], vec_stage, time_stage);
+        }
+      }
+    }
+
+    // final update
+    dst = src;
+    for(unsigned int i = 0; i < stages; ++i)
+    {
+      if(b_ex[i] != 0.0)
+        dst.add(time_step * b_ex[i], f_ex[i]);
+      if(b_im[i] != 0.0)
+        dst.add(time_step * b_im[i], f_im[i]);
+    }
+  }
+
+  unsigned int
+  get_order() const
+  {
+    return order;
+  }
+
+  // returns the number of nonlinear and accumulated linear iterations of the last time step
+  std::tuple<unsigned int, unsigned int>
+  get_iterations() const
+  {
+    return std::make_tuple(n_iterations_nonlinear, n_iterations_linear);
+  }
+
+private:
+  void
+  initialize_butcher_tableaus()
+  {
+    if(order == 1)
+    {
+      /*
+       * ARS(1,1,1)
+       *
+       *  explicit:          implicit:
+       *
+       *   0 | 0  0           0 | 0  0
+       *   1 | 1  0           1 | 0  1
+       *  ----------         ----------
+       *     | 1  0             | 0  1
+       */
+      c    = {0.0, 1.0};
+      A_ex = {{0.0, 0.0}, {1.0, 0.0}};
+      b_ex = {1.0, 0.0};
+      A_im = {{0.0, 0.0}, {0.0, 1.0}};
+      b_im = {0.0, 1.0};
+    }
+    else if(order == 2)
+    {
+      /*
+       * ARS(2,2,2) with gamma = 1 - 1/sqrt(2), delta = 1 - 1/(2 gamma)
+       *
+       *  explicit:                         implicit:
+       *
+       *   0     | 0      0          0       0     | 0  0          0
+       *   gamma | gamma  0          0       gamma | 0  gamma      0
+       *   1     | delta  1 - delta  0       1     | 0  1 - gamma  gamma
+       *  -----------------------------     ---------------------------
+       *         | delta  1 - delta  0             | 0  1 - gamma  gamma
+       */
+      double const gamma = 1.0 - 1.0 / std::sqrt(2.0);
+      double const delta = 1.0 - 1.0 / (2.0 * gamma);
+
+      c    = {0.0, gamma, 1.0};
+      A_ex = {{0.0, 0.0, 0.0}, {gamma, 0.0, 0.0}, {delta, 1.0 - delta, 0.0}};
+      b_ex = {delta, 1.0 - delta, 0.0};
+      A_im = {{0.0, 0.0, 0.0}, {0.0, gamma, 0.0}, {0.0, 1.0 - gamma, gamma}};
+      b_im = {0.0, 1.0 - gamma, gamma};
+    }
+    else if(order == 3)
+    {
+      /*
+       * ARS(3,4,3) with gamma = 0.4358665215, see Ascher, Ruuth, Spiteri (1997), Section 2.7
+       */
+      double const gamma = 0.4358665215;
+      double const beta1 = -1.5 * gamma * gamma + 4.0 * gamma - 0.25;
+      double const beta2 = 1.5 * gamma * gamma - 5.0 * gamma + 1.25;
+
+      c    = {0.0, gamma, 0.5 * (1.0 + gamma), 1.0};
+      A_ex = {{0.0, 0.0, 0.0, 0.0},
+              {gamma, 0.0, 0.0, 0.0},
+              {0.3212788860, 0.3966543747, 0.0, 0.0},
+              {-0.105858296, 0.5529291479, 0.5529291479, 0.0}};
+      b_ex = {0.0, beta1, beta2, gamma};
+      A_im = {{0.0, 0.0, 0.0, 0.0},
+              {0.0, gamma, 0.0, 0.0},
+              {0.0, 0.5 * (1.0 - gamma), gamma, 0.0},
+              {0.0, beta1, beta2, gamma}};
+      b_im = {0.0, beta1, beta2, gamma};
+    }
+    else
+    {
+      AssertThrow(false,
+                  dealii::ExcMessage("IMEX Runge-Kutta method of order " + std::to_string(order) +
+                                     " not implemented."));
+    }
+  }
+
+  // returns whether the evaluation of stage i is needed by subsequent stages or the final update
+  static bool
+  stage_is_needed(std::vector<std::vector<double>> const & A,
+                  std::vector<double> const &              b,
+                  unsigned int const                       i)
+  {
+    bool needed = (b[i] != 0.0);
+    for(unsigned int k = i + 1; k < b.size(); ++k)
+      needed = needed or (A[k][i] != 0.0);
+
+    return needed;
+  }
+
+  std::shared_ptr<Operator> underlying_operator;
+
+  unsigned int const order;
+
+  // Butcher tableaus
+  std::vector<double>              c;
+  std::vector<std::vector<double>> A_ex, A_im;
+  std::vector<double>              b_ex, b_im;
+
+  // operator evaluations of the stages
+  std::vector<VectorType> f_ex, f_im;
+
+  VectorType vec_rhs, vec_stage;
+
+  unsigned int n_iterations_nonlinear, n_iterations_linear;
+};
+
+} // namespace ExaDG
+
+#endif /* INCLUDE_EXADG_TIME_INTEGRATION_IMEX_RUNGE_KUTTA_H_ */
@@ -0,0 +1,347 @@
+/*  ______________________________________________________________________
+ *
+ *  ExaDG - High-Order Discontinuous Galerkin for the Exa-Scale
+ *
+ *  Copyright (C) 2021 by the ExaDG authors
+ *
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation, either version 3 of the License, or
+ *  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ *  ______________________________________________________________________
+ */
+
+#ifndef INCLUDE_EXADG_TIME_INTEGRATION_LOCAL_TIME_STEPPING_H_
+#define INCLUDE_EXADG_TIME_INTEGRATION_LOCAL_TIME_STEPPING_H_
+
+// C/C++
+#include <algorithm>
+#include <vector>
+
+// deal.II
+#include <deal.II/base/quadrature_lib.h>
+#include <deal.II/lac/la_parallel_block_vector.h>
+#include <deal.II/lac/la_parallel_vector.h>
+#include <deal.II/matrix_free/matrix_free.h>
+
+namespace ExaDG
+{
+/*
+ * Contiguous range [begin, end) of locally owned degrees of freedom (local indices) in the block
+ * with index block of a (block) vector.
+ */
+struct DoFRange
+{
+  unsigned int block;
+  unsigned int begin;
+  unsigned int end;
+};
+
+/*
+ * Partitioning of the locally owned cells and degrees of freedom into time step levels for local
+ * time stepping. Cells on level l are advanced with the time step size 2^l * dt, where dt is the
+ * time step size of the finest level l = 0. Hence, one time step of the coarsest level consists of
+ * 2^(n_levels-1) sub-steps of the finest level, and level l is advanced in every 2^l-th sub-step.
+ *
+ * Local time stepping is currently only used by the multirate Adams-Bashforth scheme of the
+ * acoustic solver (see TimeIntAdamsBashforthMoultonBase). The explicit Runge-Kutta schemes of the
+ * compressible solver do not support local time stepping, since this would require a coupling of
+ * the levels for each Runge-Kutta stage.
+ */
+struct TimeStepLevels
+{
+  TimeStepLevels() : n_levels(1)
+  {
+  }
+
+  unsigned int n_levels;
+
+  // cell batches of the dealii::MatrixFree object on level l
+  std::vector<std::vector<unsigned int>> cell_batches;
+
+  // cell batches of the dealii::MatrixFree object on the levels 0, ..., l
+  std::vector<std::vector<unsigned int>> cell_batches_up_to_level;
+
+  // degrees of freedom of the cells on level l
+  std::vector<std::vector<DoFRange>> dof_ranges;
+
+  // interface_dof_ranges[m][l]: degrees of freedom of the cells on level l > m that share a face
+  // with a cell on a level <= m (where the neighbor might be a ghost cell). When the levels
+  // 0, ..., m are advanced, these cells provide the exterior values at the level interface.
+  std::vector<std::vector<std::vector<DoFRange>>> interface_dof_ranges;
+};
+
+/*
+ * Returns the finest level m such that the levels 0, ..., m are advanced in the given sub-step.
+ */
+inline unsigned int
+get_max_active_time_step_level(unsigned int const sub_step, unsigned int const n_levels)
+{
+  unsigned int level = 0;
+  while(level + 1 < n_levels and sub_step % (1u << (level + 1)) == 0)
+    ++level;
+
+  return level;
+}
+
+/*
+ * Returns the weights w_i of the integration formula
+ *
+ *   int_{t_begin}^{t_end} p(t) dt = sum_i w_i * f_i ,
+ *
+ * where p is the polynomial interpolating the values f_i at the (distinct) times t_i = times[i].
+ * In contrast to ABTimeIntegratorConstants, the interval of integration is arbitrary. This is
+ * needed for local time stepping, where the state of a level is evaluated at intermediate times
+ * of its time step and where the history of a level might contain different time step sizes.
+ */
+inline std::vector<double>
+calculate_adams_bashforth_weights(std::vector<double> const & times,
+                                  double const                t_begin,
+                                  double const                t_end)
+{
+  unsigned int const n = times.size();
+
+  std::vector<double> weights(n, 0.0);
+
+  // p is of degree n-1, so that a Gauss quadrature with n points is exact. Times are shifted by
+  // times[0] to reduce round-off errors.
+  dealii::QGauss<1> const quadrature(n);
+  for(unsigned int q = 0; q < quadrature.size(); ++q)
+  {
+    double const t   = (t_begin - times[0]) + (t_end - t_begin) * quadrature.point(q)[0];
+    double const JxW = (t_end - t_begin) * quadrature.weight(q);
+
+    for(unsigned int i = 0; i < n; ++i)
+    {
+      double lagrange = 1.0;
+      for(unsigned int j = 0; j < n; ++j)
+      {
+        if(j != i)
+          lagrange *= (t - (times[j] - times[0])) / (times[i] - times[j]);
+      }
+
+      weights[i] += lagrange * JxW;
+    }
+  }
+
+  return weights;
+}
+
+/*
+ * Access to the blocks of a vector referred to by DoFRange::block.
+ */
+template<typename Number>
+dealii::LinearAlgebra::distributed::Vector<Number> &
+get_block(dealii::LinearAlgebra::distributed::BlockVector<Number> & vector,
+          unsigned int const                                        block)
+{
+  return vector.block(block);
+}
+
+template<typename Number>
+dealii::LinearAlgebra::distributed::Vector<Number> const &
+get_block(dealii::LinearAlgebra::distributed::BlockVector<Number> const & vector,
+          unsigned int const                                              block)
+{
+  return vector.block(block);
+}
+
+template<typename Number>
+dealii::LinearAlgebra::distributed::Vector<Number> &
+get_block(dealii::LinearAlgebra::distributed::Vector<Number> & vector, unsigned int const block)
+{
+  AssertThrow(block == 0, dealii::ExcMessage("Vector consists of a single block only."));
+  return vector;
+}
+
+template<typename Number>
+dealii::LinearAlgebra::distributed::Vector<Number> const &
+get_block(dealii::LinearAlgebra::distributed::Vector<Number> const & vector,
+          unsigned int const                                         block)
+{
+  AssertThrow(block == 0, dealii::ExcMessage("Vector consists of a single block only."));
+  return vector;
+}
+
+/*
+ * Vector operations restricted to a subset of the degrees of freedom.
+ */
+
+// dst = src
+template<typename VectorType>
+void
+copy_dof_ranges(VectorType & dst, VectorType const & src, std::vector<DoFRange> const & ranges)
+{
+  for(DoFRange const & range : ranges)
+  {
+    auto &       dst_block = get_block(dst, range.block);
+    auto const & src_block = get_block(src, range.block);
+    for(unsigned int i = range.begin; i < range.end; ++i)
+      dst_block.local_element(i) = src_block.local_element(i);
+  }
+}
+
+// dst += factor * src
+template<typename VectorType>
+void
+add_dof_ranges(VectorType &                          dst,
+               typename VectorType::value_type const factor,
+               VectorType const &                    src,
+               std::vector<DoFRange> const &         ranges)
+{
+  for(DoFRange const & range : ranges)
+  {
+    auto &       dst_block = get_block(dst, range.block);
+    auto const & src_block = get_block(src, range.block);
+    for(unsigned int i = range.begin; i < range.end; ++i)
+      dst_block.local_element(i) += factor * src_block.local_element(i);
+  }
+}
+
+// dst *= factor
+template<typename VectorType>
+void
+scale_dof_ranges(VectorType &                          dst,
+                 typename VectorType::value_type const factor,
+                 std::vector<DoFRange> const &         ranges)
+{
+  for(DoFRange const & range : ranges)
+  {
+    auto & dst_block = get_block(dst, range.block);
+    for(unsigned int i = range.begin; i < range.end; ++i)
+      dst_block.local_element(i) *= factor;
+  }
+}
+
+/*
+ * Sets up the time step levels given the level of each cell (indexed by active_cell_index(),
+ * locally owned and ghost cells). Cell batches of the dealii::MatrixFree object must not contain
+ * cells of different levels, see Categorization::split_categories_by_level(). The vector
+ * dof_indices contains the dof_index of dealii::MatrixFree for each block of the (block) vector.
+ * The degrees of freedom of a cell need to be numbered contiguously (discontinuous Galerkin).
+ */
+template<int dim, typename Number>
+void
+setup_time_step_levels(TimeStepLevels &                        levels,
+                       dealii::MatrixFree<dim, Number> const & matrix_free,
+                       std::vector<unsigned int> const &       cell_levels,
+                       unsigned int const                      n_levels,
+                       std::vector<unsigned int> const &       dof_indices)
+{
+  levels.n_levels = n_levels;
+  levels.cell_batches.assign(n_levels, std::vector<unsigned int>());
+  levels.cell_batches_up_to_level.assign(n_levels, std::vector<unsigned int>());
+  levels.dof_ranges.assign(n_levels, std::vector<DoFRange>());
+  levels.interface_dof_ranges.assign(n_levels,
+                                     std::vector<std::vector<DoFRange>>(n_levels,
+                                                                        std::vector<DoFRange>()));
+
+  auto const get_level = [&](auto const & cell) { return cell_levels[cell->active_cell_index()]; };
+
+  std::vector<dealii::types::global_dof_index> dof_indices_cell;
+
+  for(unsigned int cell = 0; cell < matrix_free.n_cell_batches(); ++cell)
+  {
+    unsigned int const level = get_level(matrix_free.get_cell_iterator(cell, 0));
+
+    levels.cell_batches[level].push_back(cell);
+
+    for(unsigned int v = 0; v < matrix_free.n_active_entries_per_cell_batch(cell); ++v)
+    {
+      auto const cell_v = matrix_free.get_cell_iterator(cell, v);
+
+      AssertThrow(get_level(cell_v) == level,
+                  dealii::ExcMessage("Cells of different time step levels must not be "
+                                     "vectorized together."));
+
+      // finest level among the face neighbors
+      unsigned int min_level_neighbors = level;
+      for(unsigned int f = 0; f < cell_v->n_faces(); ++f)
+      {
+        if(cell_v->at_boundary(f) and not(cell_v->has_periodic_neighbor(f)))
+          continue;
+
+        auto const neighbor = cell_v->neighbor_or_periodic_neighbor(f);
+        if(neighbor->has_children())
+        {
+          for(unsigned int c = 0; c < neighbor->n_children(); ++c)
+          {
+            if(not(neighbor->child(c)->is_artificial()))
+              min_level_neighbors = std::min(min_level_neighbors, get_level(neighbor->child(c)));
+          }
+        }
+        else
+        {
+          min_level_neighbors = std::min(min_level_neighbors, get_level(neighbor));
+        }
+      }
+
+      for(unsigned int b = 0; b < dof_indices.size(); ++b)
+      {
+        auto const cell_b = matrix_free.get_cell_iterator(cell, v, dof_indices[b]);
+        dof_indices_cell.resize(cell_b->get_fe().n_dofs_per_cell());
+        cell_b->get_dof_indices(dof_indices_cell);
+
+        auto const min_max =
+          std::minmax_element(dof_indices_cell.begin(), dof_indices_cell.end());
+        AssertThrow(*min_max.second - *min_max.first + 1 == dof_indices_cell.size(),
+                    dealii::ExcMessage("Local time stepping requires the degrees of freedom of a "
+                                       "cell to be numbered contiguously."));
+
+        unsigned int const begin =
+          matrix_free.get_vector_partitioner(dof_indices[b])->global_to_local(*min_max.first);
+
+        DoFRange const range = {b, begin, begin + (unsigned int)dof_indices_cell.size()};
+
+        levels.dof_ranges[level].push_back(range);
+        for(unsigned int m = min_level_neighbors; m < level; ++m)
+          levels.interface_dof_ranges[m][level].push_back(range);
+      }
+    }
+  }
+
+  // sort and merge ranges to obtain long contiguous ranges for the vector operations
+  auto const merge = [](std::vector<DoFRange> & ranges) {
+    std::sort(ranges.begin(), ranges.end(), [](DoFRange const & a, DoFRange const & b) {
+      return a.block < b.block or (a.block == b.block and a.begin < b.begin);
+    });
+
+    std::vector<DoFRange> merged;
+    for(DoFRange const & range : ranges)
+    {
+      if(not(merged.empty()) and merged.back().block == range.block and
+         merged.back().end == range.begin)
+        merged.back().end = range.end;
+      else
+        merged.push_back(range);
+    }
+
+    ranges.swap(merged);
+  };
+
+  for(unsigned int level = 0; level < n_levels; ++level)
+  {
+    merge(levels.dof_ranges[level]);
+    for(unsigned int m = 0; m < n_levels; ++m)
+      merge(levels.interface_dof_ranges[m][level]);
+
+    levels.cell_batches_up_to_level[level] = level > 0 ?
+                                               levels.cell_batches_up_to_level[level - 1] :
+                                               std::vector<unsigned int>();
+    levels.cell_batches_up_to_level[level].insert(levels.cell_batches_up_to_level[level].end(),
+                                                  levels.cell_batches[level].begin(),
+                                                  levels.cell_batches[level].end());
+  }
+}
+
+} // namespace ExaDG
+
+#endif /* INCLUDE_EXADG_TIME_INTEGRATION_LOCAL_TIME_STEPPING_H_ */
@@ -61,7 +61,7 @@ rename_restart_files(std::string const & filename)
 inline void
 write_restart_file(std::ostringstream & oss, std::string const & filename)
 {
-  std::ofstream stream(filename.c_str());
+  std::ofstream stream(filename.c_str(), std::ios::binary);
 
   stream << oss.str() << std::endl;
 }
@@ -24,6 +24,7 @@
 
 // C/C++
 #include <limits>
+#include <string>
 
 // deal.II
 #include <deal.II/base/conditional_ostream.h>
@@ -40,6 +41,7 @@ struct SolverInfoData
     : interval_time(std::numeric_limits<double>::max()),
       interval_wall_time(std::numeric_limits<double>::max()),
       interval_time_steps(std::numeric_limits<unsigned int>::max()),
+      statistics_filename(""),
       counter(0),
       do_output_in_this_time_step(false),
       old_time_step_number(0)
@@ -53,6 +55,8 @@ struct SolverInfoData
     print_parameter(pcout, "Interval physical time", interval_time);
     print_parameter(pcout, "Interval wall time", interval_wall_time);
     print_parameter(pcout, "Interval time steps", interval_time_steps);
+    if(not statistics_filename.empty())
+      print_parameter(pcout, "Solver statistics file", statistics_filename);
   }
 
   bool
@@ -104,6 +108,10 @@ struct SolverInfoData
   // number of time steps after which to write restart
   unsigned int interval_time_steps;
 
+  // Solver statistics (iterations, wall times, time step size) of every time step are appended
+  // to this file in the JSON lines format if a filename is specified, see SolverStatistics.
+  std::string statistics_filename;
+
   // counter needed do decide when to write restart
   mutable unsigned int counter;
 
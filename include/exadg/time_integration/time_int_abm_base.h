@@ -25,6 +25,7 @@
 
 #include <exadg/time_integration/ab_constants.h>
 #include <exadg/time_integration/am_constants.h>
+#include <exadg/time_integration/local_time_stepping.h>
 #include <exadg/time_integration/push_back_vectors.h>
 #include <exadg/time_integration/time_int_multistep_base.h>
 #include <exadg/utilities/print_solver_results.h>
@@ -33,6 +34,16 @@ namespace ExaDG
 {
 /**
  * This class implements the purely explicit Adams--Bashforth--Moulton predictor corrector method.
+ *
+ * Optionally, local time stepping is applied: The operator provides a partitioning of the cells
+ * into time step levels l = 0, ..., L-1 with time step sizes 2^l * dt_0, see TimeStepLevels, and
+ * the time step size of the time integrator is the one of the coarsest level, 2^(L-1) * dt_0. A
+ * time step is performed as a sequence of 2^(L-1) sub-steps of size dt_0 by a multirate
+ * Adams--Bashforth scheme: In every sub-step, the operator is evaluated for the cells of the
+ * levels that start a new time step, these levels are advanced by their own time step size, and
+ * the evaluated operator is stored in the history of the level. At level interfaces, the exterior
+ * values of the neighboring coarser cells are interpolated to the current time by means of the
+ * history of their level. The Adams--Moulton corrector is not applied in this case.
  */
 template<typename Operator, typename VectorType>
 class TimeIntAdamsBashforthMoultonBase : public TimeIntMultistepBase
@@ -47,6 +58,7 @@ public:
                                    unsigned int const        order_,
                                    bool const                start_with_low_order_,
                                    bool const                adaptive_time_stepping_,
+                                   bool const                local_time_stepping_,
                                    RestartData const &       restart_data_,
                                    MPI_Comm const &          mpi_comm_,
                                    bool const                is_test_)
@@ -63,7 +75,8 @@ public:
       // order of predictor can be chosen one below order of corrector
       ab(order_ - 1, start_with_low_order_),
       am(order_, start_with_low_order_),
-      vec_evaluated_operators(order_ - 1)
+      vec_evaluated_operators(order_ - 1),
+      local_time_stepping(local_time_stepping_)
   {
     AssertThrow(order_ >= 1,
                 dealii::ExcMessage("Oder of ABM time integrator has to be at least 1."));
@@ -73,7 +86,10 @@ public:
   print_iterations() const
   {
     // explicit time integration -> no iterations
-    print_list_of_iterations(pcout, {"Adams-Bashforth-Moulton"}, {0});
+    if(local_time_stepping)
+      print_list_of_iterations(pcout, {"Adams-Bashforth (local time stepping)"}, {0});
+    else
+      print_list_of_iterations(pcout, {"Adams-Bashforth-Moulton"}, {0});
   }
 
   void
@@ -109,9 +125,25 @@ private:
     pde_operator->initialize_dof_vector(solution);
     pde_operator->initialize_dof_vector(prediction);
 
-    pde_operator->initialize_dof_vector(evaluated_operator_np);
-    for(auto & evaluated_operator : vec_evaluated_operators)
-      pde_operator->initialize_dof_vector(evaluated_operator);
+    if(local_time_stepping)
+    {
+      pde_operator->initialize_dof_vector(evaluation_vector_lts);
+      pde_operator->initialize_dof_vector(evaluated_operator_lts);
+
+      history_lts.resize(order);
+      for(auto & evaluated_operator : history_lts)
+        pde_operator->initialize_dof_vector(evaluated_operator);
+
+      unsigned int const n_levels = pde_operator->get_time_step_levels().n_levels;
+      history_head_lts.assign(n_levels, 0);
+      history_times_lts.assign(n_levels, std::vector<double>());
+    }
+    else
+    {
+      pde_operator->initialize_dof_vector(evaluated_operator_np);
+      for(auto & evaluated_operator : vec_evaluated_operators)
+        pde_operator->initialize_dof_vector(evaluated_operator);
+    }
   }
 
   void
@@ -123,6 +155,12 @@ private:
   void
   initialize_former_multistep_dof_vectors() final
   {
+    if(local_time_stepping)
+    {
+      initialize_history_local_time_stepping();
+      return;
+    }
+
     if(start_with_low_order)
     {
       if(vec_evaluated_operators.size() > 0)
@@ -183,8 +221,148 @@ private:
   void
   do_timestep_solve() final
   {
-    do_timestep_predict();
-    do_timestep_correct();
+    if(local_time_stepping)
+    {
+      do_timestep_local_time_stepping();
+    }
+    else
+    {
+      do_timestep_predict();
+      do_timestep_correct();
+    }
+  }
+
+  /*
+   * Local time stepping: The evaluated operators of all levels are stored in the vectors
+   * history_lts, where each level uses the vectors as a ring buffer of its own, i.e., the evaluated
+   * operator of level l at time history_times_lts[l][i] is stored in
+   * history_lts[get_history_index(l, i)] on the degrees of freedom of the cells of level l.
+   */
+  unsigned int
+  get_history_index(unsigned int const level, unsigned int const i) const
+  {
+    return (history_head_lts[level] + i) % history_lts.size();
+  }
+
+  void
+  initialize_history_local_time_stepping()
+  {
+    // In analogy to the global time stepping, the histories remain empty when starting with a low
+    // order method. Since the integration weights are calculated from the available history
+    // entries, each level then starts with the explicit Euler method and increases the order by one
+    // in each of its first time steps until order_time_integrator is reached.
+    if(start_with_low_order)
+      return;
+
+    TimeStepLevels const & levels = pde_operator->get_time_step_levels();
+
+    // The history of each level is filled with the operator evaluated for the analytical solution
+    // at the previous time steps of the level. Since the newest entry is added in the first
+    // sub-step, the entries are stored behind the head of the ring buffer.
+    VectorType temp_sol, temp_op;
+    pde_operator->initialize_dof_vector(temp_sol);
+    pde_operator->initialize_dof_vector(temp_op);
+
+    double const sub_step_size = get_time_step_size() / (1u << (levels.n_levels - 1));
+
+    for(unsigned int level = 0; level < levels.n_levels; ++level)
+    {
+      double const level_step_size = sub_step_size * (1u << level);
+
+      for(unsigned int i = 1; i < history_lts.size(); ++i)
+      {
+        double const previous_time = get_time() - i * level_step_size;
+
+        pde_operator->prescribe_initial_conditions(temp_sol, previous_time);
+        pde_operator->evaluate(temp_op, temp_sol, previous_time);
+
+        copy_dof_ranges(history_lts[i - 1], temp_op, levels.dof_ranges[level]);
+        history_times_lts[level].push_back(previous_time);
+      }
+    }
+  }
+
+  void
+  do_timestep_local_time_stepping()
+  {
+    dealii::Timer timer;
+    timer.restart();
+
+    TimeStepLevels const & levels = pde_operator->get_time_step_levels();
+
+    unsigned int const n_sub_steps   = 1u << (levels.n_levels - 1);
+    double const       sub_step_size = get_time_step_size() / n_sub_steps;
+
+    for(unsigned int s = 0; s < n_sub_steps; ++s)
+    {
+      double const       sub_step_time    = get_time() + s * sub_step_size;
+      unsigned int const max_active_level = get_max_active_time_step_level(s, levels.n_levels);
+
+      // The vector solution contains the solution of each level at the end of the current time
+      // step of the level, which is the current time for the levels 0, ..., max_active_level.
+      for(unsigned int level = 0; level <= max_active_level; ++level)
+        copy_dof_ranges(evaluation_vector_lts, solution, levels.dof_ranges[level]);
+
+      // For the coarser levels, the solution at the current time is only needed at the level
+      // interfaces and is obtained by integrating the history of the level backwards in time.
+      for(unsigned int level = max_active_level + 1; level < levels.n_levels; ++level)
+      {
+        std::vector<DoFRange> const & ranges = levels.interface_dof_ranges[max_active_level][level];
+
+        unsigned int const n_sub_steps_level = 1u << level;
+        double const       level_end_time =
+          get_time() + (s - s % n_sub_steps_level + n_sub_steps_level) * sub_step_size;
+
+        std::vector<double> const weights = calculate_adams_bashforth_weights(
+          history_times_lts[level], level_end_time, sub_step_time);
+
+        copy_dof_ranges(evaluation_vector_lts, solution, ranges);
+        for(unsigned int i = 0; i < weights.size(); ++i)
+          add_dof_ranges(evaluation_vector_lts,
+                         static_cast<Number>(weights[i]),
+                         history_lts[get_history_index(level, i)],
+                         ranges);
+      }
+
+      pde_operator->evaluate_time_step_levels(evaluated_operator_lts,
+                                              evaluation_vector_lts,
+                                              sub_step_time,
+                                              max_active_level);
+
+      // update history and advance active levels
+      for(unsigned int level = 0; level <= max_active_level; ++level)
+      {
+        std::vector<DoFRange> const & ranges = levels.dof_ranges[level];
+
+        history_head_lts[level] = get_history_index(level, history_lts.size() - 1);
+        copy_dof_ranges(history_lts[history_head_lts[level]], evaluated_operator_lts, ranges);
+
+        std::vector<double> & times = history_times_lts[level];
+        times.insert(times.begin(), sub_step_time);
+        if(times.size() > history_lts.size())
+          times.pop_back();
+
+        double const level_step_size = sub_step_size * (1u << level);
+
+        std::vector<double> const weights =
+          calculate_adams_bashforth_weights(times, sub_step_time, sub_step_time + level_step_size);
+
+        for(unsigned int i = 0; i < weights.size(); ++i)
+          add_dof_ranges(solution,
+                         static_cast<Number>(weights[i]),
+                         history_lts[get_history_index(level, i)],
+                         ranges);
+      }
+    }
+
+    // write output
+    if(this->print_solver_info() and not(this->is_test))
+    {
+      pcout << std::endl << "Adams-Bashforth (local time stepping):";
+      print_wall_time(pcout, timer.wall_time());
+    }
+
+    timer_tree->insert({"Timeloop", "Adams-Bashforth (local time stepping)"}, timer.wall_time());
   }
 
   void
@@ -210,6 +388,9 @@ private:
   void
   prepare_vectors_for_next_timestep() final
   {
+    if(local_time_stepping)
+      return;
+
     if(vec_evaluated_operators.size() > 0)
     {
       push_back(vec_evaluated_operators);
@@ -222,6 +403,30 @@ private:
   {
     ia >> solution;
     ia >> prediction;
+
+    if(local_time_stepping)
+    {
+      unsigned int n_levels = 0;
+      ia &         n_levels;
+      AssertThrow(n_levels == pde_operator->get_time_step_levels().n_levels,
+                  dealii::ExcMessage("The number of time step levels differs from the one of the "
+                                     "simulation that wrote the restart files."));
+
+      history_head_lts.resize(n_levels);
+      history_times_lts.resize(n_levels);
+      for(unsigned int level = 0; level < n_levels; ++level)
+      {
+        unsigned int n_times = 0;
+        ia &         history_head_lts[level];
+        ia &         n_times;
+        history_times_lts[level].resize(n_times);
+        for(double & time : history_times_lts[level])
+          ia & time;
+      }
+
+      for(auto & evaluated_operator : history_lts)
+        ia >> evaluated_operator;
+    }
   }
 
   void
@@ -229,6 +434,24 @@ private:
   {
     oa << solution;
     oa << prediction;
+
+    if(local_time_stepping)
+    {
+      unsigned int n_levels = history_head_lts.size();
+      oa &         n_levels;
+
+      for(unsigned int level = 0; level < n_levels; ++level)
+      {
+        unsigned int n_times = history_times_lts[level].size();
+        oa &         history_head_lts[level];
+        oa &         n_times;
+        for(double const & time : history_times_lts[level])
+          oa & time;
+      }
+
+      for(auto const & evaluated_operator : history_lts)
+        oa << evaluated_operator;
+    }
   }
 
   void
@@ -252,6 +475,18 @@ private:
   // store evaluated operators from previous time steps
   VectorType              evaluated_operator_np;
   std::vector<VectorType> vec_evaluated_operators;
+
+  // local time stepping
+  bool const local_time_stepping;
+
+  // solution at the current sub-step (needed on active levels and level interfaces only)
+  VectorType evaluation_vector_lts;
+  VectorType evaluated_operator_lts;
+
+  // history of evaluated operators and corresponding times of all levels
+  std::vector<VectorType>          history_lts;
+  std::vector<unsigned int>        history_head_lts;
+  std::vector<std::vector<double>> history_times_lts;
 };
 
 } // namespace ExaDG
@@ -38,6 +38,7 @@ TimeIntBase::TimeIntBase(double const &      start_time_,
     time_step_number(1),
     max_number_of_time_steps(max_number_of_time_steps_),
     restart_data(restart_data_),
+    time_step_number_last_restart(0),
     mpi_comm(mpi_comm_),
     timer_tree(new TimerTree()),
     is_test(is_test_)
@@ -118,7 +119,11 @@ TimeIntBase::advance_one_timestep_post_solve()
   dealii::Timer timer;
   timer.restart();
 
-  if(started() and not finished())
+  bool const             active                   = started() and not finished();
+  types::time_step const current_time_step_number = time_step_number;
+  double const           current_time_step_size   = get_time_step_size();
+
+  if(active)
   {
     do_timestep_post_solve();
 
@@ -131,6 +136,15 @@ TimeIntBase::advance_one_timestep_post_solve()
   }
 
   timer_tree->insert({"Timeloop"}, timer.wall_time());
+
+  if(active and solver_statistics.get())
+  {
+    solver_statistics->write_time_step(current_time_step_number,
+                                       time,
+                                       current_time_step_size,
+                                       get_accumulated_iterations(),
+                                       *timer_tree);
+  }
 }
 
 void
@@ -181,6 +195,18 @@ TimeIntBase::get_timings() const
   return timer_tree;
 }
 
+void
+TimeIntBase::set_solver_statistics(std::shared_ptr<SolverStatistics> solver_statistics_in)
+{
+  solver_statistics = solver_statistics_in;
+}
+
+std::vector<std::pair<std::string, unsigned long long>>
+TimeIntBase::get_accumulated_iterations() const
+{
+  return {};
+}
+
 void
 TimeIntBase::do_timestep()
 {
@@ -204,19 +230,33 @@ TimeIntBase::write_restart() const
 
   if(restart_data.do_restart(wall_time, time - start_time, time_step_number, time_step_number == 2))
   {
-    pcout << std::endl
-          << print_horizontal_line() << std::endl
-          << std::endl
-          << " Writing restart file at time t = " << this->get_time() << ":" << std::endl;
+    force_write_restart();
+  }
+}
 
-    std::string const filename = restart_filename(restart_data.filename, mpi_comm);
+void
+TimeIntBase::force_write_restart() const
+{
+  pcout << std::endl
+        << print_horizontal_line() << std::endl
+        << std::endl
+        << " Writing restart file at time t = " << this->get_time() << ":" << std::endl;
 
-    rename_restart_files(filename);
+  std::string const filename = restart_filename(restart_data.filename, mpi_comm);
 
-    do_write_restart(restart_filename(restart_data.filename, mpi_comm));
+  rename_restart_files(filename);
 
-    pcout << std::endl << " ... done!" << std::endl << print_horizontal_line() << std::endl;
-  }
+  do_write_restart(restart_filename(restart_data.filename, mpi_comm));
+
+  time_step_number_last_restart = time_step_number;
+
+  pcout << std::endl << " ... done!" << std::endl << print_horizontal_line() << std::endl;
+}
+
+bool
+TimeIntBase::restart_written_in_last_time_step() const
+{
+  return time_step_number_last_restart == time_step_number;
 }
 
 void
@@ -228,7 +268,7 @@ TimeIntBase::read_restart()
         << " Reading restart file:" << std::endl;
 
   std::string   filename = restart_filename(restart_data.filename, mpi_comm);
-  std::ifstream in(filename);
+  std::ifstream in(filename, std::ios::binary);
   AssertThrow(in, dealii::ExcMessage("File " + filename + " does not exist."));
 
   do_read_restart(in);
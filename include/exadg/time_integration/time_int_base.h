@@ -37,6 +37,7 @@
 #include <exadg/time_integration/restart.h>
 #include <exadg/time_integration/restart_data.h>
 #include <exadg/utilities/numbers.h>
+#include <exadg/utilities/solver_statistics.h>
 #include <exadg/utilities/timer_tree.h>
 
 
@@ -148,6 +149,25 @@ public:
   std::shared_ptr<TimerTree>
   get_timings() const;
 
+  /*
+   * Solver statistics of every time step are written to the given log (if not a nullptr).
+   */
+  void
+  set_solver_statistics(std::shared_ptr<SolverStatistics> solver_statistics);
+
+  /*
+   * Returns true if restart files have been written at the end of the last time step.
+   */
+  bool
+  restart_written_in_last_time_step() const;
+
+  /*
+   * Writes restart files irrespective of the criteria specified in RestartData. This is used by
+   * coupled solvers to write the restart files of all sub-problems at the same instant of time.
+   */
+  void
+  force_write_restart() const;
+
 protected:
   /*
    * Do one time step including pre and post routines done before and after the actual solution of
@@ -184,6 +204,14 @@ protected:
   virtual void
   postprocessing() const = 0;
 
+  /*
+   * Returns the accumulated number of iterations of the solvers involved in the time integration
+   * scheme as pairs of name and number of iterations. This information is written to the solver
+   * statistics. The default implementation returns an empty vector (e.g., explicit schemes).
+   */
+  virtual std::vector<std::pair<std::string, unsigned long long>>
+  get_accumulated_iterations() const;
+
   /*
    * Get the current time step number.
    */
@@ -251,6 +279,11 @@ protected:
    */
   RestartData const restart_data;
 
+  /*
+   * Time step number at which restart files have been written last.
+   */
+  mutable types::time_step time_step_number_last_restart;
+
   /*
    * MPI communicator.
    */
@@ -263,6 +296,11 @@ protected:
   std::shared_ptr<TimerTree> timer_tree;
   bool                       is_test;
 
+  /*
+   * Machine-readable log of solver statistics (optional).
+   */
+  std::shared_ptr<SolverStatistics> solver_statistics;
+
 private:
   /*
    * Write restart data.
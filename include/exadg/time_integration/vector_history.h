@@ -0,0 +1,234 @@
+/*  ______________________________________________________________________
+ *
+ *  ExaDG - High-Order Discontinuous Galerkin for the Exa-Scale
+ *
+ *  Copyright (C) 2021 by the ExaDG authors
+ *
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation, either version 3 of the License, or
+ *  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ *  ______________________________________________________________________
+ */
+
+#ifndef INCLUDE_EXADG_TIME_INTEGRATION_VECTOR_HISTORY_H_
+#define INCLUDE_EXADG_TIME_INTEGRATION_VECTOR_HISTORY_H_
+
+// C/C++
+#include <type_traits>
+#include <vector>
+
+// deal.II
+#include <deal.II/base/parallel.h>
+#include <deal.II/lac/la_parallel_vector.h>
+
+// ExaDG
+#include <exadg/time_integration/extrapolation_constants.h>
+#include <exadg/time_integration/push_back_vectors.h>
+
+namespace ExaDG
+{
+/*
+ * This class stores the history of a quantity at previous instants of time t_{n-i}, i = 0, ...,
+ * size()-1, as needed by multistep schemes, e.g., the explicitly treated convective term of BDF
+ * schemes. The vectors can optionally be stored in single precision, which halves the memory
+ * consumption and the memory transfer for Number = double. The vectors are converted to Number
+ * on the fly when they are read. Since single precision introduces a relative error of order
+ * 1e-7, this option is only meaningful for quantities that enter the right-hand side via
+ * extrapolation and not for the solution vectors entering the BDF time derivative.
+ */
+template<typename Number>
+class VectorHistory
+{
+public:
+  typedef dealii::LinearAlgebra::distributed::Vector<Number> VectorType;
+  typedef dealii::LinearAlgebra::distributed::Vector<float>  VectorTypeReduced;
+
+  VectorHistory(unsigned int const size, bool const reduced_precision)
+    : reduced_precision(reduced_precision and not std::is_same<Number, float>::value)
+  {
+    if(this->reduced_precision)
+      vectors_reduced.resize(size);
+    else
+      vectors.resize(size);
+  }
+
+  unsigned int
+  size() const
+  {
+    return reduced_precision ? vectors_reduced.size() : vectors.size();
+  }
+
+  bool
+  stores_reduced_precision() const
+  {
+    return reduced_precision;
+  }
+
+  /*
+   * Allocates all vectors with the parallel layout of the given vector.
+   */
+  void
+  reinit(VectorType const & model)
+  {
+    if(reduced_precision)
+    {
+      for(auto & vector : vectors_reduced)
+        vector.reinit(model.get_partitioner());
+    }
+    else
+    {
+      for(auto & vector : vectors)
+        vector.reinit(model);
+    }
+  }
+
+  /*
+   * Direct access to the vectors. Only available if the vectors are stored in full precision.
+   */
+  VectorType &
+  operator[](unsigned int const i)
+  {
+    AssertThrow(not reduced_precision,
+                dealii::ExcMessage("Direct access is not possible for vectors stored in reduced "
+                                   "precision. Use get() and set() instead."));
+
+    return vectors[i];
+  }
+
+  VectorType const &
+  operator[](unsigned int const i) const
+  {
+    AssertThrow(not reduced_precision,
+                dealii::ExcMessage("Direct access is not possible for vectors stored in reduced "
+                                   "precision. Use get() and set() instead."));
+
+    return vectors[i];
+  }
+
+  /*
+   * Copies the vector at time t_{n-i} to dst (dst is reinitialized if needed).
+   */
+  void
+  get(unsigned int const i, VectorType & dst) const
+  {
+    if(reduced_precision)
+      dst = vectors_reduced[i];
+    else
+      dst = vectors[i];
+  }
+
+  /*
+   * Sets the vector at time t_{n-i}.
+   */
+  void
+  set(unsigned int const i, VectorType const & src)
+  {
+    if(reduced_precision)
+      vectors_reduced[i].copy_locally_owned_data_from(src);
+    else
+      vectors[i].copy_locally_owned_data_from(src);
+  }
+
+  /*
+   * Shifts the history by one instant of time and sets the vector at time t_{n} to vector_np.
+   * In case of full precision, vector_np is swapped into the history and contains the oldest
+   * vector afterwards.
+   */
+  void
+  push_back(VectorType & vector_np)
+  {
+    if(reduced_precision)
+    {
+      ExaDG::push_back(vectors_reduced);
+      vectors_reduced[0].copy_locally_owned_data_from(vector_np);
+    }
+    else
+    {
+      ExaDG::push_back(vectors);
+      vectors[0].swap(vector_np);
+    }
+  }
+
+  /*
+   * Adds the extrapolation of the history to dst, i.e.,
+   *
+   *   dst += factor * sum_{i} beta_i * vector_i ,
+   *
+   * in a single sweep over the vectors.
+   */
+  void
+  add_extrapolation(VectorType &                   dst,
+                    double const                   factor,
+                    ExtrapolationConstants const & extra) const
+  {
+    if(reduced_precision)
+      add_extrapolation(dst, factor, extra, vectors_reduced);
+    else
+      add_extrapolation(dst, factor, extra, vectors);
+  }
+
+private:
+  template<typename VectorTypeHistory>
+  void
+  add_extrapolation(VectorType &                           dst,
+                    double const                           factor,
+                    ExtrapolationConstants const &         extra,
+                    std::vector<VectorTypeHistory> const & src) const
+  {
+    typedef typename VectorTypeHistory::value_type Number2;
+
+    std::vector<Number>          coefficients;
+    std::vector<Number2 const *> src_ptr;
+    for(unsigned int i = 0; i < src.size(); ++i)
+    {
+      // skip vectors that do not contribute, e.g. during the start-up with low order
+      if(extra.get_beta(i) != 0.0)
+      {
+        coefficients.push_back(factor * extra.get_beta(i));
+        src_ptr.push_back(src[i].begin());
+      }
+    }
+
+    unsigned int const      n_vectors   = src_ptr.size();
+    Number const *          coefficient = coefficients.data();
+    Number2 const * const * src_data    = src_ptr.data();
+    Number *                dst_data    = dst.begin();
+
+    // the loop over the entries is split into chunks processed by the threads of the task
+    // scheduler, the loop within a chunk is vectorized
+    auto const add_extrapolation_to_range = [&](unsigned int const begin, unsigned int const end) {
+      DEAL_II_OPENMP_SIMD_PRAGMA
+      for(unsigned int j = begin; j < end; ++j)
+      {
+        Number sum = 0.0;
+        for(unsigned int i = 0; i < n_vectors; ++i)
+          sum += coefficient[i] * static_cast<Number>(src_data[i][j]);
+        dst_data[j] += sum;
+      }
+    };
+
+    unsigned int const n_entries = dst.locally_owned_size();
+    unsigned int const grain_size =
+      dealii::internal::VectorImplementation::minimum_parallel_grain_size;
+
+    dealii::parallel::apply_to_subranges(0U, n_entries, add_extrapolation_to_range, grain_size);
+  }
+
+  bool const reduced_precision;
+
+  std::vector<VectorType>        vectors;
+  std::vector<VectorTypeReduced> vectors_reduced;
+};
+
+} // namespace ExaDG
+
+#endif /* INCLUDE_EXADG_TIME_INTEGRATION_VECTOR_HISTORY_H_ */
@@ -58,6 +58,17 @@ struct GeneralParameters
                         "Set to true if the program is run as a test.",
                         dealii::Patterns::Bool(),
                         false);
+      prm.add_parameter("InTransitProcesses",
+                        n_in_transit_processes,
+                        "Number of MPI processes reserved for in-transit postprocessing "
+                        "(0 = postprocessing on the solver processes).",
+                        dealii::Patterns::Integer(0),
+                        false);
+      prm.add_parameter("InTransitSnapshotInterval",
+                        in_transit_snapshot_interval,
+                        "Number of time steps between snapshots sent to in-transit postprocessing.",
+                        dealii::Patterns::Integer(1),
+                        false);
     }
     prm.leave_subsection();
   }
@@ -67,6 +78,10 @@ struct GeneralParameters
   unsigned int dim = 2;
 
   bool is_test = false;
+
+  unsigned int n_in_transit_processes = 0;
+
+  unsigned int in_transit_snapshot_interval = 1;
 };
 
 } // namespace ExaDG
@@ -0,0 +1,157 @@
+/*  ______________________________________________________________________
+ *
+ *  ExaDG - High-Order Discontinuous Galerkin for the Exa-Scale
+ *
+ *  Copyright (C) 2021 by the ExaDG authors
+ *
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation, either version 3 of the License, or
+ *  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ *  ______________________________________________________________________
+ */
+
+#ifndef INCLUDE_EXADG_UTILITIES_IN_TRANSIT_COMMUNICATOR_H_
+#define INCLUDE_EXADG_UTILITIES_IN_TRANSIT_COMMUNICATOR_H_
+
+// deal.II
+#include <deal.II/base/exceptions.h>
+#include <deal.II/base/mpi.h>
+
+namespace ExaDG
+{
+/*
+ * Splits a global MPI communicator into a group of solver processes and a group of dedicated
+ * postprocessing processes (in-transit postprocessing). The last n_postprocessing_processes ranks
+ * of the global communicator form the postprocessing group. The local communicator returned by
+ * get_local_communicator() contains only the processes of the own group and is the communicator
+ * that the solver (or the postprocessing service) works on. Data is exchanged between the two
+ * groups via the global communicator.
+ *
+ * If n_postprocessing_processes == 0, in-transit postprocessing is inactive and the local
+ * communicator is a duplicate of the global communicator.
+ */
+class InTransitCommunicator
+{
+public:
+  InTransitCommunicator(MPI_Comm const &   global_comm_in,
+                        unsigned int const n_postprocessing_processes_in,
+                        unsigned int const snapshot_interval_in)
+    : global_comm(global_comm_in),
+      n_postprocessing_processes(n_postprocessing_processes_in),
+      snapshot_interval(snapshot_interval_in)
+  {
+    unsigned int const n_processes = dealii::Utilities::MPI::n_mpi_processes(global_comm);
+    unsigned int const rank        = dealii::Utilities::MPI::this_mpi_process(global_comm);
+
+    AssertThrow(n_postprocessing_processes < n_processes,
+                dealii::ExcMessage("The number of in-transit postprocessing processes has to be "
+                                   "smaller than the total number of MPI processes."));
+
+    AssertThrow(snapshot_interval > 0,
+                dealii::ExcMessage("The snapshot interval has to be larger than zero."));
+
+    n_solver_processes = n_processes - n_postprocessing_processes;
+
+    is_postprocessing = (rank >= n_solver_processes);
+
+    int const color = is_postprocessing ? 1 : 0;
+    MPI_Comm_split(global_comm, color, rank, &local_comm);
+  }
+
+  ~InTransitCommunicator()
+  {
+    MPI_Comm_free(&local_comm);
+  }
+
+  InTransitCommunicator(InTransitCommunicator const &) = delete;
+
+  InTransitCommunicator &
+  operator=(InTransitCommunicator const &) = delete;
+
+  /*
+   * Returns true if dedicated postprocessing processes have been requested.
+   */
+  bool
+  is_active() const
+  {
+    return n_postprocessing_processes > 0;
+  }
+
+  bool
+  is_postprocessing_process() const
+  {
+    return is_postprocessing;
+  }
+
+  MPI_Comm const &
+  get_global_communicator() const
+  {
+    return global_comm;
+  }
+
+  MPI_Comm const &
+  get_local_communicator() const
+  {
+    return local_comm;
+  }
+
+  unsigned int
+  get_n_solver_processes() const
+  {
+    return n_solver_processes;
+  }
+
+  unsigned int
+  get_n_postprocessing_processes() const
+  {
+    return n_postprocessing_processes;
+  }
+
+  /*
+   * Rank (in the global communicator) of the first process of the solver group and of the
+   * postprocessing group, respectively.
+   */
+  unsigned int
+  get_solver_root() const
+  {
+    return 0;
+  }
+
+  unsigned int
+  get_postprocessing_root() const
+  {
+    return n_solver_processes;
+  }
+
+  unsigned int
+  get_snapshot_interval() const
+  {
+    return snapshot_interval;
+  }
+
+private:
+  MPI_Comm const global_comm;
+
+  MPI_Comm local_comm;
+
+  unsigned int const n_postprocessing_processes;
+
+  unsigned int n_solver_processes;
+
+  unsigned int const snapshot_interval;
+
+  bool is_postprocessing;
+};
+
+} // namespace ExaDG
+
+#endif /* INCLUDE_EXADG_UTILITIES_IN_TRANSIT_COMMUNICATOR_H_ */
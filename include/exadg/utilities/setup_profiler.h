@@ -0,0 +1,160 @@
+/*  ______________________________________________________________________
+ *
+ *  ExaDG - High-Order Discontinuous Galerkin for the Exa-Scale
+ *
+ *  Copyright (C) 2021 by the ExaDG authors
+ *
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation, either version 3 of the License, or
+ *  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ *  ______________________________________________________________________
+ */
+
+#ifndef INCLUDE_EXADG_UTILITIES_SETUP_PROFILER_H_
+#define INCLUDE_EXADG_UTILITIES_SETUP_PROFILER_H_
+
+// C/C++
+#include <algorithm>
+#include <iomanip>
+#include <memory>
+#include <string>
+#include <utility>
+#include <vector>
+
+// deal.II
+#include <deal.II/base/conditional_ostream.h>
+#include <deal.II/base/mpi.h>
+#include <deal.II/base/timer.h>
+#include <deal.II/base/utilities.h>
+
+// ExaDG
+#include <exadg/utilities/timer_tree.h>
+
+namespace ExaDG
+{
+/**
+ * This class records the wall times and memory high-water marks of the phases of a setup, e.g.
+ * the setup of a PDE operator or a multigrid preconditioner. The wall times are collected in a
+ * TimerTree, the root of which is given by the name passed to the constructor. At the end of each
+ * phase, the memory high-water mark (VmHWM) of the calling process is recorded. The memory
+ * high-water mark can only increase, i.e. the increase from one phase to the next reveals the
+ * phases responsible for the peak memory consumption.
+ *
+ * Phases can be nested, and the profiler of a sub-component can be inserted into a phase of this
+ * profiler.
+ */
+class SetupProfiler
+{
+public:
+  SetupProfiler(std::string const & name) : name(name), timer_tree(std::make_shared<TimerTree>())
+  {
+  }
+
+  /**
+   * Executes function and records its wall time and the memory high-water mark afterwards under
+   * the specified phase.
+   */
+  template<typename Function>
+  void
+  measure(std::vector<std::string> const & phase, Function const & function)
+  {
+    dealii::Timer timer;
+
+    function();
+
+    std::vector<std::string> ids = {name};
+    ids.insert(ids.end(), phase.begin(), phase.end());
+
+    timer_tree->insert(ids, timer.wall_time());
+
+    dealii::Utilities::System::MemoryStats memory_stats;
+    dealii::Utilities::System::get_memory_stats(memory_stats);
+
+    memory_high_water_marks.emplace_back(get_path(ids), memory_stats.VmHWM);
+  }
+
+  /**
+   * Inserts the timings and memory high-water marks of another profiler into a phase of this
+   * profiler. The phase has to be measured before.
+   */
+  void
+  insert(std::vector<std::string> const & phase, SetupProfiler const & other)
+  {
+    std::vector<std::string> ids = {name};
+    ids.insert(ids.end(), phase.begin(), phase.end());
+
+    timer_tree->insert(ids, other.timer_tree);
+
+    for(auto const & [path, memory] : other.memory_high_water_marks)
+      memory_high_water_marks.emplace_back(get_path(ids) + "/" + path, memory);
+  }
+
+  std::shared_ptr<TimerTree>
+  get_timings() const
+  {
+    return timer_tree;
+  }
+
+  /**
+   * Prints the wall times of all phases as well as the minimum and maximum memory high-water marks
+   * over all processes after each phase. This function has to be called by all processes.
+   */
+  void
+  print(dealii::ConditionalOStream const & pcout, MPI_Comm const & mpi_comm) const
+  {
+    pcout << std::endl << "Wall times of setup phases:" << std::endl;
+    timer_tree->print_level(pcout, timer_tree->get_max_level());
+
+    std::vector<double> memory(memory_high_water_marks.size());
+    for(unsigned int i = 0; i < memory.size(); ++i)
+      memory[i] = memory_high_water_marks[i].second / 1024.0;
+
+    std::vector<dealii::Utilities::MPI::MinMaxAvg> const memory_data =
+      dealii::Utilities::MPI::min_max_avg(memory, mpi_comm);
+
+    unsigned int length = 0;
+    for(auto const & record : memory_high_water_marks)
+      length = std::max<unsigned int>(length, record.first.size());
+
+    pcout << std::endl
+          << "Memory high-water marks after setup phases (min / max over processes):" << std::endl
+          << std::endl;
+    for(unsigned int i = 0; i < memory_data.size(); ++i)
+    {
+      pcout << "  " << std::setw(length) << std::left << memory_high_water_marks[i].first
+            << std::setw(10) << std::right << std::fixed << std::setprecision(1)
+            << memory_data[i].min << " MB / " << std::setw(10) << memory_data[i].max << " MB"
+            << std::endl;
+    }
+  }
+
+private:
+  static std::string
+  get_path(std::vector<std::string> const & ids)
+  {
+    std::string path;
+    for(auto const & id : ids)
+      path += (path.empty() ? "" : "/") + id;
+    return path;
+  }
+
+  std::string name;
+
+  std::shared_ptr<TimerTree> timer_tree;
+
+  // pairs of phase (path of IDs separated by "/") and memory high-water mark in kB
+  std::vector<std::pair<std::string, unsigned long int>> memory_high_water_marks;
+};
+
+} // namespace ExaDG
+
+#endif /* INCLUDE_EXADG_UTILITIES_SETUP_PROFILER_H_ */
@@ -0,0 +1,258 @@
+/*  ______________________________________________________________________
+ *
+ *  ExaDG - High-Order Discontinuous Galerkin for the Exa-Scale
+ *
+ *  Copyright (C) 2021 by the ExaDG authors
+ *
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation, either version 3 of the License, or
+ *  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ *  ______________________________________________________________________
+ */
+
+// C/C++
+#include <cmath>
+#include <ctime>
+#include <iomanip>
+
+// deal.II
+#include <deal.II/base/exceptions.h>
+
+// ExaDG
+#include <exadg/utilities/solver_statistics.h>
+
+namespace ExaDG
+{
+namespace
+{
+std::string
+to_json(std::string const & in)
+{
+  std::ostringstream out;
+
+  out << "\"";
+  for(char const c : in)
+  {
+    if(c == '"' or c == '\\')
+      out << '\\' << c;
+    else if(c == '\n')
+      out << "\\n";
+    else if(c == '\t')
+      out << "\\t";
+    else if(static_cast<unsigned char>(c) < 0x20)
+      out << "\\u" << std::hex << std::setw(4) << std::setfill('0') << int(c) << std::dec;
+    else
+      out << c;
+  }
+  out << "\"";
+
+  return out.str();
+}
+
+std::string
+to_json(double const value)
+{
+  // JSON does not support inf and nan
+  if(not std::isfinite(value))
+    return "null";
+
+  std::ostringstream out;
+  out << std::setprecision(10) << value;
+
+  return out.str();
+}
+
+std::string
+trim(std::string const & in)
+{
+  std::string::size_type const first = in.find_first_not_of(" \t");
+
+  if(first == std::string::npos)
+    return "";
+
+  std::string::size_type const last = in.find_last_not_of(" \t");
+
+  return in.substr(first, last - first + 1);
+}
+
+/*
+ * Converts the parameters printed via print_parameter() into key-value pairs. Lines without a
+ * value are headers of sections (no indentation) or sub-sections (indentation), which are used
+ * as prefix of the keys.
+ */
+std::vector<std::pair<std::string, std::string>>
+parse_parameters(std::string const & parameters)
+{
+  std::vector<std::pair<std::string, std::string>> key_value_pairs;
+  std::map<std::string, unsigned int>              count;
+
+  std::istringstream stream(parameters);
+  std::string        line, section, sub_section;
+  while(std::getline(stream, line))
+  {
+    std::string::size_type const colon = line.find(':');
+    if(trim(line).empty() or colon == std::string::npos)
+      continue;
+
+    std::string const name  = trim(line.substr(0, colon));
+    std::string const value = trim(line.substr(colon + 1));
+
+    if(value.empty())
+    {
+      if(line[0] != ' ')
+      {
+        section = name;
+        sub_section.clear();
+      }
+      else
+      {
+        sub_section = name;
+      }
+    }
+    else
+    {
+      std::string key = name;
+      if(not sub_section.empty())
+        key = sub_section + "/" + key;
+      if(not section.empty())
+        key = section + "/" + key;
+
+      // make keys unique
+      if(++count[key] > 1)
+        key += " (" + std::to_string(count[key]) + ")";
+
+      key_value_pairs.emplace_back(key, value);
+    }
+  }
+
+  return key_value_pairs;
+}
+
+} // namespace
+
+SolverStatistics::SolverStatistics(std::string const & filename, MPI_Comm const & mpi_comm_in)
+  : mpi_comm(mpi_comm_in)
+{
+  if(dealii::Utilities::MPI::this_mpi_process(mpi_comm) == 0)
+  {
+    file = std::make_shared<std::ofstream>(filename, std::ios_base::app);
+
+    AssertThrow(file->good(),
+                dealii::ExcMessage("Could not open file " + filename + " for solver statistics."));
+  }
+}
+
+void
+SolverStatistics::write_time_step(
+  types::time_step const                                           time_step_number,
+  double const                                                     time,
+  double const                                                     time_step_size,
+  std::vector<std::pair<std::string, unsigned long long>> const & iterations,
+  TimerTree const &                                                timer_tree)
+{
+  std::ostringstream record;
+
+  record << "{\"record\": \"time_step\""
+         << ", \"time_step_number\": " << time_step_number << ", \"time\": " << to_json(time)
+         << ", \"time_step_size\": " << to_json(time_step_size);
+
+  record << ", \"iterations\": {";
+  for(unsigned int i = 0; i < iterations.size(); ++i)
+  {
+    unsigned long long & last = iterations_last[iterations[i].first];
+
+    record << (i > 0 ? ", " : "") << to_json(iterations[i].first) << ": "
+           << iterations[i].second - last;
+
+    last = iterations[i].second;
+  }
+  record << "}";
+
+  std::vector<std::pair<std::string, double>> const wall_times = timer_tree.get_wall_times(false);
+
+  record << ", \"wall_times\": {";
+  for(unsigned int i = 0; i < wall_times.size(); ++i)
+  {
+    double & last = wall_times_last[wall_times[i].first];
+
+    record << (i > 0 ? ", " : "") << to_json(wall_times[i].first) << ": "
+           << to_json(wall_times[i].second - last);
+
+    last = wall_times[i].second;
+  }
+  record << "}}";
+
+  write_record(record.str());
+}
+
+void
+SolverStatistics::write_summary(types::time_step const n_time_steps, TimerTree const & timer_tree)
+{
+  // collective operation
+  std::vector<std::pair<std::string, double>> const wall_times = timer_tree.get_wall_times(true);
+
+  std::ostringstream record;
+
+  record << "{\"record\": \"summary\""
+         << ", \"n_time_steps\": " << n_time_steps;
+
+  record << ", \"wall_times\": {";
+  for(unsigned int i = 0; i < wall_times.size(); ++i)
+  {
+    record << (i > 0 ? ", " : "") << to_json(wall_times[i].first) << ": "
+           << to_json(wall_times[i].second);
+  }
+  record << "}}";
+
+  write_record(record.str());
+}
+
+void
+SolverStatistics::do_write_run(std::string const &                   parameters,
+                               dealii::types::global_dof_index const n_dofs)
+{
+  std::time_t const now = std::time(nullptr);
+  char              date[32];
+  std::strftime(date, sizeof(date), "%Y-%m-%dT%H:%M:%S", std::localtime(&now));
+
+  std::ostringstream record;
+
+  record << "{\"record\": \"run\""
+         << ", \"date\": " << to_json(std::string(date))
+         << ", \"n_mpi_processes\": " << dealii::Utilities::MPI::n_mpi_processes(mpi_comm)
+         << ", \"n_dofs\": " << n_dofs;
+
+  std::vector<std::pair<std::string, std::string>> const key_value_pairs =
+    parse_parameters(parameters);
+
+  record << ", \"parameters\": {";
+  for(unsigned int i = 0; i < key_value_pairs.size(); ++i)
+  {
+    record << (i > 0 ? ", " : "") << to_json(key_value_pairs[i].first) << ": "
+           << to_json(key_value_pairs[i].second);
+  }
+  record << "}}";
+
+  write_record(record.str());
+}
+
+void
+SolverStatistics::write_record(std::string const & record) const
+{
+  if(file.get())
+  {
+    // flush after every record such that the statistics are available in case of an abort
+    *file << record << std::endl;
+  }
+}
+
+} // namespace ExaDG
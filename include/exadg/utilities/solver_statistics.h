@@ -0,0 +1,120 @@
+/*  ______________________________________________________________________
+ *
+ *  ExaDG - High-Order Discontinuous Galerkin for the Exa-Scale
+ *
+ *  Copyright (C) 2021 by the ExaDG authors
+ *
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation, either version 3 of the License, or
+ *  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ *  ______________________________________________________________________
+ */
+
+#ifndef INCLUDE_EXADG_UTILITIES_SOLVER_STATISTICS_H_
+#define INCLUDE_EXADG_UTILITIES_SOLVER_STATISTICS_H_
+
+// C/C++
+#include <fstream>
+#include <map>
+#include <memory>
+#include <sstream>
+#include <string>
+#include <utility>
+#include <vector>
+
+// deal.II
+#include <deal.II/base/conditional_ostream.h>
+#include <deal.II/base/mpi.h>
+#include <deal.II/base/types.h>
+
+// ExaDG
+#include <exadg/utilities/numbers.h>
+#include <exadg/utilities/timer_tree.h>
+
+namespace ExaDG
+{
+/*
+ * Machine-readable log of solver statistics in the JSON lines format (one JSON object per line)
+ * intended for the automated evaluation of parameter studies. Every run appends the following
+ * records to the file:
+ *
+ *  - one record of type "run" containing the number of MPI processes, the number of degrees of
+ *    freedom, and the full set of parameters as printed to screen,
+ *
+ *  - one record of type "time_step" per time step containing the time, the time step size, the
+ *    number of iterations of all solvers, and the wall times of all items of the timer tree of
+ *    the time integrator spent in this time step (wall times of MPI rank 0),
+ *
+ *  - one record of type "summary" containing the MPI-average wall times of the whole simulation.
+ *
+ * Only MPI rank 0 writes to the file. The script scripts/summarize_solver_statistics.py
+ * evaluates these files.
+ */
+class SolverStatistics
+{
+public:
+  SolverStatistics(std::string const & filename, MPI_Comm const & mpi_comm);
+
+  /*
+   * Writes the record of type "run". The parameters are obtained from the print() function of
+   * the Parameters class of the respective module.
+   */
+  template<typename Parameters>
+  void
+  write_run(Parameters const & param, dealii::types::global_dof_index const n_dofs)
+  {
+    std::ostringstream         stream;
+    dealii::ConditionalOStream pcout(stream,
+                                     dealii::Utilities::MPI::this_mpi_process(mpi_comm) == 0);
+    param.print(pcout, "Parameters:");
+
+    do_write_run(stream.str(), n_dofs);
+  }
+
+  /*
+   * Writes the record of type "time_step". The iterations and wall times are accumulated
+   * quantities (e.g., since the start of the time loop), from which the quantities of the
+   * current time step are computed as the difference to the previous call of this function.
+   */
+  void
+  write_time_step(types::time_step const                                           time_step_number,
+                  double const                                                     time,
+                  double const                                                     time_step_size,
+                  std::vector<std::pair<std::string, unsigned long long>> const & iterations,
+                  TimerTree const &                                                timer_tree);
+
+  /*
+   * Writes the record of type "summary". This function has to be called by all MPI processes.
+   */
+  void
+  write_summary(types::time_step const n_time_steps, TimerTree const & timer_tree);
+
+private:
+  void
+  do_write_run(std::string const & parameters, dealii::types::global_dof_index const n_dofs);
+
+  void
+  write_record(std::string const & record) const;
+
+  MPI_Comm const mpi_comm;
+
+  // only opened on MPI rank 0
+  std::shared_ptr<std::ofstream> file;
+
+  // accumulated quantities at the time of the previous record of type "time_step"
+  std::map<std::string, unsigned long long> iterations_last;
+  std::map<std::string, double>             wall_times_last;
+};
+
+} // namespace ExaDG
+
+#endif /* INCLUDE_EXADG_UTILITIES_SOLVER_STATISTICS_H_ */
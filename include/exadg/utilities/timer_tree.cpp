@@ -208,6 +208,16 @@ TimerTree::get_max_level() const
   return max_level;
 }
 
+std::vector<std::pair<std::string, double>>
+TimerTree::get_wall_times(bool const mpi_average) const
+{
+  std::vector<std::pair<std::string, double>> wall_times;
+
+  do_get_wall_times(wall_times, "", mpi_average);
+
+  return wall_times;
+}
+
 void
 TimerTree::copy_from(std::shared_ptr<TimerTree> other)
 {
@@ -263,6 +273,25 @@ TimerTree::do_print_plain(dealii::ConditionalOStream const & pcout,
   }
 }
 
+void
+TimerTree::do_get_wall_times(std::vector<std::pair<std::string, double>> & wall_times,
+                             std::string const &                           prefix,
+                             bool const                                    mpi_average) const
+{
+  if(id.empty())
+    return;
+
+  std::string const path = prefix.empty() ? id : prefix + "/" + id;
+
+  if(data.get())
+    wall_times.emplace_back(path, mpi_average ? get_average_wall_time() : data->wall_time);
+
+  for(auto it = sub_trees.begin(); it != sub_trees.end(); ++it)
+  {
+    (*it)->do_get_wall_times(wall_times, path, mpi_average);
+  }
+}
+
 void
 TimerTree::do_print_level(dealii::ConditionalOStream const & pcout,
                           unsigned int const                 level,
@@ -25,6 +25,7 @@
 // C++
 #include <memory>
 #include <string>
+#include <utility>
 #include <vector>
 
 // deal.II
@@ -94,6 +95,16 @@ public:
   unsigned int
   get_max_level() const;
 
+  /**
+   * Returns the wall times of all items of the tree for which data is available. The items
+   * are identified by their path in the tree, i.e., the IDs from the root element to the item
+   * separated by "/". If mpi_average is true, the MPI-average wall times are returned, which
+   * requires that all processes call this function. Otherwise, the wall times of the calling
+   * process are returned.
+   */
+  std::vector<std::pair<std::string, double>>
+  get_wall_times(bool const mpi_average) const;
+
 private:
   /**
    * This function "copies" a tree, meaning that only the ID is copied, while
@@ -132,6 +143,15 @@ private:
                  unsigned int const                 offset,
                  unsigned int const                 length) const;
 
+  /**
+   * This function recursively collects the wall times of the whole tree, where prefix is the
+   * path of the parent element.
+   */
+  void
+  do_get_wall_times(std::vector<std::pair<std::string, double>> & wall_times,
+                    std::string const &                           prefix,
+                    bool const                                    mpi_average) const;
+
   /**
    * This function prints the whole tree up to a specified level.
    */
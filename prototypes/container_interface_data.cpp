@@ -0,0 +1,249 @@
+/*  ______________________________________________________________________
+ *
+ *  ExaDG - High-Order Discontinuous Galerkin for the Exa-Scale
+ *
+ *  Copyright (C) 2021 by the ExaDG authors
+ *
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation, either version 3 of the License, or
+ *  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ *  ______________________________________________________________________
+ */
+
+/*
+ * Microbenchmark comparing the access to boundary data stored in ContainerInterfaceData (flat,
+ * face-batch-major array with offset table) against the previous implementation based on a
+ * std::map with key {face, q, v} for every quadrature point and SIMD lane.
+ */
+
+// C/C++
+#include <cmath>
+#include <iostream>
+#include <map>
+#include <tuple>
+
+// deal.II
+#include <deal.II/base/mpi.h>
+#include <deal.II/base/quadrature_lib.h>
+#include <deal.II/base/timer.h>
+#include <deal.II/dofs/dof_handler.h>
+#include <deal.II/fe/fe_dgq.h>
+#include <deal.II/fe/fe_system.h>
+#include <deal.II/fe/mapping_q.h>
+#include <deal.II/grid/grid_generator.h>
+#include <deal.II/grid/tria.h>
+#include <deal.II/lac/affine_constraints.h>
+#include <deal.II/matrix_free/matrix_free.h>
+
+// ExaDG
+#include <exadg/functions_and_boundary_conditions/container_interface_data.h>
+#include <exadg/functions_and_boundary_conditions/evaluate_functions.h>
+
+template<int dim, typename Number>
+class MapBasedContainer
+{
+public:
+  typedef dealii::Tensor<1, dim, double> data_type;
+
+  using Id = std::tuple<unsigned int /*face*/, unsigned int /*q*/, unsigned int /*v*/>;
+
+  void
+  setup(dealii::MatrixFree<dim, Number> const & matrix_free, unsigned int const q_index)
+  {
+    quad_index = q_index;
+
+    for(unsigned int face = matrix_free.n_inner_face_batches();
+        face < matrix_free.n_inner_face_batches() + matrix_free.n_boundary_face_batches();
+        ++face)
+    {
+      ExaDG::FaceIntegrator<dim, dim, Number> integrator(matrix_free, true, 0, quad_index);
+      integrator.reinit(face);
+
+      for(unsigned int q = 0; q < integrator.n_q_points; ++q)
+      {
+        for(unsigned int v = 0; v < dealii::VectorizedArray<Number>::size(); ++v)
+        {
+          map_index[quad_index].emplace(std::make_tuple(face, q, v), solution[quad_index].size());
+          solution[quad_index].push_back(data_type());
+        }
+      }
+    }
+  }
+
+  std::vector<data_type> &
+  get_array_solution()
+  {
+    return solution[quad_index];
+  }
+
+  data_type
+  get_data(unsigned int const q_index,
+           unsigned int const face,
+           unsigned int const q,
+           unsigned int const v) const
+  {
+    Id const                              id    = std::make_tuple(face, q, v);
+    dealii::types::global_dof_index const index = map_index.find(q_index)->second.find(id)->second;
+
+    return solution.find(q_index)->second[index];
+  }
+
+private:
+  unsigned int quad_index;
+
+  std::map<unsigned int, std::map<Id, dealii::types::global_dof_index>> map_index;
+  std::map<unsigned int, std::vector<data_type>>                        solution;
+};
+
+template<int dim, typename Number, typename Container>
+double
+sweep_map_based(dealii::MatrixFree<dim, Number> const & matrix_free,
+                Container const &                       container,
+                unsigned int const                      quad_index)
+{
+  double sum = 0.0;
+
+  ExaDG::FaceIntegrator<dim, dim, Number> integrator(matrix_free, true, 0, quad_index);
+  for(unsigned int face = matrix_free.n_inner_face_batches();
+      face < matrix_free.n_inner_face_batches() + matrix_free.n_boundary_face_batches();
+      ++face)
+  {
+    integrator.reinit(face);
+    for(unsigned int q = 0; q < integrator.n_q_points; ++q)
+    {
+      dealii::Tensor<1, dim, dealii::VectorizedArray<Number>> value;
+      for(unsigned int v = 0; v < dealii::VectorizedArray<Number>::size(); ++v)
+      {
+        dealii::Tensor<1, dim, double> const data = container.get_data(quad_index, face, q, v);
+        for(unsigned int d = 0; d < dim; ++d)
+          value[d][v] = data[d];
+      }
+
+      for(unsigned int d = 0; d < dim; ++d)
+        sum += value[d].sum();
+    }
+  }
+
+  return sum;
+}
+
+template<int dim, typename Number>
+double
+sweep_flat(dealii::MatrixFree<dim, Number> const &               matrix_free,
+           ExaDG::ContainerInterfaceData<1, dim, double> const & container,
+           unsigned int const                                    quad_index)
+{
+  double sum = 0.0;
+
+  ExaDG::FaceIntegrator<dim, dim, Number> integrator(matrix_free, true, 0, quad_index);
+  for(unsigned int face = matrix_free.n_inner_face_batches();
+      face < matrix_free.n_inner_face_batches() + matrix_free.n_boundary_face_batches();
+      ++face)
+  {
+    integrator.reinit(face);
+    for(unsigned int q = 0; q < integrator.n_q_points; ++q)
+    {
+      dealii::Tensor<1, dim, dealii::VectorizedArray<Number>> const value =
+        ExaDG::FunctionEvaluator<1, dim, Number>::value(container, face, q, quad_index);
+
+      for(unsigned int d = 0; d < dim; ++d)
+        sum += value[d].sum();
+    }
+  }
+
+  return sum;
+}
+
+template<int dim, typename Number>
+void
+do_test(unsigned int const degree, unsigned int const n_refinements, unsigned int const n_sweeps)
+{
+  dealii::Triangulation<dim> tria;
+  dealii::GridGenerator::hyper_cube(tria, 0.0, 1.0);
+  tria.refine_global(n_refinements);
+
+  dealii::FESystem<dim>   fe(dealii::FE_DGQ<dim>(degree), dim);
+  dealii::DoFHandler<dim> dof_handler(tria);
+  dof_handler.distribute_dofs(fe);
+
+  dealii::MappingQ<dim>             mapping(1);
+  dealii::AffineConstraints<Number> constraints;
+  constraints.close();
+
+  typename dealii::MatrixFree<dim, Number>::AdditionalData additional_data;
+  additional_data.mapping_update_flags_boundary_faces =
+    dealii::update_quadrature_points | dealii::update_JxW_values;
+
+  dealii::MatrixFree<dim, Number> matrix_free;
+  matrix_free.reinit(
+    mapping, dof_handler, constraints, dealii::QGauss<1>(degree + 1), additional_data);
+
+  unsigned int const quad_index = 0;
+
+  // flat storage
+  ExaDG::ContainerInterfaceData<1, dim, double> container_flat;
+  container_flat.setup(matrix_free, 0, {quad_index}, {0});
+
+  // map-based storage
+  MapBasedContainer<dim, Number> container_map;
+  container_map.setup(matrix_free, quad_index);
+
+  // fill both containers with the same data
+  auto & array_flat = container_flat.get_array_solution(quad_index);
+  auto & array_map  = container_map.get_array_solution();
+  AssertThrow(array_flat.size() == array_map.size(), dealii::ExcMessage("Sizes do not match."));
+  for(unsigned int i = 0; i < array_flat.size(); ++i)
+  {
+    for(unsigned int d = 0; d < dim; ++d)
+      array_flat[i][d] = array_map[i][d] = 1.0e-3 * (i % 1000) + d;
+  }
+
+  double sum_map = 0.0, sum_flat = 0.0;
+
+  dealii::Timer timer;
+  for(unsigned int i = 0; i < n_sweeps; ++i)
+    sum_map += sweep_map_based(matrix_free, container_map, quad_index);
+  double const time_map = timer.wall_time();
+
+  timer.restart();
+  for(unsigned int i = 0; i < n_sweeps; ++i)
+    sum_flat += sweep_flat(matrix_free, container_flat, quad_index);
+  double const time_flat = timer.wall_time();
+
+  AssertThrow(std::abs(sum_map - sum_flat) <= 1.e-10 * std::abs(sum_map),
+              dealii::ExcMessage("Results of map-based and flat storage differ."));
+
+  unsigned int const n_points = array_flat.size();
+
+  std::cout << "dim = " << dim << ", degree = " << degree << ", boundary points = " << n_points
+            << std::endl
+            << "  std::map storage:  " << time_map / n_sweeps << " s per sweep, "
+            << time_map / (n_sweeps * n_points) * 1.e9 << " ns per point" << std::endl
+            << "  flat storage:      " << time_flat / n_sweeps << " s per sweep, "
+            << time_flat / (n_sweeps * n_points) * 1.e9 << " ns per point" << std::endl
+            << "  speedup:           " << time_map / time_flat << std::endl
+            << std::endl;
+}
+
+int
+main(int argc, char ** argv)
+{
+  dealii::Utilities::MPI::MPI_InitFinalize mpi(argc, argv, 1);
+
+  for(unsigned int degree = 1; degree <= 5; degree += 2)
+  {
+    do_test<2, double>(degree, 6, 100);
+    do_test<3, double>(degree, 3, 20);
+  }
+
+  return 0;
+}
@@ -0,0 +1,157 @@
+#!/usr/bin/env python3
+#  ______________________________________________________________________
+#
+#  ExaDG - High-Order Discontinuous Galerkin for the Exa-Scale
+#
+#  Copyright (C) 2021 by the ExaDG authors
+#
+#  This program is free software: you can redistribute it and/or modify
+#  it under the terms of the GNU General Public License as published by
+#  the Free Software Foundation, either version 3 of the License, or
+#  (at your option) any later version.
+#
+#  This program is distributed in the hope that it will be useful,
+#  but WITHOUT ANY WARRANTY; without even the implied warranty of
+#  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+#  GNU General Public License for more details.
+#
+#  You should have received a copy of the GNU General Public License
+#  along with this program.  If not, see <https://www.gnu.org/licenses/>.
+#  ______________________________________________________________________
+
+"""
+Summarize solver statistics files written by ExaDG (see parameter "Solver statistics file").
+
+Each file is interpreted as one case, containing one or several runs (e.g. with different solver
+or preconditioner settings). For every case, the runs are ranked by their total wall time of the
+time loop and the fastest run is reported together with the parameters in which it differs from
+the other runs of the same case.
+
+Usage: summarize_solver_statistics.py file_1.jsonl [file_2.jsonl ...]
+"""
+
+import argparse
+import json
+import sys
+
+
+def read_runs(filename):
+    """Split the records of a file into runs, a new run starting with each "run" record."""
+    runs = []
+    with open(filename) as f:
+        for line_number, line in enumerate(f, start=1):
+            line = line.strip()
+            if not line:
+                continue
+            try:
+                record = json.loads(line)
+            except json.JSONDecodeError:
+                print("{}:{}: skipping invalid record".format(filename, line_number),
+                      file=sys.stderr)
+                continue
+
+            if record.get("record") == "run":
+                runs.append({"run": record, "time_steps": [], "summary": None})
+            elif runs:
+                if record.get("record") == "time_step":
+                    runs[-1]["time_steps"].append(record)
+                elif record.get("record") == "summary":
+                    runs[-1]["summary"] = record
+    return runs
+
+
+def evaluate_run(run):
+    """Compute the key figures of a single run."""
+    time_steps = run["time_steps"]
+    n_time_steps = len(time_steps)
+
+    # total wall time of the time loop, accumulated over all time steps
+    wall_time = 0.0
+    for step in time_steps:
+        times = step.get("wall_times", {})
+        # only count top-level entries to avoid counting nested timers twice
+        top_level = [t for name, t in times.items() if "/" not in name and t is not None]
+        if top_level:
+            wall_time += sum(top_level)
+        else:
+            wall_time += sum(t for t in times.values() if t is not None)
+
+    if run["summary"] is not None:
+        n_time_steps = run["summary"].get("n_time_steps", n_time_steps)
+
+    iterations = {}
+    for step in time_steps:
+        for name, n in step.get("iterations", {}).items():
+            iterations[name] = iterations.get(name, 0) + n
+
+    mean_iterations = {
+        name: float(n) / len(time_steps) for name, n in iterations.items()
+    } if time_steps else {}
+
+    return {
+        "wall_time": wall_time,
+        "n_time_steps": n_time_steps,
+        "wall_time_per_step": wall_time / n_time_steps if n_time_steps > 0 else float("nan"),
+        "mean_iterations": mean_iterations,
+        "n_dofs": run["run"].get("n_dofs"),
+        "n_mpi_processes": run["run"].get("n_mpi_processes"),
+        "parameters": run["run"].get("parameters", {}),
+    }
+
+
+def differing_parameters(results):
+    """Return the parameter names whose values are not the same for all runs."""
+    names = set()
+    for result in results:
+        names.update(result["parameters"].keys())
+    return sorted(
+        name for name in names
+        if len(set(str(r["parameters"].get(name)) for r in results)) > 1)
+
+
+def summarize(filename):
+    runs = [run for run in read_runs(filename) if run["time_steps"]]
+
+    print("Case: {}".format(filename))
+    if not runs:
+        print("  no completed time steps found\n")
+        return
+
+    results = sorted((evaluate_run(run) for run in runs), key=lambda r: r["wall_time"])
+    fastest = results[0]
+
+    print("  Number of runs:          {}".format(len(results)))
+    print("  Fastest run:")
+    print("    Wall time time loop:   {:.4e} s".format(fastest["wall_time"]))
+    print("    Number of time steps:  {}".format(fastest["n_time_steps"]))
+    print("    Wall time per step:    {:.4e} s".format(fastest["wall_time_per_step"]))
+    print("    Number of DoFs:        {}".format(fastest["n_dofs"]))
+    print("    Number of MPI ranks:   {}".format(fastest["n_mpi_processes"]))
+    for name, n in sorted(fastest["mean_iterations"].items()):
+        print("    Iterations {:<20} {:.2f} (mean per step)".format(name + ":", n))
+
+    names = differing_parameters(results)
+    if names:
+        print("  Parameters of fastest run differing from other runs:")
+        for name in names:
+            print("    {}: {}".format(name, fastest["parameters"].get(name)))
+
+    if len(results) > 1:
+        print("  Ranking (wall time time loop):")
+        for rank, result in enumerate(results, start=1):
+            print("    {:>3}. {:.4e} s".format(rank, result["wall_time"]))
+    print("")
+
+
+def main():
+    parser = argparse.ArgumentParser(
+        description="Summarize ExaDG solver statistics and report the fastest run per case.")
+    parser.add_argument("files", nargs="+", help="solver statistics files (JSON lines)")
+    args = parser.parse_args()
+
+    for filename in args.files:
+        summarize(filename)
+
+
+if __name__ == "__main__":
+    main()
@@ -0,0 +1,336 @@
+/*  ______________________________________________________________________
+ *
+ *  ExaDG - High-Order Discontinuous Galerkin for the Exa-Scale
+ *
+ *  Copyright (C) 2021 by the ExaDG authors
+ *
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation, either version 3 of the License, or
+ *  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ *  ______________________________________________________________________
+ */
+
+// C++
+#include <cmath>
+#include <iostream>
+#include <sstream>
+
+// deal.II
+#include <deal.II/base/function.h>
+#include <deal.II/base/quadrature_lib.h>
+#include <deal.II/grid/grid_generator.h>
+#include <deal.II/numerics/vector_tools.h>
+
+// ExaDG
+#include <exadg/acoustic_conservation_equations/driver.h>
+#include <exadg/acoustic_conservation_equations/user_interface/application_base.h>
+
+// Vibrating membrane on a mesh graded in x-direction without hanging nodes: The cells are assigned
+// to three time step levels. The errors of local time stepping are compared to the errors of global
+// time stepping with the time step size of the smallest cells. For the small time step size used
+// here, the spatial error dominates and both errors have to agree.
+
+using namespace ExaDG;
+
+template<int dim>
+class AnalyticalSolutionPressure : public dealii::Function<dim>
+{
+public:
+  AnalyticalSolutionPressure() : dealii::Function<dim>(1, 0.0)
+  {
+  }
+
+  double
+  value(dealii::Point<dim> const & p, unsigned int const) const final
+  {
+    double const pi = dealii::numbers::PI;
+
+    return std::cos(std::sqrt(dim) * pi * this->get_time()) * std::sin(pi * p[0]) *
+           std::sin(pi * p[1]);
+  }
+};
+
+template<int dim>
+class AnalyticalSolutionVelocity : public dealii::Function<dim>
+{
+public:
+  AnalyticalSolutionVelocity() : dealii::Function<dim>(dim, 0.0)
+  {
+  }
+
+  double
+  value(dealii::Point<dim> const & p, unsigned int const component) const final
+  {
+    double const pi = dealii::numbers::PI;
+
+    double const result = -std::sin(std::sqrt(dim) * pi * this->get_time()) / std::sqrt(dim);
+
+    if(component == 0)
+      return result * std::cos(pi * p[0]) * std::sin(pi * p[1]);
+    else
+      return result * std::sin(pi * p[0]) * std::cos(pi * p[1]);
+  }
+};
+
+/*
+ * Stores the L2 errors of pressure and velocity of the last call to do_postprocessing().
+ */
+template<int dim, typename Number>
+class ErrorPostProcessor : public Acoustics::PostProcessorBase<dim, Number>
+{
+  using Base = Acoustics::PostProcessorBase<dim, Number>;
+
+  using VectorType = typename Base::VectorType;
+
+public:
+  void
+  setup(typename Base::AcousticsOperator const & pde_operator) final
+  {
+    mapping       = pde_operator.get_mapping();
+    dof_handler_p = &pde_operator.get_dof_handler_p();
+    dof_handler_u = &pde_operator.get_dof_handler_u();
+
+    n_time_step_levels = pde_operator.get_time_step_levels().n_levels;
+  }
+
+  void
+  do_postprocessing(VectorType const &     solution,
+                    double const           time,
+                    types::time_step const time_step_number) final
+  {
+    (void)time_step_number;
+
+    AnalyticalSolutionPressure<dim> pressure;
+    AnalyticalSolutionVelocity<dim> velocity;
+
+    error_p = calculate_error(*dof_handler_p, solution.block(0), pressure, time);
+    error_u = calculate_error(*dof_handler_u, solution.block(1), velocity, time);
+  }
+
+  unsigned int n_time_step_levels = 0;
+
+  double error_p = 0.0;
+  double error_u = 0.0;
+
+private:
+  double
+  calculate_error(dealii::DoFHandler<dim> const &                            dof_handler,
+                  dealii::LinearAlgebra::distributed::Vector<Number> const & solution,
+                  dealii::Function<dim> &                                    analytical_solution,
+                  double const                                               time) const
+  {
+    dealii::LinearAlgebra::distributed::Vector<double> solution_double;
+    solution_double = solution;
+    solution_double.update_ghost_values();
+
+    analytical_solution.set_time(time);
+
+    dealii::Vector<double> error_per_cell(dof_handler.get_triangulation().n_active_cells());
+    dealii::VectorTools::integrate_difference(*mapping,
+                                              dof_handler,
+                                              solution_double,
+                                              analytical_solution,
+                                              error_per_cell,
+                                              dealii::QGauss<dim>(dof_handler.get_fe().degree + 3),
+                                              dealii::VectorTools::L2_norm);
+
+    return dealii::VectorTools::compute_global_error(dof_handler.get_triangulation(),
+                                                     error_per_cell,
+                                                     dealii::VectorTools::L2_norm);
+  }
+
+  std::shared_ptr<dealii::Mapping<dim> const> mapping;
+
+  dealii::DoFHandler<dim> const * dof_handler_p = nullptr;
+  dealii::DoFHandler<dim> const * dof_handler_u = nullptr;
+};
+
+template<int dim, typename Number>
+class Application : public Acoustics::ApplicationBase<dim, Number>
+{
+public:
+  Application(MPI_Comm const & comm,
+              bool const       local_time_stepping,
+              bool const       start_with_low_order)
+    : Acoustics::ApplicationBase<dim, Number>("", comm),
+      local_time_stepping(local_time_stepping),
+      start_with_low_order(start_with_low_order)
+  {
+  }
+
+  std::shared_ptr<ErrorPostProcessor<dim, Number>> postprocessor;
+
+private:
+  void
+  parse_parameters() final
+  {
+  }
+
+  void
+  set_parameters() final
+  {
+    // MATHEMATICAL MODEL
+    this->param.formulation     = Acoustics::Formulation::SkewSymmetric;
+    this->param.right_hand_side = false;
+
+    // PHYSICAL QUANTITIES
+    this->param.start_time     = 0.0;
+    this->param.end_time       = 0.25;
+    this->param.speed_of_sound = 1.0;
+
+    // TEMPORAL DISCRETIZATION
+    // The time step size of the finest level corresponds to a CFL number of approximately 0.04.
+    // Both the time step sizes and the end time are exactly representable, so that global and local
+    // time stepping reach the end time with the same number of time steps of the finest level.
+    this->param.calculation_of_time_step_size  = Acoustics::TimeStepCalculation::UserSpecified;
+    this->param.time_step_size                 = 1.0 / 4096.0;
+    this->param.order_time_integrator          = 3;
+    this->param.start_with_low_order           = start_with_low_order;
+    this->param.local_time_stepping            = local_time_stepping;
+    this->param.max_number_of_time_step_levels = 4;
+
+    this->param.solver_info_data.interval_time = this->param.end_time - this->param.start_time;
+
+    // SPATIAL DISCRETIZATION
+    this->param.grid.triangulation_type = TriangulationType::Distributed;
+    this->param.grid.n_refine_global    = 1;
+    this->param.mapping_degree          = 1;
+    this->param.degree_u                = 3;
+    this->param.degree_p                = 3;
+  }
+
+  void
+  create_grid(Grid<dim> & grid, std::shared_ptr<dealii::Mapping<dim>> & mapping) final
+  {
+    auto const lambda_create_triangulation =
+      [&](dealii::Triangulation<dim, dim> & tria,
+          std::vector<dealii::GridTools::PeriodicFacePair<
+            typename dealii::Triangulation<dim>::cell_iterator>> & /*periodic_face_pairs*/,
+          unsigned int const global_refinements,
+          std::vector<unsigned int> const & /* vector_local_refinements*/) {
+        // cell sizes 1/16, 1/8, 1/4 in x-direction and 1/4 in y-direction
+        std::vector<std::vector<double>> step_sizes(dim);
+        step_sizes[0] = {0.0625, 0.0625, 0.0625, 0.0625, 0.125, 0.125, 0.25, 0.25};
+        step_sizes[1] = {0.25, 0.25, 0.25, 0.25};
+
+        dealii::GridGenerator::subdivided_hyper_rectangle(tria,
+                                                          step_sizes,
+                                                          dealii::Point<dim>(0.0, 0.0),
+                                                          dealii::Point<dim>(1.0, 1.0));
+
+        tria.refine_global(global_refinements);
+      };
+
+    GridUtilities::create_triangulation<dim>(
+      grid, this->mpi_comm, this->param.grid, lambda_create_triangulation, {});
+
+    GridUtilities::create_mapping(mapping,
+                                  this->param.grid.element_type,
+                                  this->param.mapping_degree);
+  }
+
+  void
+  set_boundary_descriptor() final
+  {
+    this->boundary_descriptor->pressure_dbc.insert(
+      std::make_pair(0, std::make_shared<AnalyticalSolutionPressure<dim>>()));
+  }
+
+  void
+  set_field_functions() final
+  {
+    this->field_functions->initial_solution_pressure =
+      std::make_shared<AnalyticalSolutionPressure<dim>>();
+    this->field_functions->initial_solution_velocity =
+      std::make_shared<AnalyticalSolutionVelocity<dim>>();
+    this->field_functions->right_hand_side =
+      std::make_shared<dealii::Functions::ZeroFunction<dim>>(1);
+  }
+
+  std::shared_ptr<Acoustics::PostProcessorBase<dim, Number>>
+  create_postprocessor() final
+  {
+    postprocessor = std::make_shared<ErrorPostProcessor<dim, Number>>();
+
+    return postprocessor;
+  }
+
+  bool const local_time_stepping;
+  bool const start_with_low_order;
+};
+
+template<int dim, typename Number>
+std::shared_ptr<ErrorPostProcessor<dim, Number> const>
+run(bool const local_time_stepping, bool const start_with_low_order)
+{
+  std::shared_ptr<Application<dim, Number>> application =
+    std::make_shared<Application<dim, Number>>(MPI_COMM_WORLD,
+                                               local_time_stepping,
+                                               start_with_low_order);
+
+  // the output of the solver is not part of the test
+  std::stringstream log;
+  std::streambuf *  buffer = std::cout.rdbuf(log.rdbuf());
+
+  Acoustics::Driver<dim, Number> driver(MPI_COMM_WORLD, application, true, false);
+  driver.setup();
+  driver.solve();
+
+  std::cout.rdbuf(buffer);
+
+  return application->postprocessor;
+}
+
+void
+test(bool const start_with_low_order)
+{
+  std::cout << "Local time stepping on a graded mesh (start with low order = "
+            << (start_with_low_order ? "true" : "false") << "):" << std::endl;
+
+  auto const lts = run<2, double>(true, start_with_low_order);
+  auto const gts = run<2, double>(false, start_with_low_order);
+
+  std::cout << "  Number of time step levels: " << lts->n_time_step_levels << std::endl;
+
+  std::cout << "  Pressure error agrees with global time stepping: "
+            << (std::abs(lts->error_p - gts->error_p) < 0.05 * gts->error_p ? "yes" : "no")
+            << std::endl;
+  std::cout << "  Velocity error agrees with global time stepping: "
+            << (std::abs(lts->error_u - gts->error_u) < 0.05 * gts->error_u ? "yes" : "no")
+            << std::endl
+            << std::endl;
+}
+
+int
+main(int argc, char ** argv)
+{
+  try
+  {
+    dealii::Utilities::MPI::MPI_InitFinalize mpi(argc, argv, 1);
+
+    test(false);
+    test(true);
+  }
+  catch(std::exception & exc)
+  {
+    std::cerr << std::endl
+              << std::endl
+              << "----------------------------------------------------" << std::endl;
+    std::cerr << "Exception on processing: " << std::endl
+              << exc.what() << std::endl
+              << "Aborting!" << std::endl
+              << "----------------------------------------------------" << std::endl;
+    return 1;
+  }
+
+  return 0;
+}
@@ -0,0 +1,206 @@
+/*  ______________________________________________________________________
+ *
+ *  ExaDG - High-Order Discontinuous Galerkin for the Exa-Scale
+ *
+ *  Copyright (C) 2021 by the ExaDG authors
+ *
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation, either version 3 of the License, or
+ *  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ *  ______________________________________________________________________
+ */
+
+
+// C++
+#include <cmath>
+#include <iostream>
+
+// deal.II
+#include <deal.II/base/conditional_ostream.h>
+#include <deal.II/base/function.h>
+#include <deal.II/base/quadrature_lib.h>
+#include <deal.II/distributed/tria.h>
+#include <deal.II/dofs/dof_handler.h>
+#include <deal.II/dofs/dof_tools.h>
+#include <deal.II/fe/fe_dgq.h>
+#include <deal.II/fe/mapping_q.h>
+#include <deal.II/grid/grid_generator.h>
+#include <deal.II/lac/affine_constraints.h>
+#include <deal.II/lac/la_parallel_vector.h>
+#include <deal.II/matrix_free/matrix_free.h>
+#include <deal.II/multigrid/mg_transfer_global_coarsening.h>
+
+// ExaDG
+#include <exadg/aero_acoustic/calculators/source_term_calculator.h>
+#include <exadg/aero_acoustic/source_term_transfer.h>
+
+// The transfer of the aeroacoustic source term from the fluid mesh to a non-matching acoustic mesh
+// (AeroAcoustic::SourceTermTransfer) has to give the same result as the restriction of
+// dealii::MGTwoLevelTransferNonNested, both for the whole fluid domain and for a source region, in
+// which case the source term is zero outside the source region.
+
+using namespace ExaDG;
+
+template<int dim>
+class SourceRegion : public dealii::Function<dim>
+{
+public:
+  SourceRegion(double const radius) : dealii::Function<dim>(1, 0.0), radius(radius)
+  {
+  }
+
+  double
+  value(dealii::Point<dim> const & p, unsigned int const) const final
+  {
+    return p.norm() <= radius ? 1.0 : 0.0;
+  }
+
+private:
+  double const radius;
+};
+
+template<int dim, typename Number>
+void
+test(std::shared_ptr<dealii::Function<dim>> const & source_region)
+{
+  using VectorType = dealii::LinearAlgebra::distributed::Vector<Number>;
+
+  MPI_Comm const comm = MPI_COMM_WORLD;
+
+  dealii::ConditionalOStream pcout(std::cout, dealii::Utilities::MPI::this_mpi_process(comm) == 0);
+
+  dealii::MappingQ<dim> const mapping(1);
+
+  // fluid mesh
+  dealii::parallel::distributed::Triangulation<dim> tria_fluid(comm);
+  dealii::GridGenerator::hyper_cube(tria_fluid, -1.0, 1.0);
+  tria_fluid.refine_global(3);
+
+  dealii::DoFHandler<dim> dof_handler_fluid(tria_fluid);
+  dof_handler_fluid.distribute_dofs(dealii::FE_DGQ<dim>(2));
+
+  dealii::AffineConstraints<Number> constraints;
+  constraints.close();
+
+  typename dealii::MatrixFree<dim, Number>::AdditionalData additional_data;
+  additional_data.mapping_update_flags =
+    dealii::update_values | dealii::update_JxW_values | dealii::update_quadrature_points;
+
+  dealii::MatrixFree<dim, Number> matrix_free;
+  matrix_free.reinit(
+    mapping, dof_handler_fluid, constraints, dealii::QGauss<1>(3), additional_data);
+
+  // acoustic mesh: larger than the fluid mesh and with cell boundaries that do not coincide with
+  // the support points of the fluid mesh
+  dealii::parallel::distributed::Triangulation<dim> tria_acoustic(comm);
+  dealii::GridGenerator::hyper_cube(tria_acoustic, -1.7, 2.3);
+  tria_acoustic.refine_global(2);
+
+  dealii::DoFHandler<dim> dof_handler_acoustic(tria_acoustic);
+  dof_handler_acoustic.distribute_dofs(dealii::FE_DGQ<dim>(3));
+
+  // source region
+  AeroAcoustic::SourceTermCalculatorData<dim> data;
+  data.dof_index_pressure  = 0;
+  data.dof_index_velocity  = 0;
+  data.quad_index          = 0;
+  data.density             = 1.0;
+  data.consider_convection = false;
+  data.blend_in            = false;
+  data.source_region       = source_region;
+
+  AeroAcoustic::SourceTermCalculator<dim, Number> source_term_calculator;
+  source_term_calculator.setup(matrix_free, data);
+
+  std::vector<unsigned int> const & active_cell_batches =
+    source_term_calculator.get_active_cell_batches();
+
+  // integrated source term on the fluid mesh, zero outside the source region
+  VectorType src;
+  matrix_free.initialize_dof_vector(src);
+
+  std::vector<dealii::types::global_dof_index> dof_indices(
+    dof_handler_fluid.get_fe().n_dofs_per_cell());
+  for(auto const & batch : active_cell_batches)
+  {
+    for(unsigned int v = 0; v < matrix_free.n_active_entries_per_cell_batch(batch); ++v)
+    {
+      matrix_free.get_cell_iterator(batch, v)->get_dof_indices(dof_indices);
+      for(auto const & index : dof_indices)
+        src[index] = std::sin(1.0 + index);
+    }
+  }
+
+  VectorType dst, dst_reference;
+  dst.reinit(dof_handler_acoustic.locally_owned_dofs(),
+             dealii::DoFTools::extract_locally_relevant_dofs(dof_handler_acoustic),
+             comm);
+  dst_reference.reinit(dst);
+
+  // transfer restricted to the source region
+  AeroAcoustic::SourceTermTransfer<dim, Number> transfer;
+  transfer.reinit(matrix_free, 0, active_cell_batches, mapping, dof_handler_acoustic, mapping);
+  transfer.restrict(dst, src);
+
+  // reference: restriction of the non-nested multigrid transfer
+  dealii::MGTwoLevelTransferNonNested<dim, VectorType> transfer_reference;
+  transfer_reference.reinit(dof_handler_fluid, dof_handler_acoustic, mapping, mapping);
+  transfer_reference.restrict_and_add(dst_reference, src);
+
+  unsigned int const n_active_cell_batches =
+    dealii::Utilities::MPI::sum<unsigned int>(active_cell_batches.size(), comm);
+  unsigned int const n_cell_batches =
+    dealii::Utilities::MPI::sum<unsigned int>(matrix_free.n_cell_batches(), comm);
+
+  Number const norm_reference = dst_reference.l2_norm();
+  dst.add(-1.0, dst_reference);
+
+  if(source_region.get())
+    pcout << "  source region smaller than fluid domain:    "
+          << (n_active_cell_batches < n_cell_batches ? "yes" : "no") << std::endl;
+  pcout << "  non-zero source term transferred:           "
+        << (norm_reference > 0.0 ? "yes" : "no") << std::endl
+        << "  same result as MGTwoLevelTransferNonNested: "
+        << (dst.l2_norm() <= 1.e-12 * norm_reference ? "yes" : "no") << std::endl;
+}
+
+int
+main(int argc, char ** argv)
+{
+  try
+  {
+    dealii::Utilities::MPI::MPI_InitFinalize mpi(argc, argv, 1);
+
+    dealii::ConditionalOStream pcout(std::cout,
+                                     dealii::Utilities::MPI::this_mpi_process(MPI_COMM_WORLD) ==
+                                       0);
+
+    pcout << "Whole fluid domain:" << std::endl;
+    test<2, double>(nullptr);
+
+    pcout << "Source region:" << std::endl;
+    test<2, double>(std::make_shared<SourceRegion<2>>(0.5));
+  }
+  catch(std::exception & exc)
+  {
+    std::cerr << std::endl
+              << std::endl
+              << "----------------------------------------------------" << std::endl;
+    std::cerr << "Exception on processing: " << std::endl
+              << exc.what() << std::endl
+              << "Aborting!" << std::endl
+              << "----------------------------------------------------" << std::endl;
+    return 1;
+  }
+
+  return 0;
+}
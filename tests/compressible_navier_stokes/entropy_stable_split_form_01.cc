@@ -0,0 +1,448 @@
+/*  ______________________________________________________________________
+ *
+ *  ExaDG - High-Order Discontinuous Galerkin for the Exa-Scale
+ *
+ *  Copyright (C) 2021 by the ExaDG authors
+ *
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation, either version 3 of the License, or
+ *  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ *  ______________________________________________________________________
+ */
+
+// C++
+#include <cmath>
+#include <iostream>
+#include <sstream>
+
+// deal.II
+#include <deal.II/base/function.h>
+#include <deal.II/base/quadrature_lib.h>
+#include <deal.II/grid/grid_generator.h>
+#include <deal.II/numerics/vector_tools.h>
+
+// ExaDG
+#include <exadg/compressible_navier_stokes/driver.h>
+#include <exadg/compressible_navier_stokes/user_interface/application_base.h>
+#include <exadg/grid/deformed_cube_manifold.h>
+
+// Euler equations on a curved mesh (deformed cube manifold, mapping degree equal to the polynomial
+// degree): The entropy stable split form has to preserve a free stream to machine accuracy, and its
+// convergence rate for the isentropic vortex has to match the one of the divergence form.
+
+using namespace ExaDG;
+
+double const GAMMA = 1.4;
+double const R     = 1.0;
+double const MACH  = 0.5;
+double const T_0   = 1.0 / (MACH * MACH) / GAMMA / R;
+double const L     = 10.0;
+
+/*
+ * Isentropic vortex of strength beta moving with unit velocity in x-direction. For beta = 0, the
+ * solution is a constant free stream.
+ */
+class Vortex
+{
+public:
+  Vortex(double const beta) : beta(beta)
+  {
+  }
+
+  template<int dim>
+  void
+  evaluate(dealii::Point<dim> const & p,
+           double const               t,
+           double &                   rho,
+           double &                   u,
+           double &                   v,
+           double &                   energy) const
+  {
+    double const pi   = dealii::numbers::PI;
+    double const r_sq = (p[0] - t) * (p[0] - t) + p[1] * p[1];
+
+    rho = std::pow(1.0 - ((GAMMA - 1.0) / (16.0 * GAMMA * pi * pi) * beta * beta *
+                          std::exp(2.0 * (1.0 - r_sq))),
+                   1 / (GAMMA - 1.0));
+    u   = 1.0 - beta * std::exp(1.0 - r_sq) * p[1] / (2.0 * pi);
+    v   = beta * std::exp(1.0 - r_sq) * (p[0] - t) / (2.0 * pi);
+
+    double const pressure = std::pow(rho, GAMMA);
+    energy                = pressure / (rho * (GAMMA - 1.0)) + 0.5 * (u * u + v * v);
+  }
+
+private:
+  double const beta;
+};
+
+template<int dim>
+class Solution : public dealii::Function<dim>
+{
+public:
+  Solution(double const beta) : dealii::Function<dim>(dim + 2, 0.0), vortex(beta)
+  {
+  }
+
+  double
+  value(dealii::Point<dim> const & p, unsigned int const component) const final
+  {
+    double rho, u, v, energy;
+    vortex.evaluate(p, this->get_time(), rho, u, v, energy);
+
+    if(component == 0)
+      return rho;
+    else if(component == 1)
+      return rho * u;
+    else if(component == 2)
+      return rho * v;
+    else
+      return rho * energy;
+  }
+
+private:
+  Vortex const vortex;
+};
+
+template<int dim>
+class DensityBC : public dealii::Function<dim>
+{
+public:
+  DensityBC(double const beta) : dealii::Function<dim>(1, 0.0), vortex(beta)
+  {
+  }
+
+  double
+  value(dealii::Point<dim> const & p, unsigned int const) const final
+  {
+    double rho, u, v, energy;
+    vortex.evaluate(p, this->get_time(), rho, u, v, energy);
+
+    return rho;
+  }
+
+private:
+  Vortex const vortex;
+};
+
+template<int dim>
+class VelocityBC : public dealii::Function<dim>
+{
+public:
+  VelocityBC(double const beta) : dealii::Function<dim>(dim, 0.0), vortex(beta)
+  {
+  }
+
+  double
+  value(dealii::Point<dim> const & p, unsigned int const component) const final
+  {
+    double rho, u, v, energy;
+    vortex.evaluate(p, this->get_time(), rho, u, v, energy);
+
+    return component == 0 ? u : v;
+  }
+
+private:
+  Vortex const vortex;
+};
+
+template<int dim>
+class EnergyBC : public dealii::Function<dim>
+{
+public:
+  EnergyBC(double const beta) : dealii::Function<dim>(1, 0.0), vortex(beta)
+  {
+  }
+
+  double
+  value(dealii::Point<dim> const & p, unsigned int const) const final
+  {
+    double rho, u, v, energy;
+    vortex.evaluate(p, this->get_time(), rho, u, v, energy);
+
+    return energy;
+  }
+
+private:
+  Vortex const vortex;
+};
+
+/*
+ * Stores the L2 error of the conserved variables of the last call to do_postprocessing().
+ */
+template<int dim, typename Number>
+class ErrorPostProcessor : public CompNS::PostProcessorBase<dim, Number>
+{
+  using VectorType = typename CompNS::PostProcessorInterface<Number>::VectorType;
+
+public:
+  ErrorPostProcessor(double const beta) : beta(beta)
+  {
+  }
+
+  void
+  setup(CompNS::Operator<dim, Number> const & pde_operator) final
+  {
+    mapping     = &pde_operator.get_mapping();
+    dof_handler = &pde_operator.get_dof_handler();
+  }
+
+  void
+  do_postprocessing(VectorType const &     solution,
+                    double const           time,
+                    types::time_step const time_step_number) final
+  {
+    (void)time_step_number;
+
+    dealii::LinearAlgebra::distributed::Vector<double> solution_double;
+    solution_double = solution;
+    solution_double.update_ghost_values();
+
+    Solution<dim> analytical_solution(beta);
+    analytical_solution.set_time(time);
+
+    dealii::Vector<double> error_per_cell(dof_handler->get_triangulation().n_active_cells());
+    dealii::VectorTools::integrate_difference(*mapping,
+                                              *dof_handler,
+                                              solution_double,
+                                              analytical_solution,
+                                              error_per_cell,
+                                              dealii::QGauss<dim>(dof_handler->get_fe().degree + 3),
+                                              dealii::VectorTools::L2_norm);
+
+    error = dealii::VectorTools::compute_global_error(dof_handler->get_triangulation(),
+                                                      error_per_cell,
+                                                      dealii::VectorTools::L2_norm);
+  }
+
+  double error = 0.0;
+
+private:
+  double const beta;
+
+  dealii::Mapping<dim> const *    mapping     = nullptr;
+  dealii::DoFHandler<dim> const * dof_handler = nullptr;
+};
+
+template<int dim, typename Number>
+class Application : public CompNS::ApplicationBase<dim, Number>
+{
+public:
+  Application(MPI_Comm const &                        comm,
+              CompNS::FormulationConvectiveTerm const formulation,
+              double const                            beta,
+              unsigned int const                      n_refine_global,
+              double const                            end_time)
+    : CompNS::ApplicationBase<dim, Number>("", comm),
+      formulation(formulation),
+      beta(beta),
+      n_refine_global(n_refine_global),
+      end_time(end_time)
+  {
+  }
+
+  std::shared_ptr<ErrorPostProcessor<dim, Number>> postprocessor;
+
+private:
+  void
+  parse_parameters() final
+  {
+  }
+
+  void
+  set_parameters() final
+  {
+    // MATHEMATICAL MODEL
+    this->param.equation_type   = CompNS::EquationType::Euler;
+    this->param.right_hand_side = false;
+
+    // PHYSICAL QUANTITIES
+    this->param.start_time            = 0.0;
+    this->param.end_time              = end_time;
+    this->param.dynamic_viscosity     = 0.0;
+    this->param.reference_density     = 1.0;
+    this->param.heat_capacity_ratio   = GAMMA;
+    this->param.thermal_conductivity  = 0.0;
+    this->param.specific_gas_constant = R;
+    this->param.max_temperature       = T_0;
+
+    // TEMPORAL DISCRETIZATION
+    // a small CFL number and a fourth order method so that the spatial error dominates
+    this->param.temporal_discretization       = CompNS::TemporalDiscretization::ExplRK4Stage8Reg2;
+    this->param.order_time_integrator         = 4;
+    this->param.calculation_of_time_step_size = CompNS::TimeStepCalculation::CFL;
+    this->param.max_velocity                  = 1.0;
+    this->param.cfl_number                    = 0.2;
+    this->param.exponent_fe_degree_cfl        = 2.0;
+
+    this->param.solver_info_data.interval_time = end_time;
+
+    // SPATIAL DISCRETIZATION
+    this->param.grid.triangulation_type     = TriangulationType::Distributed;
+    this->param.grid.n_refine_global        = n_refine_global;
+    this->param.degree                      = 3;
+    this->param.mapping_degree              = this->param.degree;
+    this->param.n_q_points_convective       = CompNS::QuadratureRule::Standard;
+    this->param.n_q_points_viscous          = CompNS::QuadratureRule::Standard;
+    this->param.formulation_convective_term = formulation;
+
+    // NUMERICAL PARAMETERS
+    this->param.use_combined_operator = false;
+  }
+
+  void
+  create_grid(Grid<dim> & grid, std::shared_ptr<dealii::Mapping<dim>> & mapping) final
+  {
+    auto const lambda_create_triangulation =
+      [&](dealii::Triangulation<dim, dim> & tria,
+          std::vector<dealii::GridTools::PeriodicFacePair<
+            typename dealii::Triangulation<dim>::cell_iterator>> & /*periodic_face_pairs*/,
+          unsigned int const global_refinements,
+          std::vector<unsigned int> const & /* vector_local_refinements*/) {
+        dealii::GridGenerator::hyper_cube(tria, -L / 2.0, L / 2.0);
+
+        // curved interior faces, the boundary of the domain remains unchanged
+        tria.set_all_manifold_ids(1);
+        tria.set_manifold(1, DeformedCubeManifold<dim>(-L / 2.0, L / 2.0, 0.05 * L, 2));
+
+        tria.refine_global(global_refinements);
+      };
+
+    GridUtilities::create_triangulation<dim>(
+      grid, this->mpi_comm, this->param.grid, lambda_create_triangulation, {});
+
+    GridUtilities::create_mapping(mapping,
+                                  this->param.grid.element_type,
+                                  this->param.mapping_degree);
+  }
+
+  void
+  set_boundary_descriptor() final
+  {
+    this->boundary_descriptor->density.dirichlet_bc.insert(
+      std::make_pair(0, std::make_shared<DensityBC<dim>>(beta)));
+    this->boundary_descriptor->velocity.dirichlet_bc.insert(
+      std::make_pair(0, std::make_shared<VelocityBC<dim>>(beta)));
+    this->boundary_descriptor->pressure.neumann_bc.insert(
+      std::make_pair(0, std::make_shared<dealii::Functions::ZeroFunction<dim>>(1)));
+    this->boundary_descriptor->energy.boundary_variable.insert(
+      std::make_pair(0, CompNS::EnergyBoundaryVariable::Energy));
+    this->boundary_descriptor->energy.dirichlet_bc.insert(
+      std::make_pair(0, std::make_shared<EnergyBC<dim>>(beta)));
+  }
+
+  void
+  set_field_functions() final
+  {
+    this->field_functions->initial_solution = std::make_shared<Solution<dim>>(beta);
+    this->field_functions->right_hand_side_density =
+      std::make_shared<dealii::Functions::ZeroFunction<dim>>(1);
+    this->field_functions->right_hand_side_velocity =
+      std::make_shared<dealii::Functions::ZeroFunction<dim>>(dim);
+    this->field_functions->right_hand_side_energy =
+      std::make_shared<dealii::Functions::ZeroFunction<dim>>(1);
+  }
+
+  std::shared_ptr<CompNS::PostProcessorBase<dim, Number>>
+  create_postprocessor() final
+  {
+    postprocessor = std::make_shared<ErrorPostProcessor<dim, Number>>(beta);
+
+    return postprocessor;
+  }
+
+  CompNS::FormulationConvectiveTerm const formulation;
+  double const                            beta;
+  unsigned int const                      n_refine_global;
+  double const                            end_time;
+};
+
+template<int dim, typename Number>
+double
+run(CompNS::FormulationConvectiveTerm const formulation,
+    double const                            beta,
+    unsigned int const                      n_refine_global,
+    double const                            end_time)
+{
+  std::shared_ptr<Application<dim, Number>> application =
+    std::make_shared<Application<dim, Number>>(
+      MPI_COMM_WORLD, formulation, beta, n_refine_global, end_time);
+
+  // the output of the solver is not part of the test
+  std::stringstream log;
+  std::streambuf *  buffer = std::cout.rdbuf(log.rdbuf());
+
+  CompNS::Driver<dim, Number> driver(MPI_COMM_WORLD, application, true, false);
+  driver.setup();
+  driver.solve();
+
+  std::cout.rdbuf(buffer);
+
+  return application->postprocessor->error;
+}
+
+void
+test_free_stream()
+{
+  double const error =
+    run<2, double>(CompNS::FormulationConvectiveTerm::EntropyStableSplitForm, 0.0, 2, 0.5);
+
+  std::cout << "Free stream preserved by the split form on a curved mesh: "
+            << (error < 1.e-10 ? "yes" : "no") << std::endl;
+}
+
+void
+test_convergence()
+{
+  double const degree = 3.0;
+
+  double rate[2];
+
+  unsigned int i = 0;
+  for(auto const formulation : {CompNS::FormulationConvectiveTerm::DivergenceForm,
+                                CompNS::FormulationConvectiveTerm::EntropyStableSplitForm})
+  {
+    double const error_coarse = run<2, double>(formulation, 5.0, 3, 0.5);
+    double const error_fine   = run<2, double>(formulation, 5.0, 4, 0.5);
+
+    rate[i++] = std::log2(error_coarse / error_fine);
+  }
+
+  std::cout << "Convergence rate of the split form is at least the polynomial degree: "
+            << (rate[1] > degree ? "yes" : "no") << std::endl;
+  std::cout << "Convergence rate of the split form agrees with the divergence form: "
+            << (std::abs(rate[1] - rate[0]) < 0.5 ? "yes" : "no") << std::endl;
+}
+
+int
+main(int argc, char ** argv)
+{
+  try
+  {
+    dealii::Utilities::MPI::MPI_InitFinalize mpi(argc, argv, 1);
+
+    test_free_stream();
+    test_convergence();
+  }
+  catch(std::exception & exc)
+  {
+    std::cerr << std::endl
+              << std::endl
+              << "----------------------------------------------------" << std::endl;
+    std::cerr << "Exception on processing: " << std::endl
+              << exc.what() << std::endl
+              << "Aborting!" << std::endl
+              << "----------------------------------------------------" << std::endl;
+    return 1;
+  }
+
+  return 0;
+}
@@ -0,0 +1,304 @@
+/*  ______________________________________________________________________
+ *
+ *  ExaDG - High-Order Discontinuous Galerkin for the Exa-Scale
+ *
+ *  Copyright (C) 2021 by the ExaDG authors
+ *
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation, either version 3 of the License, or
+ *  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ *  ______________________________________________________________________
+ */
+
+// C++
+#include <cmath>
+#include <iostream>
+#include <sstream>
+
+// deal.II
+#include <deal.II/base/function.h>
+#include <deal.II/grid/grid_generator.h>
+#include <deal.II/grid/grid_tools.h>
+
+// ExaDG
+#include <exadg/compressible_navier_stokes/driver.h>
+#include <exadg/compressible_navier_stokes/user_interface/application_base.h>
+
+// Viscous shear flow on a periodic box: The temporal error of the IMEX Runge-Kutta methods of
+// order 1, 2, and 3 is measured against a solution computed on the same mesh with a much smaller
+// time step size, so that the spatial error cancels. The convergence rate under time step
+// refinement has to match the design order of the methods.
+
+using namespace ExaDG;
+
+double const GAMMA         = 1.4;
+double const R             = 1.0;
+double const DYN_VISCOSITY = 0.1;
+double const LAMBDA        = 0.1;
+double const RHO_0         = 1.0;
+double const U_0           = 0.5;
+double const P_0           = 1.0 / GAMMA; // speed of sound of 1
+double const T_0           = P_0 / (RHO_0 * R);
+
+double const END_TIME = 0.125;
+
+template<int dim>
+class InitialSolution : public dealii::Function<dim>
+{
+public:
+  InitialSolution() : dealii::Function<dim>(dim + 2, 0.0)
+  {
+  }
+
+  double
+  value(dealii::Point<dim> const & p, unsigned int const component) const final
+  {
+    double const pi = dealii::numbers::PI;
+
+    double const u = U_0 * std::sin(2.0 * pi * p[1]);
+    double const v = U_0 * std::sin(2.0 * pi * p[0]);
+
+    if(component == 0)
+      return RHO_0;
+    else if(component == 1)
+      return RHO_0 * u;
+    else if(component == 2)
+      return RHO_0 * v;
+    else
+      return P_0 / (GAMMA - 1.0) + 0.5 * RHO_0 * (u * u + v * v);
+  }
+};
+
+/*
+ * Stores the solution of the last call to do_postprocessing().
+ */
+template<int dim, typename Number>
+class SolutionPostProcessor : public CompNS::PostProcessorBase<dim, Number>
+{
+  using VectorType = typename CompNS::PostProcessorInterface<Number>::VectorType;
+
+public:
+  void
+  setup(CompNS::Operator<dim, Number> const & pde_operator) final
+  {
+    (void)pde_operator;
+  }
+
+  void
+  do_postprocessing(VectorType const &     solution_in,
+                    double const           time,
+                    types::time_step const time_step_number) final
+  {
+    (void)time;
+    (void)time_step_number;
+
+    solution = solution_in;
+  }
+
+  VectorType solution;
+};
+
+template<int dim, typename Number>
+class Application : public CompNS::ApplicationBase<dim, Number>
+{
+public:
+  Application(MPI_Comm const &   comm,
+              unsigned int const order_time_integrator,
+              unsigned int const n_time_steps)
+    : CompNS::ApplicationBase<dim, Number>("", comm),
+      order_time_integrator(order_time_integrator),
+      n_time_steps(n_time_steps)
+  {
+  }
+
+  std::shared_ptr<SolutionPostProcessor<dim, Number>> postprocessor;
+
+private:
+  void
+  parse_parameters() final
+  {
+  }
+
+  void
+  set_parameters() final
+  {
+    // MATHEMATICAL MODEL
+    this->param.equation_type   = CompNS::EquationType::NavierStokes;
+    this->param.right_hand_side = false;
+
+    // PHYSICAL QUANTITIES
+    this->param.start_time            = 0.0;
+    this->param.end_time              = END_TIME;
+    this->param.dynamic_viscosity     = DYN_VISCOSITY;
+    this->param.reference_density     = RHO_0;
+    this->param.heat_capacity_ratio   = GAMMA;
+    this->param.thermal_conductivity  = LAMBDA;
+    this->param.specific_gas_constant = R;
+    this->param.max_temperature       = T_0;
+
+    // TEMPORAL DISCRETIZATION
+    // The time step sizes are exactly representable, so that all runs reach the end time exactly.
+    this->param.temporal_discretization       = CompNS::TemporalDiscretization::IMEXRK;
+    this->param.order_time_integrator         = order_time_integrator;
+    this->param.calculation_of_time_step_size = CompNS::TimeStepCalculation::UserSpecified;
+    this->param.time_step_size                = END_TIME / n_time_steps;
+
+    this->param.solver_info_data.interval_time = END_TIME;
+
+    // SPATIAL DISCRETIZATION
+    this->param.grid.triangulation_type = TriangulationType::Distributed;
+    this->param.grid.n_refine_global    = 2;
+    this->param.degree                  = 2;
+    this->param.mapping_degree          = 1;
+    this->param.n_q_points_convective   = CompNS::QuadratureRule::Standard;
+    this->param.n_q_points_viscous      = CompNS::QuadratureRule::Standard;
+
+    // SOLVER
+    // the implicit stages are solved accurately, so that the error of the time integrator dominates
+    this->param.newton_solver_data_viscous = Newton::SolverData(100, 1.e-12, 1.e-10);
+    this->param.solver_data_viscous        = SolverData(1000, 1.e-14, 1.e-6, 30);
+    this->param.preconditioner_viscous     = CompNS::PreconditionerViscous::InverseMassMatrix;
+
+    // NUMERICAL PARAMETERS
+    this->param.use_combined_operator = false;
+  }
+
+  void
+  create_grid(Grid<dim> & grid, std::shared_ptr<dealii::Mapping<dim>> & mapping) final
+  {
+    auto const lambda_create_triangulation =
+      [&](dealii::Triangulation<dim, dim> & tria,
+          std::vector<dealii::GridTools::PeriodicFacePair<
+            typename dealii::Triangulation<dim>::cell_iterator>> & periodic_face_pairs,
+          unsigned int const global_refinements,
+          std::vector<unsigned int> const & /* vector_local_refinements*/) {
+        // periodic box with boundary ids 0, 1 in x-direction and 2, 3 in y-direction
+        dealii::GridGenerator::hyper_cube(tria, 0.0, 1.0, true);
+
+        dealii::GridTools::collect_periodic_faces(tria, 0, 1, 0, periodic_face_pairs);
+        dealii::GridTools::collect_periodic_faces(tria, 2, 3, 1, periodic_face_pairs);
+        tria.add_periodicity(periodic_face_pairs);
+
+        tria.refine_global(global_refinements);
+      };
+
+    GridUtilities::create_triangulation<dim>(
+      grid, this->mpi_comm, this->param.grid, lambda_create_triangulation, {});
+
+    GridUtilities::create_mapping(mapping,
+                                  this->param.grid.element_type,
+                                  this->param.mapping_degree);
+  }
+
+  void
+  set_boundary_descriptor() final
+  {
+    // test case with periodic BC -> boundary descriptors remain empty
+  }
+
+  void
+  set_field_functions() final
+  {
+    this->field_functions->initial_solution = std::make_shared<InitialSolution<dim>>();
+    this->field_functions->right_hand_side_density =
+      std::make_shared<dealii::Functions::ZeroFunction<dim>>(1);
+    this->field_functions->right_hand_side_velocity =
+      std::make_shared<dealii::Functions::ZeroFunction<dim>>(dim);
+    this->field_functions->right_hand_side_energy =
+      std::make_shared<dealii::Functions::ZeroFunction<dim>>(1);
+  }
+
+  std::shared_ptr<CompNS::PostProcessorBase<dim, Number>>
+  create_postprocessor() final
+  {
+    postprocessor = std::make_shared<SolutionPostProcessor<dim, Number>>();
+
+    return postprocessor;
+  }
+
+  unsigned int const order_time_integrator;
+  unsigned int const n_time_steps;
+};
+
+template<int dim, typename Number>
+dealii::LinearAlgebra::distributed::Vector<Number>
+run(unsigned int const order_time_integrator, unsigned int const n_time_steps)
+{
+  std::shared_ptr<Application<dim, Number>> application =
+    std::make_shared<Application<dim, Number>>(MPI_COMM_WORLD,
+                                               order_time_integrator,
+                                               n_time_steps);
+
+  // the output of the solver is not part of the test
+  std::stringstream log;
+  std::streambuf *  buffer = std::cout.rdbuf(log.rdbuf());
+
+  CompNS::Driver<dim, Number> driver(MPI_COMM_WORLD, application, true, false);
+  driver.setup();
+  driver.solve();
+
+  std::cout.rdbuf(buffer);
+
+  return application->postprocessor->solution;
+}
+
+void
+test()
+{
+  typedef dealii::LinearAlgebra::distributed::Vector<double> VectorType;
+
+  // reference solution with a time step size 8 times smaller than the smallest one below
+  VectorType const reference = run<2, double>(3, 2048);
+
+  for(unsigned int order = 1; order <= 3; ++order)
+  {
+    double error[2];
+
+    for(unsigned int i = 0; i < 2; ++i)
+    {
+      VectorType difference = run<2, double>(order, 128 << i);
+      difference -= reference;
+
+      error[i] = difference.l2_norm() / reference.l2_norm();
+    }
+
+    double const rate = std::log2(error[0] / error[1]);
+
+    std::cout << "IMEX Runge-Kutta method of order " << order
+              << " converges with the design order: " << (rate > order - 0.2 ? "yes" : "no")
+              << std::endl;
+  }
+}
+
+int
+main(int argc, char ** argv)
+{
+  try
+  {
+    dealii::Utilities::MPI::MPI_InitFinalize mpi(argc, argv, 1);
+
+    test();
+  }
+  catch(std::exception & exc)
+  {
+    std::cerr << std::endl
+              << std::endl
+              << "----------------------------------------------------" << std::endl;
+    std::cerr << "Exception on processing: " << std::endl
+              << exc.what() << std::endl
+              << "Aborting!" << std::endl
+              << "----------------------------------------------------" << std::endl;
+    return 1;
+  }
+
+  return 0;
+}
@@ -0,0 +1,357 @@
+/*  ______________________________________________________________________
+ *
+ *  ExaDG - High-Order Discontinuous Galerkin for the Exa-Scale
+ *
+ *  Copyright (C) 2021 by the ExaDG authors
+ *
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation, either version 3 of the License, or
+ *  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ *  ______________________________________________________________________
+ */
+
+// C++
+#include <cmath>
+#include <iostream>
+#include <sstream>
+
+// deal.II
+#include <deal.II/base/function.h>
+#include <deal.II/base/quadrature_lib.h>
+#include <deal.II/dofs/dof_tools.h>
+#include <deal.II/grid/grid_generator.h>
+#include <deal.II/numerics/vector_tools.h>
+
+// ExaDG
+#include <exadg/convection_diffusion/driver.h>
+#include <exadg/convection_diffusion/user_interface/application_base.h>
+#include <exadg/functions_and_boundary_conditions/vectorized_function.h>
+#include <exadg/grid/deformed_cube_manifold.h>
+
+// Rotating hill on a deformed mesh with adaptive mesh refinement and global-coarsening multigrid:
+// The simulation on a fully-distributed triangulation (two partitioning groups of two processes
+// each, see GridUtilities::FullyDistributedRefinement) has to produce the same adaptively refined
+// mesh and the same error as the simulation on a distributed triangulation.
+
+using namespace ExaDG;
+
+template<int dim>
+class Solution : public GenericVectorizedFunction<dim, Solution<dim>>
+{
+public:
+  Solution() : GenericVectorizedFunction<dim, Solution<dim>>(1, 0.0)
+  {
+  }
+
+  template<typename Number>
+  Number
+  evaluate(dealii::Point<dim, Number> const & p, unsigned int const /*component*/) const
+  {
+    double const t        = this->get_time();
+    double const omega    = 2.0 * dealii::numbers::PI;
+    double const center_x = -0.5 * std::sin(omega * t);
+    double const center_y = +0.5 * std::cos(omega * t);
+
+    Number const dx = p[0] - center_x;
+    Number const dy = p[1] - center_y;
+
+    return std::exp(-50.0 * (dx * dx + dy * dy));
+  }
+};
+
+template<int dim>
+class VelocityField : public GenericVectorizedFunction<dim, VelocityField<dim>>
+{
+public:
+  VelocityField() : GenericVectorizedFunction<dim, VelocityField<dim>>(dim, 0.0)
+  {
+  }
+
+  template<typename Number>
+  Number
+  evaluate(dealii::Point<dim, Number> const & p, unsigned int const component) const
+  {
+    Number value = 0.0;
+
+    if(component == 0)
+      value = -p[1] * 2.0 * dealii::numbers::PI;
+    else if(component == 1)
+      value = p[0] * 2.0 * dealii::numbers::PI;
+
+    return value;
+  }
+};
+
+/*
+ * Stores the L2 error and the number of active cells of the last call to do_postprocessing().
+ */
+template<int dim, typename Number>
+class ErrorPostProcessor : public ConvDiff::PostProcessorBase<dim, Number>
+{
+  using VectorType = typename ConvDiff::PostProcessorBase<dim, Number>::VectorType;
+
+public:
+  void
+  setup(ConvDiff::Operator<dim, Number> const & pde_operator) final
+  {
+    this->pde_operator = &pde_operator;
+
+    n_initial_cells = pde_operator.get_dof_handler().get_triangulation().n_global_active_cells();
+  }
+
+  void
+  setup_after_coarsening_and_refinement() final
+  {
+  }
+
+  void
+  do_postprocessing(VectorType const &     solution,
+                    double const           time,
+                    types::time_step const time_step_number) final
+  {
+    (void)time_step_number;
+
+    dealii::DoFHandler<dim> const & dof_handler = pde_operator->get_dof_handler();
+
+    dealii::LinearAlgebra::distributed::Vector<double> solution_double;
+    solution_double.reinit(dof_handler.locally_owned_dofs(),
+                           dealii::DoFTools::extract_locally_relevant_dofs(dof_handler),
+                           dof_handler.get_communicator());
+    solution_double.copy_locally_owned_data_from(solution);
+    solution_double.update_ghost_values();
+
+    Solution<dim> analytical_solution;
+    analytical_solution.set_time(time);
+
+    dealii::Vector<double> error_per_cell(dof_handler.get_triangulation().n_active_cells());
+    dealii::VectorTools::integrate_difference(*pde_operator->get_mapping(),
+                                              dof_handler,
+                                              solution_double,
+                                              analytical_solution,
+                                              error_per_cell,
+                                              dealii::QGauss<dim>(dof_handler.get_fe().degree + 3),
+                                              dealii::VectorTools::L2_norm);
+
+    error = dealii::VectorTools::compute_global_error(dof_handler.get_triangulation(),
+                                                      error_per_cell,
+                                                      dealii::VectorTools::L2_norm);
+
+    n_cells = dof_handler.get_triangulation().n_global_active_cells();
+  }
+
+  dealii::types::global_cell_index n_initial_cells = 0;
+  dealii::types::global_cell_index n_cells         = 0;
+
+  double error = 0.0;
+
+private:
+  ConvDiff::Operator<dim, Number> const * pde_operator = nullptr;
+};
+
+template<int dim, typename Number>
+class Application : public ConvDiff::ApplicationBase<dim, Number>
+{
+public:
+  Application(MPI_Comm const & comm, TriangulationType const triangulation_type)
+    : ConvDiff::ApplicationBase<dim, Number>("", comm), triangulation_type(triangulation_type)
+  {
+  }
+
+  std::shared_ptr<ErrorPostProcessor<dim, Number>> postprocessor;
+
+private:
+  void
+  parse_parameters() final
+  {
+  }
+
+  void
+  set_parameters() final
+  {
+    // MATHEMATICAL MODEL
+    this->param.problem_type              = ConvDiff::ProblemType::Unsteady;
+    this->param.equation_type             = ConvDiff::EquationType::Convection;
+    this->param.analytical_velocity_field = true;
+    this->param.right_hand_side           = false;
+
+    // PHYSICAL QUANTITIES
+    this->param.start_time  = 0.0;
+    this->param.end_time    = 0.125;
+    this->param.diffusivity = 0.0;
+
+    // TEMPORAL DISCRETIZATION
+    this->param.temporal_discretization       = ConvDiff::TemporalDiscretization::BDF;
+    this->param.order_time_integrator         = 2;
+    this->param.treatment_of_convective_term  = ConvDiff::TreatmentOfConvectiveTerm::Implicit;
+    this->param.start_with_low_order          = true;
+    this->param.calculation_of_time_step_size = ConvDiff::TimeStepCalculation::UserSpecified;
+    this->param.time_step_size                = 1.0 / 128.0;
+
+    this->param.solver_info_data.interval_time = this->param.end_time - this->param.start_time;
+
+    // SPATIAL DISCRETIZATION
+    this->param.grid.triangulation_type           = triangulation_type;
+    this->param.grid.n_refine_global              = 3;
+    this->param.grid.partitioning_group_size      = 2;
+    this->param.grid.keep_serial_triangulation    = true;
+    this->param.grid.create_coarse_triangulations = true;
+    this->param.degree                            = 2;
+    this->param.mapping_degree                    = this->param.degree;
+    this->param.mapping_degree_coarse_grids       = this->param.mapping_degree;
+
+    this->param.enable_adaptivity                          = true;
+    this->param.amr_data.trigger_every_n_time_steps        = 4;
+    this->param.amr_data.maximum_refinement_level          = 5;
+    this->param.amr_data.minimum_refinement_level          = 2;
+    this->param.amr_data.preserve_boundary_cells           = false;
+    this->param.amr_data.fraction_of_cells_to_be_refined   = 0.1;
+    this->param.amr_data.fraction_of_cells_to_be_coarsened = 0.3;
+
+    this->param.numerical_flux_convective_operator =
+      ConvDiff::NumericalFluxConvectiveOperator::LaxFriedrichsFlux;
+
+    // SOLVER
+    this->param.solver                = ConvDiff::Solver::GMRES;
+    this->param.solver_data           = SolverData(1e3, 1.e-20, 1.e-10, 100);
+    this->param.preconditioner        = ConvDiff::Preconditioner::Multigrid;
+    this->param.update_preconditioner = true;
+
+    this->param.mg_operator_type    = ConvDiff::MultigridOperatorType::ReactionConvection;
+    this->param.multigrid_data.type = MultigridType::hMG;
+
+    this->param.multigrid_data.smoother_data.smoother       = MultigridSmoother::Jacobi;
+    this->param.multigrid_data.smoother_data.preconditioner = PreconditionerSmoother::PointJacobi;
+    this->param.multigrid_data.smoother_data.iterations     = 5;
+    this->param.multigrid_data.smoother_data.relaxation_factor = 0.8;
+    this->param.multigrid_data.coarse_problem.solver = MultigridCoarseGridSolver::GMRES;
+
+    // NUMERICAL PARAMETERS
+    this->param.use_cell_based_face_loops = false;
+  }
+
+  void
+  create_grid(Grid<dim> &                                       grid,
+              std::shared_ptr<dealii::Mapping<dim>> &           mapping,
+              std::shared_ptr<MultigridMappings<dim, Number>> & multigrid_mappings) final
+  {
+    auto const lambda_create_triangulation =
+      [&](dealii::Triangulation<dim, dim> & tria,
+          std::vector<dealii::GridTools::PeriodicFacePair<
+            typename dealii::Triangulation<dim>::cell_iterator>> & /*periodic_face_pairs*/,
+          unsigned int const global_refinements,
+          std::vector<unsigned int> const & /* vector_local_refinements*/) {
+        dealii::GridGenerator::hyper_cube(tria, -1.0, 1.0);
+        apply_deformed_cube_manifold(tria, -1.0, 1.0, 0.2 /* deformation */, 1 /* frequency */);
+        tria.refine_global(global_refinements);
+      };
+
+    GridUtilities::create_triangulation_with_multigrid<dim>(grid,
+                                                            this->mpi_comm,
+                                                            this->param.grid,
+                                                            this->param.involves_h_multigrid(),
+                                                            lambda_create_triangulation,
+                                                            {} /* no local refinements */);
+
+    GridUtilities::create_mapping_with_multigrid(mapping,
+                                                 multigrid_mappings,
+                                                 this->param.grid.element_type,
+                                                 this->param.mapping_degree,
+                                                 this->param.mapping_degree_coarse_grids,
+                                                 this->param.involves_h_multigrid());
+  }
+
+  void
+  set_boundary_descriptor() final
+  {
+    this->boundary_descriptor->dirichlet_bc.insert(
+      std::make_pair(0, std::make_shared<Solution<dim>>()));
+  }
+
+  void
+  set_field_functions() final
+  {
+    this->field_functions->initial_solution = std::make_shared<Solution<dim>>();
+    this->field_functions->right_hand_side =
+      std::make_shared<dealii::Functions::ZeroFunction<dim>>(1);
+    this->field_functions->velocity = std::make_shared<VelocityField<dim>>();
+  }
+
+  std::shared_ptr<ConvDiff::PostProcessorBase<dim, Number>>
+  create_postprocessor() final
+  {
+    postprocessor = std::make_shared<ErrorPostProcessor<dim, Number>>();
+
+    return postprocessor;
+  }
+
+  TriangulationType const triangulation_type;
+};
+
+template<int dim, typename Number>
+std::shared_ptr<ErrorPostProcessor<dim, Number> const>
+run(TriangulationType const triangulation_type)
+{
+  std::shared_ptr<Application<dim, Number>> application =
+    std::make_shared<Application<dim, Number>>(MPI_COMM_WORLD, triangulation_type);
+
+  // the output of the solver is not part of the test
+  std::stringstream log;
+  std::streambuf *  buffer = std::cout.rdbuf(log.rdbuf());
+
+  ConvDiff::Driver<dim, Number> driver(MPI_COMM_WORLD, application, true, false);
+  driver.setup();
+  driver.solve();
+
+  std::cout.rdbuf(buffer);
+
+  return application->postprocessor;
+}
+
+int
+main(int argc, char ** argv)
+{
+  try
+  {
+    dealii::Utilities::MPI::MPI_InitFinalize mpi(argc, argv, 1);
+
+    dealii::ConditionalOStream pcout(std::cout,
+                                     dealii::Utilities::MPI::this_mpi_process(MPI_COMM_WORLD) ==
+                                       0);
+
+    auto const distributed       = run<2, double>(TriangulationType::Distributed);
+    auto const fully_distributed = run<2, double>(TriangulationType::FullyDistributed);
+
+    pcout << "Mesh adapted:                                 "
+          << (fully_distributed->n_cells != fully_distributed->n_initial_cells ? "yes" : "no")
+          << std::endl
+          << "Same number of cells as distributed mesh:     "
+          << (fully_distributed->n_cells == distributed->n_cells ? "yes" : "no") << std::endl
+          << "Error agrees with distributed triangulation:  "
+          << (std::abs(fully_distributed->error - distributed->error) < 1.e-6 * distributed->error ?
+                "yes" :
+                "no")
+          << std::endl;
+  }
+  catch(std::exception & exc)
+  {
+    std::cerr << std::endl
+              << std::endl
+              << "----------------------------------------------------" << std::endl;
+    std::cerr << "Exception on processing: " << std::endl
+              << exc.what() << std::endl
+              << "Aborting!" << std::endl
+              << "----------------------------------------------------" << std::endl;
+    return 1;
+  }
+
+  return 0;
+}
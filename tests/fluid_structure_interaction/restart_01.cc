@@ -0,0 +1,732 @@
+/*  ______________________________________________________________________
+ *
+ *  ExaDG - High-Order Discontinuous Galerkin for the Exa-Scale
+ *
+ *  Copyright (C) 2021 by the ExaDG authors
+ *
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation, either version 3 of the License, or
+ *  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ *  ______________________________________________________________________
+ */
+
+
+// C++
+#include <cstdio>
+#include <fstream>
+#include <iostream>
+#include <sstream>
+
+// deal.II
+#include <deal.II/base/function.h>
+#include <deal.II/grid/grid_generator.h>
+
+// ExaDG
+#include <exadg/fluid_structure_interaction/driver.h>
+#include <exadg/fluid_structure_interaction/user_interface/application_base.h>
+#include <exadg/time_integration/restart.h>
+
+// Restart round trip for partitioned fluid-structure interaction: A pressure wave travels through a
+// two-dimensional channel with an elastic upper wall. The simulation writes a restart file after
+// half of the time steps and is repeated from the restart file. Both simulations have to end with
+// the same fluid and structure solutions, which requires that the fluid, the structure, the ALE
+// grid deformation, and the history of the quasi-Newton method are restored from the restart
+// files.
+
+using namespace ExaDG;
+
+double const FLUID_VISCOSITY = 3.0e-6;
+double const FLUID_DENSITY   = 1.0e3;
+
+double const DENSITY_STRUCTURE       = 1.2e3;
+double const POISSON_RATIO_STRUCTURE = 0.3;
+double const E_STRUCTURE             = 3.0e5;
+
+double const LENGTH    = 5.0e-2; // length of channel
+double const HEIGHT    = 0.5e-2; // height of channel
+double const THICKNESS = 0.1e-2; // thickness of wall
+
+unsigned int const N_CELLS_AXIAL = 16;
+
+// fluid-structure interface at y = HEIGHT, inflow at x = 0, outflow at x = LENGTH, remaining walls
+dealii::types::boundary_id const BOUNDARY_ID_FSI     = 0;
+dealii::types::boundary_id const BOUNDARY_ID_INFLOW  = 1;
+dealii::types::boundary_id const BOUNDARY_ID_OUTFLOW = 2;
+dealii::types::boundary_id const BOUNDARY_ID_WALLS   = 3;
+
+double const TIME_STEP_SIZE = 1.0e-4;
+double const END_TIME       = 10 * TIME_STEP_SIZE;
+
+// the restart file is written once, after 6 of 10 time steps
+double const RESTART_INTERVAL_TIME = 5.5 * TIME_STEP_SIZE;
+
+double const ABS_TOL = 1.e-14;
+double const REL_TOL = 1.e-12;
+
+template<int dim>
+class PressureInflowBC : public dealii::Function<dim>
+{
+public:
+  PressureInflowBC() : dealii::Function<dim>(1, 0.0)
+  {
+  }
+
+  double
+  value(dealii::Point<dim> const & p, unsigned int const component) const final
+  {
+    (void)p;
+    (void)component;
+
+    return 1.3332e3 / FLUID_DENSITY;
+  }
+};
+
+void
+set_boundary_ids(dealii::Triangulation<2> & tria, double const y_fsi, double const y_wall)
+{
+  for(auto const & face : tria.active_face_iterators())
+  {
+    if(face->at_boundary())
+    {
+      if(std::abs(face->center()[0] - 0.0) < 1.e-10)
+        face->set_boundary_id(BOUNDARY_ID_INFLOW);
+      else if(std::abs(face->center()[0] - LENGTH) < 1.e-10)
+        face->set_boundary_id(BOUNDARY_ID_OUTFLOW);
+      else if(std::abs(face->center()[1] - y_fsi) < 1.e-10)
+        face->set_boundary_id(BOUNDARY_ID_FSI);
+      else if(std::abs(face->center()[1] - y_wall) < 1.e-10)
+        face->set_boundary_id(BOUNDARY_ID_WALLS);
+    }
+  }
+}
+
+/*
+ * Store the solution of the last call to do_postprocessing().
+ */
+template<int dim, typename Number>
+class FluidPostProcessor : public IncNS::PostProcessorBase<dim, Number>
+{
+  using VectorType = dealii::LinearAlgebra::distributed::Vector<Number>;
+
+public:
+  void
+  setup(IncNS::SpatialOperatorBase<dim, Number> const & pde_operator) final
+  {
+    (void)pde_operator;
+  }
+
+  void
+  do_postprocessing(VectorType const &     velocity_in,
+                    VectorType const &     pressure_in,
+                    double const           time,
+                    types::time_step const time_step_number) final
+  {
+    (void)time;
+    (void)time_step_number;
+
+    velocity = velocity_in;
+    pressure = pressure_in;
+  }
+
+  VectorType velocity;
+  VectorType pressure;
+};
+
+template<int dim, typename Number>
+class StructurePostProcessor : public Structure::PostProcessor<dim, Number>
+{
+  using VectorType = dealii::LinearAlgebra::distributed::Vector<Number>;
+
+public:
+  StructurePostProcessor(MPI_Comm const & comm)
+    : Structure::PostProcessor<dim, Number>(Structure::PostProcessorData<dim>(), comm)
+  {
+  }
+
+  void
+  do_postprocessing(VectorType const &     solution,
+                    double const           time,
+                    types::time_step const time_step_number) final
+  {
+    (void)time;
+    (void)time_step_number;
+
+    displacement = solution;
+  }
+
+  VectorType displacement;
+};
+
+template<int dim, typename Number>
+class FluidApplication : public FluidFSI::ApplicationBase<dim, Number>
+{
+public:
+  FluidApplication(std::string input_file, MPI_Comm const & comm, bool const restarted_simulation)
+    : FluidFSI::ApplicationBase<dim, Number>(input_file, comm),
+      restarted_simulation(restarted_simulation)
+  {
+  }
+
+  std::shared_ptr<FluidPostProcessor<dim, Number>> postprocessor;
+
+private:
+  void
+  set_parameters() final
+  {
+    using namespace IncNS;
+
+    Parameters & param = this->param;
+
+    // MATHEMATICAL MODEL
+    param.problem_type                   = ProblemType::Unsteady;
+    param.equation_type                  = EquationType::NavierStokes;
+    param.formulation_viscous_term       = FormulationViscousTerm::LaplaceFormulation;
+    param.formulation_convective_term    = FormulationConvectiveTerm::ConvectiveFormulation;
+    param.use_outflow_bc_convective_term = true;
+    param.right_hand_side                = false;
+
+    // ALE
+    param.ale_formulation                     = true;
+    param.mesh_movement_type                  = MeshMovementType::Poisson;
+    param.neumann_with_variable_normal_vector = false;
+
+    // PHYSICAL QUANTITIES
+    param.start_time = 0.0;
+    param.end_time   = END_TIME;
+    param.viscosity  = FLUID_VISCOSITY;
+    param.density    = FLUID_DENSITY;
+
+    // TEMPORAL DISCRETIZATION
+    param.solver_type                   = SolverType::Unsteady;
+    param.temporal_discretization       = TemporalDiscretization::BDFDualSplittingScheme;
+    param.treatment_of_convective_term  = TreatmentOfConvectiveTerm::Explicit;
+    param.order_time_integrator         = 2;
+    param.start_with_low_order          = true;
+    param.adaptive_time_stepping        = false;
+    param.calculation_of_time_step_size = TimeStepCalculation::UserSpecified;
+    param.time_step_size                = TIME_STEP_SIZE;
+    param.max_velocity                  = 1.0;
+    param.cfl                           = 0.4;
+
+    // RESTART
+    // The restart files of the structure and of the FSI coupling are written together with the
+    // restart file of the fluid. The restarted simulation does not write restart files in order to
+    // not overwrite the restart files it starts from.
+    param.restarted_simulation       = restarted_simulation;
+    param.restart_data.write_restart = not(restarted_simulation);
+    param.restart_data.interval_time = RESTART_INTERVAL_TIME;
+    param.restart_data.filename      = "restart_01_fluid";
+
+    // SPATIAL DISCRETIZATION
+    param.grid.triangulation_type     = TriangulationType::Distributed;
+    param.mapping_degree              = 1;
+    param.mapping_degree_coarse_grids = param.mapping_degree;
+    param.degree_p                    = DegreePressure::MixedOrder;
+
+    // convective term
+    param.upwind_factor = 1.0;
+
+    // viscous term
+    param.IP_formulation_viscous = InteriorPenaltyFormulation::SIPG;
+
+    // velocity pressure coupling terms
+    param.gradp_formulation = FormulationPressureGradientTerm::Weak;
+    param.divu_formulation  = FormulationVelocityDivergenceTerm::Weak;
+
+    // div-div and continuity penalty
+    param.use_divergence_penalty                     = true;
+    param.divergence_penalty_factor                  = 1.0e0;
+    param.use_continuity_penalty                     = true;
+    param.continuity_penalty_factor                  = param.divergence_penalty_factor;
+    param.continuity_penalty_components              = ContinuityPenaltyComponents::Normal;
+    param.continuity_penalty_use_boundary_data       = true;
+    param.apply_penalty_terms_in_postprocessing_step = true;
+
+    // pressure Poisson equation
+    param.solver_pressure_poisson         = SolverPressurePoisson::CG;
+    param.solver_data_pressure_poisson    = SolverData(1000, ABS_TOL, REL_TOL, 100);
+    param.preconditioner_pressure_poisson = PreconditionerPressurePoisson::PointJacobi;
+
+    // projection step
+    param.solver_projection         = SolverProjection::CG;
+    param.solver_data_projection    = SolverData(1000, ABS_TOL, REL_TOL);
+    param.preconditioner_projection = PreconditionerProjection::InverseMassMatrix;
+
+    // HIGH-ORDER DUAL SPLITTING SCHEME
+    param.order_extrapolation_pressure_nbc = param.order_time_integrator;
+    param.formulation_convective_term_bc   = FormulationConvectiveTerm::ConvectiveFormulation;
+
+    // viscous step
+    param.solver_momentum         = SolverMomentum::CG;
+    param.solver_data_momentum    = SolverData(1000, ABS_TOL, REL_TOL);
+    param.preconditioner_momentum = MomentumPreconditioner::InverseMassMatrix;
+  }
+
+  void
+  create_grid(Grid<dim> &                                       grid,
+              std::shared_ptr<dealii::Mapping<dim>> &           mapping,
+              std::shared_ptr<MultigridMappings<dim, Number>> & multigrid_mappings) final
+  {
+    auto const lambda_create_triangulation =
+      [&](dealii::Triangulation<dim, dim> & tria,
+          std::vector<dealii::GridTools::PeriodicFacePair<
+            typename dealii::Triangulation<dim>::cell_iterator>> & /*periodic_face_pairs*/,
+          unsigned int const global_refinements,
+          std::vector<unsigned int> const & /* vector_local_refinements*/) {
+        dealii::GridGenerator::subdivided_hyper_rectangle(tria,
+                                                          {N_CELLS_AXIAL, 2},
+                                                          dealii::Point<dim>(0.0, 0.0),
+                                                          dealii::Point<dim>(LENGTH, HEIGHT));
+
+        set_boundary_ids(tria, HEIGHT /* FSI */, 0.0 /* wall */);
+
+        tria.refine_global(global_refinements);
+      };
+
+    GridUtilities::create_triangulation_with_multigrid<dim>(grid,
+                                                            this->mpi_comm,
+                                                            this->param.grid,
+                                                            this->param.involves_h_multigrid(),
+                                                            lambda_create_triangulation,
+                                                            {} /* no local refinements */);
+
+    GridUtilities::create_mapping_with_multigrid(mapping,
+                                                 multigrid_mappings,
+                                                 this->param.grid.element_type,
+                                                 this->param.mapping_degree,
+                                                 this->param.mapping_degree_coarse_grids,
+                                                 this->param.involves_h_multigrid());
+  }
+
+  void
+  set_boundary_descriptor() final
+  {
+    std::shared_ptr<IncNS::BoundaryDescriptor<dim>> boundary_descriptor = this->boundary_descriptor;
+
+    typedef typename std::pair<dealii::types::boundary_id, std::shared_ptr<dealii::Function<dim>>>
+      pair;
+
+    // velocity
+    boundary_descriptor->velocity->neumann_bc.insert(
+      pair(BOUNDARY_ID_INFLOW, new dealii::Functions::ZeroFunction<dim>(dim)));
+    boundary_descriptor->velocity->dirichlet_bc.insert(
+      pair(BOUNDARY_ID_OUTFLOW, new dealii::Functions::ZeroFunction<dim>(dim)));
+    boundary_descriptor->velocity->dirichlet_bc.insert(
+      pair(BOUNDARY_ID_WALLS, new dealii::Functions::ZeroFunction<dim>(dim)));
+    boundary_descriptor->velocity->dirichlet_cached_bc.insert(BOUNDARY_ID_FSI);
+
+    // pressure
+    boundary_descriptor->pressure->dirichlet_bc.insert(
+      pair(BOUNDARY_ID_INFLOW, new PressureInflowBC<dim>()));
+    boundary_descriptor->pressure->neumann_bc.insert(BOUNDARY_ID_OUTFLOW);
+    boundary_descriptor->pressure->neumann_bc.insert(BOUNDARY_ID_WALLS);
+    boundary_descriptor->pressure->neumann_bc.insert(BOUNDARY_ID_FSI);
+  }
+
+  void
+  set_field_functions() final
+  {
+    std::shared_ptr<IncNS::FieldFunctions<dim>> field_functions = this->field_functions;
+
+    field_functions->initial_solution_velocity.reset(new dealii::Functions::ZeroFunction<dim>(dim));
+    field_functions->initial_solution_pressure.reset(new dealii::Functions::ZeroFunction<dim>(1));
+    field_functions->analytical_solution_pressure.reset(
+      new dealii::Functions::ZeroFunction<dim>(1));
+    field_functions->right_hand_side.reset(new dealii::Functions::ZeroFunction<dim>(dim));
+  }
+
+  std::shared_ptr<IncNS::PostProcessorBase<dim, Number>>
+  create_postprocessor() final
+  {
+    postprocessor = std::make_shared<FluidPostProcessor<dim, Number>>();
+
+    return postprocessor;
+  }
+
+  void
+  set_parameters_ale_poisson() final
+  {
+    using namespace Poisson;
+
+    Parameters & param = this->ale_poisson_param;
+
+    // MATHEMATICAL MODEL
+    param.right_hand_side = false;
+
+    // SPATIAL DISCRETIZATION
+    param.spatial_discretization = SpatialDiscretization::CG;
+    param.degree                 = this->param.mapping_degree;
+
+    // SOLVER
+    param.solver         = Poisson::LinearSolver::CG;
+    param.solver_data    = SolverData(1e4, ABS_TOL, REL_TOL, 100);
+    param.preconditioner = Preconditioner::PointJacobi;
+  }
+
+  void
+  set_boundary_descriptor_ale_poisson() final
+  {
+    std::shared_ptr<Poisson::BoundaryDescriptor<1, dim>> boundary_descriptor =
+      this->ale_poisson_boundary_descriptor;
+
+    typedef typename std::pair<dealii::types::boundary_id, std::shared_ptr<dealii::Function<dim>>>
+                                                                                  pair;
+    typedef typename std::pair<dealii::types::boundary_id, dealii::ComponentMask> pair_mask;
+
+    for(dealii::types::boundary_id const boundary_id :
+        {BOUNDARY_ID_INFLOW, BOUNDARY_ID_OUTFLOW, BOUNDARY_ID_WALLS})
+    {
+      boundary_descriptor->dirichlet_bc.insert(
+        pair(boundary_id, new dealii::Functions::ZeroFunction<dim>(dim)));
+      boundary_descriptor->dirichlet_bc_component_mask.insert(
+        pair_mask(boundary_id, dealii::ComponentMask()));
+    }
+
+    // fluid-structure interface
+    boundary_descriptor->dirichlet_cached_bc.insert(BOUNDARY_ID_FSI);
+  }
+
+  void
+  set_field_functions_ale_poisson() final
+  {
+    std::shared_ptr<Poisson::FieldFunctions<dim>> field_functions =
+      this->ale_poisson_field_functions;
+
+    field_functions->initial_solution.reset(new dealii::Functions::ZeroFunction<dim>(dim));
+    field_functions->right_hand_side.reset(new dealii::Functions::ZeroFunction<dim>(dim));
+  }
+
+  void
+  set_parameters_ale_elasticity() final
+  {
+  }
+
+  void
+  set_boundary_descriptor_ale_elasticity() final
+  {
+  }
+
+  void
+  set_material_descriptor_ale_elasticity() final
+  {
+  }
+
+  void
+  set_field_functions_ale_elasticity() final
+  {
+  }
+
+  bool const restarted_simulation;
+};
+
+template<int dim, typename Number>
+class StructureApplication : public StructureFSI::ApplicationBase<dim, Number>
+{
+public:
+  StructureApplication(std::string      input_file,
+                       MPI_Comm const & comm,
+                       bool const       restarted_simulation)
+    : StructureFSI::ApplicationBase<dim, Number>(input_file, comm),
+      restarted_simulation(restarted_simulation)
+  {
+  }
+
+  std::shared_ptr<StructurePostProcessor<dim, Number>> postprocessor;
+
+private:
+  void
+  set_parameters() final
+  {
+    using namespace Structure;
+
+    Parameters & param = this->param;
+
+    param.problem_type         = ProblemType::Unsteady;
+    param.body_force           = false;
+    param.pull_back_body_force = false;
+    param.large_deformation    = true;
+    param.pull_back_traction   = true;
+
+    param.density = DENSITY_STRUCTURE;
+
+    param.start_time      = 0.0;
+    param.end_time        = END_TIME;
+    param.time_step_size  = TIME_STEP_SIZE;
+    param.gen_alpha_type  = GenAlphaType::BossakAlpha;
+    param.spectral_radius = 0.8;
+
+    // restart files of the structure are written by the FSI driver
+    param.restarted_simulation       = restarted_simulation;
+    param.restart_data.write_restart = false;
+    param.restart_data.filename      = "restart_01_structure";
+
+    param.grid.triangulation_type     = TriangulationType::Distributed;
+    param.mapping_degree              = 1;
+    param.mapping_degree_coarse_grids = param.mapping_degree;
+
+    param.newton_solver_data = Newton::SolverData(1e2, ABS_TOL, REL_TOL);
+    param.solver             = Structure::Solver::FGMRES;
+    param.solver_data        = SolverData(1e4, ABS_TOL, REL_TOL, 100);
+    param.preconditioner     = Preconditioner::PointJacobi;
+
+    param.update_preconditioner                         = true;
+    param.update_preconditioner_every_time_steps        = 1;
+    param.update_preconditioner_every_newton_iterations = 1;
+  }
+
+  void
+  create_grid(Grid<dim> &                                       grid,
+              std::shared_ptr<dealii::Mapping<dim>> &           mapping,
+              std::shared_ptr<MultigridMappings<dim, Number>> & multigrid_mappings) final
+  {
+    auto const lambda_create_triangulation =
+      [&](dealii::Triangulation<dim, dim> & tria,
+          std::vector<dealii::GridTools::PeriodicFacePair<
+            typename dealii::Triangulation<dim>::cell_iterator>> & /*periodic_face_pairs*/,
+          unsigned int const global_refinements,
+          std::vector<unsigned int> const & /* vector_local_refinements*/) {
+        dealii::GridGenerator::subdivided_hyper_rectangle(tria,
+                                                          {N_CELLS_AXIAL, 1},
+                                                          dealii::Point<dim>(0.0, HEIGHT),
+                                                          dealii::Point<dim>(LENGTH,
+                                                                             HEIGHT + THICKNESS));
+
+        set_boundary_ids(tria, HEIGHT /* FSI */, HEIGHT + THICKNESS /* wall */);
+
+        tria.refine_global(global_refinements);
+      };
+
+    GridUtilities::create_triangulation_with_multigrid<dim>(grid,
+                                                            this->mpi_comm,
+                                                            this->param.grid,
+                                                            this->param.involves_h_multigrid(),
+                                                            lambda_create_triangulation,
+                                                            {} /* no local refinements */);
+
+    GridUtilities::create_mapping_with_multigrid(mapping,
+                                                 multigrid_mappings,
+                                                 this->param.grid.element_type,
+                                                 this->param.mapping_degree,
+                                                 this->param.mapping_degree_coarse_grids,
+                                                 this->param.involves_h_multigrid());
+  }
+
+  void
+  set_boundary_descriptor() final
+  {
+    std::shared_ptr<Structure::BoundaryDescriptor<dim>> boundary_descriptor =
+      this->boundary_descriptor;
+
+    typedef typename std::pair<dealii::types::boundary_id, std::shared_ptr<dealii::Function<dim>>>
+                                                                                  pair;
+    typedef typename std::pair<dealii::types::boundary_id, dealii::ComponentMask> pair_mask;
+
+    // the wall is clamped at both ends
+    for(dealii::types::boundary_id const boundary_id : {BOUNDARY_ID_INFLOW, BOUNDARY_ID_OUTFLOW})
+    {
+      boundary_descriptor->dirichlet_bc.insert(
+        pair(boundary_id, new dealii::Functions::ZeroFunction<dim>(dim)));
+      boundary_descriptor->dirichlet_bc_initial_acceleration.insert(
+        pair(boundary_id, new dealii::Functions::ZeroFunction<dim>(dim)));
+      boundary_descriptor->dirichlet_bc_component_mask.insert(
+        pair_mask(boundary_id, dealii::ComponentMask()));
+    }
+
+    // zero traction at the outer side of the wall
+    boundary_descriptor->neumann_bc.insert(
+      pair(BOUNDARY_ID_WALLS, new dealii::Functions::ZeroFunction<dim>(dim)));
+
+    // fluid-structure interface
+    boundary_descriptor->neumann_cached_bc.insert(BOUNDARY_ID_FSI);
+  }
+
+  void
+  set_material_descriptor() final
+  {
+    using namespace Structure;
+
+    typedef std::pair<dealii::types::material_id, std::shared_ptr<MaterialData>> Pair;
+
+    MaterialType const type         = MaterialType::StVenantKirchhoff;
+    Type2D const       two_dim_type = Type2D::PlaneStrain;
+
+    this->material_descriptor->insert(Pair(
+      0, new StVenantKirchhoffData<dim>(type, E_STRUCTURE, POISSON_RATIO_STRUCTURE, two_dim_type)));
+  }
+
+  void
+  set_field_functions() final
+  {
+    std::shared_ptr<Structure::FieldFunctions<dim>> field_functions = this->field_functions;
+
+    field_functions->right_hand_side.reset(new dealii::Functions::ZeroFunction<dim>(dim));
+    field_functions->initial_displacement.reset(new dealii::Functions::ZeroFunction<dim>(dim));
+    field_functions->initial_velocity.reset(new dealii::Functions::ZeroFunction<dim>(dim));
+  }
+
+  std::shared_ptr<Structure::PostProcessor<dim, Number>>
+  create_postprocessor() final
+  {
+    postprocessor = std::make_shared<StructurePostProcessor<dim, Number>>(this->mpi_comm);
+
+    return postprocessor;
+  }
+
+  bool const restarted_simulation;
+};
+
+template<int dim, typename Number>
+class Application : public FSI::ApplicationBase<dim, Number>
+{
+public:
+  Application(std::string input_file, MPI_Comm const & comm, bool const restarted_simulation)
+  {
+    fluid_application =
+      std::make_shared<FluidApplication<dim, Number>>(input_file, comm, restarted_simulation);
+    structure_application =
+      std::make_shared<StructureApplication<dim, Number>>(input_file, comm, restarted_simulation);
+
+    this->fluid     = fluid_application;
+    this->structure = structure_application;
+  }
+
+  std::shared_ptr<FluidApplication<dim, Number>>     fluid_application;
+  std::shared_ptr<StructureApplication<dim, Number>> structure_application;
+};
+
+template<int dim, typename Number>
+std::shared_ptr<Application<dim, Number>>
+run(std::string const & input_file, bool const restarted_simulation)
+{
+  std::shared_ptr<Application<dim, Number>> application =
+    std::make_shared<Application<dim, Number>>(input_file, MPI_COMM_WORLD, restarted_simulation);
+
+  // the output of the solver is not part of the test
+  std::stringstream log;
+  std::streambuf *  buffer = std::cout.rdbuf(log.rdbuf());
+
+  FSI::Driver<dim, Number> driver(input_file, MPI_COMM_WORLD, application, true);
+  driver.setup();
+  driver.solve();
+
+  std::cout.rdbuf(buffer);
+
+  return application;
+}
+
+template<typename VectorType>
+bool
+same_vectors(VectorType const & reference, VectorType const & other)
+{
+  VectorType difference = other;
+  difference.add(-1.0, reference);
+
+  return difference.l2_norm() <= 1.e-10 * reference.l2_norm();
+}
+
+int
+main(int argc, char ** argv)
+{
+  try
+  {
+    dealii::Utilities::MPI::MPI_InitFinalize mpi(argc, argv, 1);
+
+    dealii::ConditionalOStream pcout(std::cout,
+                                     dealii::Utilities::MPI::this_mpi_process(MPI_COMM_WORLD) ==
+                                       0);
+
+    // parameters of the partitioned solver and the spatial resolution are read from file
+    std::string const input_file = "restart_01.json";
+    if(dealii::Utilities::MPI::this_mpi_process(MPI_COMM_WORLD) == 0)
+    {
+      std::ofstream file(input_file);
+      file << "{" << std::endl
+           << "  \"SpatialResolutionFluid\": {\"Degree\": \"2\", \"RefineSpace\": \"0\"},"
+           << std::endl
+           << "  \"SpatialResolutionStructure\": {\"Degree\": \"2\", \"RefineSpace\": \"0\"},"
+           << std::endl
+           << "  \"FSI\": {" << std::endl
+           << "    \"AccelerationMethod\": \"IQN_ILS\"," << std::endl
+           << "    \"AbsTol\": \"1.e-14\"," << std::endl
+           << "    \"RelTol\": \"1.e-8\"," << std::endl
+           << "    \"OmegaInit\": \"0.3\"," << std::endl
+           << "    \"PartitionedIterMax\": \"100\"," << std::endl
+           << "    \"ReusedTimeSteps\": \"2\"," << std::endl
+           << "    \"GeometricTolerance\": \"1.e-8\"" << std::endl
+           << "  }" << std::endl
+           << "}" << std::endl;
+    }
+    MPI_Barrier(MPI_COMM_WORLD);
+
+    // N time steps in one go, writing restart files after about N/2 time steps
+    auto const reference = run<2, double>(input_file, false);
+
+    std::vector<std::string> const files = {restart_filename("restart_01_fluid", MPI_COMM_WORLD),
+                                            restart_filename("restart_01_structure",
+                                                             MPI_COMM_WORLD),
+                                            restart_filename("restart_01_fluid_fsi",
+                                                             MPI_COMM_WORLD)};
+
+    bool restart_files_written = true;
+    for(auto const & file : files)
+      restart_files_written =
+        restart_files_written and std::ifstream(file, std::ios::binary).good();
+    restart_files_written =
+      dealii::Utilities::MPI::min(restart_files_written ? 1 : 0, MPI_COMM_WORLD) == 1;
+
+    // the remaining time steps starting from the restart files
+    auto const restarted = run<2, double>(input_file, true);
+
+    pcout << "Restart files written (fluid, structure, FSI): "
+          << (restart_files_written ? "yes" : "no") << std::endl
+          << "Same fluid velocity after restart:             "
+          << (same_vectors(reference->fluid_application->postprocessor->velocity,
+                           restarted->fluid_application->postprocessor->velocity) ?
+                "yes" :
+                "no")
+          << std::endl
+          << "Same fluid pressure after restart:             "
+          << (same_vectors(reference->fluid_application->postprocessor->pressure,
+                           restarted->fluid_application->postprocessor->pressure) ?
+                "yes" :
+                "no")
+          << std::endl
+          << "Same structure displacement after restart:     "
+          << (same_vectors(reference->structure_application->postprocessor->displacement,
+                           restarted->structure_application->postprocessor->displacement) ?
+                "yes" :
+                "no")
+          << std::endl;
+
+    MPI_Barrier(MPI_COMM_WORLD);
+    for(auto const & file : files)
+    {
+      std::remove(file.c_str());
+      std::remove((file + ".old").c_str());
+    }
+    if(dealii::Utilities::MPI::this_mpi_process(MPI_COMM_WORLD) == 0)
+      std::remove(input_file.c_str());
+  }
+  catch(std::exception & exc)
+  {
+    std::cerr << std::endl
+              << std::endl
+              << "----------------------------------------------------" << std::endl;
+    std::cerr << "Exception on processing: " << std::endl
+              << exc.what() << std::endl
+              << "Aborting!" << std::endl
+              << "----------------------------------------------------" << std::endl;
+    return 1;
+  }
+
+  return 0;
+}
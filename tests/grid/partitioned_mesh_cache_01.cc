@@ -0,0 +1,195 @@
+/*  ______________________________________________________________________
+ *
+ *  ExaDG - High-Order Discontinuous Galerkin for the Exa-Scale
+ *
+ *  Copyright (C) 2021 by the ExaDG authors
+ *
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation, either version 3 of the License, or
+ *  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ *  ______________________________________________________________________
+ */
+
+
+// C++
+#include <algorithm>
+#include <filesystem>
+#include <iostream>
+#include <sstream>
+#include <string>
+#include <vector>
+
+// deal.II
+#include <deal.II/base/conditional_ostream.h>
+#include <deal.II/base/mpi.h>
+#include <deal.II/grid/cell_id.h>
+#include <deal.II/grid/grid_generator.h>
+
+// ExaDG
+#include <exadg/grid/grid_utilities.h>
+
+// Write/read round trip of the partitioned mesh cache: A fully-distributed triangulation read from
+// the cache has to consist of the same cells (identified by their CellId) on every process as the
+// triangulation created from scratch. Modifying the coarse mesh must not read the stale cache.
+
+using namespace ExaDG;
+
+std::string const cache_directory = "partitioned_mesh_cache_01_cache";
+
+struct Result
+{
+  std::shared_ptr<dealii::Triangulation<2>> triangulation;
+
+  bool read_from_cache;
+};
+
+Result
+create_fully_distributed_triangulation(unsigned int const n_subdivisions, bool const use_cache)
+{
+  unsigned int const dim = 2;
+
+  GridData data;
+  data.triangulation_type     = TriangulationType::FullyDistributed;
+  data.element_type           = ElementType::Hypercube;
+  data.partitioning_type      = PartitioningType::z_order;
+  data.n_refine_global        = 2;
+  data.partitioned_mesh_cache = use_cache ? cache_directory : std::string();
+
+  auto const lambda_create_triangulation =
+    [&](dealii::Triangulation<dim, dim> &       tria,
+        GridUtilities::PeriodicFacePairs<dim> & periodic_face_pairs,
+        unsigned int const                      global_refinements,
+        std::vector<unsigned int> const &       vector_local_refinements) {
+      (void)periodic_face_pairs;
+      (void)vector_local_refinements;
+
+      dealii::GridGenerator::subdivided_hyper_cube(tria, n_subdivisions, 0.0, 1.0, true);
+      tria.refine_global(global_refinements);
+    };
+
+  Result result;
+
+  GridUtilities::PeriodicFacePairs<dim> periodic_face_pairs;
+
+  // the output of the cache contains wall times and is only used to detect whether the cache was
+  // read
+  std::ostringstream log;
+  std::streambuf *   cout_buffer = std::cout.rdbuf(log.rdbuf());
+
+  GridUtilities::create_triangulation<dim>(result.triangulation,
+                                           periodic_face_pairs,
+                                           MPI_COMM_WORLD,
+                                           data,
+                                           false /* construct_multigrid_hierarchy */,
+                                           lambda_create_triangulation,
+                                           data.n_refine_global,
+                                           {} /* vector_local_refinements */,
+                                           nullptr /* fully_distributed_refinement */);
+
+  std::cout.rdbuf(cout_buffer);
+
+  result.read_from_cache = log.str().find("Wall time read partitioned mesh") != std::string::npos;
+
+  return result;
+}
+
+std::vector<dealii::CellId>
+get_locally_owned_cell_ids(dealii::Triangulation<2> const & tria)
+{
+  std::vector<dealii::CellId> cell_ids;
+  for(auto const & cell : tria.active_cell_iterators())
+    if(cell->is_locally_owned())
+      cell_ids.push_back(cell->id());
+
+  std::sort(cell_ids.begin(), cell_ids.end());
+
+  return cell_ids;
+}
+
+unsigned int
+get_n_cache_directories()
+{
+  unsigned int n_directories = 0;
+  if(dealii::Utilities::MPI::this_mpi_process(MPI_COMM_WORLD) == 0)
+  {
+    for(auto const & entry : std::filesystem::directory_iterator(cache_directory))
+      if(entry.is_directory())
+        ++n_directories;
+  }
+
+  return dealii::Utilities::MPI::broadcast(MPI_COMM_WORLD, n_directories, 0);
+}
+
+void
+test()
+{
+  dealii::ConditionalOStream pcout(std::cout,
+                                   dealii::Utilities::MPI::this_mpi_process(MPI_COMM_WORLD) == 0);
+
+  if(dealii::Utilities::MPI::this_mpi_process(MPI_COMM_WORLD) == 0)
+    std::filesystem::remove_all(cache_directory);
+  MPI_Barrier(MPI_COMM_WORLD);
+
+  Result const fresh   = create_fully_distributed_triangulation(2, false);
+  Result const written = create_fully_distributed_triangulation(2, true);
+  Result const cached  = create_fully_distributed_triangulation(2, true);
+
+  pcout << "Coarse mesh with 2x2 cells:" << std::endl;
+  pcout << "  read from cache (first run):  " << (written.read_from_cache ? "yes" : "no")
+        << std::endl;
+  pcout << "  read from cache (second run): " << (cached.read_from_cache ? "yes" : "no")
+        << std::endl;
+  pcout << "  number of cache directories:  " << get_n_cache_directories() << std::endl;
+  pcout << "  number of cells (created, cached): " << fresh.triangulation->n_global_active_cells()
+        << ", " << cached.triangulation->n_global_active_cells() << std::endl;
+
+  bool const same_cells = get_locally_owned_cell_ids(*fresh.triangulation) ==
+                          get_locally_owned_cell_ids(*cached.triangulation);
+  pcout << "  same locally owned cells on all processes: "
+        << (dealii::Utilities::MPI::min(same_cells ? 1u : 0u, MPI_COMM_WORLD) == 1u ? "yes" : "no")
+        << std::endl;
+
+  Result const modified = create_fully_distributed_triangulation(3, true);
+
+  pcout << "Coarse mesh with 3x3 cells:" << std::endl;
+  pcout << "  read from cache: " << (modified.read_from_cache ? "yes" : "no") << std::endl;
+  pcout << "  number of cache directories: " << get_n_cache_directories() << std::endl;
+  pcout << "  number of cells: " << modified.triangulation->n_global_active_cells() << std::endl;
+
+  MPI_Barrier(MPI_COMM_WORLD);
+  if(dealii::Utilities::MPI::this_mpi_process(MPI_COMM_WORLD) == 0)
+    std::filesystem::remove_all(cache_directory);
+}
+
+int
+main(int argc, char ** argv)
+{
+  try
+  {
+    dealii::Utilities::MPI::MPI_InitFinalize mpi(argc, argv, 1);
+
+    test();
+  }
+  catch(std::exception & exc)
+  {
+    std::cerr << std::endl
+              << std::endl
+              << "----------------------------------------------------" << std::endl;
+    std::cerr << "Exception on processing: " << std::endl
+              << exc.what() << std::endl
+              << "Aborting!" << std::endl
+              << "----------------------------------------------------" << std::endl;
+    return 1;
+  }
+
+  return 0;
+}
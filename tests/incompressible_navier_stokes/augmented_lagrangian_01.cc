@@ -0,0 +1,270 @@
+/*  ______________________________________________________________________
+ *
+ *  ExaDG - High-Order Discontinuous Galerkin for the Exa-Scale
+ *
+ *  Copyright (C) 2021 by the ExaDG authors
+ *
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation, either version 3 of the License, or
+ *  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ *  ______________________________________________________________________
+ */
+
+
+// C++
+#include <algorithm>
+#include <cmath>
+#include <iostream>
+#include <sstream>
+
+// deal.II
+#include <deal.II/base/function.h>
+#include <deal.II/grid/grid_generator.h>
+
+// ExaDG
+#include <exadg/incompressible_navier_stokes/spatial_discretization/operator_coupled.h>
+#include <exadg/incompressible_navier_stokes/user_interface/application_base.h>
+
+// Steady Stokes flow in a unit square with no-slip boundaries: The linear system of the coupled
+// solver is augmented by a grad-div term with penalty parameter gamma and solved with the
+// augmented Lagrangian preconditioner, using an exact inversion of the augmented velocity block
+// and the Schur-complement approximation -S^{-1} = (nu + gamma) M_p^{-1}. The number of outer
+// FGMRES iterations has to be (almost) independent of the viscosity and the mesh size.
+
+using namespace ExaDG;
+
+double const GAMMA = 10.0;
+
+template<int dim, typename Number>
+class Application : public IncNS::ApplicationBase<dim, Number>
+{
+public:
+  Application(MPI_Comm const & comm, double const viscosity, unsigned int const n_refine_global)
+    : IncNS::ApplicationBase<dim, Number>("", comm),
+      viscosity(viscosity),
+      n_refine_global(n_refine_global)
+  {
+  }
+
+private:
+  void
+  parse_parameters() final
+  {
+  }
+
+  void
+  set_parameters() final
+  {
+    using namespace IncNS;
+
+    // MATHEMATICAL MODEL
+    this->param.problem_type             = ProblemType::Steady;
+    this->param.equation_type            = EquationType::Stokes;
+    this->param.formulation_viscous_term = FormulationViscousTerm::LaplaceFormulation;
+    this->param.right_hand_side          = false;
+
+    // PHYSICAL QUANTITIES
+    this->param.start_time = 0.0;
+    this->param.end_time   = 1.0;
+    this->param.viscosity  = viscosity;
+
+    // TEMPORAL DISCRETIZATION
+    this->param.solver_type             = SolverType::Steady;
+    this->param.temporal_discretization = TemporalDiscretization::BDFCoupledSolution;
+
+    // SPATIAL DISCRETIZATION
+    this->param.grid.triangulation_type     = TriangulationType::Distributed;
+    this->param.grid.n_refine_global        = n_refine_global;
+    this->param.degree_u                    = 2;
+    this->param.degree_p                    = DegreePressure::MixedOrder;
+    this->param.mapping_degree              = 1;
+    this->param.mapping_degree_coarse_grids = 1;
+
+    this->param.IP_formulation_viscous = InteriorPenaltyFormulation::SIPG;
+
+    // COUPLED NAVIER-STOKES SOLVER
+    this->param.solver_coupled      = SolverCoupled::FGMRES;
+    this->param.solver_data_coupled = SolverData(1000, 1.e-14, 1.e-8, 200);
+
+    this->param.preconditioner_coupled      = PreconditionerCoupled::AugmentedLagrangian;
+    this->param.augmented_lagrangian_factor = GAMMA;
+
+    // the velocity block is inverted accurately, so that the outer iteration counts only reflect
+    // the quality of the Schur-complement approximation
+    this->param.preconditioner_velocity_block          = MomentumPreconditioner::Multigrid;
+    this->param.multigrid_operator_type_velocity_block = MultigridOperatorType::ReactionDiffusion;
+    // the element-wise grad-div term is treated exactly by the block-Jacobi smoother
+    this->param.multigrid_data_velocity_block.smoother_data.smoother = MultigridSmoother::Jacobi;
+    this->param.multigrid_data_velocity_block.smoother_data.preconditioner =
+      PreconditionerSmoother::BlockJacobi;
+    this->param.multigrid_data_velocity_block.smoother_data.iterations        = 5;
+    this->param.multigrid_data_velocity_block.smoother_data.relaxation_factor = 0.7;
+    this->param.exact_inversion_of_velocity_block      = true;
+    this->param.solver_data_velocity_block             = SolverData(10000, 1.e-14, 1.e-10, 200);
+
+    this->param.preconditioner_pressure_block = SchurComplementPreconditioner::InverseMassMatrix;
+  }
+
+  void
+  create_grid(Grid<dim> &                                       grid,
+              std::shared_ptr<dealii::Mapping<dim>> &           mapping,
+              std::shared_ptr<MultigridMappings<dim, Number>> & multigrid_mappings) final
+  {
+    auto const lambda_create_triangulation =
+      [&](dealii::Triangulation<dim, dim> &                        tria,
+          std::vector<dealii::GridTools::PeriodicFacePair<
+            typename dealii::Triangulation<dim>::cell_iterator>> & periodic_face_pairs,
+          unsigned int const                                       global_refinements,
+          std::vector<unsigned int> const &                        vector_local_refinements) {
+        (void)periodic_face_pairs;
+        (void)vector_local_refinements;
+
+        dealii::GridGenerator::hyper_cube(tria, 0.0, 1.0);
+
+        tria.refine_global(global_refinements);
+      };
+
+    GridUtilities::create_triangulation_with_multigrid<dim>(grid,
+                                                            this->mpi_comm,
+                                                            this->param.grid,
+                                                            this->param.involves_h_multigrid(),
+                                                            lambda_create_triangulation,
+                                                            {} /* no local refinements */);
+
+    GridUtilities::create_mapping_with_multigrid(mapping,
+                                                 multigrid_mappings,
+                                                 this->param.grid.element_type,
+                                                 this->param.mapping_degree,
+                                                 this->param.mapping_degree_coarse_grids,
+                                                 this->param.involves_h_multigrid());
+  }
+
+  void
+  set_boundary_descriptor() final
+  {
+    this->boundary_descriptor->velocity->dirichlet_bc.insert(
+      std::make_pair(0, std::make_shared<dealii::Functions::ZeroFunction<dim>>(dim)));
+
+    this->boundary_descriptor->pressure->neumann_bc.insert(0);
+  }
+
+  void
+  set_field_functions() final
+  {
+    this->field_functions->initial_solution_velocity =
+      std::make_shared<dealii::Functions::ZeroFunction<dim>>(dim);
+    this->field_functions->initial_solution_pressure =
+      std::make_shared<dealii::Functions::ZeroFunction<dim>>(1);
+    this->field_functions->analytical_solution_pressure =
+      std::make_shared<dealii::Functions::ZeroFunction<dim>>(1);
+    this->field_functions->right_hand_side =
+      std::make_shared<dealii::Functions::ZeroFunction<dim>>(dim);
+  }
+
+  std::shared_ptr<IncNS::PostProcessorBase<dim, Number>>
+  create_postprocessor() final
+  {
+    return std::make_shared<IncNS::PostProcessor<dim, Number>>(IncNS::PostProcessorData<dim>(),
+                                                               this->mpi_comm);
+  }
+
+  double const       viscosity;
+  unsigned int const n_refine_global;
+};
+
+/*
+ * Returns the number of FGMRES iterations needed to solve the linear system with a right-hand side
+ * obtained by applying the augmented saddle-point operator to a given solution.
+ */
+template<int dim, typename Number>
+unsigned int
+run(double const viscosity, unsigned int const n_refine_global)
+{
+  std::shared_ptr<Application<dim, Number>> application =
+    std::make_shared<Application<dim, Number>>(MPI_COMM_WORLD, viscosity, n_refine_global);
+
+  // the output of the setup is not part of the test
+  std::stringstream log;
+  std::streambuf *  buffer = std::cout.rdbuf(log.rdbuf());
+
+  std::shared_ptr<Grid<dim>>                      grid;
+  std::shared_ptr<dealii::Mapping<dim>>           mapping;
+  std::shared_ptr<MultigridMappings<dim, Number>> multigrid_mappings;
+  application->setup(grid, mapping, multigrid_mappings);
+
+  IncNS::OperatorCoupled<dim, Number> pde_operator(grid,
+                                                   mapping,
+                                                   multigrid_mappings,
+                                                   application->get_boundary_descriptor(),
+                                                   application->get_field_functions(),
+                                                   application->get_parameters(),
+                                                   "fluid",
+                                                   MPI_COMM_WORLD);
+  pde_operator.setup(true);
+
+  dealii::LinearAlgebra::distributed::BlockVector<Number> solution, rhs;
+  pde_operator.initialize_block_vector_velocity_pressure(solution);
+  pde_operator.initialize_block_vector_velocity_pressure(rhs);
+
+  for(unsigned int block = 0; block < 2; ++block)
+    for(unsigned int i = 0; i < solution.block(block).locally_owned_size(); ++i)
+      solution.block(block).local_element(i) = std::sin(1.0 + 3.0 * (i + block));
+
+  pde_operator.apply_linearized_problem(rhs, solution);
+
+  solution = 0.0;
+  unsigned int const n_iterations = pde_operator.solve_linear_stokes_problem(solution, rhs, true);
+
+  std::cout.rdbuf(buffer);
+
+  return n_iterations;
+}
+
+void
+test()
+{
+  std::vector<unsigned int> n_iterations;
+  for(double const viscosity : {1.0, 1.0e-3})
+    for(unsigned int const n_refine_global : {2, 3})
+      n_iterations.push_back(run<2, double>(viscosity, n_refine_global));
+
+  unsigned int const min = *std::min_element(n_iterations.begin(), n_iterations.end());
+  unsigned int const max = *std::max_element(n_iterations.begin(), n_iterations.end());
+
+  std::cout << "Iteration counts are small: " << (max <= 20 ? "yes" : "no") << std::endl;
+  std::cout << "Iteration counts are independent of viscosity and mesh size: "
+            << (max <= min + 5 ? "yes" : "no") << std::endl;
+}
+
+int
+main(int argc, char ** argv)
+{
+  try
+  {
+    dealii::Utilities::MPI::MPI_InitFinalize mpi(argc, argv, 1);
+
+    test();
+  }
+  catch(std::exception & exc)
+  {
+    std::cerr << std::endl
+              << std::endl
+              << "----------------------------------------------------" << std::endl;
+    std::cerr << "Exception on processing: " << std::endl
+              << exc.what() << std::endl
+              << "Aborting!" << std::endl
+              << "----------------------------------------------------" << std::endl;
+    return 1;
+  }
+
+  return 0;
+}
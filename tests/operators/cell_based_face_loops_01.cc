@@ -0,0 +1,149 @@
+/*  ______________________________________________________________________
+ *
+ *  ExaDG - High-Order Discontinuous Galerkin for the Exa-Scale
+ *
+ *  Copyright (C) 2021 by the ExaDG authors
+ *
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation, either version 3 of the License, or
+ *  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ *  ______________________________________________________________________
+ */
+
+// C++
+#include <iostream>
+
+// deal.II
+#include <deal.II/base/function.h>
+#include <deal.II/base/quadrature_lib.h>
+#include <deal.II/dofs/dof_handler.h>
+#include <deal.II/fe/fe_dgq.h>
+#include <deal.II/fe/mapping_q.h>
+#include <deal.II/grid/grid_generator.h>
+#include <deal.II/grid/tria.h>
+#include <deal.II/lac/affine_constraints.h>
+#include <deal.II/matrix_free/matrix_free.h>
+
+// ExaDG
+#include <exadg/matrix_free/categorization.h>
+#include <exadg/poisson/spatial_discretization/laplace_operator.h>
+
+// Check that cell-based and face-based loops compute the same diagonal of the interior penalty
+// Laplace operator on the levels of a locally refined mesh, and that cell-based face loops are
+// rejected for the active cells of a mesh with hanging nodes.
+
+using namespace ExaDG;
+
+template<int dim>
+dealii::LinearAlgebra::distributed::Vector<double>
+compute_diagonal(dealii::DoFHandler<dim> const &                              dof_handler,
+                 dealii::Mapping<dim> const &                                 mapping,
+                 std::shared_ptr<Poisson::BoundaryDescriptor<0, dim>> const & bc,
+                 unsigned int const                                           level,
+                 bool const                                                   cell_based)
+{
+  typename dealii::MatrixFree<dim, double>::AdditionalData data;
+  data.mg_level = level;
+
+  MappingFlags const flags = Operators::LaplaceKernel<dim, double>::get_mapping_flags(true, true);
+  data.mapping_update_flags                = flags.cells;
+  data.mapping_update_flags_inner_faces    = flags.inner_faces;
+  data.mapping_update_flags_boundary_faces = flags.boundary_faces;
+
+  if(cell_based)
+    Categorization::do_cell_based_loops(dof_handler.get_triangulation(), data, level);
+
+  dealii::AffineConstraints<double> constraints;
+  constraints.close();
+
+  dealii::MatrixFree<dim, double> matrix_free;
+  matrix_free.reinit(
+    mapping, dof_handler, constraints, dealii::QGauss<1>(dof_handler.get_fe().degree + 1), data);
+
+  Poisson::LaplaceOperatorData<0, dim> operator_data;
+  operator_data.bc                   = bc;
+  operator_data.use_cell_based_loops = cell_based;
+
+  Poisson::LaplaceOperator<dim, double, 1> laplace_operator;
+  laplace_operator.initialize(matrix_free, constraints, operator_data);
+
+  dealii::LinearAlgebra::distributed::Vector<double> diagonal;
+  laplace_operator.calculate_diagonal(diagonal);
+
+  return diagonal;
+}
+
+template<int dim>
+void
+test(unsigned int const degree)
+{
+  std::cout << "Test dim = " << dim << ", degree = " << degree << ":" << std::endl;
+
+  dealii::Triangulation<dim> tria(dealii::Triangulation<dim>::limit_level_difference_at_vertices);
+  dealii::GridGenerator::hyper_cube(tria, 0.0, 1.0);
+  tria.refine_global(2);
+  tria.begin_active()->set_refine_flag();
+  tria.execute_coarsening_and_refinement();
+
+  dealii::FE_DGQ<dim>     fe(degree);
+  dealii::DoFHandler<dim> dof_handler(tria);
+  dof_handler.distribute_dofs(fe);
+  dof_handler.distribute_mg_dofs();
+
+  dealii::MappingQ<dim> mapping(1);
+
+  std::shared_ptr<Poisson::BoundaryDescriptor<0, dim>> bc =
+    std::make_shared<Poisson::BoundaryDescriptor<0, dim>>();
+  bc->dirichlet_bc.insert(
+    std::make_pair(0, std::make_shared<dealii::Functions::ZeroFunction<dim>>(1)));
+
+  for(unsigned int level = 0; level < tria.n_global_levels(); ++level)
+  {
+    dealii::LinearAlgebra::distributed::Vector<double> diagonal_face_based =
+      compute_diagonal<dim>(dof_handler, mapping, bc, level, false);
+    dealii::LinearAlgebra::distributed::Vector<double> const diagonal_cell_based =
+      compute_diagonal<dim>(dof_handler, mapping, bc, level, true);
+
+    double const norm = diagonal_face_based.linfty_norm();
+    diagonal_face_based -= diagonal_cell_based;
+
+    std::cout << "  Level " << level << " (" << tria.n_cells(level)
+              << " cells): cell-based and face-based diagonals agree: "
+              << (diagonal_face_based.linfty_norm() < 1.e-12 * norm ? "yes" : "no") << std::endl;
+  }
+
+  // active cells of a locally refined mesh
+  typename dealii::MatrixFree<dim, double>::AdditionalData data;
+  try
+  {
+    Categorization::do_cell_based_loops(tria, data);
+    std::cout << "  Active cells: cell-based face loops accepted" << std::endl;
+  }
+  catch(std::exception const &)
+  {
+    std::cout << "  Active cells: cell-based face loops rejected" << std::endl;
+  }
+
+  std::cout << std::endl;
+}
+
+int
+main(int argc, char ** argv)
+{
+  dealii::Utilities::MPI::MPI_InitFinalize mpi(argc, argv, 1);
+
+  test<2>(1);
+  test<2>(3);
+  test<3>(2);
+
+  return 0;
+}
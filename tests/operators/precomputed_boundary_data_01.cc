@@ -0,0 +1,256 @@
+/*  ______________________________________________________________________
+ *
+ *  ExaDG - High-Order Discontinuous Galerkin for the Exa-Scale
+ *
+ *  Copyright (C) 2021 by the ExaDG authors
+ *
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation, either version 3 of the License, or
+ *  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ *  ______________________________________________________________________
+ */
+
+
+// C++
+#include <cmath>
+#include <iostream>
+#include <string>
+
+// deal.II
+#include <deal.II/base/function.h>
+#include <deal.II/base/quadrature_lib.h>
+#include <deal.II/dofs/dof_handler.h>
+#include <deal.II/fe/fe_dgq.h>
+#include <deal.II/fe/mapping_q.h>
+#include <deal.II/grid/grid_generator.h>
+#include <deal.II/grid/tria.h>
+#include <deal.II/lac/affine_constraints.h>
+#include <deal.II/matrix_free/matrix_free.h>
+
+// ExaDG
+#include <exadg/functions_and_boundary_conditions/precomputed_boundary_data.h>
+#include <exadg/functions_and_boundary_conditions/separable_function.h>
+#include <exadg/matrix_free/categorization.h>
+#include <exadg/matrix_free/integrators.h>
+#include <exadg/poisson/user_interface/boundary_descriptor.h>
+
+// Boundary functions in precomputed_bc are tabulated in the boundary quadrature points. Check that
+// evaluate_boundary_function() gives the same values as a direct evaluation of the function, for a
+// time-independent and a separable function, both in face loops (which use the tabulated data) and
+// in cell-based face loops (which evaluate the function directly). Time-dependent functions that
+// are not separable have to be rejected at setup.
+
+using namespace ExaDG;
+
+template<int dim>
+class SpatialFunction : public dealii::Function<dim>
+{
+public:
+  SpatialFunction() : dealii::Function<dim>(1, 0.0)
+  {
+  }
+
+  double
+  value(dealii::Point<dim> const & p, unsigned int const component = 0) const final
+  {
+    (void)component;
+
+    return std::sin(3.0 * p[0]) + p[1] * p[1];
+  }
+};
+
+template<int dim>
+class TimeDependentFunction : public dealii::Function<dim>
+{
+public:
+  TimeDependentFunction() : dealii::Function<dim>(1, 0.0)
+  {
+  }
+
+  double
+  value(dealii::Point<dim> const & p, unsigned int const component = 0) const final
+  {
+    (void)component;
+
+    return std::sin(3.0 * p[0] + this->get_time());
+  }
+};
+
+/*
+ * Returns the maximum difference between evaluate_boundary_function() and a direct evaluation of
+ * the function over all boundary quadrature points, either in a face loop or in a cell-based face
+ * loop.
+ */
+template<int dim>
+double
+compare_with_direct_evaluation(dealii::MatrixFree<dim, double> const &         matrix_free,
+                               Poisson::BoundaryDescriptor<0, dim> const &     bc,
+                               std::shared_ptr<dealii::Function<dim>> const & function,
+                               double const                                   time,
+                               bool const                                     cell_based)
+{
+  typedef dealii::VectorizedArray<double> scalar;
+
+  FaceIntegrator<dim, 1, double> integrator(matrix_free, true, 0, 0);
+
+  double difference = 0.0;
+
+  auto const compare = [&](dealii::types::boundary_id const boundary_id) {
+    for(unsigned int q = 0; q < integrator.n_q_points; ++q)
+    {
+      scalar const value = evaluate_boundary_function<0, dim, double>(
+        *function, bc, boundary_id, integrator, q, time);
+      scalar const reference = FunctionEvaluator<0, dim, double>::value(
+        *function, integrator.quadrature_point(q), time);
+
+      for(unsigned int v = 0; v < scalar::size(); ++v)
+        difference = std::max(difference, std::abs(value[v] - reference[v]));
+    }
+  };
+
+  if(cell_based)
+  {
+    for(unsigned int cell = 0; cell < matrix_free.n_cell_batches(); ++cell)
+    {
+      for(unsigned int face = 0; face < dealii::GeometryInfo<dim>::faces_per_cell; ++face)
+      {
+        // the cell categories ensure that all lanes of a batch have the same boundary IDs
+        dealii::types::boundary_id const boundary_id =
+          matrix_free.get_faces_by_cells_boundary_id(cell, face)[0];
+        if(boundary_id == dealii::numbers::internal_face_boundary_id)
+          continue;
+
+        integrator.reinit(cell, face);
+        compare(boundary_id);
+      }
+    }
+  }
+  else
+  {
+    unsigned int const begin = matrix_free.n_inner_face_batches();
+    for(unsigned int face = begin; face < begin + matrix_free.n_boundary_face_batches(); ++face)
+    {
+      integrator.reinit(face);
+      compare(matrix_free.get_boundary_id(face));
+    }
+  }
+
+  return difference;
+}
+
+template<int dim>
+void
+test()
+{
+  std::cout << "Test dim = " << dim << ":" << std::endl;
+
+  dealii::Triangulation<dim> tria;
+  dealii::GridGenerator::hyper_cube(tria, 0.0, 1.0);
+  tria.refine_global(2);
+
+  dealii::FE_DGQ<dim>     fe(2);
+  dealii::DoFHandler<dim> dof_handler(tria);
+  dof_handler.distribute_dofs(fe);
+
+  dealii::MappingQ<dim> mapping(1);
+
+  typename dealii::MatrixFree<dim, double>::AdditionalData data;
+  data.mapping_update_flags = dealii::update_quadrature_points | dealii::update_JxW_values;
+  data.mapping_update_flags_inner_faces =
+    dealii::update_quadrature_points | dealii::update_JxW_values;
+  data.mapping_update_flags_boundary_faces =
+    dealii::update_quadrature_points | dealii::update_JxW_values;
+  Categorization::do_cell_based_loops(tria, data);
+
+  dealii::AffineConstraints<double> constraints;
+  constraints.close();
+
+  dealii::MatrixFree<dim, double> matrix_free;
+  matrix_free.reinit(mapping, dof_handler, constraints, dealii::QGauss<1>(fe.degree + 1), data);
+
+  std::shared_ptr<dealii::Function<dim>> const time_independent =
+    std::make_shared<SpatialFunction<dim>>();
+  std::shared_ptr<dealii::Function<dim>> const separable =
+    std::make_shared<SeparableFunction<dim>>(std::make_shared<SpatialFunction<dim>>(),
+                                             [](double const t) { return 1.0 + t * t; });
+
+  for(auto const & function : {time_independent, separable})
+  {
+    Poisson::BoundaryDescriptor<0, dim> bc;
+    bc.dirichlet_bc.insert(std::make_pair(0, function));
+    bc.precomputed_bc.insert(0);
+
+    std::shared_ptr<PrecomputedBoundaryData<dim>> precomputed_data =
+      std::make_shared<PrecomputedBoundaryData<dim>>();
+    precomputed_data->setup(matrix_free, 0, {0}, bc.get_precomputed_functions());
+    bc.set_precomputed_data(precomputed_data);
+
+    std::string const name = function == separable ? "separable" : "time-independent";
+
+    double const time = 0.7;
+    std::cout << "  " << name << " function, face loop agrees with direct evaluation: "
+              << (compare_with_direct_evaluation(matrix_free, bc, function, time, false) < 1.e-12 ?
+                    "yes" :
+                    "no")
+              << std::endl;
+    std::cout << "  " << name << " function, cell-based loop agrees with direct evaluation: "
+              << (compare_with_direct_evaluation(matrix_free, bc, function, time, true) < 1.e-12 ?
+                    "yes" :
+                    "no")
+              << std::endl;
+  }
+
+  // time-dependent functions that are not separable
+  {
+    Poisson::BoundaryDescriptor<0, dim> bc;
+    bc.dirichlet_bc.insert(std::make_pair(0, std::make_shared<TimeDependentFunction<dim>>()));
+    bc.precomputed_bc.insert(0);
+
+    PrecomputedBoundaryData<dim> precomputed_data;
+    try
+    {
+      precomputed_data.setup(matrix_free, 0, {0}, bc.get_precomputed_functions());
+      std::cout << "  time-dependent function accepted" << std::endl;
+    }
+    catch(std::exception const &)
+    {
+      std::cout << "  time-dependent function rejected" << std::endl;
+    }
+  }
+
+  std::cout << std::endl;
+}
+
+int
+main(int argc, char ** argv)
+{
+  try
+  {
+    dealii::Utilities::MPI::MPI_InitFinalize mpi(argc, argv, 1);
+
+    test<2>();
+    test<3>();
+  }
+  catch(std::exception & exc)
+  {
+    std::cerr << std::endl
+              << std::endl
+              << "----------------------------------------------------" << std::endl;
+    std::cerr << "Exception on processing: " << std::endl
+              << exc.what() << std::endl
+              << "Aborting!" << std::endl
+              << "----------------------------------------------------" << std::endl;
+    return 1;
+  }
+
+  return 0;
+}
@@ -0,0 +1,206 @@
+/*  ______________________________________________________________________
+ *
+ *  ExaDG - High-Order Discontinuous Galerkin for the Exa-Scale
+ *
+ *  Copyright (C) 2021 by the ExaDG authors
+ *
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation, either version 3 of the License, or
+ *  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ *  ______________________________________________________________________
+ */
+
+// C++
+#include <iostream>
+#include <sstream>
+
+// deal.II
+#include <deal.II/base/function.h>
+#include <deal.II/base/quadrature_lib.h>
+#include <deal.II/distributed/tria.h>
+#include <deal.II/dofs/dof_handler.h>
+#include <deal.II/fe/fe_dgq.h>
+#include <deal.II/fe/fe_system.h>
+#include <deal.II/fe/mapping_q.h>
+#include <deal.II/grid/grid_generator.h>
+#include <deal.II/lac/affine_constraints.h>
+#include <deal.II/matrix_free/matrix_free.h>
+#include <deal.II/numerics/vector_tools.h>
+
+// ExaDG
+#include <exadg/functions_and_boundary_conditions/vectorized_function.h>
+#include <exadg/postprocessor/error_calculation.h>
+
+// Check that the matrix-free evaluation of errors with a quadrature rule with degree + 3 points
+// gives the same errors as dealii::VectorTools::integrate_difference() on a curved mesh, both for
+// an analytical solution given as dealii::Function (L2-norm and H1-seminorm) and as
+// VectorizedFunction (L2-norm).
+
+using namespace ExaDG;
+
+template<int dim>
+class Solution : public dealii::Function<dim>
+{
+public:
+  Solution(unsigned int const n_components) : dealii::Function<dim>(n_components, 0.0)
+  {
+  }
+
+  double
+  value(dealii::Point<dim> const & p, unsigned int const component) const final
+  {
+    return std::sin(p[0] + component) * std::cos(2.0 * p[1]) + this->get_time();
+  }
+
+  dealii::Tensor<1, dim>
+  gradient(dealii::Point<dim> const & p, unsigned int const component) const final
+  {
+    dealii::Tensor<1, dim> gradient;
+    gradient[0] = std::cos(p[0] + component) * std::cos(2.0 * p[1]);
+    gradient[1] = -2.0 * std::sin(p[0] + component) * std::sin(2.0 * p[1]);
+
+    return gradient;
+  }
+};
+
+template<int dim>
+class SolutionVectorized : public GenericVectorizedFunction<dim, SolutionVectorized<dim>>
+{
+public:
+  SolutionVectorized(unsigned int const n_components)
+    : GenericVectorizedFunction<dim, SolutionVectorized<dim>>(n_components, 0.0)
+  {
+  }
+
+  template<typename Number>
+  Number
+  evaluate(dealii::Point<dim, Number> const & p, unsigned int const component) const
+  {
+    return std::sin(p[0] + double(component)) * std::cos(2.0 * p[1]) + this->get_time();
+  }
+};
+
+template<int dim>
+std::string
+calculate_errors(dealii::MatrixFree<dim, double> const &                    matrix_free,
+                 dealii::Mapping<dim> const &                               mapping,
+                 dealii::LinearAlgebra::distributed::Vector<double> const & solution,
+                 std::shared_ptr<dealii::Function<dim>> const &             analytical_solution,
+                 bool const                                                 H1_seminorm,
+                 bool const                                                 use_matrix_free)
+{
+  ErrorCalculationData<dim> error_data;
+  error_data.analytical_solution         = analytical_solution;
+  error_data.calculate_relative_errors   = false;
+  error_data.calculate_H1_seminorm_error = H1_seminorm;
+  error_data.use_matrix_free_evaluation  = use_matrix_free;
+
+  ErrorCalculator<dim, double> error_calculator(MPI_COMM_WORLD);
+  error_calculator.setup(matrix_free.get_dof_handler(), mapping, matrix_free, 0, 0, error_data);
+
+  std::stringstream output;
+  std::streambuf *  buffer = std::cout.rdbuf(output.rdbuf());
+
+  error_calculator.evaluate(solution, 0.5, true);
+
+  std::cout.rdbuf(buffer);
+
+  return output.str();
+}
+
+template<int dim>
+void
+test(unsigned int const degree, unsigned int const n_components)
+{
+  std::cout << "Test dim = " << dim << ", degree = " << degree
+            << ", n_components = " << n_components << ":" << std::endl;
+
+  dealii::parallel::distributed::Triangulation<dim> tria(MPI_COMM_WORLD);
+  dealii::GridGenerator::hyper_ball(tria);
+  tria.refine_global(2);
+
+  dealii::MappingQ<dim> mapping(degree);
+
+  std::shared_ptr<dealii::FiniteElement<dim>> fe;
+  if(n_components == 1)
+    fe = std::make_shared<dealii::FE_DGQ<dim>>(degree);
+  else
+    fe = std::make_shared<dealii::FESystem<dim>>(dealii::FE_DGQ<dim>(degree), n_components);
+
+  dealii::DoFHandler<dim> dof_handler(tria);
+  dof_handler.distribute_dofs(*fe);
+
+  dealii::AffineConstraints<double> constraints;
+  constraints.close();
+
+  // dedicated quadrature rule for the error calculation
+  typename dealii::MatrixFree<dim, double>::AdditionalData data;
+  data.mapping_update_flags = dealii::update_values | dealii::update_gradients |
+                              dealii::update_JxW_values | dealii::update_quadrature_points;
+
+  dealii::MatrixFree<dim, double> matrix_free;
+  matrix_free.reinit(mapping, dof_handler, constraints, dealii::QGauss<1>(degree + 3), data);
+
+  dealii::LinearAlgebra::distributed::Vector<double> solution;
+  matrix_free.initialize_dof_vector(solution);
+
+  // interpolate a perturbed function in order to obtain errors that are not only interpolation
+  // errors
+  Solution<dim> perturbed(n_components);
+  perturbed.set_time(0.45);
+  dealii::VectorTools::interpolate(mapping, dof_handler, perturbed, solution);
+
+  auto const function = std::make_shared<Solution<dim>>(n_components);
+  std::cout << "  dealii::Function, L2-norm and H1-seminorm: errors agree: "
+            << (calculate_errors<dim>(matrix_free, mapping, solution, function, true, true) ==
+                    calculate_errors<dim>(matrix_free, mapping, solution, function, true, false) ?
+                  "yes" :
+                  "no")
+            << std::endl;
+
+  auto const vectorized_function = std::make_shared<SolutionVectorized<dim>>(n_components);
+  std::cout << "  VectorizedFunction, L2-norm: errors agree: "
+            << (calculate_errors<dim>(
+                  matrix_free, mapping, solution, vectorized_function, false, true) ==
+                    calculate_errors<dim>(
+                      matrix_free, mapping, solution, vectorized_function, false, false) ?
+                  "yes" :
+                  "no")
+            << std::endl
+            << std::endl;
+}
+
+int
+main(int argc, char ** argv)
+{
+  try
+  {
+    dealii::Utilities::MPI::MPI_InitFinalize mpi(argc, argv, 1);
+
+    test<2>(3, 1);
+    test<2>(2, 2);
+    test<3>(2, 1);
+  }
+  catch(std::exception & exc)
+  {
+    std::cerr << std::endl
+              << std::endl
+              << "----------------------------------------------------" << std::endl;
+    std::cerr << "Exception on processing: " << std::endl
+              << exc.what() << std::endl
+              << "Aborting!" << std::endl
+              << "----------------------------------------------------" << std::endl;
+    return 1;
+  }
+
+  return 0;
+}
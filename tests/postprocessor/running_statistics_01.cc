@@ -0,0 +1,253 @@
+/*  ______________________________________________________________________
+ *
+ *  ExaDG - High-Order Discontinuous Galerkin for the Exa-Scale
+ *
+ *  Copyright (C) 2021 by the ExaDG authors
+ *
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation, either version 3 of the License, or
+ *  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ *  ______________________________________________________________________
+ */
+
+// C++
+#include <algorithm>
+#include <cmath>
+#include <fstream>
+#include <iostream>
+#include <sstream>
+#include <vector>
+
+// deal.II
+#include <deal.II/base/function.h>
+#include <deal.II/base/quadrature_lib.h>
+#include <deal.II/distributed/tria.h>
+#include <deal.II/dofs/dof_handler.h>
+#include <deal.II/fe/fe_dgq.h>
+#include <deal.II/fe/fe_system.h>
+#include <deal.II/fe/mapping_q.h>
+#include <deal.II/grid/grid_generator.h>
+#include <deal.II/lac/affine_constraints.h>
+#include <deal.II/matrix_free/matrix_free.h>
+#include <deal.II/numerics/vector_tools.h>
+
+// ExaDG
+#include <exadg/incompressible_navier_stokes/postprocessor/running_statistics_calculator.h>
+
+// Running statistics averaged in x-direction for the samples k = 1, ..., 7 of the fields
+// u = (k y, k^2) and p = k + x, for which the statistics are known analytically. In addition, the
+// accumulation is interrupted after 3 samples, written to restart files, and continued after
+// reading the restart files, which has to give the same result as the uninterrupted accumulation.
+
+using namespace ExaDG;
+
+unsigned int const N_SAMPLES = 7;
+
+template<int dim>
+class Velocity : public dealii::Function<dim>
+{
+public:
+  Velocity(double const k) : dealii::Function<dim>(dim, 0.0), k(k)
+  {
+  }
+
+  double
+  value(dealii::Point<dim> const & p, unsigned int const component) const final
+  {
+    return component == 0 ? k * p[1] : k * k;
+  }
+
+private:
+  double const k;
+};
+
+template<int dim>
+class Pressure : public dealii::Function<dim>
+{
+public:
+  Pressure(double const k) : dealii::Function<dim>(1, 0.0), k(k)
+  {
+  }
+
+  double
+  value(dealii::Point<dim> const & p, unsigned int const) const final
+  {
+    return k + p[0];
+  }
+
+private:
+  double const k;
+};
+
+template<int dim>
+class Test
+{
+public:
+  typedef dealii::LinearAlgebra::distributed::Vector<double> VectorType;
+
+  Test() : tria(MPI_COMM_WORLD), mapping(1), dof_handler_u(tria), dof_handler_p(tria)
+  {
+    dealii::GridGenerator::hyper_cube(tria, 0.0, 1.0);
+    tria.refine_global(2);
+
+    dof_handler_u.distribute_dofs(dealii::FESystem<dim>(dealii::FE_DGQ<dim>(2), dim));
+    dof_handler_p.distribute_dofs(dealii::FE_DGQ<dim>(1));
+
+    dealii::AffineConstraints<double> constraints;
+    constraints.close();
+
+    typename dealii::MatrixFree<dim, double>::AdditionalData data;
+    data.mapping_update_flags =
+      dealii::update_values | dealii::update_JxW_values | dealii::update_quadrature_points;
+
+    matrix_free.reinit(mapping,
+                       std::vector<dealii::DoFHandler<dim> const *>{&dof_handler_u, &dof_handler_p},
+                       std::vector<dealii::AffineConstraints<double> const *>{&constraints,
+                                                                              &constraints},
+                       dealii::QGauss<1>(3),
+                       data);
+  }
+
+  /*
+   * Accumulates the samples first_sample, ..., last_sample and writes the output file. Returns the
+   * content of the output file on the first process.
+   */
+  std::string
+  accumulate(std::string const & filename,
+             unsigned int const  first_sample,
+             unsigned int const  last_sample,
+             bool const          read_restart)
+  {
+    IncNS::RunningStatisticsData<dim> data;
+    data.time_control_data_statistics.time_control_data.is_active = true;
+    data.averaging_directions                                     = {0};
+    data.write_restart                                            = true;
+    data.read_restart                                             = read_restart;
+    data.directory                                                = "./";
+    data.filename                                                 = filename;
+
+    IncNS::RunningStatisticsCalculator<dim, double> calculator(MPI_COMM_WORLD);
+    calculator.setup(matrix_free, 0, 1, 0, data);
+
+    VectorType velocity, pressure;
+    matrix_free.initialize_dof_vector(velocity, 0);
+    matrix_free.initialize_dof_vector(pressure, 1);
+
+    for(unsigned int k = first_sample; k <= last_sample; ++k)
+    {
+      dealii::VectorTools::interpolate(mapping, dof_handler_u, Velocity<dim>(k), velocity);
+      dealii::VectorTools::interpolate(mapping, dof_handler_p, Pressure<dim>(k), pressure);
+
+      calculator.evaluate(velocity, pressure);
+    }
+
+    calculator.write_output();
+
+    std::ostringstream content;
+    if(dealii::Utilities::MPI::this_mpi_process(MPI_COMM_WORLD) == 0)
+    {
+      std::ifstream file(filename + ".running_statistics");
+      content << file.rdbuf();
+    }
+
+    return content.str();
+  }
+
+private:
+  dealii::parallel::distributed::Triangulation<dim> tria;
+  dealii::MappingQ<dim>                             mapping;
+  dealii::DoFHandler<dim>                           dof_handler_u, dof_handler_p;
+  dealii::MatrixFree<dim, double>                   matrix_free;
+};
+
+/*
+ * Compares the rows of the output file to the statistics of the samples k = 1, ..., 7, i.e., the
+ * mean values 4 and 20 of k and k^2, the variances 4 and 268 of k and k^2, and their covariance 32.
+ * The variance of the pressure includes the variance 1/12 of x in averaging direction.
+ */
+bool
+check_statistics(std::string const & content)
+{
+  bool         correct = content.find("N = " + std::to_string(N_SAMPLES)) != std::string::npos;
+  unsigned int n_rows  = 0;
+
+  std::istringstream stream(content);
+  std::string        line;
+  while(std::getline(stream, line))
+  {
+    std::istringstream row(line);
+
+    // y, <u_0>, <u_1>, <u_0'u_0'>, <u_0'u_1'>, <u_1'u_1'>, <p>, <p'p'>
+    std::vector<double> values(8);
+    for(auto & value : values)
+      row >> value;
+
+    // skip the header lines
+    if(row.fail())
+      continue;
+
+    double const              y        = values[0];
+    std::vector<double> const expected = {
+      y, 4.0 * y, 20.0, 4.0 * y * y, 32.0 * y, 268.0, 4.5, 4.0 + 1.0 / 12.0};
+
+    for(unsigned int i = 0; i < values.size(); ++i)
+      correct = correct and std::abs(values[i] - expected[i]) < 1.e-6 * std::max(1.0, expected[i]);
+
+    ++n_rows;
+  }
+
+  // 4 cells with 3 quadrature points each in y-direction
+  return correct and n_rows == 12;
+}
+
+void
+test()
+{
+  Test<2> test;
+
+  std::string const continuous = test.accumulate("continuous", 1, N_SAMPLES, false);
+
+  test.accumulate("restarted", 1, 3, false);
+  std::string const restarted = test.accumulate("restarted", 4, N_SAMPLES, true);
+
+  if(dealii::Utilities::MPI::this_mpi_process(MPI_COMM_WORLD) == 0)
+  {
+    std::cout << "Statistics agree with the analytical values: "
+              << (check_statistics(continuous) ? "yes" : "no") << std::endl;
+    std::cout << "Statistics after restart agree with continuous accumulation: "
+              << (restarted == continuous ? "yes" : "no") << std::endl;
+  }
+}
+
+int
+main(int argc, char ** argv)
+{
+  try
+  {
+    dealii::Utilities::MPI::MPI_InitFinalize mpi(argc, argv, 1);
+
+    test();
+  }
+  catch(std::exception & exc)
+  {
+    std::cerr << std::endl
+              << std::endl
+              << "----------------------------------------------------" << std::endl;
+    std::cerr << "Exception on processing: " << std::endl
+              << exc.what() << std::endl
+              << "Aborting!" << std::endl
+              << "----------------------------------------------------" << std::endl;
+    return 1;
+  }
+
+  return 0;
+}
@@ -0,0 +1,179 @@
+/*  ______________________________________________________________________
+ *
+ *  ExaDG - High-Order Discontinuous Galerkin for the Exa-Scale
+ *
+ *  Copyright (C) 2021 by the ExaDG authors
+ *
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation, either version 3 of the License, or
+ *  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ *  ______________________________________________________________________
+ */
+
+// C++
+#include <algorithm>
+#include <cmath>
+#include <iostream>
+
+// deal.II
+#include <deal.II/base/conditional_ostream.h>
+#include <deal.II/base/function.h>
+#include <deal.II/distributed/tria.h>
+#include <deal.II/dofs/dof_handler.h>
+#include <deal.II/fe/fe_dgq.h>
+#include <deal.II/fe/fe_system.h>
+#include <deal.II/grid/grid_generator.h>
+#include <deal.II/numerics/vector_tools.h>
+
+// ExaDG
+#include <exadg/postprocessor/snapshot_transfer.h>
+#include <exadg/utilities/in_transit_communicator.h>
+
+// In-transit postprocessing with two solver processes and one dedicated postprocessing process
+// (InTransitProcesses = 1): Three snapshots of a velocity and a pressure field on a locally refined
+// mesh are sent back-to-back by the solver processes. The postprocessing process receives them on
+// its own partitioning of the mesh and compares them to the fields interpolated locally.
+
+using namespace ExaDG;
+
+template<int dim>
+class Field : public dealii::Function<dim>
+{
+public:
+  Field(unsigned int const n_components) : dealii::Function<dim>(n_components, 0.0)
+  {
+  }
+
+  double
+  value(dealii::Point<dim> const & p, unsigned int const component) const final
+  {
+    return (component + 1.0) * p[0] + p[1] * p[1] + this->get_time();
+  }
+};
+
+template<int dim>
+void
+test()
+{
+  typedef dealii::LinearAlgebra::distributed::Vector<double> VectorType;
+
+  InTransitCommunicator const in_transit(MPI_COMM_WORLD, 1, 1);
+
+  dealii::ConditionalOStream pcout(std::cout,
+                                   dealii::Utilities::MPI::this_mpi_process(MPI_COMM_WORLD) == 0);
+
+  // the same mesh exists on both groups of processes with a different parallel partitioning
+  dealii::parallel::distributed::Triangulation<dim> tria(in_transit.get_local_communicator());
+  dealii::GridGenerator::hyper_cube(tria, 0.0, 1.0);
+  tria.refine_global(2);
+  for(auto const & cell : tria.active_cell_iterators())
+    if(cell->is_locally_owned() and cell->center()[0] < 0.5)
+      cell->set_refine_flag();
+  tria.execute_coarsening_and_refinement();
+
+  dealii::FESystem<dim>   fe_u(dealii::FE_DGQ<dim>(2), dim);
+  dealii::FE_DGQ<dim>     fe_p(1);
+  dealii::DoFHandler<dim> dof_handler_u(tria), dof_handler_p(tria);
+  dof_handler_u.distribute_dofs(fe_u);
+  dof_handler_p.distribute_dofs(fe_p);
+
+  VectorType velocity(dof_handler_u.locally_owned_dofs(), in_transit.get_local_communicator());
+  VectorType pressure(dof_handler_p.locally_owned_dofs(), in_transit.get_local_communicator());
+
+  Field<dim> field_u(dim), field_p(1);
+
+  SnapshotTransfer<dim, double> transfer(in_transit, {&dof_handler_u, &dof_handler_p});
+
+  unsigned int n_received = 0;
+  double       error_time = 0.0;
+  double       error_u    = 0.0;
+  double       error_p    = 0.0;
+
+  if(not in_transit.is_postprocessing_process())
+  {
+    for(unsigned int step = 1; step <= 3; ++step)
+    {
+      double const time = 0.1 * step;
+
+      field_u.set_time(time);
+      field_p.set_time(time);
+      dealii::VectorTools::interpolate(dof_handler_u, field_u, velocity);
+      dealii::VectorTools::interpolate(dof_handler_p, field_p, pressure);
+
+      transfer.send({&velocity, &pressure}, time, step);
+    }
+
+    transfer.finalize();
+  }
+  else
+  {
+    double           time = 0.0;
+    types::time_step step = 0;
+
+    VectorType velocity_reference(velocity), pressure_reference(pressure);
+
+    while(transfer.receive({&velocity, &pressure}, time, step))
+    {
+      ++n_received;
+
+      error_time = std::max(error_time, std::abs(time - 0.1 * step));
+
+      field_u.set_time(0.1 * step);
+      field_p.set_time(0.1 * step);
+      dealii::VectorTools::interpolate(dof_handler_u, field_u, velocity_reference);
+      dealii::VectorTools::interpolate(dof_handler_p, field_p, pressure_reference);
+
+      velocity_reference -= velocity;
+      pressure_reference -= pressure;
+
+      error_u = std::max(error_u, velocity_reference.linfty_norm());
+      error_p = std::max(error_p, pressure_reference.linfty_norm());
+    }
+
+    transfer.send_statistics(0.0);
+  }
+
+  n_received = dealii::Utilities::MPI::max(n_received, MPI_COMM_WORLD);
+  error_time = dealii::Utilities::MPI::max(error_time, MPI_COMM_WORLD);
+  error_u    = dealii::Utilities::MPI::max(error_u, MPI_COMM_WORLD);
+  error_p    = dealii::Utilities::MPI::max(error_p, MPI_COMM_WORLD);
+
+  pcout << "Snapshots sent:                   " << transfer.get_n_snapshots() << std::endl
+        << "Snapshots received:               " << n_received << std::endl
+        << "Time and step received correctly: " << (error_time < 1.e-14 ? "yes" : "no") << std::endl
+        << "Velocity received correctly:      " << (error_u < 1.e-14 ? "yes" : "no") << std::endl
+        << "Pressure received correctly:      " << (error_p < 1.e-14 ? "yes" : "no") << std::endl;
+}
+
+int
+main(int argc, char ** argv)
+{
+  try
+  {
+    dealii::Utilities::MPI::MPI_InitFinalize mpi(argc, argv, 1);
+
+    test<2>();
+  }
+  catch(std::exception & exc)
+  {
+    std::cerr << std::endl
+              << std::endl
+              << "----------------------------------------------------" << std::endl;
+    std::cerr << "Exception on processing: " << std::endl
+              << exc.what() << std::endl
+              << "Aborting!" << std::endl
+              << "----------------------------------------------------" << std::endl;
+    return 1;
+  }
+
+  return 0;
+}
@@ -0,0 +1,223 @@
+/*  ______________________________________________________________________
+ *
+ *  ExaDG - High-Order Discontinuous Galerkin for the Exa-Scale
+ *
+ *  Copyright (C) 2021 by the ExaDG authors
+ *
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation, either version 3 of the License, or
+ *  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ *  ______________________________________________________________________
+ */
+
+
+// C++
+#include <cmath>
+#include <iostream>
+
+// deal.II
+#include <deal.II/lac/la_parallel_vector.h>
+
+// ExaDG
+#include <exadg/solvers_and_preconditioners/multigrid/smoothers/chebyshev_smoother.h>
+
+// Reuse of Chebyshev eigenvalue estimates: A shifted one-dimensional Laplace operator
+// A = scaling * (shift * I + tridiag(-1, 2, -1)) is smoothed by a point-Jacobi preconditioned
+// Chebyshev iteration. A uniform scaling of the operator does not change the spectrum of the
+// preconditioned operator, so that the cached eigenvalue estimate has to be reused and has to give
+// the same smoother as a new eigenvalue estimation. A large change of the shift changes the
+// spectrum, which has to trigger a new eigenvalue estimation.
+
+using namespace ExaDG;
+
+typedef dealii::LinearAlgebra::distributed::Vector<double> VectorType;
+
+class ShiftedLaplaceOperator
+{
+public:
+  typedef double value_type;
+
+  ShiftedLaplaceOperator(unsigned int const size) : size(size), shift(1.0), scaling(1.0)
+  {
+  }
+
+  void
+  set_coefficients(double const shift_in, double const scaling_in)
+  {
+    shift   = shift_in;
+    scaling = scaling_in;
+  }
+
+  void
+  initialize_dof_vector(VectorType & vector) const
+  {
+    vector.reinit(size);
+  }
+
+  void
+  vmult(VectorType & dst, VectorType const & src) const
+  {
+    for(unsigned int i = 0; i < size; ++i)
+    {
+      double value = (2.0 + shift) * src(i);
+      if(i > 0)
+        value -= src(i - 1);
+      if(i + 1 < size)
+        value -= src(i + 1);
+
+      dst(i) = scaling * value;
+    }
+  }
+
+  void
+  calculate_inverse_diagonal(VectorType & inverse_diagonal) const
+  {
+    inverse_diagonal = 1.0 / (scaling * (2.0 + shift));
+  }
+
+  // the block-Jacobi and additive Schwarz preconditioners are not used in this test
+  void
+  initialize_block_diagonal_preconditioner(bool const initialize) const
+  {
+    (void)initialize;
+    AssertThrow(false, dealii::ExcNotImplemented());
+  }
+
+  void
+  update_block_diagonal_preconditioner() const
+  {
+    AssertThrow(false, dealii::ExcNotImplemented());
+  }
+
+  void
+  apply_inverse_block_diagonal(VectorType & dst, VectorType const & src) const
+  {
+    (void)dst;
+    (void)src;
+    AssertThrow(false, dealii::ExcNotImplemented());
+  }
+
+  void
+  compute_factorized_additive_schwarz_matrices() const
+  {
+    AssertThrow(false, dealii::ExcNotImplemented());
+  }
+
+  void
+  apply_inverse_additive_schwarz_matrices(VectorType & dst, VectorType const & src) const
+  {
+    (void)dst;
+    (void)src;
+    AssertThrow(false, dealii::ExcNotImplemented());
+  }
+
+private:
+  unsigned int const size;
+  double             shift;
+  double             scaling;
+};
+
+typedef ChebyshevSmoother<ShiftedLaplaceOperator, VectorType> Smoother;
+
+/*
+ * Returns the relative difference of the results of both smoothers applied to the same vector.
+ */
+double
+compare_smoothers(ShiftedLaplaceOperator const & op, Smoother const & a, Smoother const & b)
+{
+  VectorType src, dst_a, dst_b;
+  op.initialize_dof_vector(src);
+  op.initialize_dof_vector(dst_a);
+  op.initialize_dof_vector(dst_b);
+
+  for(unsigned int i = 0; i < src.locally_owned_size(); ++i)
+    src.local_element(i) = std::cos(0.3 * i);
+
+  a.vmult(dst_a, src);
+  b.vmult(dst_b, src);
+
+  double const norm = dst_b.l2_norm();
+  dst_a -= dst_b;
+
+  return dst_a.l2_norm() / norm;
+}
+
+void
+test()
+{
+  ShiftedLaplaceOperator op(200);
+
+  Smoother::AdditionalData data;
+  data.preconditioner                   = PreconditionerSmoother::PointJacobi;
+  data.smoothing_range                  = 20;
+  data.degree                           = 5;
+  data.iterations_eigenvalue_estimation = 20;
+  data.reuse_eigenvalue_estimates       = true;
+  data.eigenvalue_drift_tolerance       = 0.1;
+
+  Smoother smoother;
+  smoother.setup(op, true, data);
+
+  std::cout << "Eigenvalue estimations after setup: " << smoother.get_n_eigenvalue_estimations()
+            << std::endl;
+
+  // uniform scaling of the operator
+  op.set_coefficients(1.0, 10.0);
+  smoother.update();
+
+  std::cout << "Eigenvalue estimations after uniform scaling: "
+            << smoother.get_n_eigenvalue_estimations()
+            << ", reused estimates: " << smoother.get_n_reused_eigenvalue_estimates()
+            << std::endl;
+
+  Smoother::AdditionalData data_no_reuse = data;
+  data_no_reuse.reuse_eigenvalue_estimates = false;
+
+  Smoother reference;
+  reference.setup(op, true, data_no_reuse);
+
+  std::cout << "Reused estimate gives the same smoother as a new estimation: "
+            << (compare_smoothers(op, smoother, reference) < 1.e-12 ? "yes" : "no") << std::endl;
+
+  // drift of the spectrum
+  op.set_coefficients(1000.0, 10.0);
+  smoother.update();
+
+  std::cout << "Eigenvalue estimations after change of spectrum: "
+            << smoother.get_n_eigenvalue_estimations()
+            << ", reused estimates: " << smoother.get_n_reused_eigenvalue_estimates()
+            << std::endl;
+}
+
+int
+main(int argc, char ** argv)
+{
+  try
+  {
+    dealii::Utilities::MPI::MPI_InitFinalize mpi(argc, argv, 1);
+
+    test();
+  }
+  catch(std::exception & exc)
+  {
+    std::cerr << std::endl
+              << std::endl
+              << "----------------------------------------------------" << std::endl;
+    std::cerr << "Exception on processing: " << std::endl
+              << exc.what() << std::endl
+              << "Aborting!" << std::endl
+              << "----------------------------------------------------" << std::endl;
+    return 1;
+  }
+
+  return 0;
+}
@@ -0,0 +1,103 @@
+/*  ______________________________________________________________________
+ *
+ *  ExaDG - High-Order Discontinuous Galerkin for the Exa-Scale
+ *
+ *  Copyright (C) 2021 by the ExaDG authors
+ *
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation, either version 3 of the License, or
+ *  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ *  ______________________________________________________________________
+ */
+
+
+// C++
+#include <iostream>
+#include <vector>
+
+// deal.II
+#include <deal.II/base/mpi.h>
+
+// ExaDG
+#include <exadg/solvers_and_preconditioners/multigrid/multigrid_parameters.h>
+
+// Update of the coarser h-levels of multigrid under mesh motion: The coarser h-levels are updated
+// every mesh_motion_coarse_update_interval grid updates, or earlier if the relative change of the
+// integration weights exceeds mesh_motion_coarse_update_tolerance. The counter of grid updates is
+// reset after each update of the coarser h-levels (as in
+// MultigridPreconditionerBase::update_after_grid_motion()), and the relative change of the
+// integration weights must only be computed if the interval has not been reached yet.
+
+using namespace ExaDG;
+
+void
+test(unsigned int const interval, double const tolerance, std::vector<double> const & changes)
+{
+  MultigridData data;
+  data.mesh_motion_coarse_update_interval  = interval;
+  data.mesh_motion_coarse_update_tolerance = tolerance;
+
+  unsigned int n_updates_since_coarse_update = 0;
+  unsigned int n_evaluations                 = 0;
+
+  std::cout << "interval = " << interval << ", tolerance = " << tolerance
+            << ", coarse levels updated:";
+
+  for(double const change : changes)
+  {
+    ++n_updates_since_coarse_update;
+
+    bool const update_coarse_levels =
+      data.mesh_motion_coarse_levels_need_update(n_updates_since_coarse_update, [&]() {
+        ++n_evaluations;
+        return change;
+      });
+
+    if(update_coarse_levels)
+      n_updates_since_coarse_update = 0;
+
+    std::cout << " " << update_coarse_levels;
+  }
+
+  std::cout << std::endl << "  number of evaluations of JxW: " << n_evaluations << std::endl;
+}
+
+int
+main(int argc, char ** argv)
+{
+  try
+  {
+    dealii::Utilities::MPI::MPI_InitFinalize mpi(argc, argv, 1);
+
+    // default: all levels are updated in every step
+    test(1, 0.05, {0.5, 0.0, 0.0, 0.0, 0.0, 0.0});
+
+    // small deformations: the interval determines the update
+    test(3, 0.05, {0.01, 0.01, 0.01, 0.01, 0.01, 0.01});
+
+    // a large deformation triggers an update before the interval has been reached
+    test(3, 0.05, {0.01, 0.1, 0.01, 0.01, 0.01, 0.01});
+  }
+  catch(std::exception & exc)
+  {
+    std::cerr << std::endl
+              << std::endl
+              << "----------------------------------------------------" << std::endl;
+    std::cerr << "Exception on processing: " << std::endl
+              << exc.what() << std::endl
+              << "Aborting!" << std::endl
+              << "----------------------------------------------------" << std::endl;
+    return 1;
+  }
+
+  return 0;
+}
@@ -0,0 +1,191 @@
+/*  ______________________________________________________________________
+ *
+ *  ExaDG - High-Order Discontinuous Galerkin for the Exa-Scale
+ *
+ *  Copyright (C) 2021 by the ExaDG authors
+ *
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation, either version 3 of the License, or
+ *  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ *  ______________________________________________________________________
+ */
+
+
+// C++
+#include <cmath>
+#include <iostream>
+#include <vector>
+
+// deal.II
+#include <deal.II/base/mpi.h>
+#include <deal.II/lac/la_parallel_vector.h>
+
+// ExaDG
+#include <exadg/solvers_and_preconditioners/preconditioners/jacobi_preconditioner.h>
+#include <exadg/solvers_and_preconditioners/solvers/iterative_solvers_dealii_wrapper.h>
+
+// Recycling of the initial guess across a sequence of linear systems: A sequence of systems with
+// the same operator and right-hand sides b_k = f + 0.1 k g is solved with a zero initial guess.
+// Since all right-hand sides lie in span{f, g}, the projection onto the recycle space gives an
+// accurate initial guess once two systems have been solved, and the number of iterations has to
+// be much smaller than without recycling. All solutions have to satisfy the tolerance with respect
+// to the residual of the original initial guess.
+
+using namespace ExaDG;
+
+typedef dealii::LinearAlgebra::distributed::Vector<double> VectorType;
+
+class ShiftedLaplaceOperator
+{
+public:
+  typedef double value_type;
+
+  ShiftedLaplaceOperator(unsigned int const size, double const shift) : size(size), shift(shift)
+  {
+  }
+
+  void
+  initialize_dof_vector(VectorType & vector) const
+  {
+    vector.reinit(size);
+  }
+
+  void
+  vmult(VectorType & dst, VectorType const & src) const
+  {
+    for(unsigned int i = 0; i < size; ++i)
+    {
+      double value = (2.0 + shift) * src(i);
+      if(i > 0)
+        value -= src(i - 1);
+      if(i + 1 < size)
+        value -= src(i + 1);
+
+      dst(i) = value;
+    }
+  }
+
+  void
+  calculate_inverse_diagonal(VectorType & inverse_diagonal) const
+  {
+    inverse_diagonal = 1.0 / (2.0 + shift);
+  }
+
+private:
+  unsigned int const size;
+  double const       shift;
+};
+
+typedef Krylov::SolverCG<ShiftedLaplaceOperator, PreconditionerBase<double>, VectorType> Solver;
+
+/*
+ * Solves the sequence of systems and returns the number of iterations of each solve.
+ */
+std::vector<unsigned int>
+solve_sequence(ShiftedLaplaceOperator const & op,
+               unsigned int const             n_recycle_vectors,
+               unsigned int const             n_systems,
+               double const                   rel_tol,
+               bool &                         tolerance_satisfied)
+{
+  JacobiPreconditioner<ShiftedLaplaceOperator> preconditioner(op, true);
+
+  Krylov::SolverDataCG solver_data;
+  solver_data.solver_tolerance_rel = rel_tol;
+  solver_data.use_preconditioner   = true;
+  solver_data.n_recycle_vectors    = n_recycle_vectors;
+
+  Solver solver(op, preconditioner, solver_data);
+
+  std::vector<unsigned int> n_iterations;
+
+  tolerance_satisfied = true;
+
+  VectorType rhs, solution, residual;
+  op.initialize_dof_vector(rhs);
+  op.initialize_dof_vector(solution);
+  op.initialize_dof_vector(residual);
+
+  for(unsigned int k = 0; k < n_systems; ++k)
+  {
+    for(unsigned int i = 0; i < rhs.locally_owned_size(); ++i)
+      rhs.local_element(i) = 1.0 + 0.1 * k * std::cos(0.05 * i);
+
+    solution = 0.0;
+    n_iterations.push_back(solver.solve(solution, rhs));
+
+    op.vmult(residual, solution);
+    residual.sadd(-1.0, 1.0, rhs);
+    if(residual.l2_norm() > 1.1 * rel_tol * rhs.l2_norm())
+      tolerance_satisfied = false;
+  }
+
+  return n_iterations;
+}
+
+void
+test()
+{
+  ShiftedLaplaceOperator const op(1000, 1.e-3);
+
+  unsigned int const n_systems = 10;
+  double const       rel_tol   = 1.e-10;
+
+  bool tolerance_satisfied_reference = false, tolerance_satisfied_recycling = false;
+
+  std::vector<unsigned int> const n_iterations_reference =
+    solve_sequence(op, 0, n_systems, rel_tol, tolerance_satisfied_reference);
+  std::vector<unsigned int> const n_iterations_recycling =
+    solve_sequence(op, 5, n_systems, rel_tol, tolerance_satisfied_recycling);
+
+  // the first two systems span the space of all right-hand sides
+  unsigned int sum_reference = 0, sum_recycling = 0;
+  for(unsigned int k = 2; k < n_systems; ++k)
+  {
+    sum_reference += n_iterations_reference[k];
+    sum_recycling += n_iterations_recycling[k];
+  }
+
+  std::cout << "Same number of iterations for the first system: "
+            << (n_iterations_reference[0] == n_iterations_recycling[0] ? "yes" : "no")
+            << std::endl;
+  std::cout << "Number of iterations reduced by more than a factor of 10 by recycling: "
+            << (10 * sum_recycling < sum_reference ? "yes" : "no") << std::endl;
+  std::cout << "Tolerance satisfied without recycling: "
+            << (tolerance_satisfied_reference ? "yes" : "no") << std::endl;
+  std::cout << "Tolerance satisfied with recycling: "
+            << (tolerance_satisfied_recycling ? "yes" : "no") << std::endl;
+}
+
+int
+main(int argc, char ** argv)
+{
+  try
+  {
+    dealii::Utilities::MPI::MPI_InitFinalize mpi(argc, argv, 1);
+
+    test();
+  }
+  catch(std::exception & exc)
+  {
+    std::cerr << std::endl
+              << std::endl
+              << "----------------------------------------------------" << std::endl;
+    std::cerr << "Exception on processing: " << std::endl
+              << exc.what() << std::endl
+              << "Aborting!" << std::endl
+              << "----------------------------------------------------" << std::endl;
+    return 1;
+  }
+
+  return 0;
+}
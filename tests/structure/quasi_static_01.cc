@@ -0,0 +1,370 @@
+/*  ______________________________________________________________________
+ *
+ *  ExaDG - High-Order Discontinuous Galerkin for the Exa-Scale
+ *
+ *  Copyright (C) 2021 by the ExaDG authors
+ *
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation, either version 3 of the License, or
+ *  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ *  ______________________________________________________________________
+ */
+
+
+// C++
+#include <algorithm>
+#include <cmath>
+#include <iostream>
+#include <memory>
+#include <sstream>
+#include <vector>
+
+// deal.II
+#include <deal.II/base/function.h>
+#include <deal.II/grid/grid_generator.h>
+
+// ExaDG
+#include <exadg/structure/driver.h>
+#include <exadg/structure/user_interface/application_base.h>
+#include <exadg/utilities/enum_utilities.h>
+
+// Load stepping of the quasi-static solver: With adaptive load increments, the load increment has
+// to grow for a mildly nonlinear problem and the last increment has to be clipped to hit the
+// maximum load exactly. The quadratic predictor must not need more load steps than taking the
+// solution of the last load step as initial guess, and all variants have to converge to the same
+// solution as a computation with small constant load increments.
+
+using namespace ExaDG;
+
+/*
+ * Traction scaled by the load factor, which records the load factors of all load steps (accepted
+ * and rejected).
+ */
+template<int dim>
+class Traction : public dealii::Function<dim>
+{
+public:
+  Traction(double const traction, std::shared_ptr<std::vector<double>> load_factors)
+    : dealii::Function<dim>(dim), traction(traction), load_factors(load_factors)
+  {
+  }
+
+  double
+  value(dealii::Point<dim> const & p, unsigned int const c) const final
+  {
+    (void)p;
+
+    // the time is the load factor in case of the quasi-static solver
+    double const load_factor = this->get_time();
+
+    if(load_factor > 0.0 and (load_factors->empty() or load_factors->back() != load_factor))
+      load_factors->push_back(load_factor);
+
+    if(c == 1)
+      return traction * load_factor;
+    else
+      return 0.0;
+  }
+
+private:
+  double const                         traction;
+  std::shared_ptr<std::vector<double>> load_factors;
+};
+
+/*
+ * Stores the displacement of the last call to do_postprocessing().
+ */
+template<int dim, typename Number>
+class SolutionPostProcessor : public Structure::PostProcessor<dim, Number>
+{
+  using VectorType = dealii::LinearAlgebra::distributed::Vector<Number>;
+
+public:
+  SolutionPostProcessor(MPI_Comm const & comm)
+    : Structure::PostProcessor<dim, Number>(Structure::PostProcessorData<dim>(), comm)
+  {
+  }
+
+  void
+  do_postprocessing(VectorType const &     solution,
+                    double const           time,
+                    types::time_step const time_step_number) final
+  {
+    (void)time;
+    (void)time_step_number;
+
+    displacement = solution;
+  }
+
+  VectorType displacement;
+};
+
+template<int dim, typename Number>
+class Application : public Structure::ApplicationBase<dim, Number>
+{
+public:
+  Application(MPI_Comm const &                   comm,
+              bool const                         adaptive_load_increment,
+              Structure::LoadStepPredictor const load_step_predictor)
+    : Structure::ApplicationBase<dim, Number>("", comm),
+      load_factors(std::make_shared<std::vector<double>>()),
+      adaptive_load_increment(adaptive_load_increment),
+      load_step_predictor(load_step_predictor)
+  {
+  }
+
+  std::shared_ptr<SolutionPostProcessor<dim, Number>> postprocessor;
+
+  std::shared_ptr<std::vector<double>> load_factors;
+
+private:
+  void
+  parse_parameters() final
+  {
+  }
+
+  void
+  set_parameters() final
+  {
+    // MATHEMATICAL MODEL
+    this->param.problem_type         = Structure::ProblemType::QuasiStatic;
+    this->param.body_force           = false;
+    this->param.large_deformation    = true;
+    this->param.pull_back_body_force = false;
+    this->param.pull_back_traction   = false;
+
+    // PHYSICAL QUANTITIES
+    this->param.density = 1.0;
+
+    // LOAD STEPPING
+    this->param.load_increment            = adaptive_load_increment ? 0.1 : 0.05;
+    this->param.adaptive_load_increment   = adaptive_load_increment;
+    this->param.load_increment_min        = 0.01;
+    this->param.load_increment_max        = 0.5;
+    this->param.load_increment_max_growth = 2.0;
+    this->param.desired_newton_iterations = 5;
+    this->param.load_step_predictor       = load_step_predictor;
+
+    // SPATIAL DISCRETIZATION
+    this->param.grid.triangulation_type     = TriangulationType::Distributed;
+    this->param.grid.n_refine_global        = 1;
+    this->param.degree                      = 2;
+    this->param.mapping_degree              = 1;
+    this->param.mapping_degree_coarse_grids = this->param.mapping_degree;
+
+    // SOLVER
+    this->param.newton_solver_data = Newton::SolverData(1e2, 1.e-12, 1.e-10);
+    this->param.solver             = Structure::Solver::FGMRES;
+    this->param.solver_data        = SolverData(1e3, 1.e-14, 1.e-10, 100);
+    this->param.preconditioner     = Structure::Preconditioner::PointJacobi;
+
+    this->param.update_preconditioner                         = true;
+    this->param.update_preconditioner_every_time_steps        = 1;
+    this->param.update_preconditioner_every_newton_iterations = 1;
+  }
+
+  void
+  create_grid(Grid<dim> &                                       grid,
+              std::shared_ptr<dealii::Mapping<dim>> &           mapping,
+              std::shared_ptr<MultigridMappings<dim, Number>> & multigrid_mappings) final
+  {
+    auto const lambda_create_triangulation =
+      [&](dealii::Triangulation<dim, dim> & tria,
+          std::vector<dealii::GridTools::PeriodicFacePair<
+            typename dealii::Triangulation<dim>::cell_iterator>> & /*periodic_face_pairs*/,
+          unsigned int const global_refinements,
+          std::vector<unsigned int> const & /* vector_local_refinements*/) {
+        // cantilever of length 1 and height 0.25, clamped at the left end (bid = 1) and loaded at
+        // the right end (bid = 2)
+        dealii::GridGenerator::subdivided_hyper_rectangle(tria,
+                                                          {4, 1},
+                                                          dealii::Point<dim>(0.0, 0.0),
+                                                          dealii::Point<dim>(1.0, 0.25));
+
+        for(auto const & face : tria.active_face_iterators())
+        {
+          if(face->at_boundary())
+          {
+            if(std::abs(face->center()[0] - 0.0) < 1.e-8)
+              face->set_boundary_id(1);
+            else if(std::abs(face->center()[0] - 1.0) < 1.e-8)
+              face->set_boundary_id(2);
+          }
+        }
+
+        tria.refine_global(global_refinements);
+      };
+
+    GridUtilities::create_triangulation_with_multigrid<dim>(grid,
+                                                            this->mpi_comm,
+                                                            this->param.grid,
+                                                            this->param.involves_h_multigrid(),
+                                                            lambda_create_triangulation,
+                                                            {} /* no local refinements */);
+
+    GridUtilities::create_mapping_with_multigrid(mapping,
+                                                 multigrid_mappings,
+                                                 this->param.grid.element_type,
+                                                 this->param.mapping_degree,
+                                                 this->param.mapping_degree_coarse_grids,
+                                                 this->param.involves_h_multigrid());
+  }
+
+  void
+  set_boundary_descriptor() final
+  {
+    this->boundary_descriptor->dirichlet_bc.insert(
+      std::make_pair(1, std::make_shared<dealii::Functions::ZeroFunction<dim>>(dim)));
+    this->boundary_descriptor->dirichlet_bc_initial_acceleration.insert(
+      std::make_pair(1, std::make_shared<dealii::Functions::ZeroFunction<dim>>(dim)));
+    this->boundary_descriptor->dirichlet_bc_component_mask.insert(
+      std::make_pair(1, dealii::ComponentMask(dim, true)));
+
+    this->boundary_descriptor->neumann_bc.insert(
+      std::make_pair(0, std::make_shared<dealii::Functions::ZeroFunction<dim>>(dim)));
+    this->boundary_descriptor->neumann_bc.insert(
+      std::make_pair(2, std::make_shared<Traction<dim>>(0.25 /* traction */, load_factors)));
+  }
+
+  void
+  set_material_descriptor() final
+  {
+    this->material_descriptor->insert(
+      std::make_pair(0,
+                     std::make_shared<Structure::StVenantKirchhoffData<dim>>(
+                       Structure::MaterialType::StVenantKirchhoff,
+                       200.0 /* E */,
+                       0.3 /* nu */,
+                       Structure::Type2D::PlaneStress)));
+  }
+
+  void
+  set_field_functions() final
+  {
+    this->field_functions->right_hand_side =
+      std::make_shared<dealii::Functions::ZeroFunction<dim>>(dim);
+    this->field_functions->initial_displacement =
+      std::make_shared<dealii::Functions::ZeroFunction<dim>>(dim);
+    this->field_functions->initial_velocity =
+      std::make_shared<dealii::Functions::ZeroFunction<dim>>(dim);
+  }
+
+  std::shared_ptr<Structure::PostProcessor<dim, Number>>
+  create_postprocessor() final
+  {
+    postprocessor = std::make_shared<SolutionPostProcessor<dim, Number>>(this->mpi_comm);
+
+    return postprocessor;
+  }
+
+  bool const                         adaptive_load_increment;
+  Structure::LoadStepPredictor const load_step_predictor;
+};
+
+template<int dim, typename Number>
+std::shared_ptr<Application<dim, Number>>
+run(bool const adaptive_load_increment, Structure::LoadStepPredictor const load_step_predictor)
+{
+  std::shared_ptr<Application<dim, Number>> application =
+    std::make_shared<Application<dim, Number>>(MPI_COMM_WORLD,
+                                               adaptive_load_increment,
+                                               load_step_predictor);
+
+  // the output of the solver is not part of the test
+  std::stringstream log;
+  std::streambuf *  buffer = std::cout.rdbuf(log.rdbuf());
+
+  Structure::Driver<dim, Number> driver(MPI_COMM_WORLD, application, true, false);
+  driver.setup();
+  driver.solve();
+
+  std::cout.rdbuf(buffer);
+
+  return application;
+}
+
+template<int dim, typename Number>
+void
+test()
+{
+  dealii::ConditionalOStream pcout(std::cout,
+                                   dealii::Utilities::MPI::this_mpi_process(MPI_COMM_WORLD) == 0);
+
+  auto const reference = run<dim, Number>(false, Structure::LoadStepPredictor::Linear);
+
+  auto const check = [&](Application<dim, Number> const & application) {
+    auto difference = application.postprocessor->displacement;
+    difference.add(-1.0, reference->postprocessor->displacement);
+
+    return difference.l2_norm() <= 1.e-8 * reference->postprocessor->displacement.l2_norm();
+  };
+
+  std::vector<Structure::LoadStepPredictor> const predictors = {
+    Structure::LoadStepPredictor::None,
+    Structure::LoadStepPredictor::Linear,
+    Structure::LoadStepPredictor::Quadratic};
+
+  std::vector<unsigned int> n_load_steps;
+  for(auto const & predictor : predictors)
+  {
+    auto const application = run<dim, Number>(true, predictor);
+
+    std::vector<double> const & load_factors = *application->load_factors;
+
+    // the load increment has to exceed the initial load increment 0.1 (step 0 and the last load
+    // step, which is clipped, are excluded)
+    double max_increment = 0.0;
+    for(unsigned int i = 2; i + 1 < load_factors.size(); ++i)
+      max_increment = std::max(max_increment, load_factors[i] - load_factors[i - 1]);
+
+    bool const increment_grows = max_increment > 0.1 * (1.0 + 1.e-12);
+
+    n_load_steps.push_back(load_factors.size());
+
+    pcout << "Adaptive load increments, predictor " << Utilities::enum_to_string(predictor) << ":"
+          << std::endl
+          << "  load increment grows:           " << (increment_grows ? "yes" : "no") << std::endl
+          << "  maximum load reached exactly:   "
+          << (std::abs(load_factors.back() - 1.0) < 1.e-12 ? "yes" : "no") << std::endl
+          << "  fewer load steps than constant: "
+          << (load_factors.size() < reference->load_factors->size() ? "yes" : "no") << std::endl
+          << "  same solution as constant:      " << (check(*application) ? "yes" : "no")
+          << std::endl;
+  }
+
+  pcout << "Quadratic predictor needs at most as many load steps as predictor None: "
+        << (n_load_steps[2] <= n_load_steps[0] ? "yes" : "no") << std::endl;
+}
+
+int
+main(int argc, char ** argv)
+{
+  try
+  {
+    dealii::Utilities::MPI::MPI_InitFinalize mpi(argc, argv, 1);
+
+    test<2, double>();
+  }
+  catch(std::exception & exc)
+  {
+    std::cerr << std::endl
+              << std::endl
+              << "----------------------------------------------------" << std::endl;
+    std::cerr << "Exception on processing: " << std::endl
+              << exc.what() << std::endl
+              << "Aborting!" << std::endl
+              << "----------------------------------------------------" << std::endl;
+    return 1;
+  }
+
+  return 0;
+}
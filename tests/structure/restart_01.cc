@@ -0,0 +1,366 @@
+/*  ______________________________________________________________________
+ *
+ *  ExaDG - High-Order Discontinuous Galerkin for the Exa-Scale
+ *
+ *  Copyright (C) 2021 by the ExaDG authors
+ *
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation, either version 3 of the License, or
+ *  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ *  ______________________________________________________________________
+ */
+
+
+// C++
+#include <cstdio>
+#include <fstream>
+#include <iostream>
+#include <sstream>
+
+// deal.II
+#include <deal.II/base/function.h>
+#include <deal.II/grid/grid_generator.h>
+
+// ExaDG
+#include <exadg/structure/driver.h>
+#include <exadg/structure/user_interface/application_base.h>
+#include <exadg/time_integration/restart.h>
+
+// Restart round trip for the generalized-alpha time integrator and the quasi-static solver: A
+// simulation that writes a restart file half-way is repeated from the restart file, and both
+// simulations have to end with the same displacement field.
+
+using namespace ExaDG;
+
+template<int dim>
+class Traction : public dealii::Function<dim>
+{
+public:
+  Traction(double const traction, bool const quasistatic)
+    : dealii::Function<dim>(dim), traction(traction), quasistatic(quasistatic)
+  {
+  }
+
+  double
+  value(dealii::Point<dim> const & p, unsigned int const c) const final
+  {
+    (void)p;
+
+    // the time is the load factor in case of the quasi-static solver
+    double const factor = quasistatic ? this->get_time() : 1.0;
+
+    if(c == 1)
+      return traction * factor;
+    else
+      return 0.0;
+  }
+
+private:
+  double const traction;
+  bool const   quasistatic;
+};
+
+/*
+ * Stores the displacement of the last call to do_postprocessing().
+ */
+template<int dim, typename Number>
+class SolutionPostProcessor : public Structure::PostProcessor<dim, Number>
+{
+  using VectorType = dealii::LinearAlgebra::distributed::Vector<Number>;
+
+public:
+  SolutionPostProcessor(MPI_Comm const & comm)
+    : Structure::PostProcessor<dim, Number>(Structure::PostProcessorData<dim>(), comm)
+  {
+  }
+
+  void
+  do_postprocessing(VectorType const &     solution,
+                    double const           time,
+                    types::time_step const time_step_number) final
+  {
+    (void)time;
+    (void)time_step_number;
+
+    displacement = solution;
+  }
+
+  VectorType displacement;
+};
+
+template<int dim, typename Number>
+class Application : public Structure::ApplicationBase<dim, Number>
+{
+public:
+  Application(MPI_Comm const &             comm,
+              Structure::ProblemType const problem_type,
+              std::string const &          restart_filename,
+              bool const                   restarted_simulation)
+    : Structure::ApplicationBase<dim, Number>("", comm),
+      problem_type(problem_type),
+      restart_filename(restart_filename),
+      restarted_simulation(restarted_simulation)
+  {
+  }
+
+  std::shared_ptr<SolutionPostProcessor<dim, Number>> postprocessor;
+
+private:
+  void
+  parse_parameters() final
+  {
+  }
+
+  void
+  set_parameters() final
+  {
+    // MATHEMATICAL MODEL
+    this->param.problem_type         = problem_type;
+    this->param.body_force           = false;
+    this->param.large_deformation    = true;
+    this->param.pull_back_body_force = false;
+    this->param.pull_back_traction   = false;
+
+    // PHYSICAL QUANTITIES
+    this->param.density = 1.0;
+
+    // TEMPORAL DISCRETIZATION
+    this->param.start_time      = 0.0;
+    this->param.end_time        = 0.5;
+    this->param.time_step_size  = 0.05;
+    this->param.gen_alpha_type  = GenAlphaType::BossakAlpha;
+    this->param.spectral_radius = 0.8;
+
+    // load stepping of the quasi-static solver: the load increment is adapted and the quadratic
+    // predictor needs the increments of the last two load steps, i.e., the state of the load
+    // stepping has to be restored completely from the restart file
+    this->param.load_increment            = 0.1;
+    this->param.adaptive_load_increment   = true;
+    this->param.load_increment_min        = 0.01;
+    this->param.load_increment_max        = 0.2;
+    this->param.desired_newton_iterations = 3;
+    this->param.load_step_predictor       = Structure::LoadStepPredictor::Quadratic;
+
+    // RESTART
+    // The restart file is written once after about half of the simulation (physical time for the
+    // unsteady problem, load factor for the quasi-static problem). The restarted simulation does
+    // not write restart files in order to not overwrite the restart file it starts from.
+    this->param.restarted_simulation       = restarted_simulation;
+    this->param.restart_data.write_restart = not(restarted_simulation);
+    this->param.restart_data.interval_time =
+      problem_type == Structure::ProblemType::Unsteady ? 0.3 : 0.6;
+    this->param.restart_data.filename = restart_filename;
+
+    // SPATIAL DISCRETIZATION
+    this->param.grid.triangulation_type     = TriangulationType::Distributed;
+    this->param.grid.n_refine_global        = 1;
+    this->param.degree                      = 2;
+    this->param.mapping_degree              = 1;
+    this->param.mapping_degree_coarse_grids = this->param.mapping_degree;
+
+    // SOLVER
+    this->param.newton_solver_data = Newton::SolverData(1e2, 1.e-12, 1.e-10);
+    this->param.solver             = Structure::Solver::FGMRES;
+    this->param.solver_data        = SolverData(1e3, 1.e-14, 1.e-10, 100);
+    this->param.preconditioner     = Structure::Preconditioner::PointJacobi;
+
+    // update the preconditioner in every Newton iteration so that it does not depend on the
+    // history before the restart
+    this->param.update_preconditioner                         = true;
+    this->param.update_preconditioner_every_time_steps        = 1;
+    this->param.update_preconditioner_every_newton_iterations = 1;
+  }
+
+  void
+  create_grid(Grid<dim> &                                       grid,
+              std::shared_ptr<dealii::Mapping<dim>> &           mapping,
+              std::shared_ptr<MultigridMappings<dim, Number>> & multigrid_mappings) final
+  {
+    auto const lambda_create_triangulation =
+      [&](dealii::Triangulation<dim, dim> & tria,
+          std::vector<dealii::GridTools::PeriodicFacePair<
+            typename dealii::Triangulation<dim>::cell_iterator>> & /*periodic_face_pairs*/,
+          unsigned int const global_refinements,
+          std::vector<unsigned int> const & /* vector_local_refinements*/) {
+        // cantilever of length 1 and height 0.25, clamped at the left end (bid = 1) and loaded at
+        // the right end (bid = 2)
+        dealii::GridGenerator::subdivided_hyper_rectangle(tria,
+                                                          {4, 1},
+                                                          dealii::Point<dim>(0.0, 0.0),
+                                                          dealii::Point<dim>(1.0, 0.25));
+
+        for(auto const & face : tria.active_face_iterators())
+        {
+          if(face->at_boundary())
+          {
+            if(std::abs(face->center()[0] - 0.0) < 1.e-8)
+              face->set_boundary_id(1);
+            else if(std::abs(face->center()[0] - 1.0) < 1.e-8)
+              face->set_boundary_id(2);
+          }
+        }
+
+        tria.refine_global(global_refinements);
+      };
+
+    GridUtilities::create_triangulation_with_multigrid<dim>(grid,
+                                                            this->mpi_comm,
+                                                            this->param.grid,
+                                                            this->param.involves_h_multigrid(),
+                                                            lambda_create_triangulation,
+                                                            {} /* no local refinements */);
+
+    GridUtilities::create_mapping_with_multigrid(mapping,
+                                                 multigrid_mappings,
+                                                 this->param.grid.element_type,
+                                                 this->param.mapping_degree,
+                                                 this->param.mapping_degree_coarse_grids,
+                                                 this->param.involves_h_multigrid());
+  }
+
+  void
+  set_boundary_descriptor() final
+  {
+    this->boundary_descriptor->dirichlet_bc.insert(
+      std::make_pair(1, std::make_shared<dealii::Functions::ZeroFunction<dim>>(dim)));
+    this->boundary_descriptor->dirichlet_bc_initial_acceleration.insert(
+      std::make_pair(1, std::make_shared<dealii::Functions::ZeroFunction<dim>>(dim)));
+    this->boundary_descriptor->dirichlet_bc_component_mask.insert(
+      std::make_pair(1, dealii::ComponentMask(dim, true)));
+
+    this->boundary_descriptor->neumann_bc.insert(
+      std::make_pair(0, std::make_shared<dealii::Functions::ZeroFunction<dim>>(dim)));
+    bool const quasistatic = (problem_type == Structure::ProblemType::QuasiStatic);
+    this->boundary_descriptor->neumann_bc.insert(
+      std::make_pair(2, std::make_shared<Traction<dim>>(0.25 /* traction */, quasistatic)));
+  }
+
+  void
+  set_material_descriptor() final
+  {
+    this->material_descriptor->insert(
+      std::make_pair(0,
+                     std::make_shared<Structure::StVenantKirchhoffData<dim>>(
+                       Structure::MaterialType::StVenantKirchhoff,
+                       200.0 /* E */,
+                       0.3 /* nu */,
+                       Structure::Type2D::PlaneStress)));
+  }
+
+  void
+  set_field_functions() final
+  {
+    this->field_functions->right_hand_side =
+      std::make_shared<dealii::Functions::ZeroFunction<dim>>(dim);
+    this->field_functions->initial_displacement =
+      std::make_shared<dealii::Functions::ZeroFunction<dim>>(dim);
+    this->field_functions->initial_velocity =
+      std::make_shared<dealii::Functions::ZeroFunction<dim>>(dim);
+  }
+
+  std::shared_ptr<Structure::PostProcessor<dim, Number>>
+  create_postprocessor() final
+  {
+    postprocessor = std::make_shared<SolutionPostProcessor<dim, Number>>(this->mpi_comm);
+
+    return postprocessor;
+  }
+
+  Structure::ProblemType const problem_type;
+  std::string const            restart_filename;
+  bool const                   restarted_simulation;
+};
+
+template<int dim, typename Number>
+dealii::LinearAlgebra::distributed::Vector<Number>
+run(Structure::ProblemType const problem_type,
+    std::string const &          filename,
+    bool const                   restarted_simulation)
+{
+  std::shared_ptr<Application<dim, Number>> application =
+    std::make_shared<Application<dim, Number>>(MPI_COMM_WORLD,
+                                               problem_type,
+                                               filename,
+                                               restarted_simulation);
+
+  // the output of the solver is not part of the test
+  std::stringstream log;
+  std::streambuf *  buffer = std::cout.rdbuf(log.rdbuf());
+
+  Structure::Driver<dim, Number> driver(MPI_COMM_WORLD, application, true, false);
+  driver.setup();
+  driver.solve();
+
+  std::cout.rdbuf(buffer);
+
+  return application->postprocessor->displacement;
+}
+
+template<int dim, typename Number>
+void
+test(Structure::ProblemType const problem_type, std::string const & filename)
+{
+  dealii::ConditionalOStream pcout(std::cout,
+                                   dealii::Utilities::MPI::this_mpi_process(MPI_COMM_WORLD) == 0);
+
+  // N steps in one go, writing a restart file after about N/2 steps
+  auto const reference = run<dim, Number>(problem_type, filename, false);
+
+  std::string const file = restart_filename(filename, MPI_COMM_WORLD);
+
+  bool const restart_file_written =
+    dealii::Utilities::MPI::min(std::ifstream(file, std::ios::binary).good() ? 1 : 0,
+                                MPI_COMM_WORLD) == 1;
+
+  // the remaining steps starting from the restart file
+  auto difference = run<dim, Number>(problem_type, filename, true);
+  difference.add(-1.0, reference);
+
+  pcout << "  restart file written:        " << (restart_file_written ? "yes" : "no") << std::endl
+        << "  same solution after restart: "
+        << (difference.l2_norm() <= 1.e-10 * reference.l2_norm() ? "yes" : "no") << std::endl;
+
+  std::remove(file.c_str());
+  std::remove((file + ".old").c_str());
+}
+
+int
+main(int argc, char ** argv)
+{
+  try
+  {
+    dealii::Utilities::MPI::MPI_InitFinalize mpi(argc, argv, 1);
+
+    dealii::ConditionalOStream pcout(std::cout,
+                                     dealii::Utilities::MPI::this_mpi_process(MPI_COMM_WORLD) ==
+                                       0);
+
+    pcout << "Unsteady problem (generalized-alpha time integration):" << std::endl;
+    test<2, double>(Structure::ProblemType::Unsteady, "restart_01_unsteady");
+
+    pcout << "Quasi-static problem (adaptive load increments, quadratic predictor):" << std::endl;
+    test<2, double>(Structure::ProblemType::QuasiStatic, "restart_01_quasi_static");
+  }
+  catch(std::exception & exc)
+  {
+    std::cerr << std::endl
+              << std::endl
+              << "----------------------------------------------------" << std::endl;
+    std::cerr << "Exception on processing: " << std::endl
+              << exc.what() << std::endl
+              << "Aborting!" << std::endl
+              << "----------------------------------------------------" << std::endl;
+    return 1;
+  }
+
+  return 0;
+}
@@ -0,0 +1,130 @@
+/*  ______________________________________________________________________
+ *
+ *  ExaDG - High-Order Discontinuous Galerkin for the Exa-Scale
+ *
+ *  Copyright (C) 2021 by the ExaDG authors
+ *
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation, either version 3 of the License, or
+ *  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ *  ______________________________________________________________________
+ */
+
+
+// C++
+#include <algorithm>
+#include <cmath>
+#include <iostream>
+
+// deal.II
+#include <deal.II/base/mpi.h>
+#include <deal.II/lac/la_parallel_vector.h>
+
+// ExaDG
+#include <exadg/time_integration/extrapolation_constants.h>
+#include <exadg/time_integration/push_back_vectors.h>
+#include <exadg/time_integration/vector_history.h>
+
+// Check push_back() and add_extrapolation() of VectorHistory against a std::vector of vectors, with
+// more entries than the grain size of the parallel loop in add_extrapolation()
+
+using namespace ExaDG;
+
+template<typename Number>
+void
+test(bool const reduced_precision, double const tolerance)
+{
+  using VectorType = dealii::LinearAlgebra::distributed::Vector<Number>;
+
+  unsigned int const order     = 3;
+  unsigned int const n_entries = 100000;
+  double const       factor    = 2.0;
+
+  ExtrapolationConstants extra(order, true);
+
+  VectorType model(n_entries);
+
+  VectorHistory<Number> history(order, reduced_precision);
+  history.reinit(model);
+
+  std::vector<VectorType> reference(order, model);
+
+  bool same_history = true, same_extrapolation = true;
+  for(unsigned int step = 1; step <= 2 * order; ++step)
+  {
+    extra.update(std::min(step, order), false, {});
+
+    VectorType vector_np(model);
+    for(unsigned int j = 0; j < n_entries; ++j)
+      vector_np[j] = std::sin(step + 0.1 * j);
+
+    VectorType reference_np(vector_np);
+    push_back(reference);
+    reference[0].swap(reference_np);
+
+    history.push_back(vector_np);
+
+    VectorType vector;
+    for(unsigned int i = 0; i < order; ++i)
+    {
+      history.get(i, vector);
+      vector.add(-1.0, reference[i]);
+      same_history = same_history and vector.linfty_norm() <= tolerance;
+    }
+
+    VectorType dst(model), dst_reference(model);
+    dst           = 1.0;
+    dst_reference = 1.0;
+
+    history.add_extrapolation(dst, factor, extra);
+    for(unsigned int i = 0; i < order; ++i)
+      dst_reference.add(factor * extra.get_beta(i), reference[i]);
+
+    dst.add(-1.0, dst_reference);
+    same_extrapolation =
+      same_extrapolation and dst.linfty_norm() <= tolerance * dst_reference.linfty_norm();
+  }
+
+  std::cout << "  same history:       " << (same_history ? "yes" : "no") << std::endl
+            << "  same extrapolation: " << (same_extrapolation ? "yes" : "no") << std::endl;
+}
+
+int
+main(int argc, char ** argv)
+{
+  try
+  {
+    dealii::Utilities::MPI::MPI_InitFinalize mpi(argc, argv);
+
+    std::cout << "float:" << std::endl;
+    test<float>(false, 1.e-5);
+
+    std::cout << "double:" << std::endl;
+    test<double>(false, 1.e-13);
+
+    std::cout << "double, stored in reduced precision:" << std::endl;
+    test<double>(true, 1.e-5);
+  }
+  catch(std::exception & exc)
+  {
+    std::cerr << std::endl
+              << std::endl
+              << "----------------------------------------------------" << std::endl;
+    std::cerr << "Exception on processing: " << std::endl
+              << exc.what() << std::endl
+              << "Aborting!" << std::endl
+              << "----------------------------------------------------" << std::endl;
+    return 1;
+  }
+
+  return 0;
+}